@@ -0,0 +1,366 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Host-native benchmark of the CFS Memory Dwell dwell engine.
+ *
+ *   Loads dwell tables through table validation and update, then times
+ *   MD_DwellLoop over a sweep of table counts, table sizes and delay
+ *   patterns, reporting the time per table load, per wakeup and per dwell
+ *   entry sampled.
+ *
+ *   Usage: md_benchmark [wakeups]
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "md_benchmark.h"
+#include "md_app.h"
+#include "md_dwell_pkt.h"
+#include "md_dwell_tbl.h"
+#include "md_symcache.h"
+#include "md_internal_cfg.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*************************************************************************
+** Local Definitions
+*************************************************************************/
+
+/** \brief Wakeups timed for each configuration unless given on the command line */
+#define MD_BENCH_DEFAULT_WAKEUPS 20000
+
+/** \brief Wakeups run before timing starts */
+#define MD_BENCH_WARMUP_WAKEUPS 100
+
+/** \brief Times each table is loaded while timing table loads */
+#define MD_BENCH_LOAD_REPS 16
+
+/** \brief How entry delays are laid out across a table */
+typedef enum
+{
+    MD_BENCH_BURST,  /**< \brief Whole table sampled on every wakeup */
+    MD_BENCH_SPREAD, /**< \brief One entry sampled on each wakeup */
+    MD_BENCH_MIXED,  /**< \brief Entries sampled in groups a few wakeups apart */
+    MD_BENCH_NUM_PATTERNS
+} MD_BenchPattern_t;
+
+/** \brief One configuration's results */
+typedef struct
+{
+    uint64 LoadNs;    /**< \brief Time per table load */
+    uint64 WakeupNs;  /**< \brief Time per wakeup */
+    uint64 EntryPs;   /**< \brief Time per dwell entry sampled, in picoseconds */
+    uint32 Entries;   /**< \brief Dwell entries sampled while timing */
+    uint32 Packets;   /**< \brief Packets sent while timing */
+} MD_BenchResult_t;
+
+/*************************************************************************
+** Global Data
+*************************************************************************/
+
+MD_AppData_t MD_AppData;
+
+const char *MD_BenchPatternNames[MD_BENCH_NUM_PATTERNS] = {"burst", "spread", "mixed"};
+
+MD_DwellTableLoad_t MD_BenchLoad;
+
+/******************************************************************************/
+
+/*
+** Same layout as MD_InitControlStructures, which the benchmark doesn't link
+** so it doesn't need Table Services and Software Bus set up
+*/
+void MD_BenchInitControlStructures(void)
+{
+    uint16 TblIndex;
+    uint32 Capacity;
+    uint32 PoolIndex = 0;
+
+    memset(&MD_AppData, 0, sizeof(MD_AppData));
+
+    for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+    {
+        MD_AppData.MD_DwellTables[TblIndex].Countdown = 1;
+
+        Capacity = MD_INTERNAL_DWELL_TABLE_CAPACITY(TblIndex);
+
+        if ((Capacity >= 1) && (Capacity <= MD_INTERFACE_DWELL_TABLE_SIZE) &&
+            (Capacity <= (MD_INTERNAL_DWELL_ENTRY_POOL_SIZE - PoolIndex)))
+        {
+            MD_AppData.MD_DwellTables[TblIndex].Capacity = (uint16)Capacity;
+            MD_AppData.MD_DwellTables[TblIndex].Entry    = &MD_AppData.DwellEntryPool[PoolIndex];
+
+            MD_AppData.DwellReportControl[TblIndex].Deadband = &MD_AppData.DwellDeadbandPool[PoolIndex];
+            MD_AppData.DwellReportControl[TblIndex].Group    = &MD_AppData.DwellGroupPool[PoolIndex];
+            MD_AppData.DwellReportControl[TblIndex].Signed   = &MD_AppData.DwellSignedPool[PoolIndex];
+            MD_AppData.DwellReportControl[TblIndex].Stats    = &MD_AppData.DwellStatsPool[PoolIndex];
+            MD_AppData.DwellReportControl[TblIndex].ReadErr  = &MD_AppData.DwellReadErrPool[PoolIndex];
+
+            MD_AppData.CompiledTables[TblIndex].Capacity = (uint16)Capacity;
+            MD_AppData.CompiledTables[TblIndex].Entry    = &MD_AppData.CompiledEntryPool[PoolIndex];
+            MD_AppData.CompiledTables[TblIndex].Deadband = &MD_AppData.CompiledDeadbandPool[PoolIndex];
+            MD_AppData.CompiledTables[TblIndex].Group    = &MD_AppData.CompiledGroupPool[PoolIndex];
+            MD_AppData.CompiledTables[TblIndex].Signed   = &MD_AppData.CompiledSignedPool[PoolIndex];
+            MD_AppData.CompiledTables[TblIndex].Image    = &MD_AppData.CompiledImagePool[PoolIndex];
+
+            PoolIndex += Capacity;
+        }
+    }
+
+    MD_AppData.Capture.State = MD_CAPTURE_IDLE;
+
+    MD_BenchResetBackEnds();
+    MD_InitSymCache();
+}
+
+/******************************************************************************/
+
+/*
+** Fills the load image with NumEntries 4-byte entries read from a run of the
+** memory image, so neighbouring entries can be read as a block
+*/
+void MD_BenchBuildLoad(uint16 TblIndex, uint16 NumEntries, MD_BenchPattern_t Pattern)
+{
+    uint16 EntryIndex;
+    uint32 Offset;
+
+    memset(&MD_BenchLoad, 0, sizeof(MD_BenchLoad));
+
+    MD_BenchLoad.Enabled = MD_Dwell_States_ENABLED;
+
+    for (EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+    {
+        Offset = (((uint32)TblIndex * NumEntries) + EntryIndex) * sizeof(uint32);
+
+        MD_BenchLoad.Entry[EntryIndex].Length              = sizeof(uint32);
+        MD_BenchLoad.Entry[EntryIndex].DwellAddress.Offset = Offset % MD_BENCH_IMAGE_SIZE;
+        strncpy(MD_BenchLoad.Entry[EntryIndex].DwellAddress.SymName, MD_BENCH_IMAGE_SYMBOL,
+                sizeof(MD_BenchLoad.Entry[EntryIndex].DwellAddress.SymName) - 1);
+
+        switch (Pattern)
+        {
+            case MD_BENCH_BURST:
+                MD_BenchLoad.Entry[EntryIndex].Delay = (EntryIndex == (NumEntries - 1)) ? 1 : 0;
+                break;
+
+            case MD_BENCH_SPREAD:
+                MD_BenchLoad.Entry[EntryIndex].Delay = 1;
+                break;
+
+            default:
+                MD_BenchLoad.Entry[EntryIndex].Delay = (EntryIndex % 4 == 3) ? 2 : 0;
+                break;
+        }
+    }
+
+    /* The table needs a non-zero rate to be sampled at all */
+    if ((NumEntries > 0) && (MD_BenchLoad.Entry[NumEntries - 1].Delay == 0))
+    {
+        MD_BenchLoad.Entry[NumEntries - 1].Delay = 1;
+    }
+}
+
+/******************************************************************************/
+
+/* Validates and installs a table the way MD_ManageDwellTable and MD_UpdateDwellTable do */
+bool MD_BenchLoadTable(uint16 TblIndex)
+{
+    bool  Loaded = false;
+    int32 Status = CFE_SUCCESS;
+
+    MD_AppData.CompileTblIndex = TblIndex;
+
+    Status = MD_TableValidationFunc(&MD_BenchLoad);
+
+    MD_AppData.CompileTblIndex = MD_INTERFACE_NUM_DWELL_TABLES;
+
+    if (Status == CFE_SUCCESS)
+    {
+        MD_CopyUpdatedTbl(&MD_BenchLoad, TblIndex);
+        MD_StartDwellStream(TblIndex);
+
+        Loaded = true;
+    }
+
+    return Loaded;
+}
+
+/******************************************************************************/
+
+uint32 MD_BenchSampleCount(uint16 NumTables)
+{
+    uint16 TblIndex;
+    uint32 SampleCount = 0;
+
+    for (TblIndex = 0; TblIndex < NumTables; TblIndex++)
+    {
+        SampleCount += MD_AppData.DwellCounters[TblIndex].SampleCount;
+    }
+
+    return SampleCount;
+}
+
+/******************************************************************************/
+
+bool MD_BenchRun(uint16 NumTables, uint16 TableSize, MD_BenchPattern_t Pattern, uint32 Wakeups,
+                 MD_BenchResult_t *ResultPtr)
+{
+    MD_Wakeup_t Wakeup;
+    uint16      TblIndex;
+    uint16      NumEntries;
+    uint16      Rep;
+    uint32      WakeupCount;
+    uint32      Entries;
+    uint64      StartNs;
+    uint64      LoadNs = 0;
+    uint64      RunNs;
+
+    memset(&Wakeup, 0, sizeof(Wakeup));
+    memset(ResultPtr, 0, sizeof(*ResultPtr));
+
+    MD_BenchInitControlStructures();
+
+    for (TblIndex = 0; TblIndex < NumTables; TblIndex++)
+    {
+        /* Every entry has to fit in the table and every cycle in a dwell packet */
+        NumEntries = TableSize;
+        if (NumEntries > MD_AppData.MD_DwellTables[TblIndex].Capacity)
+        {
+            NumEntries = MD_AppData.MD_DwellTables[TblIndex].Capacity;
+        }
+        if (NumEntries > (MD_INTERFACE_DWELL_PKT_DATA_SIZE / sizeof(uint32)))
+        {
+            NumEntries = MD_INTERFACE_DWELL_PKT_DATA_SIZE / sizeof(uint32);
+        }
+
+        MD_BenchBuildLoad(TblIndex, NumEntries, Pattern);
+
+        for (Rep = 0; Rep < MD_BENCH_LOAD_REPS; Rep++)
+        {
+            StartNs = MD_BenchClockNs();
+
+            if (!MD_BenchLoadTable(TblIndex))
+            {
+                return false;
+            }
+
+            LoadNs += MD_BenchClockNs() - StartNs;
+        }
+    }
+
+    for (WakeupCount = 0; WakeupCount < MD_BENCH_WARMUP_WAKEUPS; WakeupCount++)
+    {
+        MD_DwellLoop(&Wakeup);
+    }
+
+    Entries                      = MD_BenchSampleCount(NumTables);
+    MD_BenchCounters.PacketCount = 0;
+
+    StartNs = MD_BenchClockNs();
+
+    for (WakeupCount = 0; WakeupCount < Wakeups; WakeupCount++)
+    {
+        MD_DwellLoop(&Wakeup);
+    }
+
+    RunNs = MD_BenchClockNs() - StartNs;
+
+    Entries = MD_BenchSampleCount(NumTables) - Entries;
+
+    ResultPtr->LoadNs   = LoadNs / ((uint64)NumTables * MD_BENCH_LOAD_REPS);
+    ResultPtr->WakeupNs = RunNs / Wakeups;
+    ResultPtr->EntryPs  = (Entries > 0) ? ((RunNs * 1000) / Entries) : 0;
+    ResultPtr->Entries  = Entries;
+    ResultPtr->Packets  = MD_BenchCounters.PacketCount;
+
+    return true;
+}
+
+/******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    const uint16      TableCounts[] = {1, 8, 32, MD_INTERFACE_NUM_DWELL_TABLES};
+    const uint16      TableSizes[]  = {1, 8, 32, MD_INTERFACE_DWELL_TABLE_SIZE};
+    uint32            Wakeups       = MD_BENCH_DEFAULT_WAKEUPS;
+    uint16            CountIndex;
+    uint16            SizeIndex;
+    uint16            LastCount = 0;
+    uint16            LastSize;
+    MD_BenchPattern_t Pattern;
+    MD_BenchResult_t  Result;
+    int               ExitCode = EXIT_SUCCESS;
+
+    if (argc > 1)
+    {
+        Wakeups = (uint32)strtoul(argv[1], NULL, 0);
+        if (Wakeups == 0)
+        {
+            fprintf(stderr, "usage: %s [wakeups]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf("%6s %6s %-7s %10s %10s %10s %10s %8s\n", "tables", "size", "delays", "load_ns", "wakeup_ns",
+           "entry_ns", "entries", "packets");
+
+    for (CountIndex = 0; CountIndex < (sizeof(TableCounts) / sizeof(TableCounts[0])); CountIndex++)
+    {
+        /* Skip counts the configuration doesn't have, or has already run */
+        if ((TableCounts[CountIndex] > MD_INTERFACE_NUM_DWELL_TABLES) || (TableCounts[CountIndex] <= LastCount))
+        {
+            continue;
+        }
+
+        LastCount = TableCounts[CountIndex];
+        LastSize  = 0;
+
+        for (SizeIndex = 0; SizeIndex < (sizeof(TableSizes) / sizeof(TableSizes[0])); SizeIndex++)
+        {
+            if ((TableSizes[SizeIndex] > MD_INTERFACE_DWELL_TABLE_SIZE) || (TableSizes[SizeIndex] <= LastSize))
+            {
+                continue;
+            }
+
+            LastSize = TableSizes[SizeIndex];
+
+            for (Pattern = MD_BENCH_BURST; Pattern < MD_BENCH_NUM_PATTERNS; Pattern++)
+            {
+                if (!MD_BenchRun(TableCounts[CountIndex], TableSizes[SizeIndex], Pattern, Wakeups, &Result))
+                {
+                    fprintf(stderr, "%u tables of %u %s entries failed validation\n", TableCounts[CountIndex],
+                            TableSizes[SizeIndex], MD_BenchPatternNames[Pattern]);
+                    ExitCode = EXIT_FAILURE;
+                    continue;
+                }
+
+                printf("%6u %6u %-7s %10lu %10lu %6lu.%03lu %10lu %8lu\n", TableCounts[CountIndex],
+                       TableSizes[SizeIndex], MD_BenchPatternNames[Pattern], (unsigned long)Result.LoadNs,
+                       (unsigned long)Result.WakeupNs, (unsigned long)(Result.EntryPs / 1000),
+                       (unsigned long)(Result.EntryPs % 1000), (unsigned long)Result.Entries,
+                       (unsigned long)Result.Packets);
+            }
+        }
+    }
+
+    return ExitCode;
+}
@@ -0,0 +1,100 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the host-native benchmark of the CFS Memory Dwell
+ *   dwell engine and the host back-ends it runs on.
+ */
+#ifndef MD_BENCHMARK_H
+#define MD_BENCHMARK_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+
+#include "cfe.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Size of the host memory image the benchmark dwells on, in bytes
+ */
+#define MD_BENCH_IMAGE_SIZE 65536
+
+/**
+ * \brief Symbol name that resolves to the start of the host memory image
+ */
+#define MD_BENCH_IMAGE_SYMBOL "MD_BenchImage"
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief Counts of calls the host back-ends saw
+ */
+typedef struct
+{
+    uint32 EventCount;  /**< \brief Events sent */
+    uint32 PacketCount; /**< \brief Software bus messages and buffers transmitted */
+} MD_BenchCounters_t;
+
+/*************************************************************************
+ * Exported Data
+ *************************************************************************/
+
+/** \brief Host memory image read by the dwell tables */
+extern uint32 MD_BenchImage[MD_BENCH_IMAGE_SIZE / sizeof(uint32)];
+
+/** \brief Counts of calls the host back-ends saw */
+extern MD_BenchCounters_t MD_BenchCounters;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Read the host clock
+ *
+ * \par Description
+ *          Reads the host's monotonic clock, which both times the benchmark
+ *          and backs the fake PSP clock the dwell engine reads.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \return Nanoseconds since an arbitrary starting point
+ */
+uint64 MD_BenchClockNs(void);
+
+/**
+ * \brief Reset the host back-ends
+ *
+ * \par Description
+ *          Empties the counters and returns every software bus buffer
+ *          to the free pool.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Buffers still held by dwell tables must not be used afterwards.
+ */
+void MD_BenchResetBackEnds(void);
+
+#endif
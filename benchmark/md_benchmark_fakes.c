@@ -0,0 +1,349 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Lightweight host back-ends for the cFE, OSAL and PSP calls made by the
+ *   CFS Memory Dwell dwell engine, so it can be benchmarked natively.
+ *
+ *   Memory reads come from a host memory image and software bus messages
+ *   are counted and dropped, so the times measured are those of the dwell
+ *   engine itself.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "md_benchmark.h"
+#include "md_msg.h"
+#include "md_platform_cfg.h"
+#include <string.h>
+#include <time.h>
+
+/*************************************************************************
+** Local Definitions
+*************************************************************************/
+
+/** \brief Number of software bus buffers, one held by each table and one in flight */
+#define MD_BENCH_NUM_SB_BUFS (MD_INTERFACE_NUM_DWELL_TABLES + 1)
+
+/** \brief A software bus buffer large enough for any dwell packet */
+typedef union
+{
+    CFE_SB_Buffer_t Buf;
+    MD_DwellPkt_t   DwellPkt;
+} MD_BenchSbBuf_t;
+
+/*************************************************************************
+** Global Data
+*************************************************************************/
+
+uint32             MD_BenchImage[MD_BENCH_IMAGE_SIZE / sizeof(uint32)];
+MD_BenchCounters_t MD_BenchCounters;
+
+MD_BenchSbBuf_t  MD_BenchSbBufs[MD_BENCH_NUM_SB_BUFS];
+MD_BenchSbBuf_t *MD_BenchSbFreeList[MD_BENCH_NUM_SB_BUFS];
+uint32           MD_BenchSbFreeCount;
+
+/******************************************************************************/
+
+uint64 MD_BenchClockNs(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return ((uint64)Now.tv_sec * 1000000000) + (uint64)Now.tv_nsec;
+}
+
+/******************************************************************************/
+
+void MD_BenchResetBackEnds(void)
+{
+    memset(&MD_BenchCounters, 0, sizeof(MD_BenchCounters));
+
+    for (MD_BenchSbFreeCount = 0; MD_BenchSbFreeCount < MD_BENCH_NUM_SB_BUFS; MD_BenchSbFreeCount++)
+    {
+        MD_BenchSbFreeList[MD_BenchSbFreeCount] = &MD_BenchSbBufs[MD_BenchSbFreeCount];
+    }
+}
+
+/******************************************************************************/
+/* Event Services                                                             */
+/******************************************************************************/
+
+CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    MD_BenchCounters.EventCount++;
+
+    return CFE_SUCCESS;
+}
+
+/******************************************************************************/
+/* Executive Services                                                         */
+/******************************************************************************/
+
+void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit) {}
+
+/******************************************************************************/
+/* Software Bus and Message                                                   */
+/******************************************************************************/
+
+CFE_Status_t CFE_MSG_SetSize(CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t Size)
+{
+    return CFE_SUCCESS;
+}
+
+/* The benchmark's wakeups all carry the same sequence count, so none are taken as missed */
+CFE_Status_t CFE_MSG_GetSequenceCount(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_SequenceCount_t *SeqCnt)
+{
+    *SeqCnt = 0;
+    return CFE_SUCCESS;
+}
+
+CFE_MSG_SequenceCount_t CFE_MSG_GetNextSequenceCount(CFE_MSG_SequenceCount_t SeqCnt)
+{
+    return (SeqCnt + 1) & 0x3FFF;
+}
+
+CFE_Status_t CFE_MSG_SetMsgTime(CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t NewTime)
+{
+    return CFE_SUCCESS;
+}
+
+void CFE_SB_TimeStampMsg(CFE_MSG_Message_t *MsgPtr) {}
+
+CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementSequenceCount)
+{
+    MD_BenchCounters.PacketCount++;
+
+    return CFE_SUCCESS;
+}
+
+CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
+{
+    CFE_SB_Buffer_t *BufPtr = NULL;
+
+    if ((MsgSize <= sizeof(MD_BenchSbBuf_t)) && (MD_BenchSbFreeCount > 0))
+    {
+        BufPtr = &MD_BenchSbFreeList[--MD_BenchSbFreeCount]->Buf;
+    }
+
+    return BufPtr;
+}
+
+CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr)
+{
+    MD_BenchSbFreeList[MD_BenchSbFreeCount++] = (MD_BenchSbBuf_t *)BufPtr;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IncrementSequenceCount)
+{
+    MD_BenchCounters.PacketCount++;
+
+    return CFE_SB_ReleaseMessageBuffer(BufPtr);
+}
+
+int32 CFE_SB_MessageStringGet(char *DestStringPtr, const char *SourceStringPtr, const char *DefaultString,
+                              size_t DestMaxSize, size_t SourceMaxSize)
+{
+    size_t Length = 0;
+
+    if ((SourceMaxSize == 0) || (SourceStringPtr[0] == '\0'))
+    {
+        SourceStringPtr = (DefaultString != NULL) ? DefaultString : "";
+        SourceMaxSize   = DestMaxSize;
+    }
+
+    while ((Length < (DestMaxSize - 1)) && (Length < SourceMaxSize) && (SourceStringPtr[Length] != '\0'))
+    {
+        DestStringPtr[Length] = SourceStringPtr[Length];
+        Length++;
+    }
+
+    DestStringPtr[Length] = '\0';
+
+    return (int32)Length;
+}
+
+/******************************************************************************/
+/* Time Services                                                              */
+/******************************************************************************/
+
+/* The benchmark's tables are paced by delays, so time is only read if one is timed */
+CFE_TIME_SysTime_t CFE_TIME_GetTime(void)
+{
+    CFE_TIME_SysTime_t Now = {0, 0};
+
+    return Now;
+}
+
+uint32 CFE_TIME_Sub2MicroSecs(uint32 SubSeconds)
+{
+    return (uint32)(((uint64)SubSeconds * 1000000) >> 32);
+}
+
+uint32 CFE_TIME_Micro2SubSecs(uint32 MicroSeconds)
+{
+    return (uint32)(((uint64)MicroSeconds << 32) / 1000000);
+}
+
+/******************************************************************************/
+/* Table Services, only used by commands the benchmark doesn't send           */
+/******************************************************************************/
+
+CFE_Status_t CFE_TBL_GetAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle)
+{
+    return CFE_TBL_ERR_INVALID_HANDLE;
+}
+
+CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle)
+{
+    return CFE_TBL_ERR_INVALID_HANDLE;
+}
+
+CFE_Status_t CFE_TBL_ReleaseAddress(CFE_TBL_Handle_t TblHandle)
+{
+    return CFE_TBL_ERR_INVALID_HANDLE;
+}
+
+/******************************************************************************/
+/* File Services, only used to dump captures                                  */
+/******************************************************************************/
+
+void CFE_FS_InitHeader(CFE_FS_Header_t *Hdr, const char *Description, uint32 SubType)
+{
+    memset(Hdr, 0, sizeof(*Hdr));
+}
+
+CFE_Status_t CFE_FS_WriteHeader(osal_id_t FileDes, CFE_FS_Header_t *Hdr)
+{
+    return OS_ERROR;
+}
+
+int32 OS_OpenCreate(osal_id_t *filedes, const char *path, int32 flags, int32 access_mode)
+{
+    return OS_ERROR;
+}
+
+int32 OS_write(osal_id_t filedes, const void *buffer, size_t nbytes)
+{
+    return OS_ERROR;
+}
+
+int32 OS_close(osal_id_t filedes)
+{
+    return OS_SUCCESS;
+}
+
+/******************************************************************************/
+/* OSAL symbols and mutexes                                                   */
+/******************************************************************************/
+
+int32 OS_SymbolLookup(cpuaddr *symbol_address, const char *symbol_name)
+{
+    int32 Status = OS_ERROR;
+
+    if (strcmp(symbol_name, MD_BENCH_IMAGE_SYMBOL) == 0)
+    {
+        *symbol_address = (cpuaddr)MD_BenchImage;
+        Status          = OS_SUCCESS;
+    }
+
+    return Status;
+}
+
+void OS_ForEachObjectOfType(osal_objtype_t objtype, osal_id_t creator_id, OS_ArgCallback_t callback_ptr,
+                            void *callback_arg)
+{
+}
+
+int32 OS_MutSemCreate(osal_id_t *sem_id, const char *sem_name, uint32 options)
+{
+    *sem_id = OS_OBJECT_ID_UNDEFINED;
+
+    return OS_SUCCESS;
+}
+
+int32 OS_MutSemTake(osal_id_t sem_id)
+{
+    return OS_SUCCESS;
+}
+
+int32 OS_MutSemGive(osal_id_t sem_id)
+{
+    return OS_SUCCESS;
+}
+
+/******************************************************************************/
+/* PSP memory access and clock                                                */
+/******************************************************************************/
+
+int32 CFE_PSP_MemValidateRange(cpuaddr Address, size_t Size, uint32 MemoryType)
+{
+    int32 Status = CFE_PSP_INVALID_MEM_RANGE;
+
+    if ((Address >= (cpuaddr)MD_BenchImage) && (Size <= MD_BENCH_IMAGE_SIZE) &&
+        ((Address - (cpuaddr)MD_BenchImage) <= (MD_BENCH_IMAGE_SIZE - Size)))
+    {
+        Status = CFE_PSP_SUCCESS;
+    }
+
+    return Status;
+}
+
+int32 CFE_PSP_MemRead8(cpuaddr MemoryAddress, uint8 *ByteValue)
+{
+    *ByteValue = *(volatile uint8 *)MemoryAddress;
+
+    return CFE_PSP_SUCCESS;
+}
+
+int32 CFE_PSP_MemRead16(cpuaddr MemoryAddress, uint16 *uint16Value)
+{
+    *uint16Value = *(volatile uint16 *)MemoryAddress;
+
+    return CFE_PSP_SUCCESS;
+}
+
+int32 CFE_PSP_MemRead32(cpuaddr MemoryAddress, uint32 *uint32Value)
+{
+    *uint32Value = *(volatile uint32 *)MemoryAddress;
+
+    return CFE_PSP_SUCCESS;
+}
+
+int32 CFE_PSP_MemCpy(void *dest, const void *src, uint32 n)
+{
+    memcpy(dest, src, n);
+
+    return CFE_PSP_SUCCESS;
+}
+
+void CFE_PSP_GetTime(OS_time_t *LocalTime)
+{
+    uint64 Now = MD_BenchClockNs();
+
+    *LocalTime = OS_TimeAssembleFromNanoseconds((int64)(Now / 1000000000), (uint32)(Now % 1000000000));
+}
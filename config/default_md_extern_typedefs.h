@@ -56,5 +56,64 @@ typedef enum
     MD_Dwell_States_ENABLED   /**< \brief MD Dwell Stream Enabled */
 } MD_Dwell_States;
 
+/**
+ *  \brief  MD enum used for representing capture trigger conditions
+ *
+ *  \par Description
+ *       Each condition is tested on the watched dwell entry's value ANDed
+ *       with the trigger mask.
+ */
+typedef enum
+{
+    MD_Capture_Conditions_EQUAL,   /**< \brief Masked value equals the masked trigger value */
+    MD_Capture_Conditions_GREATER, /**< \brief Masked value is greater than the masked trigger value */
+    MD_Capture_Conditions_BIT_SET, /**< \brief Any bit of the mask is set in the value */
+    MD_Capture_Conditions_CHANGED  /**< \brief Masked value differs from the previous cycle's */
+} MD_Capture_Conditions;
+
+/**
+ *  \brief  MD enum used for representing the phases whose execution time is measured
+ *
+ *  \par Description
+ *       Each phase has a performance log ID and a histogram in the
+ *       performance histogram packet.
+ */
+typedef enum
+{
+    MD_Perf_Phases_TBL_MANAGE,   /**< \brief Dwell table validation and management, on the main task */
+    MD_Perf_Phases_TBL_UPDATE,   /**< \brief Swapping in an updated dwell table */
+    MD_Perf_Phases_DWELL_SAMPLE, /**< \brief Sampling one dwell table on a wakeup, including any packet it sends */
+    MD_Perf_Phases_PKT_SEND,     /**< \brief Reporting one completed dwell cycle */
+    MD_Perf_Phases_CMD           /**< \brief Handling one ground command */
+} MD_Perf_Phases;
+
+/**
+ *  \brief Number of #MD_Perf_Phases
+ */
+#define MD_PERF_NUM_PHASES 5
+
+/**
+ *  \brief Capture File Header
+ *
+ *  \par Description
+ *       Follows the cFE file header in a capture file.  RecordCount records
+ *       come next, oldest first.  Each is the uint32 task wakeup count the
+ *       cycle completed on followed by ByteCount bytes of dwell data laid
+ *       out as in a dwell packet.  The record at TriggerRecord, counting
+ *       from 0, is the cycle the trigger fired on.
+ */
+typedef struct
+{
+    uint16 TableId;       /**< \brief TableId from 1 to #MD_INTERFACE_NUM_DWELL_TABLES */
+    uint16 EntryId;       /**< \brief Watched entry, 1..#MD_INTERFACE_DWELL_TABLE_SIZE */
+    uint8  Condition;     /**< \brief Trigger condition, see #MD_Capture_Conditions */
+    uint8  Spare;         /**< \brief Preserves alignment */
+    uint16 ByteCount;     /**< \brief Number of bytes of dwell data in each record */
+    uint32 TriggerValue;  /**< \brief Value the trigger condition compares against */
+    uint32 TriggerMask;   /**< \brief Mask applied to the watched entry before comparing */
+    uint16 RecordCount;   /**< \brief Number of records in the file */
+    uint16 TriggerRecord; /**< \brief Index of the record the trigger fired on */
+} MD_CaptureFileHdr_t;
+
 
 #endif /* DEFAULT_MD_EXTERN_TYPEDEFS_H */
\ No newline at end of file
@@ -36,12 +36,17 @@
 
 enum MD_FunctionCode_
 {
-    MD_FunctionCode_NOOP           = 0,
-    MD_FunctionCode_RESET_COUNTERS = 1,
-    MD_FunctionCode_START_DWELL    = 2,
-    MD_FunctionCode_STOP_DWELL     = 3,
-    MD_FunctionCode_JAM_DWELL      = 4,
-    MD_FunctionCode_SET_SIGNATURE  = 5,
+    MD_FunctionCode_NOOP             = 0,
+    MD_FunctionCode_RESET_COUNTERS   = 1,
+    MD_FunctionCode_START_DWELL      = 2,
+    MD_FunctionCode_STOP_DWELL       = 3,
+    MD_FunctionCode_JAM_DWELL        = 4,
+    MD_FunctionCode_SET_SIGNATURE    = 5,
+    MD_FunctionCode_SET_BATCH_FACTOR = 6,
+    MD_FunctionCode_ARM_CAPTURE      = 7,
+    MD_FunctionCode_TBL_MANAGE       = 8,
+    MD_FunctionCode_JAM_MULTI_DWELL  = 9,
+    MD_FunctionCode_SEND_PERF_HIST   = 10,
 };
 
 #endif /* DEFAULT_MD_FCNCODE_VALUES_H */
\ No newline at end of file
@@ -47,11 +47,14 @@
 
 /**
  * \brief Start and Stop Dwell Commands Payload
+ *
+ * Bit n of TableMask selects table MaskOffset + n + 1, so each command
+ * addresses up to 16 consecutive tables.
  */
 typedef struct
 {
-    uint16 TableMask; /**< \brief 0x0001=TBL1 bit, 0x0002=TBL2 bit, 0x0004=TBL3 bit, etc. */
-    uint16 Padding;   /**< \brief structure padding */
+    uint16 TableMask;  /**< \brief 0x0001=TBL1 bit, 0x0002=TBL2 bit, 0x0004=TBL3 bit, etc. when MaskOffset is 0 */
+    uint16 MaskOffset; /**< \brief Number of tables before the one bit 0 of TableMask selects */
 } MD_CmdStartStop_Payload_t;
 
 typedef struct
@@ -65,9 +68,109 @@ typedef struct
     char Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH]; /**< \brief Signature */
 #endif
 
-    uint8 Data[MD_INTERFACE_DWELL_TABLE_SIZE * 4]; /**< \brief Dwell data (can be variable size based on dfn) */
+    uint8 Data[MD_INTERFACE_DWELL_PKT_DATA_SIZE]; /**< \brief Dwell data (can be variable size based on dfn) */
 } MD_DwellPkt_Payload_t;
 
+/**
+ * \brief Batched Dwell Packet Payload
+ *
+ * \par Description
+ *      Carries CycleCount consecutive cycles of one dwell table.  Data holds
+ *      one record per cycle: a uint16 time offset followed by ByteCount
+ *      bytes of dwell data laid out as in #MD_DwellPkt_Payload_t.  The time
+ *      offset is the number of task wakeup calls between the first cycle in
+ *      the packet and the cycle the record belongs to, saturating at 65535.
+ *      The packet time stamp is the time of the first cycle.
+ */
+typedef struct
+{
+    uint8  TableId;     /**< \brief TableId from 1 to #MD_INTERFACE_NUM_DWELL_TABLES */
+    uint8  AddrCount;   /**< \brief Number of addresses in each cycle - 1..#MD_INTERFACE_DWELL_TABLE_SIZE valid */
+    uint16 ByteCount;   /**< \brief Number of bytes of dwell data in each cycle */
+    uint32 Rate;        /**< \brief Number of counts between cycles */
+    uint16 BatchFactor; /**< \brief Number of cycles the table batches into one packet */
+    uint16 CycleCount;  /**< \brief Number of cycles contained in packet */
+
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+    char Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH]; /**< \brief Signature */
+#endif
+
+    uint8 Data[MD_INTERFACE_DWELL_BATCH_DATA_SIZE]; /**< \brief Time offset and dwell data of each cycle */
+} MD_DwellBatchPkt_Payload_t;
+
+/**
+ * \brief Encoded Dwell Packet Payload
+ *
+ * \par Description
+ *      Carries one cycle of one dwell table, encoded.  The cycle's ByteCount
+ *      bytes of dwell data are XORed with the previous cycle sent for the
+ *      table, or with zeros in a keyframe, and the result is run-length
+ *      encoded into the first EncodedSize bytes of Data.  Each run starts
+ *      with a header byte n: 0 to 127 means the next n + 1 bytes are copied
+ *      as is, 129 to 255 means the next byte is repeated 257 - n times, and
+ *      128 is skipped.  A packet lost after the last keyframe is seen as a
+ *      gap in the header sequence count, and the data can't be decoded again
+ *      until the next keyframe.
+ */
+typedef struct
+{
+    uint8  TableId;     /**< \brief TableId from 1 to #MD_INTERFACE_NUM_DWELL_TABLES */
+    uint8  AddrCount;   /**< \brief Number of addresses being sent - 1..#MD_INTERFACE_DWELL_TABLE_SIZE valid */
+    uint16 ByteCount;   /**< \brief Number of bytes of dwell data once decoded */
+    uint32 Rate;        /**< \brief Number of counts between packet sends*/
+    uint8  Keyframe;    /**< \brief 1 if Data was encoded against zeros, 0 if against the previous cycle sent */
+    uint8  Padding;     /**< \brief Structure padding */
+    uint16 EncodedSize; /**< \brief Number of bytes of encoded data contained in packet */
+
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+    char Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH]; /**< \brief Signature */
+#endif
+
+    uint8 Data[MD_INTERFACE_DWELL_ENC_DATA_SIZE]; /**< \brief Encoded dwell data */
+} MD_DwellEncPkt_Payload_t;
+
+/**
+ * \brief Dwell Entry Statistics
+ *
+ * \par Description
+ *      Entries of 1, 2 or 4 bytes are taken as unsigned integers, or as
+ *      signed ones if their dwell table entry's Signed field is set, in
+ *      which case Min and Max hold the 32 bit two's complement of the value.
+ *      Cycles in which the entry's read failed, or the entry was
+ *      quarantined, are left out.  Block entries, and entries not read in
+ *      any cycle of the window, report all fields as zero.  The standard
+ *      deviation is the square root of Variance.
+ */
+typedef struct
+{
+    uint32 Min;      /**< \brief Smallest value in the window */
+    uint32 Max;      /**< \brief Largest value in the window */
+    float  Mean;     /**< \brief Mean of the values in the window */
+    float  Variance; /**< \brief Population variance of the values in the window */
+} MD_DwellEntryStats_t;
+
+/**
+ * \brief Dwell Statistics Packet Payload
+ *
+ * \par Description
+ *      Summarizes CycleCount consecutive cycles of one dwell table with one
+ *      #MD_DwellEntryStats_t per dwell address, in table order.  The packet
+ *      time stamp is the time the last cycle in the window completed.
+ */
+typedef struct
+{
+    uint8  TableId;    /**< \brief TableId from 1 to #MD_INTERFACE_NUM_DWELL_TABLES */
+    uint8  AddrCount;  /**< \brief Number of addresses summarized - 1..#MD_INTERFACE_DWELL_TABLE_SIZE valid */
+    uint16 CycleCount; /**< \brief Number of cycles summarized */
+    uint32 Rate;       /**< \brief Number of counts between cycles */
+
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+    char Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH]; /**< \brief Signature */
+#endif
+
+    MD_DwellEntryStats_t Stats[MD_INTERFACE_DWELL_TABLE_SIZE]; /**< \brief Statistics of each dwell address */
+} MD_DwellStatsPkt_Payload_t;
+
 /**
  * \brief Jam Dwell Command Payload
  */
@@ -75,11 +178,39 @@ typedef struct
 {
     uint16       TableId;      /**< \brief Table Id: 1..#MD_INTERFACE_NUM_DWELL_TABLES */
     uint16       EntryId;      /**< \brief Address index: 1..#MD_INTERFACE_DWELL_TABLE_SIZE  */
-    uint16       FieldLength;  /**< \brief Length of Dwell Field : 0, 1, 2, or 4  */
+    uint16       FieldLength;  /**< \brief Length of Dwell Field : 0, 1, 2, 4, or 8..MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH */
     uint16       DwellDelay;   /**< \brief Dwell Delay (number of task wakeup calls before following dwell) */
     MD_SymAddr_t DwellAddress; /**< \brief Dwell Address in #MD_SymAddr_t format */
+    uint32       Deadband;     /**< \brief Change from the last reported value needed to report the entry again */
 } MD_CmdJam_Payload_t;
 
+/**
+ * \brief Jam Multiple Dwell Command Entry
+ */
+typedef struct
+{
+    uint16       EntryId;      /**< \brief Address index: 1..#MD_INTERFACE_DWELL_TABLE_SIZE  */
+    uint16       FieldLength;  /**< \brief Length of Dwell Field : 0, 1, 2, 4, or 8..MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH */
+    uint16       DwellDelay;   /**< \brief Dwell Delay (number of task wakeup calls before following dwell) */
+    uint16       Padding;      /**< \brief Preserves alignment */
+    MD_SymAddr_t DwellAddress; /**< \brief Dwell Address in #MD_SymAddr_t format */
+    uint32       Deadband;     /**< \brief Change from the last reported value needed to report the entry again */
+} MD_JamMultiEntry_t;
+
+/**
+ * \brief Jam Multiple Dwell Command Payload
+ *
+ * Only the first NumEntries elements of Entry are sent, so the command
+ * length depends on NumEntries.
+ */
+typedef struct
+{
+    uint16             TableId;    /**< \brief Table Id: 1..#MD_INTERFACE_NUM_DWELL_TABLES */
+    uint16             NumEntries; /**< \brief Number of entries that follow: 1..#MD_INTERFACE_MAX_JAM_ENTRIES */
+    uint32             Padding;    /**< \brief Preserves alignment */
+    MD_JamMultiEntry_t Entry[MD_INTERFACE_MAX_JAM_ENTRIES]; /**< \brief Entries to jam, applied in order */
+} MD_CmdJamMulti_Payload_t;
+
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
 
 /**
@@ -94,24 +225,101 @@ typedef struct
 
 #endif
 
+/**
+ * \brief Set Batch Factor Command Payload
+ */
+typedef struct
+{
+    uint16 TableId;     /**< \brief Table Id: 1..MD_INTERFACE_NUM_DWELL_TABLES */
+    uint16 BatchFactor; /**< \brief Number of cycles per dwell packet, 0 or 1 for no batching */
+} MD_CmdSetBatchFactor_Payload_t;
+
+/**
+ * \brief Arm Capture Command Payload
+ */
+typedef struct
+{
+    uint16 TableId;     /**< \brief Table Id: 1..MD_INTERFACE_NUM_DWELL_TABLES */
+    uint16 EntryId;     /**< \brief Watched entry: 1..MD_INTERFACE_DWELL_TABLE_SIZE, a 1, 2 or 4 byte dwell */
+    uint8  Condition;   /**< \brief Trigger condition, see #MD_Capture_Conditions */
+    uint8  Spare;       /**< \brief Preserves alignment */
+    uint16 PreTrigger;  /**< \brief Number of cycles to keep from before the trigger */
+    uint16 PostTrigger; /**< \brief Number of cycles to record after the trigger */
+    uint16 Padding;     /**< \brief Preserves alignment */
+    uint32 Value;       /**< \brief Value the trigger condition compares against */
+    uint32 Mask;        /**< \brief Mask applied to the watched entry before comparing, must be non-zero */
+} MD_CmdArmCapture_Payload_t;
+
+/**
+ * \brief Table Manage Command Payload
+ *
+ * Laid out like the payload of the notification Table Services sends for
+ * a table registered with #CFE_TBL_NotifyByMessage.
+ */
+typedef struct
+{
+    uint32 Parameter; /**< \brief Dwell table index: 0..MD_INTERFACE_NUM_DWELL_TABLES-1 */
+} MD_CmdTblManage_Payload_t;
+
 /**
  *  \brief Memory Dwell HK Telemetry Payload
+ *
+ *  Reports one page of tables.  Element n of each per-table array, and bit
+ *  n of DwellEnabledMask, belong to table FirstTableId + n.  Elements past
+ *  TableCount are zero.
  */
 typedef struct
 {
     uint8  InvalidCmdCntr;   /**< \brief Count of invalid commands received */
     uint8  ValidCmdCntr;     /**< \brief Count of valid commands received */
-    uint16 DwellEnabledMask; /**< \brief Dwell table enable bitmask 0x0001=TBL1, etc */
+    uint16 DwellEnabledMask; /**< \brief Dwell table enable bitmask 0x0001=first table on the page, etc */
+
+    uint16 DwellTblAddrCount[MD_INTERFACE_HK_TABLES_PER_PAGE]; /**< \brief Number of dwell addresses in table */
+    uint16 NumWaitsPerPkt[MD_INTERFACE_HK_TABLES_PER_PAGE];    /**< \brief Number of delay counts in table */
+    uint16 ByteCount[MD_INTERFACE_HK_TABLES_PER_PAGE];         /**< \brief Number of bytes of data specified by table */
+    uint16 DwellPktOffset[MD_INTERFACE_HK_TABLES_PER_PAGE];    /**< \brief Current write offset within dwell pkt data region */
+    uint16 DwellTblEntry[MD_INTERFACE_HK_TABLES_PER_PAGE];     /**< \brief Next dwell table entry to be processed  */
+
+    uint16 Countdown[MD_INTERFACE_HK_TABLES_PER_PAGE];         /**< \brief Current value of countdown timer  */
+    uint16 FailingEntryCount[MD_INTERFACE_HK_TABLES_PER_PAGE]; /**< \brief Number of entries whose last read failed */
+    uint16 QuarantinedCount[MD_INTERFACE_HK_TABLES_PER_PAGE];  /**< \brief Number of entries left out of reads, sent as zeros */
 
-    uint16 DwellTblAddrCount[MD_INTERFACE_NUM_DWELL_TABLES]; /**< \brief Number of dwell addresses in table */
-    uint16 NumWaitsPerPkt[MD_INTERFACE_NUM_DWELL_TABLES];    /**< \brief Number of delay counts in table */
-    uint16 ByteCount[MD_INTERFACE_NUM_DWELL_TABLES];         /**< \brief Number of bytes of data specified by table */
-    uint16 DwellPktOffset[MD_INTERFACE_NUM_DWELL_TABLES];    /**< \brief Current write offset within dwell pkt data region */
-    uint16 DwellTblEntry[MD_INTERFACE_NUM_DWELL_TABLES];     /**< \brief Next dwell table entry to be processed  */
+    uint16 FirstTableId; /**< \brief Table Id of the first table on the page */
+    uint16 TableCount;   /**< \brief Number of tables on the page */
 
-    uint16 Countdown[MD_INTERFACE_NUM_DWELL_TABLES]; /**< \brief Current value of countdown timer  */
+    uint32 WakeupOverrunCount; /**< \brief Number of gaps found in the wakeup messages' sequence counts */
+    uint32 WakeupCatchupCount; /**< \brief Number of missed wakeups made up for by processing them late */
+    uint32 WakeupRephaseCount; /**< \brief Number of gaps too long to make up for, which shifted every schedule */
+
+    uint32 SampleCount[MD_INTERFACE_HK_TABLES_PER_PAGE];        /**< \brief Number of dwell entries read */
+    uint32 ReadErrCount[MD_INTERFACE_HK_TABLES_PER_PAGE];       /**< \brief Number of dwell entries that could not be read */
+    uint32 PktSentCount[MD_INTERFACE_HK_TABLES_PER_PAGE];       /**< \brief Number of dwell, batched, encoded and statistics packets sent */
+    uint32 PktSuppressedCount[MD_INTERFACE_HK_TABLES_PER_PAGE]; /**< \brief Number of cycles suppressed by deadbands */
+    uint32 CycleOverrunCount[MD_INTERFACE_HK_TABLES_PER_PAGE];  /**< \brief Number of cycles that took longer than the rate */
+    uint32 MaxSampleTime[MD_INTERFACE_HK_TABLES_PER_PAGE];      /**< \brief Longest time reading the table on one wakeup, in microseconds */
 } MD_HkTlm_Payload_t;
 
+/**
+ *  \brief Execution time histogram of one performance phase
+ *
+ *  \par Description
+ *       Bin 0 counts times under 1 us and bin n times from 2^(n-1) up to
+ *       2^n us, with the last bin also counting every longer time.
+ */
+typedef struct
+{
+    uint32 MaxTime;                          /**< \brief Longest time measured, in microseconds */
+    uint32 Bin[MD_INTERFACE_PERF_HIST_BINS]; /**< \brief Number of times measured in each bin */
+} MD_PerfHist_t;
+
+/**
+ *  \brief Memory Dwell Performance Histogram Telemetry Payload
+ */
+typedef struct
+{
+    MD_PerfHist_t Hist[MD_PERF_NUM_PHASES]; /**< \brief Histogram of each phase, indexed by #MD_Perf_Phases */
+} MD_PerfHistPkt_Payload_t;
+
 /**\}*/
 
 #endif /* DEFAULT_MD_MSGDEFS_H */
@@ -54,6 +54,18 @@
 /** \brief Base Message Id for Memory Dwell's dwell packets. */
 #define MD_DWELL_PKT_MID_BASE CFE_PLATFORM_MD_TLM_MIDVAL(DWELL_PKT_MID_BASE)
 
+/** \brief Base Message Id for Memory Dwell's batched dwell packets. */
+#define MD_DWELL_BATCH_PKT_MID_BASE CFE_PLATFORM_MD_TLM_MIDVAL(DWELL_BATCH_PKT_MID_BASE)
+
+/** \brief Base Message Id for Memory Dwell's encoded dwell packets. */
+#define MD_DWELL_ENC_PKT_MID_BASE CFE_PLATFORM_MD_TLM_MIDVAL(DWELL_ENC_PKT_MID_BASE)
+
+/** \brief Base Message Id for Memory Dwell's dwell statistics packets. */
+#define MD_DWELL_STATS_PKT_MID_BASE CFE_PLATFORM_MD_TLM_MIDVAL(DWELL_STATS_PKT_MID_BASE)
+
+/** \brief Message Id for Memory Dwell's performance histogram pkt */
+#define MD_PERF_HIST_TLM_MID CFE_PLATFORM_MD_TLM_MIDVAL(PERF_HIST_TLM)
+
 /**\}*/
 
 #endif /* DEFAULT_MD_MSGIDS_H */
@@ -67,6 +67,42 @@ typedef struct
     MD_DwellPkt_Payload_t     Payload;
 } MD_DwellPkt_t;
 
+/**
+ *  \brief Memory Dwell Batched Telemetry Packet format
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t  TelemetryHeader; /**< \brief Telemetry header */
+    MD_DwellBatchPkt_Payload_t Payload;
+} MD_DwellBatchPkt_t;
+
+/**
+ *  \brief Memory Dwell Encoded Telemetry Packet format
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+    MD_DwellEncPkt_Payload_t  Payload;
+} MD_DwellEncPkt_t;
+
+/**
+ *  \brief Memory Dwell Statistics Telemetry Packet format
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t  TelemetryHeader; /**< \brief Telemetry header */
+    MD_DwellStatsPkt_Payload_t Payload;
+} MD_DwellStatsPkt_t;
+
+/**
+ *  \brief Memory Dwell Performance Histogram Telemetry Packet format
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+    MD_PerfHistPkt_Payload_t  Payload;
+} MD_PerfHistPkt_t;
+
 /**
  * \brief Jam Dwell Command
  *
@@ -78,6 +114,17 @@ typedef struct
     MD_CmdJam_Payload_t     Payload;
 } MD_JamDwellCmd_t;
 
+/**
+ * \brief Jam Multiple Dwell Command
+ *
+ * For command details, see #MD_JAM_MULTI_DWELL_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t  Header; /**< \brief Command header */
+    MD_CmdJamMulti_Payload_t Payload;
+} MD_JamMultiDwellCmd_t;
+
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
 
 /**
@@ -93,6 +140,39 @@ typedef struct
 
 #endif
 
+/**
+ * \brief Set Batch Factor Command
+ *
+ * For command details, see #MD_SET_BATCH_FACTOR_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t        Header; /**< \brief Command Header */
+    MD_CmdSetBatchFactor_Payload_t Payload;
+} MD_SetBatchFactorCmd_t;
+
+/**
+ * \brief Arm Capture Command
+ *
+ * For command details, see #MD_ARM_CAPTURE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t    Header; /**< \brief Command Header */
+    MD_CmdArmCapture_Payload_t Payload;
+} MD_ArmCaptureCmd_t;
+
+/**
+ * \brief Table Manage Command
+ *
+ * For command details, see #MD_TBL_MANAGE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t   Header; /**< \brief Command Header */
+    MD_CmdTblManage_Payload_t Payload;
+} MD_TblManageCmd_t;
+
 typedef struct
 {
     CFE_MSG_CommandHeader_t CmdHeader; /**< Command Header */
@@ -113,4 +193,14 @@ typedef struct
     CFE_MSG_CommandHeader_t CmdHeader; /**< Command Header */
 } MD_SendHkCmd_t;
 
+/**
+ * \brief Send Performance Histograms Command
+ *
+ * For command details, see #MD_SEND_PERF_HIST_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< Command Header */
+} MD_SendPerfHistCmd_t;
+
 #endif /* DEFAULT_MD_MSGSTRUCT_H */
\ No newline at end of file
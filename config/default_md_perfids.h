@@ -29,6 +29,13 @@
  */
 
 #define MD_APPMAIN_PERF_ID 26 /**< \brief Application main performance ID */
+#define MD_SAMPLER_PERF_ID 27 /**< \brief Sampler child task performance ID */
+
+#define MD_TBL_MANAGE_PERF_ID   28 /**< \brief Dwell table validation and management performance ID */
+#define MD_TBL_UPDATE_PERF_ID   29 /**< \brief Dwell table update performance ID */
+#define MD_DWELL_SAMPLE_PERF_ID 30 /**< \brief Dwell table sampling performance ID */
+#define MD_PKT_SEND_PERF_ID     31 /**< \brief Dwell packet send performance ID */
+#define MD_CMD_PERF_ID          32 /**< \brief Ground command handling performance ID */
 
 /**\}*/
 
@@ -44,7 +44,10 @@
  *
  *    The following checks must be met for a valid non-null entry:
  *
- *    - Length fields must be 1, 2, or 4.
+ *    - Length fields must be 1, 2, 4, or a block length from 8 to
+ *      MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH.
+ *    - The total length of the active entries must fit in
+ *      MD_INTERFACE_DWELL_PKT_DATA_SIZE.
  *    - Delay can be any value in a uint16 field.
  *    - DwellAddress.SymName must be a null string or must be found in the Symbol Table.
  *    - The sum of DwellAddress.SymName plus DwellAddress.Offset must be in a valid range,
@@ -53,12 +56,33 @@
  *      must be even.
  *    - If the Length field is 4, the sum of DwellAddress.SymName plus DwellAddress.Offset
  *      must be evenly divisable by 4.
+ *    - Deadband can be any value in a uint32 field.  It is only used when the table's
+ *      HeartbeatInterval is non-zero.
+ *    - SnapshotGroup must be 0, for an entry that is read on its own, or a
+ *      group from 1 to MD_INTERNAL_NUM_SNAPSHOT_GROUPS.  The members of a
+ *      group, in any dwell table, are read together in one pass, and each
+ *      member reports its value from the latest pass.
+ *    - Signed is 1 if an entry of Length 1, 2 or 4 holds a two's complement
+ *      integer, which deadbands and dwell statistics then sign-extend, or 0
+ *      if it holds an unsigned one.  Any non-zero value is taken as 1.  It
+ *      changes nothing else about the entry.
+ *
+ *    An entry of Length 1, 2 or 4 is read with a single access of that
+ *    width, by CFE_PSP_MemRead8, CFE_PSP_MemRead16 or CFE_PSP_MemRead32,
+ *    and a block entry with CFE_PSP_MemCpy.  If MD_INTERNAL_COALESCE_DWELL_READS
+ *    is set, entries with a zero Delay whose data is adjacent in memory are
+ *    read together with one CFE_PSP_MemCpy, which doesn't keep the access
+ *    width of each entry.  Dwell tables that address memory mapped
+ *    registers need MD_INTERNAL_COALESCE_DWELL_READS left at 0.
  */
 typedef struct
 {
-    uint16       Length;       /**< \brief Length of dwell field in bytes. 0 indicates null entry. */
-    uint16       Delay;        /**< \brief Delay before following dwell sample in number of task wakeup calls */
-    MD_SymAddr_t DwellAddress; /**< \brief Dwell Address in #MD_SymAddr_t format */
+    uint16       Length;        /**< \brief Length of dwell field in bytes. 0 indicates null entry. */
+    uint16       Delay;         /**< \brief Delay before following dwell sample in number of task wakeup calls */
+    MD_SymAddr_t DwellAddress;  /**< \brief Dwell Address in #MD_SymAddr_t format */
+    uint32       Deadband;      /**< \brief Change from the last reported value needed to report the entry again */
+    uint16       SnapshotGroup; /**< \brief Snapshot group the entry is read with, 0 if none */
+    uint16       Signed;        /**< \brief 1 if the entry holds a signed integer, 0 if unsigned */
 } MD_TableLoadEntry_t;
 
 #endif /* DEFAULT_MD_TBLDEFS_H */
\ No newline at end of file
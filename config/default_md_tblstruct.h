@@ -43,6 +43,31 @@
  *      terminator entry or the end of the table, must be non-zero.
  *    - The table's Enabled field must be set to TRUE.  This is initially set in the load, and
  *      is controlled with the #MD_START_DWELL_CC and #MD_STOP_DWELL_CC commands.
+ *
+ *    A BatchFactor greater than 1 is only valid if that many cycles of the table's dwell data,
+ *    each with its 2-byte time offset, fit in #MD_INTERFACE_DWELL_BATCH_DATA_SIZE bytes.
+ *
+ *    A HeartbeatInterval of 0 reports every dwell cycle.  Otherwise a cycle is only reported
+ *    if an entry moved beyond its Deadband since the last reported cycle, or if
+ *    HeartbeatInterval cycles have completed since then.  Entries of 1, 2 or 4 bytes are
+ *    compared as unsigned integers, modulo their width, so signed values work as well.
+ *    Block entries are reported on any change and their Deadband is not used.
+ *
+ *    A KeyframeInterval of 0 sends each reported cycle in a dwell packet.  Otherwise reported
+ *    cycles that aren't batched go out in encoded dwell packets, and every KeyframeInterval-th
+ *    one is a keyframe that can be decoded without the cycles before it.
+ *
+ *    A StatsWindow of 0 sends dwell data as described above.  Otherwise no dwell data is sent;
+ *    the minimum, maximum, mean and variance of each entry over every StatsWindow cycles are sent
+ *    in a dwell statistics packet instead.  Entries are taken as unsigned integers unless their
+ *    Signed field is set, and cycles in which an entry couldn't be read are left out of its
+ *    statistics.
+ *
+ *    A PeriodMsec of 0 paces dwell cycles by the entry delays.  Otherwise the entry delays are not
+ *    used, and a whole cycle is read on the first wakeup at or after each deadline, which fall
+ *    PhaseMsec past every whole multiple of PeriodMsec milliseconds of CFE_TIME.  Tables with the
+ *    same period and phase are read on the same wakeup, and their packets are time stamped with
+ *    the deadline.  PhaseMsec must be less than PeriodMsec.
  */
 typedef struct
 {
@@ -52,7 +77,43 @@ typedef struct
     char Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH]; /**< \brief Signature */
 #endif
 
+    uint16 BatchFactor;       /**< \brief Cycles per batched dwell packet, 0 or 1 to send each cycle on its own */
+    uint16 HeartbeatInterval; /**< \brief Cycles between forced reports, 0 to report every cycle */
+    uint16 KeyframeInterval;  /**< \brief Encoded packets per keyframe, 0 to send dwell packets unencoded */
+    uint16 StatsWindow;       /**< \brief Cycles per statistics packet, 0 to send the cycles themselves */
+    uint32 PeriodMsec;        /**< \brief Milliseconds between cycle deadlines, 0 to pace cycles by entry delays */
+    uint32 PhaseMsec;         /**< \brief Milliseconds each deadline falls past a whole multiple of PeriodMsec */
+
     MD_TableLoadEntry_t Entry[MD_INTERFACE_DWELL_TABLE_SIZE]; /**< \brief Array of individual memory dwell entries */
 } MD_DwellTableLoad_t;
 
+/** \brief Signature field of #MD_DWELL_TABLE_LOAD_STRUCT, if dwell tables have one */
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+#define MD_DWELL_TABLE_LOAD_SIGNATURE char Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH];
+#else
+#define MD_DWELL_TABLE_LOAD_SIGNATURE
+#endif
+
+/**
+ *  \brief Memory Dwell Table Load structure of a table with Capacity entries
+ *  \par Description
+ *    Laid out as #MD_DwellTableLoad_t with only the first Capacity entries.
+ *    Table files of tables whose #MD_INTERNAL_DWELL_TABLE_CAPACITY is less
+ *    than #MD_INTERFACE_DWELL_TABLE_SIZE must be built from this structure,
+ *    as Table Services rejects files larger than the registered table.
+ */
+#define MD_DWELL_TABLE_LOAD_STRUCT(Capacity)   \
+    struct                                     \
+    {                                          \
+        MD_Dwell_States Enabled;               \
+        MD_DWELL_TABLE_LOAD_SIGNATURE          \
+        uint16              BatchFactor;       \
+        uint16              HeartbeatInterval; \
+        uint16              KeyframeInterval;  \
+        uint16              StatsWindow;       \
+        uint32              PeriodMsec;        \
+        uint32              PhaseMsec;         \
+        MD_TableLoadEntry_t Entry[Capacity];   \
+    }
+
 #endif /* DEFAULT_MD_TBLSTRUCT_H */
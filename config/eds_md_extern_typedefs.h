@@ -31,4 +31,7 @@
 /* Source the definitions from EDS */
 #include "md_eds_typedefs.h"
 
+/* Number of Perf_Phases, which index the performance histogram array */
+#define MD_PERF_NUM_PHASES 5
+
 #endif /* EDS_MD_EXTERN_TYPEDEFS_H */
\ No newline at end of file
@@ -80,7 +80,8 @@
  *  \par Cause:
  *
  *  Issued when a #CFE_TBL_ERR_INVALID_SIZE error message is received from #CFE_TBL_Register call.
- *  Load structure can be reduced by reducing #MD_INTERFACE_DWELL_TABLE_SIZE, number of entries per Dwell Table.
+ *  Load structure can be reduced by reducing the table's #MD_INTERNAL_DWELL_TABLE_CAPACITY, number of entries
+ *  in the Dwell Table.
  */
 #define MD_DWELL_TBL_TOO_LARGE_CRIT_EID 5
 
@@ -274,7 +275,7 @@
  *
  *  This error event is issued when a Jam Dwell Command is received
  *  with an invalid value for the entry id argument.
- *  Values in the range 1..#MD_INTERFACE_DWELL_TABLE_SIZE are expected.
+ *  Values in the range 1..#MD_INTERNAL_DWELL_TABLE_CAPACITY of the table are expected.
  */
 #define MD_INVALID_ENTRY_ARG_ERR_EID 33
 
@@ -682,7 +683,9 @@
  *  \par Cause:
  *
  *  This event message is issued when the PSP returns an error when attempting
- *  to read the memory address of an entry
+ *  to read the memory address of an entry.  An entry that keeps failing is
+ *  reported on its 1st, 2nd, 4th, 8th and so on failure, and the failures
+ *  in between are counted in #MD_READ_ERR_SUMMARY_ERR_EID.
  */
 #define MD_DWELL_LOOP_GET_DWELL_DATA_ERR_EID 70
 
@@ -747,6 +750,484 @@
  */
 #define MD_TBL_ENTRY_ERR_EID 75
 
+/**
+ * \brief MD Dwell Table Data Size Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dwell table fails validation because
+ *  the dwell lengths of its active entries add up to more than
+ *  #MD_INTERFACE_DWELL_PKT_DATA_SIZE bytes.  The entry field is the first
+ *  entry that does not fit in the dwell packet.
+ */
+#define MD_TBL_DATA_SIZE_ERR_EID 76
+
+/**
+ * \brief MD Jam Dwell Data Size Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_JAM_DWELL_CC or
+ *  #MD_JAM_MULTI_DWELL_CC command is rejected because the jammed entries
+ *  would make the table collect more than
+ *  #MD_INTERFACE_DWELL_PKT_DATA_SIZE bytes of dwell data.
+ */
+#define MD_JAM_DATA_SIZE_ERR_EID 77
+
+/**
+ * \brief MD Set Batch Factor Command Success Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued upon successful processing of a
+ *  #MD_SET_BATCH_FACTOR_CC command.
+ */
+#define MD_SET_BATCH_FACTOR_INF_EID 78
+
+/**
+ * \brief MD Set Batch Factor Command Invalid Table ID Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_SET_BATCH_FACTOR_CC command
+ *  specifies a table ID outside of 1..#MD_INTERFACE_NUM_DWELL_TABLES.
+ */
+#define MD_INVALID_BATCH_TABLE_ERR_EID 79
+
+/**
+ * \brief MD Set Batch Factor Command Invalid Batch Factor Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_SET_BATCH_FACTOR_CC command is
+ *  rejected because that many cycles of the table's dwell data would not fit
+ *  in #MD_INTERFACE_DWELL_BATCH_DATA_SIZE bytes.
+ */
+#define MD_INVALID_BATCH_FACTOR_ERR_EID 80
+
+/**
+ * \brief MD Set Batch Factor Command Table Update Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the table address cannot be acquired
+ *  for the table specified in the #MD_SetBatchFactorCmd.
+ */
+#define MD_SET_BATCH_FACTOR_ERR_EID 81
+
+/**
+ * \brief MD Dwell Table Update Batch Factor Get Address Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the table address cannot be acquired in
+ *  the MD_UpdateTableBatchFactor function.  This event is issued when the
+ *  #CFE_TBL_GetAddress function returns a value other than CFE_SUCCESS or
+ *  CFE_TBL_INFO_UPDATED.
+ */
+#define MD_UPDATE_TBL_BATCH_ERR_EID 82
+
+/**
+ * \brief MD Dwell Table Batch Size Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dwell table fails validation because
+ *  its batch factor times the size of one batched cycle exceeds
+ *  #MD_INTERFACE_DWELL_BATCH_DATA_SIZE bytes.
+ */
+#define MD_TBL_BATCH_SIZE_ERR_EID 83
+
+/**
+ * \brief MD Jam Dwell Batch Size Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_JAM_DWELL_CC or
+ *  #MD_JAM_MULTI_DWELL_CC command is rejected because the jammed entries
+ *  would make the table's batched cycles exceed
+ *  #MD_INTERFACE_DWELL_BATCH_DATA_SIZE bytes.
+ */
+#define MD_JAM_BATCH_SIZE_ERR_EID 84
+
+/**
+ * \brief MD Arm Capture Command Success Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_ARM_CAPTURE_CC command has been
+ *  accepted and the capture is armed.
+ */
+#define MD_ARM_CAPTURE_INF_EID 85
+
+/**
+ * \brief MD Arm Capture Command Invalid Table ID Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_ARM_CAPTURE_CC command
+ *  specifies a table ID outside of 1..#MD_INTERFACE_NUM_DWELL_TABLES.
+ */
+#define MD_ARM_CAPTURE_TABLE_ERR_EID 86
+
+/**
+ * \brief MD Arm Capture Command Invalid Entry ID Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_ARM_CAPTURE_CC command
+ *  specifies an entry that isn't an active 1, 2 or 4 byte dwell of the table.
+ */
+#define MD_ARM_CAPTURE_ENTRY_ERR_EID 87
+
+/**
+ * \brief MD Arm Capture Command Invalid Condition Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_ARM_CAPTURE_CC command
+ *  specifies an unknown trigger condition or a zero trigger mask.
+ */
+#define MD_ARM_CAPTURE_COND_ERR_EID 88
+
+/**
+ * \brief MD Arm Capture Command Invalid Size Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_ARM_CAPTURE_CC command is
+ *  rejected because the pre-trigger, trigger and post-trigger cycles of the
+ *  table would not fit in #MD_INTERNAL_CAPTURE_BUFFER_SIZE bytes.
+ */
+#define MD_ARM_CAPTURE_SIZE_ERR_EID 89
+
+/**
+ * \brief MD Capture Triggered Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the trigger condition of an armed
+ *  capture holds and recording of the post-trigger cycles begins.
+ */
+#define MD_CAPTURE_TRIGGERED_INF_EID 90
+
+/**
+ * \brief MD Capture File Written Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a triggered capture has been written
+ *  to its capture file.
+ */
+#define MD_CAPTURE_FILE_INF_EID 91
+
+/**
+ * \brief MD Capture File Write Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a triggered capture couldn't be
+ *  written to its capture file because the file couldn't be created or
+ *  an #OS_write or #CFE_FS_WriteHeader call didn't write every byte.
+ */
+#define MD_CAPTURE_FILE_ERR_EID 92
+
+/**
+ * \brief MD Capture Cancelled Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when an armed capture that hasn't
+ *  triggered is dropped because its table was stopped or its entries
+ *  changed, or another capture was armed.
+ */
+#define MD_CAPTURE_CANCELLED_INF_EID 93
+
+/**
+ * \brief MD Sampler Child Task Creation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when #CFE_ES_CreateChildTask fails to
+ *  create the child task that samples dwell tables.
+ */
+#define MD_CREATE_SAMPLER_ERR_EID 94
+
+/**
+ * \brief MD Sampler Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a command or housekeeping request is
+ *  dropped because the sampler child task hasn't yet worked through the
+ *  #MD_INTERNAL_SAMPLER_QUEUE_DEPTH requests already handed to it.
+ */
+#define MD_SAMPLER_QUEUE_FULL_ERR_EID 95
+
+/**
+ * \brief MD Table Notification Registration Failed Event ID
+ *
+ *  \par Type: CRITICAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when #CFE_TBL_NotifyByMessage fails to
+ *  register the table manage command for a Dwell Table during
+ *  initialization.
+ */
+#define MD_TBL_NOTIFY_CRIT_EID 96
+
+/**
+ * \brief MD Table Manage Invalid Table Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_TBL_MANAGE_CC command names
+ *  a table index that isn't a Dwell Table.
+ */
+#define MD_TBL_MANAGE_ERR_EID 97
+
+/**
+ * \brief MD Symbol Cache Mutex Creation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when #OS_MutSemCreate fails to create
+ *  the mutex that serializes use of the symbol cache.
+ */
+#define MD_CREATE_SYM_MUTEX_ERR_EID 98
+
+/**
+ * \brief MD Jam Multiple Dwell Success Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_JAM_MULTI_DWELL_CC command
+ *  has applied all of its entries.
+ */
+#define MD_JAM_MULTI_DWELL_INF_EID 99
+
+/**
+ * \brief MD Jam Multiple Dwell Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the Table Services buffer of the
+ *  table named by a #MD_JAM_MULTI_DWELL_CC command couldn't be updated.
+ *  None of the command's entries are applied.
+ */
+#define MD_JAM_MULTI_DWELL_ERR_EID 100
+
+/**
+ * \brief MD Jam Multiple Dwell Entry Count Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_JAM_MULTI_DWELL_CC command
+ *  names no entries or more than #MD_INTERFACE_MAX_JAM_ENTRIES.
+ */
+#define MD_JAM_MULTI_COUNT_ERR_EID 101
+
+/**
+ * \brief MD Dwell Table Capacity Invalid Event ID
+ *
+ *  \par Type: CRITICAL
+ *
+ *  \par Cause:
+ *
+ *  Issued during initialization when a dwell table's
+ *  #MD_INTERNAL_DWELL_TABLE_CAPACITY is not 1..#MD_INTERFACE_DWELL_TABLE_SIZE
+ *  or doesn't fit in the #MD_INTERNAL_DWELL_ENTRY_POOL_SIZE entries left
+ *  by the tables before it.
+ */
+#define MD_DWELL_TBL_CAPACITY_CRIT_EID 102
+
+/**
+ * \brief MD Send Performance Histograms Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_SEND_PERF_HIST_CC command
+ *  has sent the performance histogram packet.
+ */
+#define MD_SEND_PERF_HIST_INF_EID 103
+
+/**
+ * \brief MD Dwell Table Cycle Deadline Phase Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dwell table fails validation because
+ *  it gives a non-zero cycle deadline period and a phase that is not less
+ *  than the period.
+ */
+#define MD_TBL_PHASE_ERR_EID 104
+
+/**
+ * \brief MD Dwell Table Snapshot Group Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dwell table fails validation because
+ *  an entry's SnapshotGroup is greater than #MD_INTERNAL_NUM_SNAPSHOT_GROUPS.
+ */
+#define MD_TBL_SNAPSHOT_GROUP_ERR_EID 105
+
+/**
+ * \brief MD Snapshot Groups Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dwell table update leaves more
+ *  entries assigned to snapshot groups, across all tables, than the
+ *  #MD_INTERNAL_SNAPSHOT_MAX_MEMBERS that can be read together.  The
+ *  entries left over are read on their own.
+ */
+#define MD_SNAPSHOT_FULL_ERR_EID 106
+
+/**
+ * \brief MD Dwell Read Error Summary Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued every #MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL
+ *  wakeups when dwell entries failed to be read since the last summary
+ *  without a #MD_DWELL_LOOP_GET_DWELL_DATA_ERR_EID event of their own.
+ */
+#define MD_READ_ERR_SUMMARY_ERR_EID 107
+
+/**
+ * \brief MD Dwell Entry Quarantined Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dwell entry has failed to be read
+ *  #MD_INTERNAL_READ_ERR_QUARANTINE_COUNT times in a row.  The entry is
+ *  only read again once each #MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL
+ *  wakeups until it is read successfully or its table is updated.
+ */
+#define MD_READ_ERR_QUARANTINE_ERR_EID 108
+
+/**
+ * \brief MD Table Update Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a validated dwell table can't be
+ *  handed to the sampler child task for its update because the sampler
+ *  queue is full.  The main task asks again after each message it receives
+ *  and each #MD_SB_TIMEOUT without one, without another event, until the
+ *  update is queued.
+ */
+#define MD_TBL_UPDATE_QUEUE_FULL_ERR_EID 109
+
+/**
+ * \brief MD Dwell Table Validation No Table Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dwell table load is validated
+ *  while MD isn't managing or initializing a dwell table, so there is no
+ *  table to compile it for.  The load is rejected.
+ */
+#define MD_TBL_VAL_NO_TBL_ERR_EID 110
+
+/**
+ * \brief MD Arm Capture Command Capture Not Written Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #MD_ARM_CAPTURE_CC command is
+ *  rejected because the previous capture has triggered and is still
+ *  recording its post-trigger cycles, or the main task hasn't written its
+ *  file yet.  The file is written within #MD_SB_TIMEOUT milliseconds of
+ *  the last post-trigger cycle.
+ */
+#define MD_ARM_CAPTURE_BUSY_ERR_EID 111
+
+/**
+ * \brief MD Wakeup Rephase Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the sequence count of a wakeup
+ *  message shows more than #MD_INTERNAL_MAX_CATCHUP_WAKEUPS wakeups were
+ *  missed, so they are skipped and every table's schedule shifts later.
+ *  It is issued on the 1st, 2nd, 4th, 8th and so on rephase since the
+ *  counters were last reset; housekeeping counts every one.
+ */
+#define MD_WAKEUP_REPHASE_ERR_EID 112
+
 /**\}*/
 
 #endif
@@ -65,6 +65,9 @@
  *       Memory Dwell housekeeping telemetry:
  *       - Command Execution Counter
  *       - Command Error Counter
+ *       - The counters of each dwell table
+ *
+ *       It also empties the performance histograms.
  *
  *  \par Command Structure
  *       MD_ResetCountersCmd_t
@@ -100,6 +103,10 @@
  *      This command sets the Enabled flag(s) associated with the Dwell Table(s)
  *      that have been designated by the command's TableMask argument.
  *
+ *      Bit n of TableMask designates table MaskOffset + n + 1.  With more
+ *      than 16 Dwell Tables, later tables are designated with a non-zero
+ *      MaskOffset.
+ *
  *      When this Enabled flag is set, and the associated Dwell Table has
  *      one or more dwell specifications defined beginning with the Table's
  *      first entry, and the Table has a non-zero value for total delays
@@ -143,7 +150,8 @@
  *  \par Error Conditions
  *       This command may fail for the following reasons:
  *       - Unexpected command length.
- *       - Dwell Table mask argument contains no valid table values ( 1..MD_INTERFACE_NUM_DWELL_TABLES).
+ *       - Dwell Table mask argument contains no valid table values ( 1..MD_INTERFACE_NUM_DWELL_TABLES)
+ *         at or after MaskOffset + 1.
  *
  *       Evidence of an unexpected command length error may be found
  *       in the following telemetry:
@@ -170,6 +178,10 @@
  *      This command clears the Enabled flag(s) associated with the Dwell Table(s)
  *      that have been designated by the command's TableMask argument.
  *
+ *      Bit n of TableMask designates table MaskOffset + n + 1.  With more
+ *      than 16 Dwell Tables, later tables are designated with a non-zero
+ *      MaskOffset.
+ *
  *      When the Enabled flag associated with a Dwell Table is cleared,
  *      dwell processing cannot occur for that Dwell Table.
  *
@@ -195,7 +207,8 @@
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Unexpected command length.
- *       - Dwell Table mask argument contains no valid table values ( 1..MD_INTERFACE_NUM_DWELL_TABLES).
+ *       - Dwell Table mask argument contains no valid table values ( 1..MD_INTERFACE_NUM_DWELL_TABLES)
+ *         at or after MaskOffset + 1.
  *
  *       Evidence of an unexpected command length error may be found
  *       in the following telemetry:
@@ -219,7 +232,7 @@
  *
  *  \par Description
  *      This command inserts the specified dwell parameters (dwell address,
- *      dwell field length, and delay count) into the specified table,
+ *      dwell field length, delay count, and deadband) into the specified table,
  *      at the specified index.
  *
  *      Note that it is safe to send a Jam command to an active Dwell Table.
@@ -245,12 +258,16 @@
  *       This command may fail for the following reason(s):
  *       - Unexpected command length                    (Event message MD_CMD_LEN_ERR_EID is issued)
  *       - Table Id other than 1..MD_INTERFACE_NUM_DWELL_TABLES   (Event message MD_INVALID_JAM_TABLE_ERR_EID is issued)
- *       - Entry Id other than 1..MD_INTERFACE_DWELL_TABLE_SIZE   (Event message MD_INVALID_ENTRY_ARG_ERR_EID is issued)
+ *       - Entry Id other than 1..the table's #MD_INTERNAL_DWELL_TABLE_CAPACITY
+ *         (Event message MD_INVALID_ENTRY_ARG_ERR_EID is issued)
  *       - Unrecognized Dwell Address symbol            (Event message MD_CANT_RESOLVE_JAM_ADDR_ERR_EID is issued)
- *       - Dwell Field Length other than 0, 1, 2, or 4  (Event message MD_INVALID_LEN_ARG_ERR_EID is issued)
+ *       - Dwell Field Length other than 0, 1, 2, 4, or 8..MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH
+ *                                                      (Event message MD_INVALID_LEN_ARG_ERR_EID is issued)
  *       - Specified Dwell Address is out of range      (Event message MD_INVALID_JAM_ADDR_ERR_EID is issued)
  *       - Specified Dwell Address is not properly aligned for the specified Dwell Length
  *         (Event message MD_JAM_ADDR_NOT_32BIT_ERR_EID or MD_JAM_ADDR_NOT_16BIT_ERR_EID is issued)
+ *       - Dwell data for the table would exceed MD_INTERFACE_DWELL_PKT_DATA_SIZE bytes
+ *                                                      (Event message MD_JAM_DATA_SIZE_ERR_EID is issued)
  *
  *       Any time the command fails, MD_HkTlm_Payload_t.InvalidCmdCntr increments.
  *
@@ -288,6 +305,184 @@
 #define MD_SET_SIGNATURE_CC MD_CCVAL(SET_SIGNATURE)
 #endif
 
+/**
+ * \brief Set Batch Factor Command
+ *
+ *  \par Description
+ *       Sets the number of consecutive cycles of the specified Dwell Table
+ *       that are packed into one batched dwell packet.  A batch factor of
+ *       0 or 1 sends each cycle in its own dwell packet.  Cycles already
+ *       batched when the command is received are sent first.
+ *
+ *  \par Command Structure
+ *       MD_SetBatchFactorCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - MD_HkTlm_Payload_t.ValidCmdCntr will increment.
+ *       - The MD_SET_BATCH_FACTOR_INF_EID informational event message is issued.
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Unexpected command length.                    (Event message MD_CMD_LEN_ERR_EID is issued)
+ *       - Dwell Table ID is invalid.                    (Event message MD_INVALID_BATCH_TABLE_ERR_EID is issued)
+ *       - Batched cycles would exceed MD_INTERFACE_DWELL_BATCH_DATA_SIZE bytes
+ *                                                       (Event message MD_INVALID_BATCH_FACTOR_ERR_EID is issued)
+ *       - Table Services buffer could not be updated.   (Event message MD_SET_BATCH_FACTOR_ERR_EID is issued)
+ *
+ *       Any time the command fails, MD_HkTlm_Payload_t.InvalidCmdCntr increments.
+ *
+ *  \par Criticality
+ *       None.
+ */
+#define MD_SET_BATCH_FACTOR_CC MD_CCVAL(SET_BATCH_FACTOR)
+
+/**
+ * \brief Arm Capture Command
+ *
+ *  \par Description
+ *       Arms a triggered capture on the specified Dwell Table.  Every full
+ *       cycle of the table is recorded in a RAM ring buffer until the trigger
+ *       condition holds for the watched entry.  The cycles recorded before
+ *       the trigger, up to PreTrigger of them, the trigger cycle and the
+ *       PostTrigger cycles after it are then written to a capture file by
+ *       the main task and the capture is disarmed.  Only one capture is
+ *       armed at a time; a new command replaces a capture that hasn't
+ *       triggered yet, and is rejected once the trigger has fired until
+ *       the capture file is written.
+ *
+ *  \par Command Structure
+ *       MD_ArmCaptureCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - MD_HkTlm_Payload_t.ValidCmdCntr will increment.
+ *       - The MD_ARM_CAPTURE_INF_EID informational event message is issued.
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Unexpected command length.                    (Event message MD_CMD_LEN_ERR_EID is issued)
+ *       - Dwell Table ID is invalid.                    (Event message MD_ARM_CAPTURE_TABLE_ERR_EID is issued)
+ *       - Entry ID isn't an active 1, 2 or 4 byte dwell (Event message MD_ARM_CAPTURE_ENTRY_ERR_EID is issued)
+ *       - Condition is invalid or mask is zero.         (Event message MD_ARM_CAPTURE_COND_ERR_EID is issued)
+ *       - Captured cycles would exceed MD_INTERNAL_CAPTURE_BUFFER_SIZE bytes
+ *                                                       (Event message MD_ARM_CAPTURE_SIZE_ERR_EID is issued)
+ *       - Previous capture is triggered or its file isn't written yet.
+ *                                                       (Event message MD_ARM_CAPTURE_BUSY_ERR_EID is issued)
+ *
+ *       Any time the command fails, MD_HkTlm_Payload_t.InvalidCmdCntr increments.
+ *
+ *  \par Criticality
+ *       None.
+ */
+#define MD_ARM_CAPTURE_CC MD_CCVAL(ARM_CAPTURE)
+
+/**
+ * \brief Table Manage Command
+ *
+ *  \par Description
+ *       Sent by Table Services, not the ground, when a Dwell Table has a
+ *       load waiting to be validated or made active.  MD registers this
+ *       command for each Dwell Table with #CFE_TBL_NotifyByMessage, with
+ *       the table index as the parameter, and manages only that table
+ *       when it arrives.  It is always executed by the MD main task.
+ *
+ *  \par Command Structure
+ *       MD_TblManageCmd_t
+ *
+ *  \par Command Verification
+ *       The command counters are not changed.  The table validation or
+ *       update it leads to is reported by Table Services.
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Unexpected command length.                    (Event message MD_CMD_LEN_ERR_EID is issued)
+ *       - Table index is invalid.                       (Event message MD_TBL_MANAGE_ERR_EID is issued)
+ *
+ *  \par Criticality
+ *       None.
+ */
+#define MD_TBL_MANAGE_CC MD_CCVAL(TBL_MANAGE)
+
+/**
+ * \brief Jam Multiple Dwell
+ *
+ *  \par Description
+ *      This command inserts up to MD_INTERFACE_MAX_JAM_ENTRIES sets of dwell
+ *      parameters into the specified table, each at its own index.  Entries
+ *      are applied in order, so a later entry for the same index wins.
+ *
+ *      Every entry is checked as it would be by MD_JAM_DWELL_CC, and the
+ *      data size and batch checks apply to the table with all of them in
+ *      place.  If any entry is rejected, none are applied.  Otherwise the
+ *      table's Table Services buffer is updated once for the whole command.
+ *
+ *      The command length must match NumEntries: the command carries only
+ *      the entries it uses.
+ *
+ *  \par Command Structure
+ *       MD_JamMultiDwellCmd_t
+ *
+ *  \par Command Verification
+ *       Nominal successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - MD_HkTlm_Payload_t.ValidCmdCntr increments.
+ *       - The MD_JAM_MULTI_DWELL_INF_EID informational event message is issued.
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command length doesn't match NumEntries      (Event message MD_CMD_LEN_ERR_EID is issued)
+ *       - Table Id other than 1..MD_INTERFACE_NUM_DWELL_TABLES   (Event message MD_INVALID_JAM_TABLE_ERR_EID is issued)
+ *       - NumEntries other than 1..MD_INTERFACE_MAX_JAM_ENTRIES  (Event message MD_JAM_MULTI_COUNT_ERR_EID is issued)
+ *       - Any entry fails a MD_JAM_DWELL_CC entry check (The event message for that check is issued)
+ *       - Dwell data for the table would exceed MD_INTERFACE_DWELL_PKT_DATA_SIZE bytes
+ *                                                      (Event message MD_JAM_DATA_SIZE_ERR_EID is issued)
+ *       - Batched cycles would exceed MD_INTERFACE_DWELL_BATCH_DATA_SIZE bytes
+ *                                                      (Event message MD_JAM_BATCH_SIZE_ERR_EID is issued)
+ *       - Table Services buffer could not be updated   (Event message MD_JAM_MULTI_DWELL_ERR_EID is issued)
+ *
+ *       Any time the command fails, MD_HkTlm_Payload_t.InvalidCmdCntr increments.
+ *
+ *  \par Criticality
+ *       None.
+ *
+ *  \sa MD_JAM_DWELL_CC
+ */
+#define MD_JAM_MULTI_DWELL_CC MD_CCVAL(JAM_MULTI_DWELL)
+
+/**
+ * \brief Send Performance Histograms
+ *
+ *  \par Description
+ *       Sends the execution time histogram of each MD_Perf_Phases phase in
+ *       an MD_PerfHistPkt_t on MD_PERF_HIST_TLM_MID.  Times are measured with
+ *       the PSP clock from when MD starts or its counters are last reset.
+ *
+ *  \par Command Structure
+ *       MD_SendPerfHistCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - MD_HkTlm_Payload_t.ValidCmdCntr will increment.
+ *       - The MD_SEND_PERF_HIST_INF_EID informational event message is issued.
+ *       - The performance histogram packet is sent.
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Unexpected command length.                    (Event message MD_CMD_LEN_ERR_EID is issued)
+ *
+ *       Any time the command fails, MD_HkTlm_Payload_t.InvalidCmdCntr increments.
+ *
+ *  \par Criticality
+ *       None.
+ *
+ *  \sa MD_RESET_CNTRS_CC
+ */
+#define MD_SEND_PERF_HIST_CC MD_CCVAL(SEND_PERF_HIST)
+
 /**\}*/
 
 #endif /* MD_FCNCODES_H */
\ No newline at end of file
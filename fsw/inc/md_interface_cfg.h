@@ -42,12 +42,37 @@
 /**
  *  \brief Number of memory dwell tables.
  *
+ *  \par Description
+ *       Start and Stop commands select up to 16 tables at a time, starting
+ *       after the command's mask offset.  Housekeeping reports
+ *       #MD_INTERFACE_HK_TABLES_PER_PAGE tables per packet.
+ *
  *  \par Limits
- *       Acceptable values for this parameter are 1 to 16.
+ *       Acceptable values for this parameter are 1 to 255, the largest
+ *       Table Id dwell packets can carry.  Each table is registered with
+ *       Table Services, so CFE_PLATFORM_TBL_MAX_NUM_TABLES must leave room
+ *       for them.  Each dwell packet type takes this many message IDs from
+ *       its base, so the bases must be at least this far apart.
  */
 #define MD_INTERFACE_NUM_DWELL_TABLES         MD_INTERFACE_CFGVAL(NUM_DWELL_TABLES)
 #define DEFAULT_MD_INTERFACE_NUM_DWELL_TABLES 4
 
+/**
+ *  \brief Number of dwell tables reported in each housekeeping packet.
+ *
+ *  \par Description
+ *       When there are more dwell tables than this, each housekeeping
+ *       request reports the next page of tables, wrapping back to table 1
+ *       after the last.
+ *
+ *  \par Limits
+ *       Must be 1 to 16, so the enabled mask covers the page, and no greater
+ *       than #MD_INTERFACE_NUM_DWELL_TABLES.
+ */
+#define MD_INTERFACE_HK_TABLES_PER_PAGE MD_INTERFACE_CFGVAL(HK_TABLES_PER_PAGE)
+#define DEFAULT_MD_INTERFACE_HK_TABLES_PER_PAGE \
+    ((DEFAULT_MD_INTERFACE_NUM_DWELL_TABLES < 16) ? DEFAULT_MD_INTERFACE_NUM_DWELL_TABLES : 16)
+
 /**
  *  \brief Maximum number of dwell specifications (address/delay/length)
  *    in a Dwell Table.
@@ -60,6 +85,101 @@
 #define MD_INTERFACE_DWELL_TABLE_SIZE         MD_INTERFACE_CFGVAL(DWELL_TABLE_SIZE)
 #define DEFAULT_MD_INTERFACE_DWELL_TABLE_SIZE 25
 
+/**
+ *  \brief Maximum number of dwell entries in a Jam Multiple Dwell command.
+ *
+ *  \par Description
+ *       Sizes the entry array of #MD_JamMultiDwellCmd_t.  Commands carry
+ *       only the entries they use, but each sampler queue entry is sized
+ *       for a full command.
+ *
+ *  \par Limits
+ *       Must be at least 1 and no greater than
+ *       #MD_INTERFACE_DWELL_TABLE_SIZE.  A full command must also fit in a
+ *       software bus message.
+ */
+#define MD_INTERFACE_MAX_JAM_ENTRIES         MD_INTERFACE_CFGVAL(MAX_JAM_ENTRIES)
+#define DEFAULT_MD_INTERFACE_MAX_JAM_ENTRIES 16
+
+/**
+ *  \brief Maximum length in bytes of a block dwell entry.
+ *
+ *  \par Description
+ *       Dwell entries of 1, 2 or 4 bytes are sampled with a single memory
+ *       read of that width.  Entries with a length from 8 bytes up to this
+ *       value are block dwells, copied into the dwell packet in one operation
+ *       with no alignment requirement.
+ *
+ *  \par Limits
+ *       Values below 8 disable block dwell entries.  The value cannot be
+ *       greater than #MD_INTERFACE_DWELL_PKT_DATA_SIZE.
+ */
+#define MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH         MD_INTERFACE_CFGVAL(MAX_BLOCK_DWELL_LENGTH)
+#define DEFAULT_MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH 64
+
+/**
+ *  \brief Size in bytes of the data area of a dwell packet.
+ *
+ *  \par Description
+ *       Bounds the total number of bytes a single dwell table can collect.
+ *       Table loads and jam commands whose entries would exceed it are
+ *       rejected.  The default gives every table entry room for a 4-byte
+ *       dwell, matching the packet layout used before block dwells.
+ *
+ *  \par Limits
+ *       Must be at least 4 and no greater than 65535.
+ */
+#define MD_INTERFACE_DWELL_PKT_DATA_SIZE         MD_INTERFACE_CFGVAL(DWELL_PKT_DATA_SIZE)
+#define DEFAULT_MD_INTERFACE_DWELL_PKT_DATA_SIZE (DEFAULT_MD_INTERFACE_DWELL_TABLE_SIZE * 4)
+
+/**
+ *  \brief Size in bytes of the data area of a batched dwell packet.
+ *
+ *  \par Description
+ *       A dwell table with a batch factor greater than 1 packs that many
+ *       consecutive cycles into one batched dwell packet.  Each cycle takes
+ *       a 2-byte time offset plus the table's dwell data bytes.  Table loads,
+ *       jam commands and set batch factor commands that would not leave room
+ *       for every cycle are rejected.
+ *
+ *  \par Limits
+ *       Must be at least #MD_INTERFACE_DWELL_PKT_DATA_SIZE + 2 and no greater
+ *       than 65535.
+ */
+#define MD_INTERFACE_DWELL_BATCH_DATA_SIZE         MD_INTERFACE_CFGVAL(DWELL_BATCH_DATA_SIZE)
+#define DEFAULT_MD_INTERFACE_DWELL_BATCH_DATA_SIZE ((DEFAULT_MD_INTERFACE_DWELL_PKT_DATA_SIZE + 2) * 4)
+
+/**
+ *  \brief Size in bytes of the data area of an encoded dwell packet.
+ *
+ *  \par Description
+ *       A dwell table with a non-zero keyframe interval sends each cycle as
+ *       the run-length encoded XOR of its dwell data against the previous
+ *       cycle sent.  Data that doesn't repeat grows by one byte for every
+ *       128, so the default covers the worst case for a full dwell packet.
+ *
+ *  \par Limits
+ *       Must be at least #MD_INTERFACE_DWELL_PKT_DATA_SIZE plus one byte for
+ *       every 128 bytes of it, rounded up, and no greater than 65535.
+ */
+#define MD_INTERFACE_DWELL_ENC_DATA_SIZE         MD_INTERFACE_CFGVAL(DWELL_ENC_DATA_SIZE)
+#define DEFAULT_MD_INTERFACE_DWELL_ENC_DATA_SIZE (DEFAULT_MD_INTERFACE_DWELL_PKT_DATA_SIZE + ((DEFAULT_MD_INTERFACE_DWELL_PKT_DATA_SIZE + 127) / 128))
+
+/**
+ *  \brief Number of bins in each performance histogram.
+ *
+ *  \par Description
+ *       Execution times are binned by their number of significant bits in
+ *       microseconds: bin 0 counts times under 1 us and bin n times from
+ *       2^(n-1) up to 2^n us.  The last bin also counts every longer time,
+ *       so the default bins run up to 2^18 us, about a quarter second.
+ *
+ *  \par Limits
+ *       Must be 2 to 33.
+ */
+#define MD_INTERFACE_PERF_HIST_BINS         MD_INTERFACE_CFGVAL(PERF_HIST_BINS)
+#define DEFAULT_MD_INTERFACE_PERF_HIST_BINS 20
+
 /**
  *  \brief Option of whether 32 bit integers must be aligned to 32 bit
  *   boundaries.  1 indicates 'yes' (32-bit boundary alignment enforced),
@@ -61,6 +61,374 @@
 #define MD_INTERNAL_TBL_FILENAME_FORMAT         MD_INTERNAL_CFGVAL(TBL_FILENAME_FORMAT)
 #define DEFAULT_MD_INTERNAL_TBL_FILENAME_FORMAT "/cf/md_dw%02d.tbl"
 
+/**
+ * \brief Coalesce Contiguous Dwell Reads
+ *
+ *  \par Description:
+ *       When set to 1, each dwell table is compiled into a sampling plan
+ *       when it is loaded or modified.  Runs of entries that dwell on
+ *       adjacent addresses and are sampled on the same wakeup call are
+ *       read with a single #CFE_PSP_MemCpy directly into the dwell packet
+ *       instead of one #CFE_PSP_MemRead8, #CFE_PSP_MemRead16 or
+ *       #CFE_PSP_MemRead32 call per entry.  The dwell packet contents are
+ *       the same either way, but the memory is no longer accessed with the
+ *       width of each entry: #CFE_PSP_MemCpy may read it a byte or a word
+ *       at a time.
+ *
+ *  \par Limits:
+ *       Must be 0 or 1.  Only set to 1 if no dwell table addresses memory
+ *       mapped registers or other memory that requires accesses of the
+ *       exact entry width.
+ */
+#define MD_INTERNAL_COALESCE_DWELL_READS         MD_INTERNAL_CFGVAL(COALESCE_DWELL_READS)
+#define DEFAULT_MD_INTERNAL_COALESCE_DWELL_READS 0
+
+/**
+ * \brief Zero Copy Dwell Packets
+ *
+ *  \par Description:
+ *       When set to 1, each dwell packet is filled in a buffer obtained
+ *       from #CFE_SB_AllocateMessageBuffer and sent with
+ *       #CFE_SB_TransmitBuffer, so the packet is not copied again by the
+ *       software bus.  Header fields are copied from a per-table template
+ *       kept in MD_AppData.  If a buffer can't be allocated, that dwell
+ *       packet is filled in the template and sent with #CFE_SB_TransmitMsg.
+ *
+ *       Data a jam keeps a cycle from reading is sent as zeros, where the
+ *       template would still hold the previous cycle's bytes.
+ *
+ *  \par Limits:
+ *       Must be 0 or 1.  Each enabled dwell table holds one software bus
+ *       buffer of sizeof(MD_DwellPkt_t) bytes from the first read of a
+ *       cycle until its packet is sent, which is across wakeups for a
+ *       table with non-zero delays, and for as long as its cycles are
+ *       suppressed, batched, encoded or summarized.  The software bus
+ *       buffer pool needs room for MD_INTERFACE_NUM_DWELL_TABLES such
+ *       buffers on top of the rest of the mission's traffic.
+ */
+#define MD_INTERNAL_ZERO_COPY_DWELL_PKTS         MD_INTERNAL_CFGVAL(ZERO_COPY_DWELL_PKTS)
+#define DEFAULT_MD_INTERNAL_ZERO_COPY_DWELL_PKTS 0
+
+/**
+ * \brief Capture Buffer Size
+ *
+ *  \par Description:
+ *       Number of bytes of RAM set aside in MD_AppData for the triggered
+ *       capture ring buffer.  Each captured cycle takes a 4-byte wakeup
+ *       count plus the dwell table's data size, so this bounds the number
+ *       of pre-trigger and post-trigger cycles an Arm Capture command can
+ *       ask for.
+ *
+ *  \par Limits:
+ *       Must be at least #MD_INTERFACE_DWELL_PKT_DATA_SIZE + 4 so one cycle
+ *       of the largest dwell table fits.
+ */
+#define MD_INTERNAL_CAPTURE_BUFFER_SIZE         MD_INTERNAL_CFGVAL(CAPTURE_BUFFER_SIZE)
+#define DEFAULT_MD_INTERNAL_CAPTURE_BUFFER_SIZE 8192
+
+/**
+ *  \brief Capture Filename
+ *
+ *  \par Description:
+ *       Name and location of the file a completed capture is written to.
+ *       The dwell table number, 01 up to the number of tables, is filled
+ *       in, and a later capture of the same table overwrites the file.
+ *
+ *  \par Limits:
+ *       This string shouldn't be longer than #OS_MAX_PATH_LEN for the
+ *       target platform in question
+ */
+#define MD_INTERNAL_CAPTURE_FILENAME_FORMAT         MD_INTERNAL_CFGVAL(CAPTURE_FILENAME_FORMAT)
+#define DEFAULT_MD_INTERNAL_CAPTURE_FILENAME_FORMAT "/cf/md_cap%02d.dat"
+
+/**
+ *  \brief Capture File Subtype
+ *
+ *  \par Description:
+ *       Value written to the SubType field of the cFE file header of
+ *       capture files so ground tools can recognize them.
+ *
+ *  \par Limits:
+ *       Any 32-bit value.
+ */
+#define MD_INTERNAL_CAPTURE_FILE_SUBTYPE         MD_INTERNAL_CFGVAL(CAPTURE_FILE_SUBTYPE)
+#define DEFAULT_MD_INTERNAL_CAPTURE_FILE_SUBTYPE 0x4D440001
+
+/**
+ * \brief Sample Dwell Tables on a Child Task
+ *
+ *  \par Description:
+ *       When set to 1, dwell tables are sampled by a child task that waits
+ *       on its own wakeup pipe.  The main task keeps the command pipe and
+ *       table validation, and hands commands, housekeeping requests and
+ *       table updates to the child task through a lock-free queue that the
+ *       child task works through after each wakeup.  Slow commands or table
+ *       validations then no longer delay sampling.  When set to 0, the main
+ *       task does everything as it receives it.
+ *
+ *  \par Limits:
+ *       Must be 0 or 1.
+ */
+#define MD_INTERNAL_SAMPLER_CHILD_TASK         MD_INTERNAL_CFGVAL(SAMPLER_CHILD_TASK)
+#define DEFAULT_MD_INTERNAL_SAMPLER_CHILD_TASK 1
+
+/**
+ * \brief Sampler Child Task Name
+ *
+ *  \par Description:
+ *       Name of the child task that samples dwell tables.
+ *
+ *  \par Limits:
+ *       The string must be no longer than #OS_MAX_API_NAME (including terminator).
+ */
+#define MD_INTERNAL_SAMPLER_TASK_NAME         MD_INTERNAL_CFGVAL(SAMPLER_TASK_NAME)
+#define DEFAULT_MD_INTERNAL_SAMPLER_TASK_NAME "MD_SAMPLER"
+
+/**
+ * \brief Sampler Child Task Stack Size
+ *
+ *  \par Description:
+ *       Stack size in bytes of the child task that samples dwell tables.
+ *       The child task also executes commands.
+ *
+ *  \par Limits:
+ *       Must be large enough for the target's event message formatting.
+ */
+#define MD_INTERNAL_SAMPLER_TASK_STACK_SIZE         MD_INTERNAL_CFGVAL(SAMPLER_TASK_STACK_SIZE)
+#define DEFAULT_MD_INTERNAL_SAMPLER_TASK_STACK_SIZE 16384
+
+/**
+ * \brief Sampler Child Task Priority
+ *
+ *  \par Description:
+ *       Priority of the child task that samples dwell tables.
+ *
+ *  \par Limits:
+ *       Should be a higher priority (lower number) than the MD main task
+ *       so sampling preempts command and table handling.
+ */
+#define MD_INTERNAL_SAMPLER_TASK_PRIORITY         MD_INTERNAL_CFGVAL(SAMPLER_TASK_PRIORITY)
+#define DEFAULT_MD_INTERNAL_SAMPLER_TASK_PRIORITY 40
+
+/**
+ * \brief Wakeup Pipe Name
+ *
+ *  \par Description:
+ *       Software bus name for the pipe the sampler child task receives
+ *       wakeup messages on.
+ *
+ *  \par Limits:
+ *       The string must be no longer than #OS_MAX_API_NAME (including terminator).
+ */
+#define MD_INTERNAL_WAKEUP_PIPE_NAME         MD_INTERNAL_CFGVAL(WAKEUP_PIPE_NAME)
+#define DEFAULT_MD_INTERNAL_WAKEUP_PIPE_NAME "MD_WAKEUP_PIPE"
+
+/**
+ * \brief Wakeup Pipe Depth
+ *
+ *  \par Description:
+ *       Maximum number of wakeup messages that will be allowed in the
+ *       wakeup pipe at one time.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than an unsigned 16 bit
+ *       integer (65535).
+ */
+#define MD_INTERNAL_WAKEUP_PIPE_DEPTH         MD_INTERNAL_CFGVAL(WAKEUP_PIPE_DEPTH)
+#define DEFAULT_MD_INTERNAL_WAKEUP_PIPE_DEPTH 4
+
+/**
+ * \brief Sampler Queue Depth
+ *
+ *  \par Description:
+ *       Number of commands, housekeeping requests and table updates the
+ *       main task can hand to the sampler child task before it has worked
+ *       through them.  A message that arrives while the queue is full is
+ *       dropped.  Each entry is as large as the largest MD command.
+ *
+ *  \par Limits:
+ *       Must be a power of two.
+ */
+#define MD_INTERNAL_SAMPLER_QUEUE_DEPTH         MD_INTERNAL_CFGVAL(SAMPLER_QUEUE_DEPTH)
+#define DEFAULT_MD_INTERNAL_SAMPLER_QUEUE_DEPTH 16
+
+/**
+ * \brief Sampler Requests per Wakeup
+ *
+ *  \par Description:
+ *       Most queued requests the sampler child task works through after
+ *       each wakeup or wakeup pipe timeout.  Any others wait for the next
+ *       one, so a burst of commands can't run into the next wakeup.
+ *
+ *  \par Limits:
+ *       Must be at least 1.
+ */
+#define MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP         MD_INTERNAL_CFGVAL(SAMPLER_REQUESTS_PER_WAKEUP)
+#define DEFAULT_MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP 4
+
+/**
+ * \brief Maximum Wakeups Caught Up
+ *
+ *  \par Description:
+ *       Most wakeups missed in a row, as shown by a gap in the wakeup
+ *       messages' sequence counts, that are made up for by processing
+ *       them all when the next wakeup arrives.  After a longer gap the
+ *       missed wakeups are skipped instead, so every table's schedule
+ *       shifts later by the length of the gap.  0 always skips them.
+ *
+ *  \par Limits:
+ *       Must be less than 16384, the range of a message sequence count.
+ */
+#define MD_INTERNAL_MAX_CATCHUP_WAKEUPS         MD_INTERNAL_CFGVAL(MAX_CATCHUP_WAKEUPS)
+#define DEFAULT_MD_INTERNAL_MAX_CATCHUP_WAKEUPS 8
+
+/**
+ * \brief Symbol Cache Size
+ *
+ *  \par Description:
+ *       Number of symbol names whose addresses are remembered after
+ *       #OS_SymbolLookup finds them, so dwell table validation, the copy
+ *       of a validated table and jam commands look each symbol up once.
+ *       The cache is emptied whenever a module is loaded or unloaded.
+ *       Each entry holds a #CFE_MISSION_MAX_PATH_LEN byte symbol name.
+ *
+ *  \par Limits:
+ *       Must be a power of two.
+ */
+#define MD_INTERNAL_SYM_CACHE_SIZE         MD_INTERNAL_CFGVAL(SYM_CACHE_SIZE)
+#define DEFAULT_MD_INTERNAL_SYM_CACHE_SIZE 64
+
+/**
+ * \brief Symbol Cache Mutex Name
+ *
+ *  \par Description:
+ *       Name of the mutex that serializes symbol cache use by the main
+ *       task and the sampler child task.
+ *
+ *  \par Limits:
+ *       The string must be no longer than #OS_MAX_API_NAME (including terminator).
+ */
+#define MD_INTERNAL_SYM_CACHE_MUTEX_NAME         MD_INTERNAL_CFGVAL(SYM_CACHE_MUTEX_NAME)
+#define DEFAULT_MD_INTERNAL_SYM_CACHE_MUTEX_NAME "MD_SYM_CACHE"
+
+/**
+ * \brief Dwell Table Capacity
+ *
+ *  \par Description:
+ *       Number of entries dwell table TblIndex (0 based) holds.  Each table
+ *       is registered with Table Services, and so takes Table Services
+ *       buffers and a critical data store image, only as large as its
+ *       capacity, and takes that many entries from the dwell entry pool.
+ *       A table file for a smaller table must be built from a load
+ *       structure of the same size, see #MD_DWELL_TABLE_LOAD_STRUCT.
+ *
+ *  \par Limits:
+ *       Must be 1 to #MD_INTERFACE_DWELL_TABLE_SIZE for every table, and the
+ *       capacities together can't exceed #MD_INTERNAL_DWELL_ENTRY_POOL_SIZE.
+ *       Tables that break these limits are reported when the application
+ *       initializes, which then fails.
+ */
+#define MD_INTERNAL_DWELL_TABLE_CAPACITY(TblIndex)         MD_INTERNAL_CFGVAL(DWELL_TABLE_CAPACITY)(TblIndex)
+#define DEFAULT_MD_INTERNAL_DWELL_TABLE_CAPACITY(TblIndex) MD_INTERFACE_DWELL_TABLE_SIZE
+
+/**
+ * \brief Dwell Entry Pool Size
+ *
+ *  \par Description:
+ *       Number of dwell entries shared by all dwell tables.  The control,
+ *       compiled and statistics entries of every table are taken from pools
+ *       of this size, in table order.
+ *
+ *  \par Limits:
+ *       Must be at least #MD_INTERFACE_NUM_DWELL_TABLES.  The default leaves
+ *       room for every table to have #MD_INTERFACE_DWELL_TABLE_SIZE entries.
+ */
+#define MD_INTERNAL_DWELL_ENTRY_POOL_SIZE MD_INTERNAL_CFGVAL(DWELL_ENTRY_POOL_SIZE)
+#define DEFAULT_MD_INTERNAL_DWELL_ENTRY_POOL_SIZE \
+    (MD_INTERFACE_NUM_DWELL_TABLES * MD_INTERFACE_DWELL_TABLE_SIZE)
+
+/**
+ * \brief Number of Snapshot Groups
+ *
+ *  \par Description:
+ *       Number of snapshot groups dwell entries can be assigned to.  The
+ *       members of a group, in any dwell table, are read back to back in a
+ *       single pass whenever one of them is due, so their values are
+ *       consistent with each other.
+ *
+ *  \par Limits:
+ *       Must be 1 to 65535.  Dwell table entries with a SnapshotGroup
+ *       greater than this fail validation.
+ */
+#define MD_INTERNAL_NUM_SNAPSHOT_GROUPS         MD_INTERNAL_CFGVAL(NUM_SNAPSHOT_GROUPS)
+#define DEFAULT_MD_INTERNAL_NUM_SNAPSHOT_GROUPS 4
+
+/**
+ * \brief Snapshot Group Member Limit
+ *
+ *  \par Description:
+ *       Number of dwell entries, in all groups and tables together, that
+ *       can be read as members of snapshot groups.  Each member keeps a
+ *       copy of its value from the last pass of its group.  Entries
+ *       assigned to a group once this many are taken are read on their
+ *       own, which is reported when the table is loaded.
+ *
+ *  \par Limits:
+ *       Must be 1 to 65535.
+ */
+#define MD_INTERNAL_SNAPSHOT_MAX_MEMBERS         MD_INTERNAL_CFGVAL(SNAPSHOT_MAX_MEMBERS)
+#define DEFAULT_MD_INTERNAL_SNAPSHOT_MAX_MEMBERS 32
+
+/**
+ * \brief Dwell Read Error Summary Interval
+ *
+ *  \par Description:
+ *       Number of wakeups between dwell read error summaries.  Events
+ *       for an entry that keeps failing to be read are backed off, and the
+ *       failures not reported in an event of their own are reported
+ *       together in a summary event at this interval.  Quarantined
+ *       entries are read again at the same interval to see whether they
+ *       have recovered.
+ *
+ *  \par Limits:
+ *       Must be at least 1.
+ */
+#define MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL         MD_INTERNAL_CFGVAL(READ_ERR_SUMMARY_INTERVAL)
+#define DEFAULT_MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL 100
+
+/**
+ * \brief Dwell Read Error Quarantine Count
+ *
+ *  \par Description:
+ *       Number of reads in a row a dwell entry can fail before it is
+ *       quarantined.  A quarantined entry is left out of its dwell packet
+ *       reads, except for one retry each read error summary interval,
+ *       until it is read successfully or its table is updated.  It is
+ *       sent as zeros, counted in housekeeping, and left out of deadbands,
+ *       statistics and capture triggers meanwhile.
+ *
+ *  \par Limits:
+ *       0 never quarantines an entry.
+ */
+#define MD_INTERNAL_READ_ERR_QUARANTINE_COUNT         MD_INTERNAL_CFGVAL(READ_ERR_QUARANTINE_COUNT)
+#define DEFAULT_MD_INTERNAL_READ_ERR_QUARANTINE_COUNT 16
+
+/**
+ * \brief Cache Line Size
+ *
+ *  \par Description:
+ *       Alignment in bytes of the dwell state read on every wakeup, the
+ *       dwell schedule, packet control structures and dwell entry pool, so
+ *       it starts on a cache line of its own and isn't shared with state
+ *       that is only used when commands or reports are processed.
+ *
+ *  \par Limits:
+ *       Must be a power of two.  Values smaller than the processor's cache
+ *       line only cost locality, not correctness.
+ */
+#define MD_INTERNAL_CACHE_LINE_SIZE         MD_INTERNAL_CFGVAL(CACHE_LINE_SIZE)
+#define DEFAULT_MD_INTERNAL_CACHE_LINE_SIZE 64
+
 /**
  * \brief Mission specific version number for MD application
  *
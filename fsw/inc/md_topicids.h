@@ -37,4 +37,16 @@
 #define CFE_MISSION_MD_DWELL_PKT_MID_BASE_TOPICID         CFE_MISSION_MD_TIDVAL(DWELL_PKT_MID_BASE)
 #define DEFAULT_CFE_MISSION_MD_DWELL_PKT_MID_BASE_TOPICID 0x91
 
+#define CFE_MISSION_MD_DWELL_BATCH_PKT_MID_BASE_TOPICID         CFE_MISSION_MD_TIDVAL(DWELL_BATCH_PKT_MID_BASE)
+#define DEFAULT_CFE_MISSION_MD_DWELL_BATCH_PKT_MID_BASE_TOPICID 0xA1
+
+#define CFE_MISSION_MD_DWELL_ENC_PKT_MID_BASE_TOPICID         CFE_MISSION_MD_TIDVAL(DWELL_ENC_PKT_MID_BASE)
+#define DEFAULT_CFE_MISSION_MD_DWELL_ENC_PKT_MID_BASE_TOPICID 0xB1
+
+#define CFE_MISSION_MD_DWELL_STATS_PKT_MID_BASE_TOPICID         CFE_MISSION_MD_TIDVAL(DWELL_STATS_PKT_MID_BASE)
+#define DEFAULT_CFE_MISSION_MD_DWELL_STATS_PKT_MID_BASE_TOPICID 0xC1
+
+#define CFE_MISSION_MD_PERF_HIST_TLM_TOPICID         CFE_MISSION_MD_TIDVAL(PERF_HIST_TLM)
+#define DEFAULT_CFE_MISSION_MD_PERF_HIST_TLM_TOPICID 0x8F
+
 #endif /* MD_TOPICIDS_H */
\ No newline at end of file
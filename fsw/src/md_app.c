@@ -33,6 +33,10 @@
 #include "md_dwell_tbl.h"
 #include "md_dwell_pkt.h"
 #include "md_utils.h"
+#include "md_sampler.h"
+#include "md_symcache.h"
+#include "md_perf.h"
+#include "md_capture.h"
 #include "md_perfids.h"
 #include "md_version.h"
 
@@ -41,7 +45,7 @@ MD_AppData_t MD_AppData;
 void MD_AppMain(void)
 {
     CFE_Status_t     Status       = CFE_SUCCESS;
-    uint8            TblIndex     = 0;
+    uint16           TblIndex     = 0;
     CFE_SB_Buffer_t *BufPtr       = NULL;
 
     MD_AppData.RunStatus = CFE_ES_RunStatus_APP_RUN;
@@ -57,17 +61,22 @@ void MD_AppMain(void)
         CFE_ES_WriteToSysLog("MD:Application Init Failed,RC=%08x\n", (unsigned int)Status);
         MD_AppData.RunStatus = CFE_ES_RunStatus_APP_ERROR;
     }
-
-    /* Loop Forever, or until ES exit command, or SB error  */
-    while (CFE_ES_RunLoop(&MD_AppData.RunStatus) == true)
+    else
     {
-        /* Copy any newly loaded tables */
+        /*
+        ** Copy any tables loaded before table manage notifications were
+        ** registered.  Table Services notifies MD of later loads.
+        */
         for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
         {
             MD_ManageDwellTable(TblIndex);
 
         } /* end for each table loop */
+    }
 
+    /* Loop Forever, or until ES exit command, or SB error  */
+    while (CFE_ES_RunLoop(&MD_AppData.RunStatus) == true)
+    {
         CFE_ES_PerfLogExit(MD_APPMAIN_PERF_ID);
 
         /* Wait for next message */
@@ -92,9 +101,40 @@ void MD_AppMain(void)
         /* Process message if received successfully */
         if (Status == CFE_SUCCESS)
         {
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+            /* Commands run on the sampler child task between wakeups */
+            if (MD_IsMainTaskMsg(BufPtr))
+            {
+                MD_ProcessCommandPacket(BufPtr);
+            }
+            else
+            {
+                MD_QueueSamplerMsg(BufPtr);
+            }
+#else
             MD_ProcessCommandPacket(BufPtr);
+#endif
+
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+            /* Queue any table update the sampler queue had no room for */
+            MD_RetryTableUpdates();
+#endif
+        }
+        else if (Status == CFE_SB_TIME_OUT)
+        {
+            /*
+            ** Look over every table while idle, in case a notification was
+            ** lost or an update is still owed
+            */
+            for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+            {
+                MD_ManageDwellTable(TblIndex);
+            }
         }
 
+        /* Write any capture the dwell cycles completed, off the sampling path */
+        MD_WriteCompletedCapture();
+
     }/* end while forever loop */
 
     /*
@@ -138,6 +178,14 @@ CFE_Status_t MD_AppInit(void)
         CFE_ES_WriteToSysLog("MD_APP:Call to CFE_EVS_Register Failed:RC=%d\n", (unsigned int)Status);
     }
 
+    /*
+    ** Set up the symbol cache used to validate tables
+    */
+    if (Status == CFE_SUCCESS)
+    {
+        Status = MD_InitSymCache();
+    }
+
     /*
     ** Register for Table Services
     */
@@ -146,6 +194,16 @@ CFE_Status_t MD_AppInit(void)
         Status = MD_InitTableServices();
     }
 
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+    /*
+    ** Start sampling once the tables are loaded
+    */
+    if (Status == CFE_SUCCESS)
+    {
+        Status = MD_InitSampler();
+    }
+#endif
+
     /*
     ** Issue Event Message
     */
@@ -163,23 +221,88 @@ CFE_Status_t MD_AppInit(void)
 void MD_InitControlStructures(void)
 {
     uint16                   TblIndex;
+    uint32                   Capacity;
+    uint32                   PoolIndex       = 0;
     MD_DwellPacketControl_t *DwellControlPtr = NULL;
+    MD_DwellReportControl_t *ReportPtr       = NULL;
+    MD_CompiledDwellTable_t *CompiledPtr     = NULL;
+
+    memset(MD_AppData.DwellEntryPool, 0, sizeof(MD_AppData.DwellEntryPool));
+    memset(MD_AppData.CompiledEntryPool, 0, sizeof(MD_AppData.CompiledEntryPool));
+    memset(MD_AppData.DwellDeadbandPool, 0, sizeof(MD_AppData.DwellDeadbandPool));
+    memset(MD_AppData.CompiledDeadbandPool, 0, sizeof(MD_AppData.CompiledDeadbandPool));
+    memset(MD_AppData.DwellGroupPool, 0, sizeof(MD_AppData.DwellGroupPool));
+    memset(MD_AppData.CompiledGroupPool, 0, sizeof(MD_AppData.CompiledGroupPool));
+    memset(MD_AppData.DwellSignedPool, 0, sizeof(MD_AppData.DwellSignedPool));
+    memset(MD_AppData.CompiledSignedPool, 0, sizeof(MD_AppData.CompiledSignedPool));
+    memset(MD_AppData.CompiledImagePool, 0, sizeof(MD_AppData.CompiledImagePool));
+    memset(MD_AppData.DwellStatsPool, 0, sizeof(MD_AppData.DwellStatsPool));
+    memset(MD_AppData.DwellReadErrPool, 0, sizeof(MD_AppData.DwellReadErrPool));
+    memset(MD_AppData.DwellCounters, 0, sizeof(MD_AppData.DwellCounters));
 
     for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
     {
         DwellControlPtr = &MD_AppData.MD_DwellTables[TblIndex];
+        ReportPtr       = &MD_AppData.DwellReportControl[TblIndex];
+        CompiledPtr     = &MD_AppData.CompiledTables[TblIndex];
 
         memset(DwellControlPtr, 0, sizeof(*DwellControlPtr));
+        memset(ReportPtr, 0, sizeof(*ReportPtr));
+        memset(CompiledPtr, 0, sizeof(*CompiledPtr));
 
-        /* Countdown must be set to 1 since it's decremented at the top of */
-        /* the dwell loop. */
+        /* Countdown of 1 causes the first read on the first wakeup call */
+        /* once the table is enabled and scheduled. */
         DwellControlPtr->Countdown = 1;
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
-        strncpy(DwellControlPtr->Signature, "", MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
+        strncpy(ReportPtr->Signature, "", MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
 #endif
 
+        /* Take the table's entries from the pools, tables that can't have them are left empty */
+        Capacity = MD_INTERNAL_DWELL_TABLE_CAPACITY(TblIndex);
+
+        if ((Capacity >= 1) && (Capacity <= MD_INTERFACE_DWELL_TABLE_SIZE) &&
+            (Capacity <= (MD_INTERNAL_DWELL_ENTRY_POOL_SIZE - PoolIndex)))
+        {
+            DwellControlPtr->Capacity = (uint16)Capacity;
+            DwellControlPtr->Entry    = &MD_AppData.DwellEntryPool[PoolIndex];
+
+            ReportPtr->Deadband = &MD_AppData.DwellDeadbandPool[PoolIndex];
+            ReportPtr->Group    = &MD_AppData.DwellGroupPool[PoolIndex];
+            ReportPtr->Signed   = &MD_AppData.DwellSignedPool[PoolIndex];
+            ReportPtr->Stats    = &MD_AppData.DwellStatsPool[PoolIndex];
+            ReportPtr->ReadErr  = &MD_AppData.DwellReadErrPool[PoolIndex];
+
+            CompiledPtr->Capacity = (uint16)Capacity;
+            CompiledPtr->Entry    = &MD_AppData.CompiledEntryPool[PoolIndex];
+            CompiledPtr->Deadband = &MD_AppData.CompiledDeadbandPool[PoolIndex];
+            CompiledPtr->Group    = &MD_AppData.CompiledGroupPool[PoolIndex];
+            CompiledPtr->Signed   = &MD_AppData.CompiledSignedPool[PoolIndex];
+            CompiledPtr->Image    = &MD_AppData.CompiledImagePool[PoolIndex];
+
+            PoolIndex += Capacity;
+        }
+
     } /* end for TblIndex loop */
+
+    /* No table is being validated */
+    MD_AppData.CompileTblIndex = MD_INTERFACE_NUM_DWELL_TABLES;
+
+    /* No tables are scheduled until enabled with a non-zero rate */
+    memset(&MD_AppData.DwellSchedule, 0, sizeof(MD_AppData.DwellSchedule));
+
+    /* Housekeeping reports the first page of tables first */
+    MD_AppData.HkPageTblIndex = 0;
+
+    /* No capture is armed until commanded */
+    MD_AppData.Capture.State = MD_CAPTURE_IDLE;
+
+    /* No entries are read in snapshot groups until a table assigns them */
+    memset(&MD_AppData.SnapshotGroups, 0, sizeof(MD_AppData.SnapshotGroups));
+
+    /* Nothing has failed to be read yet */
+    MD_AppData.ReadErrSummary.Countdown       = MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL;
+    MD_AppData.ReadErrSummary.UnreportedCount = 0;
 }
 
 /******************************************************************************/
@@ -192,6 +315,12 @@ CFE_Status_t MD_InitSoftwareBusServices(void)
     ** Initialize housekeeping telemetry packet (clear user data area)
     */
     CFE_MSG_Init(CFE_MSG_PTR(MD_AppData.HkPkt.TelemetryHeader), CFE_SB_ValueToMsgId(MD_HK_TLM_MID), sizeof(MD_HkTlm_t));
+
+    /*
+    ** Initialize performance histogram packet (clear user data area)
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(MD_AppData.PerfHistPkt.TelemetryHeader), CFE_SB_ValueToMsgId(MD_PERF_HIST_TLM_MID),
+                 sizeof(MD_PerfHistPkt_t));
     /*
     ** Initialize dwell packets (clear user data area)
     */
@@ -204,6 +333,18 @@ CFE_Status_t MD_InitSoftwareBusServices(void)
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
         MD_AppData.MD_DwellPkt[TblIndex].Payload.Signature[0] = '\0';
 #endif
+
+        CFE_MSG_Init(CFE_MSG_PTR(MD_AppData.MD_DwellBatchPkt[TblIndex].TelemetryHeader),
+                     CFE_SB_ValueToMsgId(MD_DWELL_BATCH_PKT_MID_BASE + TblIndex),
+                     sizeof(MD_DwellBatchPkt_t)); /* this is max pkt size */
+
+        CFE_MSG_Init(CFE_MSG_PTR(MD_AppData.MD_DwellEncPkt[TblIndex].TelemetryHeader),
+                     CFE_SB_ValueToMsgId(MD_DWELL_ENC_PKT_MID_BASE + TblIndex),
+                     sizeof(MD_DwellEncPkt_t)); /* this is max pkt size */
+
+        CFE_MSG_Init(CFE_MSG_PTR(MD_AppData.MD_DwellStatsPkt[TblIndex].TelemetryHeader),
+                     CFE_SB_ValueToMsgId(MD_DWELL_STATS_PKT_MID_BASE + TblIndex),
+                     sizeof(MD_DwellStatsPkt_t)); /* this is max pkt size */
     }
 
     /*
@@ -244,6 +385,7 @@ CFE_Status_t MD_InitSoftwareBusServices(void)
         }
     }
 
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 0
     /*
     ** Subscribe to MD wakeup packets
     */
@@ -257,6 +399,7 @@ CFE_Status_t MD_InitSoftwareBusServices(void)
                               "Failed to subscribe to wakeup messages.  RC = %08x", (unsigned int)Status);
         }
     }
+#endif
 
     return Status;
 }
@@ -267,7 +410,7 @@ CFE_Status_t MD_InitTableServices(void)
 {
     CFE_Status_t         Status           = CFE_SUCCESS;
     int32                GetAddressResult = 0;
-    uint8                TblIndex;
+    uint16               TblIndex;
     bool                 RecoveredValidTable = true; /* for current table */
     bool                 TableInitValidFlag  = true; /* for all tables so far*/
     MD_DwellTableLoad_t *MD_LoadTablePtr     = NULL;
@@ -284,6 +427,9 @@ CFE_Status_t MD_InitTableServices(void)
     {
         RecoveredValidTable = false;
 
+        /* Validations of this table, including those done while loading it, compile it here */
+        MD_AppData.CompileTblIndex = TblIndex;
+
         /* Prepare Table Name */
         Status = snprintf(MD_AppData.MD_TableName[TblIndex], sizeof(MD_AppData.MD_TableName[TblIndex]), "%s%d",
                           MD_DWELL_TABLE_BASENAME, TblIndex + 1);
@@ -314,10 +460,25 @@ CFE_Status_t MD_InitTableServices(void)
             continue;
         }
 
-        /* Register Dwell Table #tblnum */
+        /* MD_InitControlStructures left the table empty if its entries couldn't be taken from the pools */
+        if (MD_AppData.MD_DwellTables[TblIndex].Capacity == 0)
+        {
+            CFE_EVS_SendEvent(MD_DWELL_TBL_CAPACITY_CRIT_EID, CFE_EVS_EventType_CRITICAL,
+                              "Dwell Table %u capacity %u is not 1..%d or exceeds the %d entry pool",
+                              (unsigned int)TblIndex + 1, (unsigned int)MD_INTERNAL_DWELL_TABLE_CAPACITY(TblIndex),
+                              MD_INTERFACE_DWELL_TABLE_SIZE, MD_INTERNAL_DWELL_ENTRY_POOL_SIZE);
+
+            Status             = MD_ERROR;
+            TableInitValidFlag = false;
+
+            /* Advance to the next index */
+            continue;
+        }
+
+        /* Register Dwell Table #tblnum, only as large as its capacity */
         Status = CFE_TBL_Register(&MD_AppData.MD_TableHandle[TblIndex], /* Table Handle (to be returned) */
                                   MD_AppData.MD_TableName[TblIndex],    /*   Table Name */
-                                  sizeof(MD_DwellTableLoad_t),          /* Size of Table being Registered */
+                                  MD_DWELL_TABLE_LOAD_SIZE(MD_AppData.MD_DwellTables[TblIndex].Capacity),
                                   CFE_TBL_OPT_DEFAULT | CFE_TBL_OPT_CRITICAL,
                                   &MD_TableValidationFunc); /* Ptr to table validation function */
 
@@ -370,7 +531,8 @@ CFE_Status_t MD_InitTableServices(void)
         {
             CFE_EVS_SendEvent(MD_DWELL_TBL_TOO_LARGE_CRIT_EID, CFE_EVS_EventType_CRITICAL,
                               "Dwell Table(s) are too large to register: %u bytes, %d entries",
-                              (unsigned int)sizeof(MD_DwellTableLoad_t), MD_INTERFACE_DWELL_TABLE_SIZE);
+                              (unsigned int)MD_DWELL_TABLE_LOAD_SIZE(MD_AppData.MD_DwellTables[TblIndex].Capacity),
+                              MD_AppData.MD_DwellTables[TblIndex].Capacity);
             TableInitValidFlag = false;
         }
 
@@ -387,6 +549,23 @@ CFE_Status_t MD_InitTableServices(void)
             TableInitValidFlag = true;
         }
 
+        /*
+        ** Have Table Services tell MD when this table needs managing
+        */
+        if (TableInitValidFlag == true)
+        {
+            Status = CFE_TBL_NotifyByMessage(MD_AppData.MD_TableHandle[TblIndex], CFE_SB_ValueToMsgId(MD_CMD_MID),
+                                             MD_TBL_MANAGE_CC, TblIndex);
+
+            if (Status != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(MD_TBL_NOTIFY_CRIT_EID, CFE_EVS_EventType_CRITICAL,
+                                  "CFE_TBL_NotifyByMessage error %08x received for tbl#%u", (unsigned int)Status,
+                                  (unsigned int)TblIndex + 1);
+                TableInitValidFlag = false;
+            }
+        }
+
         /*
         ** Load initial values if needed
         */
@@ -418,6 +597,9 @@ CFE_Status_t MD_InitTableServices(void)
 
     } /* end for loop */
 
+    /* Validations outside of MD_ManageDwellTable have no table to compile */
+    MD_AppData.CompileTblIndex = MD_INTERFACE_NUM_DWELL_TABLES;
+
     /* Output init and recovery event message */
     CFE_EVS_SendEvent(MD_TBL_INIT_INF_EID, CFE_EVS_EventType_INFORMATION,
                       "Dwell Tables Recovered: %u, Dwell Tables Initialized: %u", TblRecos, TblInits);
@@ -433,12 +615,13 @@ CFE_Status_t MD_InitTableServices(void)
 }
 
 /******************************************************************************/
-CFE_Status_t MD_ManageDwellTable(uint8 TblIndex)
+CFE_Status_t MD_ManageDwellTable(uint16 TblIndex)
 {
-    CFE_Status_t         Status           = CFE_SUCCESS;
-    int32                GetAddressResult = 0;
-    bool                 FinishedManaging = false;
-    MD_DwellTableLoad_t *MD_LoadTablePtr  = 0;
+    CFE_Status_t Status           = CFE_SUCCESS;
+    bool         FinishedManaging = false;
+    OS_time_t    StartTime;
+
+    MD_PerfBegin(MD_Perf_Phases_TBL_MANAGE, &StartTime);
 
     while (!FinishedManaging)
     {
@@ -447,9 +630,13 @@ CFE_Status_t MD_ManageDwellTable(uint8 TblIndex)
 
         if (Status == CFE_TBL_INFO_VALIDATION_PENDING)
         {
-            /* Validate the specified Table */
+            /* Validate the specified Table, compiling it for the update that follows */
+            MD_AppData.CompileTblIndex = TblIndex;
+
             Status = CFE_TBL_Validate(MD_AppData.MD_TableHandle[TblIndex]);
 
+            MD_AppData.CompileTblIndex = MD_INTERFACE_NUM_DWELL_TABLES;
+
             if (Status != CFE_SUCCESS)
             {
                 /* If an error occurred during Validate, */
@@ -459,32 +646,12 @@ CFE_Status_t MD_ManageDwellTable(uint8 TblIndex)
         }
         else if (Status == CFE_TBL_INFO_UPDATE_PENDING)
         {
-            Status = CFE_TBL_Update(MD_AppData.MD_TableHandle[TblIndex]);
-
-            /* If table was updated, copy contents to local structure */
-            if (Status == CFE_SUCCESS)
-            {
-                GetAddressResult = CFE_TBL_GetAddress((void *)&MD_LoadTablePtr, MD_AppData.MD_TableHandle[TblIndex]);
-
-                if (GetAddressResult == CFE_TBL_INFO_UPDATED)
-                {
-                    MD_CopyUpdatedTbl(MD_LoadTablePtr, TblIndex);
-
-                    if (MD_LoadTablePtr->Enabled == MD_Dwell_States_ENABLED)
-                    {
-                        MD_StartDwellStream((uint16)TblIndex);
-                    }
-                }
-                else
-                {
-                    CFE_EVS_SendEvent(MD_NO_TBL_COPY_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Didn't update MD tbl #%d due to unexpected CFE_TBL_GetAddress return: %u",
-                                      (unsigned int)TblIndex + 1, (unsigned int)GetAddressResult);
-                }
-
-                /* Unlock Table */
-                CFE_TBL_ReleaseAddress(MD_AppData.MD_TableHandle[TblIndex]);
-            }
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+            /* The sampler child task swaps the table in between wakeups */
+            Status = MD_QueueTableUpdate(TblIndex);
+#else
+            Status = MD_UpdateDwellTable(TblIndex);
+#endif
 
             /* After an Update, always assume we are done */
             /* and return Update Status */
@@ -504,16 +671,82 @@ CFE_Status_t MD_ManageDwellTable(uint8 TblIndex)
         }
     }
 
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+    /* Ask again later for an update the sampler queue had no room for */
+    MD_AppData.SamplerQueue.UpdateOwed[TblIndex] = (Status == MD_QUEUE_FULL_ERROR);
+#endif
+
+    MD_PerfEnd(MD_Perf_Phases_TBL_MANAGE, &StartTime);
+
+    return Status;
+}
+
+/******************************************************************************/
+void MD_RetryTableUpdates(void)
+{
+    uint16 TblIndex;
+
+    for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+    {
+        if (MD_AppData.SamplerQueue.UpdateOwed[TblIndex])
+        {
+            MD_ManageDwellTable(TblIndex);
+        }
+    }
+}
+
+/******************************************************************************/
+CFE_Status_t MD_UpdateDwellTable(uint16 TblIndex)
+{
+    CFE_Status_t         Status           = CFE_SUCCESS;
+    int32                GetAddressResult = 0;
+    MD_DwellTableLoad_t *MD_LoadTablePtr  = 0;
+    OS_time_t            StartTime;
+
+    MD_PerfBegin(MD_Perf_Phases_TBL_UPDATE, &StartTime);
+
+    Status = CFE_TBL_Update(MD_AppData.MD_TableHandle[TblIndex]);
+
+    /* If table was updated, copy contents to local structure */
+    if (Status == CFE_SUCCESS)
+    {
+        GetAddressResult = CFE_TBL_GetAddress((void *)&MD_LoadTablePtr, MD_AppData.MD_TableHandle[TblIndex]);
+
+        if (GetAddressResult == CFE_TBL_INFO_UPDATED)
+        {
+            MD_CopyUpdatedTbl(MD_LoadTablePtr, TblIndex);
+
+            if (MD_LoadTablePtr->Enabled == MD_Dwell_States_ENABLED)
+            {
+                MD_StartDwellStream((uint16)TblIndex);
+            }
+        }
+        else
+        {
+            CFE_EVS_SendEvent(MD_NO_TBL_COPY_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Didn't update MD tbl #%d due to unexpected CFE_TBL_GetAddress return: %u",
+                              (unsigned int)TblIndex + 1, (unsigned int)GetAddressResult);
+        }
+
+        /* Unlock Table */
+        CFE_TBL_ReleaseAddress(MD_AppData.MD_TableHandle[TblIndex]);
+    }
+
+    MD_PerfEnd(MD_Perf_Phases_TBL_UPDATE, &StartTime);
+
     return Status;
 }
 
 /******************************************************************************/
 CFE_Status_t MD_HkStatus(const MD_SendHkCmd_t *Msg)
 {
-    uint8                    TblIndex;
+    uint16                   TblIndex;
+    uint16                   PageIndex;
+    uint16                   TableCount;
     uint16                   MemDwellEnableBits = 0;
     MD_HkTlm_t *             HkPktPtr           = NULL;
     MD_DwellPacketControl_t *ThisDwellTablePtr  = NULL;
+    MD_DwellCounters_t *     CountersPtr        = NULL;
 
     /* Assign pointer used as shorthand to access Housekeeping Packet fields */
     HkPktPtr = &MD_AppData.HkPkt;
@@ -523,18 +756,56 @@ CFE_Status_t MD_HkStatus(const MD_SendHkCmd_t *Msg)
     HkPktPtr->Payload.ValidCmdCntr   = MD_AppData.CmdCounter;
     HkPktPtr->Payload.InvalidCmdCntr = MD_AppData.ErrCounter;
 
-    for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+    /* Assign values for missed wakeup counters */
+
+    HkPktPtr->Payload.WakeupOverrunCount = MD_AppData.WakeupCounters.OverrunCount;
+    HkPktPtr->Payload.WakeupCatchupCount = MD_AppData.WakeupCounters.CatchupCount;
+    HkPktPtr->Payload.WakeupRephaseCount = MD_AppData.WakeupCounters.RephaseCount;
+
+    /* Report the next page of tables, the last page may be short */
+    TableCount = MD_INTERFACE_NUM_DWELL_TABLES - MD_AppData.HkPageTblIndex;
+    if (TableCount > MD_INTERFACE_HK_TABLES_PER_PAGE)
     {
+        TableCount = MD_INTERFACE_HK_TABLES_PER_PAGE;
+    }
+
+    HkPktPtr->Payload.FirstTableId = MD_AppData.HkPageTblIndex + 1;
+    HkPktPtr->Payload.TableCount   = TableCount;
+
+    for (PageIndex = 0; PageIndex < MD_INTERFACE_HK_TABLES_PER_PAGE; PageIndex++)
+    {
+        if (PageIndex >= TableCount)
+        {
+            HkPktPtr->Payload.DwellTblAddrCount[PageIndex] = 0;
+            HkPktPtr->Payload.NumWaitsPerPkt[PageIndex]    = 0;
+            HkPktPtr->Payload.DwellPktOffset[PageIndex]    = 0;
+            HkPktPtr->Payload.ByteCount[PageIndex]         = 0;
+            HkPktPtr->Payload.DwellTblEntry[PageIndex]     = 0;
+            HkPktPtr->Payload.Countdown[PageIndex]         = 0;
+            HkPktPtr->Payload.FailingEntryCount[PageIndex] = 0;
+            HkPktPtr->Payload.QuarantinedCount[PageIndex]  = 0;
+
+            HkPktPtr->Payload.SampleCount[PageIndex]        = 0;
+            HkPktPtr->Payload.ReadErrCount[PageIndex]       = 0;
+            HkPktPtr->Payload.PktSentCount[PageIndex]       = 0;
+            HkPktPtr->Payload.PktSuppressedCount[PageIndex] = 0;
+            HkPktPtr->Payload.CycleOverrunCount[PageIndex]  = 0;
+            HkPktPtr->Payload.MaxSampleTime[PageIndex]      = 0;
+            continue;
+        }
+
+        TblIndex = MD_AppData.HkPageTblIndex + PageIndex;
+
         /*
         **  Prepare the DwellEnabledMask showing which dwell streams are enabled
         */
 
         /*   The dwell enabled bits are set in the following bit pattern:
-         0x0001 = table 1 enabled, 0x0002 = table 2 enabled
-         0x0004 = table 3 enabled, 0x0008 = table 4 enabled,
-         0x0010 = table 5 enabled, etc.
+         0x0001 = first table on the page enabled, 0x0002 = second table enabled
+         0x0004 = third table enabled, 0x0008 = fourth table enabled,
+         0x0010 = fifth table enabled, etc.
         */
-        MemDwellEnableBits |= (MD_AppData.MD_DwellTables[TblIndex].Enabled << (TblIndex));
+        MemDwellEnableBits |= (MD_AppData.MD_DwellTables[TblIndex].Enabled << (PageIndex));
 
         /* Assign pointer used as shorthand to access current dwell tbl data */
         ThisDwellTablePtr = &MD_AppData.MD_DwellTables[TblIndex];
@@ -542,16 +813,47 @@ CFE_Status_t MD_HkStatus(const MD_SendHkCmd_t *Msg)
         /*
         **  Insert current values for each dwell stream
         */
-        HkPktPtr->Payload.DwellTblAddrCount[TblIndex] = ThisDwellTablePtr->AddrCount;
-        HkPktPtr->Payload.NumWaitsPerPkt[TblIndex]    = ThisDwellTablePtr->Rate;
-        HkPktPtr->Payload.DwellPktOffset[TblIndex]    = ThisDwellTablePtr->PktOffset;
-        HkPktPtr->Payload.ByteCount[TblIndex]         = ThisDwellTablePtr->DataSize;
-        HkPktPtr->Payload.DwellTblEntry[TblIndex]     = ThisDwellTablePtr->CurrentEntry;
-        HkPktPtr->Payload.Countdown[TblIndex]         = ThisDwellTablePtr->Countdown;
+        HkPktPtr->Payload.DwellTblAddrCount[PageIndex] = ThisDwellTablePtr->AddrCount;
+        HkPktPtr->Payload.NumWaitsPerPkt[PageIndex]    = ThisDwellTablePtr->Rate;
+        HkPktPtr->Payload.DwellPktOffset[PageIndex]    = ThisDwellTablePtr->PktOffset;
+        HkPktPtr->Payload.ByteCount[PageIndex]         = ThisDwellTablePtr->DataSize;
+        HkPktPtr->Payload.DwellTblEntry[PageIndex]     = ThisDwellTablePtr->CurrentEntry;
+
+        /* Report remaining wakeups for scheduled tables, last reload value otherwise */
+        if (MD_AppData.DwellSchedule.HeapSlot[TblIndex] != 0)
+        {
+            HkPktPtr->Payload.Countdown[PageIndex] =
+                MD_AppData.DwellSchedule.DueCount[TblIndex] - MD_AppData.DwellSchedule.WakeupCount;
+        }
+        else
+        {
+            HkPktPtr->Payload.Countdown[PageIndex] = ThisDwellTablePtr->Countdown;
+        }
+
+        /* Entries sent as zeros until they are retried, and those still failing */
+        HkPktPtr->Payload.FailingEntryCount[PageIndex] = ThisDwellTablePtr->FailingEntries;
+        HkPktPtr->Payload.QuarantinedCount[PageIndex]  = MD_AppData.DwellReportControl[TblIndex].QuarantinedEntries;
+
+        /* Report the work done for each dwell stream */
+        CountersPtr = &MD_AppData.DwellCounters[TblIndex];
+
+        HkPktPtr->Payload.SampleCount[PageIndex]        = CountersPtr->SampleCount;
+        HkPktPtr->Payload.ReadErrCount[PageIndex]       = CountersPtr->ReadErrCount;
+        HkPktPtr->Payload.PktSentCount[PageIndex]       = CountersPtr->PktSentCount;
+        HkPktPtr->Payload.PktSuppressedCount[PageIndex] = CountersPtr->PktSuppressedCount;
+        HkPktPtr->Payload.CycleOverrunCount[PageIndex]  = CountersPtr->CycleOverrunCount;
+        HkPktPtr->Payload.MaxSampleTime[PageIndex]      = CountersPtr->MaxSampleTime;
     }
 
     HkPktPtr->Payload.DwellEnabledMask = MemDwellEnableBits;
 
+    /* Move on to the next page, back to table 1 after the last */
+    MD_AppData.HkPageTblIndex += TableCount;
+    if (MD_AppData.HkPageTblIndex >= MD_INTERFACE_NUM_DWELL_TABLES)
+    {
+        MD_AppData.HkPageTblIndex = 0;
+    }
+
     /*
     ** Send housekeeping telemetry packet...
     */
@@ -31,7 +31,9 @@
 #include "cfe_mission_cfg.h"
 #include "md_msgids.h"
 #include "md_interface_cfg.h"
+#include "md_internal_cfg.h"
 #include "md_msgstruct.h"
+#include "md_tbldefs.h"
 #include "md_dispatch.h"
 
 /************************************************************************
@@ -44,16 +46,57 @@
  * \name Function Return Codes for Table Validation function and related routines
  * \{
  */
-#define MD_ERROR               (-1)         /**< \brief Generic error value */
-#define MD_TBL_ENA_FLAG_ERROR  (0xc0000001) /**< \brief Enable flag in table load is invalid */
-#define MD_ZERO_RATE_TBL_ERROR (0xc0000002) /**< \brief Table zero for total delay, at least one dwell specified */
-#define MD_RESOLVE_ERROR       (0xc0000003) /**< \brief Symbolic address couldn't be resolved */
-#define MD_INVALID_ADDR_ERROR  (0xc0000004) /**< \brief Invalid address found */
-#define MD_INVALID_LEN_ERROR   (0xc0000005) /**< \brief Invalid dwell length found */
-#define MD_NOT_ALIGNED_ERROR   (0xc0000006) /**< \brief Dwell address improperly aligned for specified dwell length */
-#define MD_SIG_LEN_TBL_ERROR   (0xc0000007) /**< \brief Signature not null terminated in table */
+#define MD_ERROR                (-1)         /**< \brief Generic error value */
+#define MD_TBL_ENA_FLAG_ERROR   (0xc0000001) /**< \brief Enable flag in table load is invalid */
+#define MD_ZERO_RATE_TBL_ERROR  (0xc0000002) /**< \brief Table zero for total delay, at least one dwell specified */
+#define MD_RESOLVE_ERROR        (0xc0000003) /**< \brief Symbolic address couldn't be resolved */
+#define MD_INVALID_ADDR_ERROR   (0xc0000004) /**< \brief Invalid address found */
+#define MD_INVALID_LEN_ERROR    (0xc0000005) /**< \brief Invalid dwell length found */
+#define MD_NOT_ALIGNED_ERROR    (0xc0000006) /**< \brief Dwell address improperly aligned for specified dwell length */
+#define MD_SIG_LEN_TBL_ERROR    (0xc0000007) /**< \brief Signature not null terminated in table */
+#define MD_DATA_SIZE_TBL_ERROR  (0xc0000008) /**< \brief Dwell data too large for dwell packet */
+#define MD_BATCH_SIZE_TBL_ERROR (0xc0000009) /**< \brief Batched cycles too large for batched dwell packet */
+#define MD_DECODE_ERROR         (0xc000000A) /**< \brief Encoded dwell data doesn't decode to the expected size */
+#define MD_PHASE_TBL_ERROR      (0xc000000B) /**< \brief Cycle deadline phase not less than the period */
+#define MD_SNAPSHOT_GROUP_ERROR (0xc000000C) /**< \brief Entry assigned to a snapshot group that doesn't exist */
+#define MD_QUEUE_FULL_ERROR     (0xc000000D) /**< \brief Sampler queue has no room for a table update */
 /** \} */
 
+/**
+ * \brief Shortest dwell length sampled as a block dwell
+ *
+ * \par Description
+ *      Dwell lengths from this value up to #MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH
+ *      are copied into the dwell packet in a single operation.
+ */
+#define MD_MIN_BLOCK_DWELL_LENGTH 8
+
+/**
+ * \brief Bytes ahead of each cycle's dwell data in a batched dwell packet
+ *
+ * \par Description
+ *      Each cycle in a batched dwell packet starts with a uint16 time offset.
+ */
+#define MD_BATCH_CYCLE_HDR_SIZE 2
+
+/**
+ * \name Capture states
+ * \{
+ */
+#define MD_CAPTURE_IDLE      0 /**< \brief No capture is armed */
+#define MD_CAPTURE_ARMED     1 /**< \brief Recording cycles and waiting for the trigger */
+#define MD_CAPTURE_TRIGGERED 2 /**< \brief Trigger fired, recording the post-trigger cycles */
+#define MD_CAPTURE_COMPLETE  3 /**< \brief Recording done, waiting for the main task to write the file */
+/** \} */
+
+/**
+ * \brief Bytes ahead of each cycle's dwell data in a capture record
+ *
+ * \par Description
+ *      Each captured cycle starts with the uint32 wakeup count it completed on.
+ */
+#define MD_CAPTURE_RECORD_HDR_SIZE 4
+
 /**
  * \brief Wakeup for MD
  *
@@ -69,48 +112,499 @@
 
 /**
  *  \brief MD structure for specifying individual memory dwell
+ *
+ *  \par Description
+ *       Holds only what sampling needs on every wakeup, so entries pack
+ *       without padding.  The deadband of each entry, only needed when a
+ *       cycle is reported, is kept in a parallel array.
  */
 typedef struct
 {
+    cpuaddr ResolvedAddress; /**< \brief Dwell address in numerical form */
     uint16  Length;          /**< \brief Length of dwell field in bytes, 0 indicates null entry. */
     uint16  Delay;           /**< \brief Delay before following dwell sample in terms of number of task wakeup calls */
-    cpuaddr ResolvedAddress; /**< \brief Dwell address in numerical form */
+    uint16  BlockEntries;    /**< \brief Number of entries read together starting with this one, per sampling plan */
+    uint16  BlockBytes;      /**< \brief Number of bytes read together starting with this entry, per sampling plan */
 } MD_DwellControlEntry_t;
 
+/**
+ *  \brief MD structure for accumulating statistics on a dwell entry
+ *
+ *  \par Description
+ *       Sums are taken relative to the first value in the window so the
+ *       variance doesn't lose precision when it is small next to the mean.
+ *       Values are kept sign-extended for signed entries, so a signed and
+ *       an unsigned 32 bit value both fit.
+ */
+typedef struct
+{
+    int64  Min;     /**< \brief Smallest value in the window */
+    int64  Max;     /**< \brief Largest value in the window */
+    int64  Base;    /**< \brief First value in the window */
+    double Sum;     /**< \brief Sum of differences from Base */
+    double SumSq;   /**< \brief Sum of squared differences from Base */
+    uint32 Samples; /**< \brief Number of cycles in the window the entry was read in */
+    uint32 Spare;   /**< \brief Preserves alignment */
+} MD_DwellStatsEntry_t;
+
+/**
+ *  \brief MD structure tracking the read errors of a dwell entry
+ *
+ *  \par Description
+ *       ErrCount counts every failed read since the table was last
+ *       updated, so an entry that keeps failing, even on and off, is only
+ *       reported each time it doubles.  FailRun counts the failures since
+ *       the last successful read and decides when the entry is quarantined.
+ */
+typedef struct
+{
+    uint32 ErrCount;       /**< \brief Failed reads since the table was updated */
+    uint32 NextEventCount; /**< \brief ErrCount at which the next failure is reported in an event */
+    uint32 FailRun;        /**< \brief Failed reads since the last successful read */
+    bool   Quarantined;    /**< \brief Whether the entry is left out of reads until the next retry */
+} MD_DwellReadErrEntry_t;
+
 /**
  *  \brief MD structure for controlling dwell operations
+ *
+ *  \par Description
+ *       Holds the state of a dwell table that is used on every wakeup the
+ *       table is due, in 64 bytes on 64-bit targets.  State only needed
+ *       when a cycle is reported is in #MD_DwellReportControl_t.
  */
 typedef struct
 {
     uint16 Enabled;      /**< \brief Dwell enabled: MD_Dwell_States_DISABLED or MD_Dwell_States_ENABLED */
     uint16 AddrCount;    /**< \brief Number of dwell addresses to telemeter  */
-    uint32 Rate;         /**< \brief Packet issuance interval in terms of number of task wakeup calls */
-    uint32 Countdown;    /**< \brief Counts down from Rate to 0, then read next address */
     uint16 PktOffset;    /**< \brief Tracks where to write next data in dwell pkt */
     uint16 CurrentEntry; /**< \brief Current entry in dwell table */
-    uint16 DataSize;     /**< \brief Total number of data bytes specified in dwell table */
-    uint16 Filler;       /**< \brief Preserves alignment */
+    uint32 Rate;         /**< \brief Packet issuance interval in terms of number of task wakeup calls */
+    uint32 Countdown;    /**< \brief Wakeup calls to wait before reading next address, as of last (re)schedule */
+
+    MD_DwellPkt_t *         PktBuf; /**< \brief Dwell packet being filled, NULL until the next packet is started */
+    MD_DwellControlEntry_t *Entry;  /**< \brief Individual memory dwell specifications, from the dwell entry pool */
+
+    uint16 DataSize;       /**< \brief Total number of data bytes specified in dwell table */
+    uint16 Capacity;       /**< \brief Number of entries in the table, 0 if it has none */
+    uint16 BatchFactor;    /**< \brief Cycles per batched dwell packet, 0 or 1 if not batching */
+    uint16 BatchCycles;    /**< \brief Number of cycles in the batched dwell packet */
+    uint16 BatchOffset;    /**< \brief Tracks where to write next cycle in batched dwell pkt */
+    uint16 FailingEntries; /**< \brief Number of entries whose last read failed, including quarantined ones */
+
+    uint32 BatchStartWakeup; /**< \brief Wakeup count at which the first batched cycle completed */
+
+    uint16 HeartbeatInterval;  /**< \brief Cycles between forced reports, 0 to report every cycle */
+    uint16 HeartbeatCountdown; /**< \brief Unchanged cycles left before a report is forced, 0 to report next cycle */
+    uint16 KeyframeInterval;   /**< \brief Encoded packets per keyframe, 0 to send dwell packets unencoded */
+    uint16 KeyframeCountdown;  /**< \brief Encoded packets left before the next keyframe, 0 to send one next */
+    uint16 StatsWindow;        /**< \brief Cycles per statistics packet, 0 to send the cycles themselves */
+    uint16 StatsCycles;        /**< \brief Number of cycles in the statistics accumulated so far */
+} MD_DwellPacketControl_t;
+
+/**
+ *  \brief MD structure for reporting dwell cycles
+ *
+ *  \par Description
+ *       Holds the state of a dwell table that is only used when a completed
+ *       cycle is reported or the dwell packet template is rebuilt, apart
+ *       from the #MD_DwellPacketControl_t used on every wakeup.
+ */
+typedef struct
+{
+    uint32 *                Deadband;           /**< \brief Deadband of each entry, parallel to the control entries */
+    uint16 *                Group;              /**< \brief Snapshot group of each entry, 0 if none, parallel to the
+                                                     control entries */
+    uint16 *                Signed;             /**< \brief Whether each entry holds a signed integer, parallel to the
+                                                     control entries */
+    MD_DwellStatsEntry_t *  Stats;              /**< \brief Statistics of each entry over the window, from the
+                                                     statistics pool */
+    MD_DwellReadErrEntry_t *ReadErr;            /**< \brief Read errors of each entry, from the read error pool */
+    uint16                  QuarantinedEntries; /**< \brief Number of entries left out of reads until the next retry */
+    uint32                  CycleDueWakeup;     /**< \brief Wakeup count the next cycle should complete by, 0 if
+                                                     unknown */
 
-    MD_DwellControlEntry_t Entry[MD_INTERFACE_DWELL_TABLE_SIZE]; /**< \brief Array of individual memory dwell specifications */
+    uint8 LastReported[MD_INTERFACE_DWELL_PKT_DATA_SIZE]; /**< \brief Dwell data of the last reported cycle */
+    uint8 EncodeRef[MD_INTERFACE_DWELL_PKT_DATA_SIZE];    /**< \brief Dwell data of the last encoded cycle */
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     char Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH]; /**< \brief Signature string used for dwell table to dwell pkt */
 #endif
-} MD_DwellPacketControl_t;
+} MD_DwellReportControl_t;
+
+/**
+ *  \brief MD structure counting the work done for a dwell table
+ *
+ *  \par Description
+ *       Reported in housekeeping, and cleared by the Reset Counters command.
+ */
+typedef struct
+{
+    uint32 SampleCount;        /**< \brief Number of dwell entries read */
+    uint32 ReadErrCount;       /**< \brief Number of dwell entries that could not be read */
+    uint32 PktSentCount;       /**< \brief Number of dwell, batched, encoded and statistics packets sent */
+    uint32 PktSuppressedCount; /**< \brief Number of cycles not reported because nothing moved past its deadband */
+    uint32 CycleOverrunCount;  /**< \brief Number of cycles that completed more wakeups after the last than the rate */
+    uint32 MaxSampleTime;      /**< \brief Longest time spent reading the table on one wakeup, in microseconds */
+} MD_DwellCounters_t;
+
+/**
+ *  \brief MD counters of wakeup messages that never arrived
+ *
+ *  \par Description
+ *       Reported in housekeeping, and cleared by the Reset Counters command.
+ */
+typedef struct
+{
+    uint32 OverrunCount;     /**< \brief Number of gaps in the wakeup messages' sequence counts */
+    uint32 CatchupCount;     /**< \brief Number of missed wakeups made up for by processing them late */
+    uint32 RephaseCount;     /**< \brief Number of gaps too long to make up for, which shifted every schedule */
+    uint32 NextRephaseEvent; /**< \brief Value of RephaseCount at which the next rephase event is sent */
+} MD_WakeupCounters_t;
+
+/**
+ *  \brief MD structure for summarizing dwell read errors
+ *
+ *  \par Description
+ *       Failed reads that weren't reported in an event of their own are
+ *       counted until the next summary, #MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL
+ *       wakeups apart.
+ */
+typedef struct
+{
+    uint32 Countdown;       /**< \brief Wakeups left before the next summary */
+    uint32 UnreportedCount; /**< \brief Failed reads not reported in an event since the last summary */
+} MD_ReadErrSummary_t;
+
+/**
+ *  \brief MD structure holding a dwell table compiled by validation
+ *
+ *  \par Description
+ *       Validation checks, resolves and plans the entries of a dwell table
+ *       load in a single pass and leaves the result here, so the table
+ *       update only has to copy it into the control structure.  Image
+ *       and SymCacheGeneration identify the load entries and the symbol
+ *       cache contents it was compiled from.
+ *
+ *       Only the main task writes the compiled table.  Sequence is odd
+ *       while it does, so the sampler child task, which copies the table
+ *       without a lock, installs the copy only if Sequence was even and
+ *       unchanged from before the copy to after it.
+ */
+typedef struct
+{
+    volatile uint32 Sequence;           /**< \brief Odd while validation writes the table, changed by each write */
+    bool            Ready;              /**< \brief Whether the entries hold a table that passed validation */
+    uint16          AddrCount;          /**< \brief Number of dwell addresses to telemeter */
+    uint16          DataSize;           /**< \brief Total number of data bytes specified in dwell table */
+    uint16          Spare;              /**< \brief Preserves alignment */
+    uint32          Rate;               /**< \brief Packet issuance interval in terms of number of task wakeup calls */
+    uint32          SymCacheGeneration; /**< \brief Symbol cache generation the addresses were resolved in */
+
+    uint16                  Capacity; /**< \brief Number of entries in the table, 0 if it has none */
+    MD_DwellControlEntry_t *Entry;    /**< \brief Compiled dwell entries, from the compiled entry pool */
+    uint32 *                Deadband; /**< \brief Compiled deadband of each entry, from the compiled deadband pool */
+    uint16 *                Group;    /**< \brief Compiled snapshot group of each entry, from the compiled group pool */
+    uint16 *                Signed;   /**< \brief Compiled signedness of each entry, from the compiled signed pool */
+    MD_TableLoadEntry_t *   Image;    /**< \brief Load entries that were compiled, from the compiled image pool */
+} MD_CompiledDwellTable_t;
+
+/**
+ *  \brief MD structure for scheduling dwell table processing
+ *
+ *  \par Description
+ *       Tables that are enabled and have a non-zero rate are kept in a
+ *       binary min-heap keyed on the wakeup count at which each table next
+ *       needs to be serviced.  Each wakeup therefore only visits the tables
+ *       that are due, rather than every table.
+ */
+typedef struct
+{
+    uint32 WakeupCount;   /**< \brief Number of wakeup calls processed, used as the schedule time base */
+    uint16 NumScheduled;  /**< \brief Number of tables currently in the heap */
+    uint16 LastSeqCount;  /**< \brief Sequence count of the last wakeup message, if LastSeqValid */
+    bool   LastSeqValid;  /**< \brief Whether a wakeup message has been received */
+
+    uint16 Heap[MD_INTERFACE_NUM_DWELL_TABLES];     /**< \brief Table indices ordered as a min-heap on due count */
+    uint16 HeapSlot[MD_INTERFACE_NUM_DWELL_TABLES]; /**< \brief Heap position + 1 of each table, 0 if not scheduled */
+    uint32 DueCount[MD_INTERFACE_NUM_DWELL_TABLES]; /**< \brief Wakeup count at which each table is next due */
+} MD_DwellSchedule_t;
+
+/**
+ *  \brief MD structure for scheduling dwell tables against absolute time
+ *
+ *  \par Description
+ *       Tables with a non-zero PeriodMsec are read a whole cycle at a time
+ *       on deadlines of CFE_TIME, rather than being kept in the wakeup
+ *       schedule.  Times are in microseconds of CFE_TIME.  NextDeadline
+ *       lets a wakeup with nothing due skip looking at every table.
+ */
+typedef struct
+{
+    uint64 NextDeadline; /**< \brief Earliest deadline of any table, 0 if no table is waiting on one */
+
+    uint32 PeriodMsec[MD_INTERFACE_NUM_DWELL_TABLES]; /**< \brief Milliseconds between deadlines, 0 if not timed */
+    uint32 PhaseMsec[MD_INTERFACE_NUM_DWELL_TABLES];  /**< \brief Milliseconds each deadline falls past a period */
+    uint64 Deadline[MD_INTERFACE_NUM_DWELL_TABLES];   /**< \brief Next deadline of each table, 0 if not waiting */
+    uint64 CycleTime[MD_INTERFACE_NUM_DWELL_TABLES];  /**< \brief Deadline of the last cycle read, for time stamps */
+} MD_DwellDeadlines_t;
+
+/**
+ *  \brief MD structure for a dwell entry read with its snapshot group
+ *
+ *  \par Description
+ *       Data holds the entry's value from the last pass over its group.
+ *       Fresh is set by each pass and cleared once the value is copied to
+ *       the entry's dwell packet, so an entry reached again before the
+ *       next pass starts one.
+ */
+typedef struct
+{
+    cpuaddr ResolvedAddress; /**< \brief Dwell address in numerical form */
+    int32   Status;          /**< \brief Result of reading the entry on the last pass */
+    uint16  Length;          /**< \brief Length of dwell field in bytes */
+    uint16  Group;           /**< \brief Snapshot group the entry is a member of */
+    uint16  TableIndex;      /**< \brief Dwell table of the entry */
+    uint16  EntryIndex;      /**< \brief Entry in its dwell table */
+    bool    Fresh;           /**< \brief Whether Data is from a pass the entry hasn't reported yet */
+
+    uint32 Data[(MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH + 3) / 4]; /**< \brief Value read on the last pass */
+} MD_SnapshotMember_t;
+
+/**
+ *  \brief MD structure holding the members of every snapshot group
+ *
+ *  \par Description
+ *       Members are kept together by group, in table and entry order, so
+ *       a pass over a group reads its members back to back.  Group g is
+ *       Member[FirstMember[g - 1]] through the MemberCount[g - 1] members
+ *       after it.
+ */
+typedef struct
+{
+    uint16 NumMembers;                                    /**< \brief Number of members in all groups */
+    uint16 FirstMember[MD_INTERNAL_NUM_SNAPSHOT_GROUPS];  /**< \brief Index of the first member of each group */
+    uint16 MemberCount[MD_INTERNAL_NUM_SNAPSHOT_GROUPS];  /**< \brief Number of members of each group */
+
+    MD_SnapshotMember_t Member[MD_INTERNAL_SNAPSHOT_MAX_MEMBERS]; /**< \brief Members of all groups */
+} MD_SnapshotGroups_t;
+
+/**
+ *  \brief MD structure for controlling a triggered capture
+ *
+ *  \par Description
+ *       Records are kept in Buffer as a ring of MaxRecords slots of
+ *       RecordSize bytes.  While armed, only the newest PreTrigger + 1
+ *       records are kept, so the PostTrigger records after the trigger
+ *       never overwrite the history leading up to it.
+ *
+ *       The task that samples the table records the cycles.  Once the
+ *       capture is complete the ring is left alone until the main task
+ *       has written it to the capture file and set State back to
+ *       #MD_CAPTURE_IDLE.
+ */
+typedef struct
+{
+    volatile uint16 State;         /**< \brief One of the capture states, see #MD_CAPTURE_IDLE */
+    uint16          TableIndex;    /**< \brief Dwell table being captured */
+    uint16          EntryIndex;    /**< \brief Watched dwell entry */
+    uint16          EntryOffset;   /**< \brief Offset of the watched entry in the dwell data */
+    uint16          EntryLength;   /**< \brief Length of the watched entry in bytes */
+    uint8           Condition;     /**< \brief Trigger condition, see #MD_Capture_Conditions */
+    uint8           HaveLast;      /**< \brief Non-zero once LastValue holds a cycle's value */
+    uint16          PreTrigger;    /**< \brief Records to keep from before the trigger */
+    uint16          PostTrigger;   /**< \brief Records to take after the trigger */
+    uint16          PostRemaining; /**< \brief Post-trigger records still to take */
+    uint16          RecordSize;    /**< \brief Wakeup count plus the table's dwell data size */
+    uint16          MaxRecords;    /**< \brief Slots in the ring, PreTrigger + 1 + PostTrigger */
+    uint16          FirstRecord;   /**< \brief Slot of the oldest record */
+    uint16          NumRecords;    /**< \brief Number of records in the ring */
+    uint16          TriggerRecord; /**< \brief Records ahead of the trigger record, oldest first */
+    uint32          TriggerValue;  /**< \brief Value the trigger condition compares against */
+    uint32          Mask;          /**< \brief Mask applied to the watched entry before comparing */
+    uint32          LastValue;     /**< \brief Masked value of the watched entry on the previous cycle */
+
+    uint8 Buffer[MD_INTERNAL_CAPTURE_BUFFER_SIZE]; /**< \brief Ring of captured cycles */
+} MD_CaptureControl_t;
+
+/**
+ * \name Sampler request types
+ * \{
+ */
+#define MD_SAMPLER_REQ_MSG        1 /**< \brief Command or housekeeping request to process */
+#define MD_SAMPLER_REQ_TBL_UPDATE 2 /**< \brief Dwell table with an update pending */
+/** \} */
+
+/**
+ *  \brief Largest message the main task hands to the sampler child task
+ */
+typedef union
+{
+    CFE_SB_Buffer_t        Buf;               /**< \brief Software bus buffer view */
+    MD_NoopCmd_t           NoopCmd;           /**< \brief No-op command */
+    MD_ResetCountersCmd_t  ResetCountersCmd;  /**< \brief Reset counters command */
+    MD_StartDwellCmd_t     StartDwellCmd;     /**< \brief Start dwell command */
+    MD_StopDwellCmd_t      StopDwellCmd;      /**< \brief Stop dwell command */
+    MD_JamDwellCmd_t       JamDwellCmd;       /**< \brief Jam dwell command */
+    MD_JamMultiDwellCmd_t  JamMultiDwellCmd;  /**< \brief Jam multiple dwell command */
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+    MD_SetSignatureCmd_t   SetSignatureCmd;   /**< \brief Set signature command */
+#endif
+    MD_SetBatchFactorCmd_t SetBatchFactorCmd; /**< \brief Set batch factor command */
+    MD_ArmCaptureCmd_t     ArmCaptureCmd;     /**< \brief Arm capture command */
+    MD_SendHkCmd_t         SendHkCmd;         /**< \brief Housekeeping request */
+} MD_SamplerMsg_t;
+
+/**
+ *  \brief Request handed from the main task to the sampler child task
+ */
+typedef struct
+{
+    uint16          Type;       /**< \brief MD_SAMPLER_REQ_MSG or MD_SAMPLER_REQ_TBL_UPDATE */
+    uint16          TableIndex; /**< \brief Dwell table of a MD_SAMPLER_REQ_TBL_UPDATE request */
+    MD_SamplerMsg_t Msg;        /**< \brief Copy of the message of a MD_SAMPLER_REQ_MSG request */
+} MD_SamplerRequest_t;
+
+/**
+ *  \brief Single producer, single consumer queue to the sampler child task
+ *
+ *  \par Description
+ *       Only the main task writes WriteCount, UpdateRequests and UpdateOwed,
+ *       and only the sampler child task writes ReadCount and UpdatesDone, so
+ *       no lock is needed.  The counters run freely and the slot of a request
+ *       is its count modulo #MD_INTERNAL_SAMPLER_QUEUE_DEPTH.  A table has an
+ *       update queued while its UpdateRequests and UpdatesDone differ.
+ */
+typedef struct
+{
+    volatile uint32 WriteCount;                                    /**< \brief Requests queued */
+    volatile uint32 ReadCount;                                     /**< \brief Requests processed */
+    volatile uint32 UpdateRequests[MD_INTERFACE_NUM_DWELL_TABLES]; /**< \brief Table updates queued */
+    volatile uint32 UpdatesDone[MD_INTERFACE_NUM_DWELL_TABLES];    /**< \brief Table updates processed */
+    bool            UpdateOwed[MD_INTERFACE_NUM_DWELL_TABLES];     /**< \brief Table updates the queue had no room
+                                                                        for */
+
+    MD_SamplerRequest_t Request[MD_INTERNAL_SAMPLER_QUEUE_DEPTH]; /**< \brief Ring of queued requests */
+} MD_SamplerQueue_t;
+
+/**
+ *  \brief Symbol cache entry
+ *
+ *  \par Description
+ *       A slot whose SymName starts with a NUL is empty.  SymName is
+ *       compared over its full length, so it needn't be NUL terminated.
+ */
+typedef struct
+{
+    uint32  Hash;                              /**< \brief Hash of SymName */
+    cpuaddr Address;                           /**< \brief Address #OS_SymbolLookup returned, without offset */
+    char    SymName[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Symbol name */
+} MD_SymCacheEntry_t;
+
+/**
+ *  \brief Symbol name to address cache
+ *
+ *  \par Description
+ *       Open addressed hash table of symbols found by #OS_SymbolLookup.
+ *       ModuleCount and ModuleIdSum describe the modules loaded when the
+ *       cache was last emptied, so a module load or unload can be noticed.
+ *       Generation counts the times the cache has been emptied.
+ *       The main task and the sampler child task share the cache, so it is
+ *       only used while holding MutexId.
+ */
+typedef struct
+{
+    osal_id_t MutexId;     /**< \brief Mutex serializing use of the cache */
+    uint32    ModuleCount; /**< \brief Number of modules loaded */
+    uint32    ModuleIdSum; /**< \brief Sum of the IDs of the modules loaded */
+    uint32    Generation;  /**< \brief Number of times the cache has been emptied */
+
+    MD_SymCacheEntry_t Entry[MD_INTERNAL_SYM_CACHE_SIZE]; /**< \brief Cached symbols */
+} MD_SymCache_t;
 
 /**
  *  \brief MD global data structure
  */
 typedef struct
 {
-    uint8 CmdCounter; /**< \brief MD Application Command Counter */
-    uint8 ErrCounter; /**< \brief MD Application Error Counter */
+    /*
+     * Read on every wakeup, so kept together at the start, each array on
+     * cache lines of its own.
+     */
+    /** \brief Next-due schedule of dwell tables */
+    MD_DwellSchedule_t DwellSchedule OS_ALIGN(MD_INTERNAL_CACHE_LINE_SIZE);
+
+    /** \brief Absolute-time deadlines of timed dwell tables */
+    MD_DwellDeadlines_t DwellDeadlines OS_ALIGN(MD_INTERNAL_CACHE_LINE_SIZE);
+
+    /** \brief Array of packet control structures */
+    MD_DwellPacketControl_t MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES] OS_ALIGN(MD_INTERNAL_CACHE_LINE_SIZE);
+
+    /** \brief Control entries of all tables */
+    MD_DwellControlEntry_t DwellEntryPool[MD_INTERNAL_DWELL_ENTRY_POOL_SIZE] OS_ALIGN(MD_INTERNAL_CACHE_LINE_SIZE);
+
+    /*
+     * Only used when commands, tables and completed dwell cycles are processed.
+     */
+    uint8 CmdCounter OS_ALIGN(MD_INTERNAL_CACHE_LINE_SIZE); /**< \brief MD Application Command Counter */
+    uint8 ErrCounter;                                       /**< \brief MD Application Error Counter */
+
+    MD_HkTlm_t HkPkt;          /**< \brief Housekeeping telemetry packet */
+    uint16     HkPageTblIndex; /**< \brief Index of the first table the next housekeeping packet reports */
 
-    MD_HkTlm_t HkPkt; /**< \brief Housekeeping telemetry packet */
+    MD_PerfHistPkt_t PerfHistPkt; /**< \brief Performance histograms, kept in their telemetry packet */
 
-    CFE_SB_PipeId_t         CmdPipe;                             /**< \brief Command pipe ID               */
-    MD_DwellPacketControl_t MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES]; /**< \brief Array of packet control structures    */
-    MD_DwellPkt_t           MD_DwellPkt[MD_INTERFACE_NUM_DWELL_TABLES];    /**< \brief Array of dwell packet  structures    */
+    CFE_SB_PipeId_t         CmdPipe;                                           /**< \brief Command pipe ID */
+    CFE_SB_PipeId_t         WakeupPipe;                                        /**< \brief Sampler wakeup pipe ID */
+    CFE_ES_TaskId_t         SamplerTaskId;                                     /**< \brief Sampler child task ID */
+    MD_DwellReportControl_t DwellReportControl[MD_INTERFACE_NUM_DWELL_TABLES]; /**< \brief Array of report control
+                                                                                    structures */
+    MD_DwellCounters_t      DwellCounters[MD_INTERFACE_NUM_DWELL_TABLES];      /**< \brief Array of dwell table
+                                                                                    counters */
+    MD_WakeupCounters_t     WakeupCounters;                                    /**< \brief Counters of missed wakeups */
+    MD_ReadErrSummary_t     ReadErrSummary;                                    /**< \brief Dwell read errors not yet
+                                                                                    reported */
+    MD_DwellPkt_t           MD_DwellPkt[MD_INTERFACE_NUM_DWELL_TABLES];        /**< \brief Array of dwell packet
+                                                                                    templates */
+    MD_DwellBatchPkt_t      MD_DwellBatchPkt[MD_INTERFACE_NUM_DWELL_TABLES];   /**< \brief Array of batched dwell
+                                                                                    packets */
+    MD_DwellEncPkt_t        MD_DwellEncPkt[MD_INTERFACE_NUM_DWELL_TABLES];     /**< \brief Array of encoded dwell
+                                                                                    packets */
+    MD_DwellStatsPkt_t      MD_DwellStatsPkt[MD_INTERFACE_NUM_DWELL_TABLES];   /**< \brief Array of dwell statistics
+                                                                                    packets */
+    MD_CaptureControl_t     Capture;                                           /**< \brief Triggered capture of one
+                                                                                    dwell table */
+    MD_SnapshotGroups_t     SnapshotGroups;                                    /**< \brief Entries read together in
+                                                                                    snapshot groups */
+    MD_SamplerQueue_t       SamplerQueue;                                      /**< \brief Requests for the sampler
+                                                                                    child task */
+    MD_SymCache_t           SymCache;                                          /**< \brief Addresses of symbols already
+                                                                                    looked up */
+    MD_CompiledDwellTable_t CompiledTables[MD_INTERFACE_NUM_DWELL_TABLES];     /**< \brief Tables compiled by
+                                                                                    validation */
+    uint16                  CompileTblIndex;                                   /**< \brief Table being validated,
+                                                                                    #MD_INTERFACE_NUM_DWELL_TABLES if
+                                                                                    none */
+
+    MD_DwellControlEntry_t CompiledEntryPool[MD_INTERNAL_DWELL_ENTRY_POOL_SIZE];    /**< \brief Compiled entries of all
+                                                                                         tables */
+    uint32                 DwellDeadbandPool[MD_INTERNAL_DWELL_ENTRY_POOL_SIZE];    /**< \brief Entry deadbands of all
+                                                                                         tables */
+    uint32                 CompiledDeadbandPool[MD_INTERNAL_DWELL_ENTRY_POOL_SIZE]; /**< \brief Compiled deadbands of
+                                                                                         all tables */
+    uint16                 DwellGroupPool[MD_INTERNAL_DWELL_ENTRY_POOL_SIZE];       /**< \brief Entry snapshot groups of
+                                                                                         all tables */
+    uint16                 CompiledGroupPool[MD_INTERNAL_DWELL_ENTRY_POOL_SIZE];    /**< \brief Compiled snapshot groups
+                                                                                         of all tables */
+    uint16                 DwellSignedPool[MD_INTERNAL_DWELL_ENTRY_POOL_SIZE];      /**< \brief Entry signedness of all
+                                                                                         tables */
+    uint16                 CompiledSignedPool[MD_INTERNAL_DWELL_ENTRY_POOL_SIZE];   /**< \brief Compiled signedness of
+                                                                                         all tables */
+    MD_TableLoadEntry_t    CompiledImagePool[MD_INTERNAL_DWELL_ENTRY_POOL_SIZE];    /**< \brief Compiled load entries of
+                                                                                         all tables */
+    MD_DwellStatsEntry_t   DwellStatsPool[MD_INTERNAL_DWELL_ENTRY_POOL_SIZE];       /**< \brief Entry statistics of all
+                                                                                         tables */
+    MD_DwellReadErrEntry_t DwellReadErrPool[MD_INTERNAL_DWELL_ENTRY_POOL_SIZE];     /**< \brief Entry read errors of all
+                                                                                         tables */
 
     uint32 RunStatus; /**< \brief Application run status         */
 
@@ -124,7 +618,7 @@ typedef struct
  * \name Return values for MD_SearchCmdHndlrTbl routine used to process commands
  * \{
  */
-#define MD_BAD_CMD_CODE (-1) /**< \brief Bad command code */
+#define MD_BAD_CMD_CODE         (-1)         /**< \brief Bad command code */
 /**\}*/
 
 /** \brief Command handler table record */
@@ -177,9 +671,12 @@ CFE_Status_t MD_AppInit(void);
  *
  * \par Description
  *  Initialize control structures for each of the #MD_INTERFACE_NUM_DWELL_TABLES dwell streams.
+ *  Each table gets #MD_INTERNAL_DWELL_TABLE_CAPACITY entries from the dwell entry pools.
  *
  * \par Assumptions, External Events, and Notes:
- *          None
+ *          A table whose capacity is out of range or doesn't fit in what is
+ *          left of the pools is left with a capacity of 0, which
+ *          #MD_InitTableServices reports.
  */
 void MD_InitControlStructures(void);
 
@@ -203,6 +700,7 @@ CFE_Status_t MD_InitSoftwareBusServices(void);
  *
  * \par Description
  *  Register Tables with Table Services.
+ *  Register the table manage command to be sent when a Table needs managing.
  *  Check for Recovered Tables.
  *  IF Recovered Tables Found
  *  THEN
@@ -228,9 +726,47 @@ CFE_Status_t MD_InitTableServices(void);
  * \par Description
  *       Checks status of Tables, and takes action if
  *       validation requests or update requests are pending.
+ *       With #MD_INTERNAL_SAMPLER_CHILD_TASK set, a pending update is
+ *       queued for the sampler child task instead of made here, and the
+ *       table is marked for #MD_RetryTableUpdates if the queue is full.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called for every table at startup and each #MD_SB_TIMEOUT
+ *          without a message, and otherwise only for the table named by
+ *          each #MD_TBL_MANAGE_CC notification or owed an update.
+ *
+ * \param[in] TblIndex   Dwell table identifier.
+ *                       Internal values [0..MD_INTERFACE_NUM_DWELL_TABLES-1] are used.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t MD_ManageDwellTable(uint16 TblIndex);
+
+/**
+ * \brief Retry Table Updates
+ *
+ * \par Description
+ *       Manages again each table whose update couldn't be queued for the
+ *       sampler child task because the sampler queue was full.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called by the main task after each message it receives.  Each
+ *          #MD_SB_TIMEOUT without a message, every table is managed again.
+ */
+void MD_RetryTableUpdates(void);
+
+/**
+ * \brief Update a Dwell Table
+ *
+ * \par Description
+ *       Has Table Services make a validated table load active, then
+ *       copies the table into the dwell control structures and restarts
+ *       its dwell stream if the table enables it.
  *
  * \par Assumptions, External Events, and Notes:
- *          Assumes that an update is pending for the specified table.
+ *          Called by the task that samples dwell tables, since it changes
+ *          the dwell control structures.
  *
  * \param[in] TblIndex   Dwell table identifier.
  *                       Internal values [0..MD_INTERFACE_NUM_DWELL_TABLES-1] are used.
@@ -238,7 +774,7 @@ CFE_Status_t MD_InitTableServices(void);
  *  \return Execution status, see \ref CFEReturnCodes
  *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
  */
-CFE_Status_t MD_ManageDwellTable(uint8 TblIndex);
+CFE_Status_t MD_UpdateDwellTable(uint16 TblIndex);
 
 /**
  * \brief Send Housekeeping Status to Health & Safety task
@@ -248,6 +784,8 @@ CFE_Status_t MD_ManageDwellTable(uint8 TblIndex);
  *          number of dwell addresses, number of counts for packet formation,
  *          data size in bytes, current entry in data processing, current
  *          offset in packet data field, countdown to next data collection.
+ *          Each call reports the next #MD_INTERFACE_HK_TABLES_PER_PAGE
+ *          tables, starting again from table 1 after the last.
  *
  * \par Assumptions, External Events, and Notes:
  *          None
@@ -0,0 +1,327 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to record Memory Dwell cycles around a trigger and write
+ *   them to a capture file.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "md_capture.h"
+#include "md_dwell_pkt.h"
+#include "md_dwell_err.h"
+#include "md_app.h"
+#include "md_eventids.h"
+#include "md_extern_typedefs.h"
+#include "md_internal_cfg.h"
+#include "md_sampler.h"
+#include <string.h>
+#include <stdio.h>
+
+extern MD_AppData_t MD_AppData;
+
+/******************************************************************************/
+
+bool MD_ValidCaptureEntry(uint16 TableIndex, uint16 EntryId)
+{
+    bool                     IsValid = false;
+    uint16                   Length;
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[TableIndex];
+
+    if ((EntryId >= 1) && (EntryId <= TblPtr->AddrCount))
+    {
+        Length = TblPtr->Entry[EntryId - 1].Length;
+
+        if ((Length == 1) || (Length == 2) || (Length == 4))
+        {
+            IsValid = true;
+        }
+    }
+
+    return IsValid;
+}
+
+/******************************************************************************/
+
+bool MD_ValidCaptureSize(uint16 PreTrigger, uint16 PostTrigger, uint16 DataSize)
+{
+    bool   IsValid    = false;
+    uint32 NumRecords = (uint32)PreTrigger + 1 + PostTrigger;
+
+    /* Record positions are kept in 16 bits */
+    if ((NumRecords <= 0xFFFF) &&
+        (NumRecords <= (MD_INTERNAL_CAPTURE_BUFFER_SIZE / (MD_CAPTURE_RECORD_HDR_SIZE + (uint32)DataSize))))
+    {
+        IsValid = true;
+    }
+
+    return IsValid;
+}
+
+/******************************************************************************/
+
+void MD_ArmCapture(const MD_CmdArmCapture_Payload_t *ArmPtr)
+{
+    uint16                   EntryIndex;
+    MD_CaptureControl_t *    CapPtr = &MD_AppData.Capture;
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[ArmPtr->TableId - 1];
+
+    CapPtr->TableIndex  = ArmPtr->TableId - 1;
+    CapPtr->EntryIndex  = ArmPtr->EntryId - 1;
+    CapPtr->EntryLength = TblPtr->Entry[CapPtr->EntryIndex].Length;
+
+    /* The watched entry's data follows that of every entry ahead of it */
+    CapPtr->EntryOffset = 0;
+    for (EntryIndex = 0; EntryIndex < CapPtr->EntryIndex; EntryIndex++)
+    {
+        CapPtr->EntryOffset += TblPtr->Entry[EntryIndex].Length;
+    }
+
+    CapPtr->Condition     = ArmPtr->Condition;
+    CapPtr->TriggerValue  = ArmPtr->Value;
+    CapPtr->Mask          = ArmPtr->Mask;
+    CapPtr->HaveLast      = 0;
+    CapPtr->LastValue     = 0;
+    CapPtr->PreTrigger    = ArmPtr->PreTrigger;
+    CapPtr->PostTrigger   = ArmPtr->PostTrigger;
+    CapPtr->PostRemaining = ArmPtr->PostTrigger;
+    CapPtr->RecordSize    = MD_CAPTURE_RECORD_HDR_SIZE + TblPtr->DataSize;
+    CapPtr->MaxRecords    = ArmPtr->PreTrigger + 1 + ArmPtr->PostTrigger;
+    CapPtr->FirstRecord   = 0;
+    CapPtr->NumRecords    = 0;
+    CapPtr->TriggerRecord = 0;
+
+    CapPtr->State = MD_CAPTURE_ARMED;
+}
+
+/******************************************************************************/
+
+void MD_CaptureDwellCycle(uint16 TableIndex, const uint8 *DataPtr)
+{
+    uint16                   Slot;
+    uint32                   Value;
+    uint8 *                  RecordPtr;
+    MD_CaptureControl_t *    CapPtr = &MD_AppData.Capture;
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[TableIndex];
+
+    /* A cycle cut short by a jam doesn't hold a value for every entry */
+    if (((CapPtr->State == MD_CAPTURE_ARMED) || (CapPtr->State == MD_CAPTURE_TRIGGERED)) &&
+        (CapPtr->TableIndex == TableIndex) && (TblPtr->PktOffset == TblPtr->DataSize))
+    {
+        if ((CapPtr->State == MD_CAPTURE_ARMED) && (CapPtr->NumRecords > CapPtr->PreTrigger))
+        {
+            /* Only the newest PreTrigger cycles are kept ahead of the trigger */
+            CapPtr->FirstRecord = (CapPtr->FirstRecord + 1) % CapPtr->MaxRecords;
+            CapPtr->NumRecords--;
+        }
+
+        Slot      = (CapPtr->FirstRecord + CapPtr->NumRecords) % CapPtr->MaxRecords;
+        RecordPtr = &CapPtr->Buffer[(uint32)Slot * CapPtr->RecordSize];
+
+        memcpy(RecordPtr, &MD_AppData.DwellSchedule.WakeupCount, MD_CAPTURE_RECORD_HDR_SIZE);
+        memcpy(&RecordPtr[MD_CAPTURE_RECORD_HDR_SIZE], DataPtr, TblPtr->DataSize);
+        CapPtr->NumRecords++;
+
+        if (CapPtr->State == MD_CAPTURE_TRIGGERED)
+        {
+            CapPtr->PostRemaining--;
+        }
+        else if (!MD_DwellEntryUnread(TableIndex, CapPtr->EntryIndex))
+        {
+            /* A watched entry with no value this cycle can't trigger */
+            Value = MD_DwellEntryValue(&DataPtr[CapPtr->EntryOffset], CapPtr->EntryLength);
+
+            if (MD_CaptureTriggered(Value))
+            {
+                CapPtr->State         = MD_CAPTURE_TRIGGERED;
+                CapPtr->TriggerRecord = CapPtr->NumRecords - 1;
+
+                CFE_EVS_SendEvent(MD_CAPTURE_TRIGGERED_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Capture triggered on Dwell Tbl#%d Entry #%d value 0x%08X after %d cycles",
+                                  TableIndex + 1, CapPtr->EntryIndex + 1, (unsigned int)Value,
+                                  CapPtr->TriggerRecord);
+            }
+        }
+
+        if ((CapPtr->State == MD_CAPTURE_TRIGGERED) && (CapPtr->PostRemaining == 0))
+        {
+            /* Leave the file to the main task, the ring holds still until it is written */
+            MD_SAMPLER_BARRIER();
+            CapPtr->State = MD_CAPTURE_COMPLETE;
+        }
+    }
+}
+
+/******************************************************************************/
+
+bool MD_CaptureTriggered(uint32 Value)
+{
+    bool                 Triggered = false;
+    MD_CaptureControl_t *CapPtr    = &MD_AppData.Capture;
+    uint32               Masked    = Value & CapPtr->Mask;
+
+    switch (CapPtr->Condition)
+    {
+        case MD_Capture_Conditions_EQUAL:
+            Triggered = (Masked == (CapPtr->TriggerValue & CapPtr->Mask));
+            break;
+
+        case MD_Capture_Conditions_GREATER:
+            Triggered = (Masked > (CapPtr->TriggerValue & CapPtr->Mask));
+            break;
+
+        case MD_Capture_Conditions_BIT_SET:
+            Triggered = (Masked != 0);
+            break;
+
+        case MD_Capture_Conditions_CHANGED:
+            Triggered = ((CapPtr->HaveLast != 0) && (Masked != CapPtr->LastValue));
+            break;
+
+        default:
+            break;
+    }
+
+    CapPtr->LastValue = Masked;
+    CapPtr->HaveLast  = 1;
+
+    return Triggered;
+}
+
+/******************************************************************************/
+
+void MD_WriteCaptureFile(void)
+{
+    int32                OS_Status;
+    int32                WriteStatus = 0;
+    uint16               FirstCount;
+    uint32               FirstBytes;
+    uint32               WrapBytes;
+    osal_id_t            FileId = OS_OBJECT_ID_UNDEFINED;
+    char                 FileName[OS_MAX_PATH_LEN];
+    CFE_FS_Header_t      FileHdr;
+    MD_CaptureFileHdr_t  CaptureHdr;
+    MD_CaptureControl_t *CapPtr = &MD_AppData.Capture;
+
+    snprintf(FileName, sizeof(FileName), MD_INTERNAL_CAPTURE_FILENAME_FORMAT, CapPtr->TableIndex + 1);
+
+    memset(&CaptureHdr, 0, sizeof(CaptureHdr));
+    CaptureHdr.TableId       = CapPtr->TableIndex + 1;
+    CaptureHdr.EntryId       = CapPtr->EntryIndex + 1;
+    CaptureHdr.Condition     = CapPtr->Condition;
+    CaptureHdr.ByteCount     = CapPtr->RecordSize - MD_CAPTURE_RECORD_HDR_SIZE;
+    CaptureHdr.TriggerValue  = CapPtr->TriggerValue;
+    CaptureHdr.TriggerMask   = CapPtr->Mask;
+    CaptureHdr.RecordCount   = CapPtr->NumRecords;
+    CaptureHdr.TriggerRecord = CapPtr->TriggerRecord;
+
+    /* Records run from the oldest to the end of the ring, then wrap to its start */
+    FirstCount = CapPtr->MaxRecords - CapPtr->FirstRecord;
+    if (FirstCount > CapPtr->NumRecords)
+    {
+        FirstCount = CapPtr->NumRecords;
+    }
+    FirstBytes = (uint32)FirstCount * CapPtr->RecordSize;
+    WrapBytes  = (uint32)(CapPtr->NumRecords - FirstCount) * CapPtr->RecordSize;
+
+    OS_Status = OS_OpenCreate(&FileId, FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    if (OS_Status == OS_SUCCESS)
+    {
+        CFE_FS_InitHeader(&FileHdr, MD_CAPTURE_FILE_DESC, MD_INTERNAL_CAPTURE_FILE_SUBTYPE);
+
+        if (CFE_FS_WriteHeader(FileId, &FileHdr) != (int32)sizeof(FileHdr))
+        {
+            WriteStatus = -1;
+        }
+        else if (OS_write(FileId, &CaptureHdr, sizeof(CaptureHdr)) != (int32)sizeof(CaptureHdr))
+        {
+            WriteStatus = -1;
+        }
+        else if (OS_write(FileId, &CapPtr->Buffer[(uint32)CapPtr->FirstRecord * CapPtr->RecordSize], FirstBytes) !=
+                 (int32)FirstBytes)
+        {
+            WriteStatus = -1;
+        }
+        else if ((WrapBytes > 0) && (OS_write(FileId, CapPtr->Buffer, WrapBytes) != (int32)WrapBytes))
+        {
+            WriteStatus = -1;
+        }
+
+        OS_close(FileId);
+
+        if (WriteStatus == 0)
+        {
+            CFE_EVS_SendEvent(MD_CAPTURE_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Capture of Dwell Tbl#%d written to %s: %d records, trigger at record %d",
+                              CapPtr->TableIndex + 1, FileName, CapPtr->NumRecords, CapPtr->TriggerRecord);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(MD_CAPTURE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Capture of Dwell Tbl#%d lost, error writing %s", CapPtr->TableIndex + 1, FileName);
+        }
+    }
+    else
+    {
+        CFE_EVS_SendEvent(MD_CAPTURE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Capture of Dwell Tbl#%d lost, error creating %s: OS_OpenCreate returned %d",
+                          CapPtr->TableIndex + 1, FileName, (int)OS_Status);
+    }
+
+    MD_SAMPLER_BARRIER();
+    CapPtr->State = MD_CAPTURE_IDLE;
+}
+
+/******************************************************************************/
+
+void MD_WriteCompletedCapture(void)
+{
+    if (MD_AppData.Capture.State == MD_CAPTURE_COMPLETE)
+    {
+        MD_SAMPLER_BARRIER();
+        MD_WriteCaptureFile();
+    }
+}
+
+/******************************************************************************/
+
+void MD_CancelCapture(uint16 TableIndex)
+{
+    MD_CaptureControl_t *CapPtr = &MD_AppData.Capture;
+
+    if (((CapPtr->State == MD_CAPTURE_ARMED) || (CapPtr->State == MD_CAPTURE_TRIGGERED)) &&
+        (CapPtr->TableIndex == TableIndex))
+    {
+        if (CapPtr->State == MD_CAPTURE_TRIGGERED)
+        {
+            /* Keep the cycles recorded since the trigger fired, the main task writes them */
+            MD_SAMPLER_BARRIER();
+            CapPtr->State = MD_CAPTURE_COMPLETE;
+        }
+        else
+        {
+            CFE_EVS_SendEvent(MD_CAPTURE_CANCELLED_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Capture armed on Dwell Tbl#%d cancelled before it triggered", TableIndex + 1);
+
+            CapPtr->State = MD_CAPTURE_IDLE;
+        }
+    }
+}
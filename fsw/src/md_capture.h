@@ -0,0 +1,185 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Dwell triggered capture functions.
+ */
+#ifndef MD_CAPTURE_H
+#define MD_CAPTURE_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+
+#include "cfe.h"
+#include "md_msg.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Description written to the cFE file header of capture files
+ */
+#define MD_CAPTURE_FILE_DESC "MD triggered capture"
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Valid Capture Entry
+ *
+ * \par Description
+ *          Checks that an entry ID names an active dwell of the table
+ *          that is 1, 2 or 4 bytes long, so its value can be tested
+ *          against a trigger condition.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          TableIndex is valid.
+ *
+ * \param[in] TableIndex Dwell table index, 0..MD_INTERFACE_NUM_DWELL_TABLES-1
+ * \param[in] EntryId    Entry ID, 1..MD_INTERFACE_DWELL_TABLE_SIZE
+ *
+ * \return Boolean entry valid response
+ * \retval true  Entry can be watched
+ * \retval false Entry can't be watched
+ */
+bool MD_ValidCaptureEntry(uint16 TableIndex, uint16 EntryId);
+
+/**
+ * \brief Valid Capture Size
+ *
+ * \par Description
+ *          Checks that the pre-trigger, trigger and post-trigger cycles of
+ *          a table fit in the capture buffer along with their wakeup counts.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] PreTrigger  Cycles to keep from before the trigger
+ * \param[in] PostTrigger Cycles to record after the trigger
+ * \param[in] DataSize    Number of bytes of dwell data in each cycle
+ *
+ * \return Boolean size valid response
+ * \retval true  Cycles fit in #MD_INTERNAL_CAPTURE_BUFFER_SIZE bytes
+ * \retval false Cycles don't fit
+ */
+bool MD_ValidCaptureSize(uint16 PreTrigger, uint16 PostTrigger, uint16 DataSize);
+
+/**
+ * \brief Arm Capture
+ *
+ * \par Description
+ *          Sets up the capture buffer to record every full cycle of the
+ *          table and watch the entry for the trigger condition.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The arguments have been validated and any capture in progress
+ *          has been cancelled.
+ *
+ * \param[in] ArmPtr Arm Capture command arguments
+ */
+void MD_ArmCapture(const MD_CmdArmCapture_Payload_t *ArmPtr);
+
+/**
+ * \brief Capture Dwell Cycle
+ *
+ * \par Description
+ *          Records a completed cycle of the table in the capture ring and
+ *          tests the trigger condition.  Once the trigger has fired and
+ *          the post-trigger cycles are recorded, the capture is complete
+ *          and the ring is kept for #MD_WriteCompletedCapture to write.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called for every completed cycle of every table.  Does nothing
+ *          unless a capture is armed or triggered on this table.  A cycle
+ *          cut short by a jam isn't recorded, and the trigger isn't tested
+ *          on a cycle in which the watched entry couldn't be read.
+ *
+ * \param[in] TableIndex Dwell table index, 0..MD_INTERFACE_NUM_DWELL_TABLES-1
+ * \param[in] DataPtr    Dwell data of the cycle, laid out as in a dwell packet
+ */
+void MD_CaptureDwellCycle(uint16 TableIndex, const uint8 *DataPtr);
+
+/**
+ * \brief Capture Triggered
+ *
+ * \par Description
+ *          Tests the trigger condition on a value of the watched entry and
+ *          remembers the value for the changed condition.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The changed condition never fires on the first cycle after
+ *          the capture is armed.
+ *
+ * \param[in] Value Value of the watched entry
+ *
+ * \return Boolean trigger response
+ * \retval true  Trigger condition holds
+ * \retval false Trigger condition doesn't hold
+ */
+bool MD_CaptureTriggered(uint32 Value);
+
+/**
+ * \brief Write Capture File
+ *
+ * \par Description
+ *          Writes the recorded cycles, oldest first, to the capture file
+ *          after a cFE file header and a #MD_CaptureFileHdr_t, then
+ *          disarms the capture.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called on the main task by #MD_WriteCompletedCapture, so the
+ *          file isn't written on the task that samples the table.
+ */
+void MD_WriteCaptureFile(void);
+
+/**
+ * \brief Write Completed Capture
+ *
+ * \par Description
+ *          Writes the capture file of a completed capture, which lets
+ *          another capture be armed.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called by the main task after each message it receives and each
+ *          #MD_SB_TIMEOUT without one.  Does nothing unless a capture is
+ *          complete.
+ */
+void MD_WriteCompletedCapture(void);
+
+/**
+ * \brief Cancel Capture
+ *
+ * \par Description
+ *          Disarms a capture on the table.  A capture that has already
+ *          triggered is completed with the post-trigger cycles recorded so
+ *          far, and written by #MD_WriteCompletedCapture.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called before a table's entries change or it is stopped, and
+ *          before another capture is armed.  Does nothing unless a capture
+ *          is armed or triggered on this table.
+ *
+ * \param[in] TableIndex Dwell table index, 0..MD_INTERFACE_NUM_DWELL_TABLES-1
+ */
+void MD_CancelCapture(uint16 TableIndex);
+
+#endif
@@ -32,6 +32,10 @@
 #include "md_app.h"
 #include "md_eventids.h"
 #include "md_dwell_tbl.h"
+#include "md_dwell_pkt.h"
+#include "md_capture.h"
+#include "md_symcache.h"
+#include "md_perf.h"
 #include "md_extern_typedefs.h"
 #include "md_version.h"
 #include "md_internal_cfg.h"
@@ -68,6 +72,9 @@ CFE_Status_t MD_ResetCountersCmd(const MD_ResetCountersCmd_t *Msg)
                         "Reset Counters Cmd Received");
     MD_AppData.CmdCounter = 0;
     MD_AppData.ErrCounter = 0;
+    memset(MD_AppData.DwellCounters, 0, sizeof(MD_AppData.DwellCounters));
+    memset(&MD_AppData.WakeupCounters, 0, sizeof(MD_AppData.WakeupCounters));
+    MD_ResetPerfHist();
     return CFE_SUCCESS;    
 }
 
@@ -77,7 +84,8 @@ CFE_Status_t MD_StartDwellCmd(const MD_StartDwellCmd_t *Msg)
     CFE_Status_t       Status;
     CFE_Status_t       TableUpdateStatus;
     int32              NumTblInMask = 0; /* Purely as info for event message */
-    uint16             TableId      = 0;
+    uint32             TableId      = 0;
+    uint16             MaskBit;
     uint16             TableIndex;
     bool               AnyTablesInMask = false;
 
@@ -85,9 +93,11 @@ CFE_Status_t MD_StartDwellCmd(const MD_StartDwellCmd_t *Msg)
 
     /*  Preview tables specified by command:                   */
     /*  Check that there's at least one valid table specified. */
-    for (TableId = 1; TableId <= MD_INTERFACE_NUM_DWELL_TABLES; TableId++)
+    for (MaskBit = 1; MaskBit <= 16; MaskBit++)
     {
-        if (MD_TableIsInMask(TableId, Msg->Payload.TableMask))
+        TableId = (uint32)Msg->Payload.MaskOffset + MaskBit;
+
+        if ((TableId <= MD_INTERFACE_NUM_DWELL_TABLES) && MD_TableIsInMask(MaskBit, Msg->Payload.TableMask))
         {
             /* At least one valid Table Id is in Mask */
             AnyTablesInMask = true;
@@ -102,20 +112,35 @@ CFE_Status_t MD_StartDwellCmd(const MD_StartDwellCmd_t *Msg)
     if (AnyTablesInMask)
     { /* Handle Nominal Case */
 
-        for (TableId = 1; TableId <= MD_INTERFACE_NUM_DWELL_TABLES; TableId++)
+        for (MaskBit = 1; MaskBit <= 16; MaskBit++)
         {
-            if (MD_TableIsInMask(TableId, Msg->Payload.TableMask))
+            TableId = (uint32)Msg->Payload.MaskOffset + MaskBit;
+
+            if ((TableId <= MD_INTERFACE_NUM_DWELL_TABLES) && MD_TableIsInMask(MaskBit, Msg->Payload.TableMask))
             {
                 NumTblInMask++;
 
                 /* Setting Countdown to 1 causes a dwell packet to be issued */
                 /* on first wakeup call received. */
-                TableIndex                                         = TableId - 1;
+                TableIndex                                         = (uint16)(TableId - 1);
                 MD_AppData.MD_DwellTables[TableIndex].Enabled      = MD_Dwell_States_ENABLED;
                 MD_AppData.MD_DwellTables[TableIndex].Countdown    = 1;
                 MD_AppData.MD_DwellTables[TableIndex].CurrentEntry = 0;
                 MD_AppData.MD_DwellTables[TableIndex].PktOffset    = 0;
 
+                /* The first cycle isn't late however long the table was stopped */
+                MD_AppData.DwellReportControl[TableIndex].CycleDueWakeup = 0;
+
+                if (MD_DwellTableIsTimed(TableIndex))
+                {
+                    /* A timed table is first read on its next deadline */
+                    MD_ScheduleDwellDeadline(TableIndex, MD_GetDeadlineTime());
+                }
+                else if (MD_AppData.MD_DwellTables[TableIndex].Rate > 0)
+                {
+                    MD_ScheduleDwellTable(TableIndex, 1);
+                }
+
                 /* Change value in Table Services managed buffer */
                 TableUpdateStatus = MD_UpdateTableEnabledField(TableIndex, MD_Dwell_States_ENABLED);
                 if (TableUpdateStatus != CFE_SUCCESS)
@@ -124,12 +149,12 @@ CFE_Status_t MD_StartDwellCmd(const MD_StartDwellCmd_t *Msg)
                     Status = TableUpdateStatus;
                 }
 
-                /* If table contains a rate of zero, report that no processing will occur */
-                if (MD_AppData.MD_DwellTables[TableIndex].Rate == 0)
+                /* If table contains a rate of zero and isn't timed, report that no processing will occur */
+                if ((MD_AppData.MD_DwellTables[TableIndex].Rate == 0) && !MD_DwellTableIsTimed(TableIndex))
                 {
                     CFE_EVS_SendEvent(MD_ZERO_RATE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
                                       "Dwell Table %d is enabled with a delay of zero so no processing will occur",
-                                      TableId);
+                                      (int)TableId);
                 }
             }
         }
@@ -139,24 +164,24 @@ CFE_Status_t MD_StartDwellCmd(const MD_StartDwellCmd_t *Msg)
             MD_AppData.CmdCounter++;
 
             CFE_EVS_SendEvent(MD_START_DWELL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                              "Start Dwell Table command processed successfully for table mask 0x%04X",
-                              Msg->Payload.TableMask);
+                              "Start Dwell Table command processed successfully for table mask 0x%04X offset %d",
+                              Msg->Payload.TableMask, Msg->Payload.MaskOffset);
         }
         else
         {
             MD_AppData.ErrCounter++;
 
             CFE_EVS_SendEvent(MD_START_DWELL_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Start Dwell Table for mask 0x%04X failed for %d of %d tables", Msg->Payload.TableMask,
-                              (int)ErrorCount, (int)NumTblInMask);
+                              "Start Dwell Table for mask 0x%04X offset %d failed for %d of %d tables",
+                              Msg->Payload.TableMask, Msg->Payload.MaskOffset, (int)ErrorCount, (int)NumTblInMask);
         }
     }
     else /* No valid table id's specified in mask */
     {
         MD_AppData.ErrCounter++;
         CFE_EVS_SendEvent(MD_EMPTY_TBLMASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s command rejected because no tables were specified in table mask (0x%04X)", "Start Dwell",
-                          Msg->Payload.TableMask);
+                          "%s command rejected because no tables were specified in table mask (0x%04X) offset %d",
+                          "Start Dwell", Msg->Payload.TableMask, Msg->Payload.MaskOffset);
     }
     return Status;
 }
@@ -169,23 +194,38 @@ CFE_Status_t MD_StopDwellCmd(const MD_StopDwellCmd_t *Msg)
     CFE_Status_t       Status;
     CFE_Status_t       TableUpdateStatus;
     int32              NumTblInMask = 0; /* Purely as info for event message */
-    uint16             TableId      = 0;
+    uint32             TableId      = 0;
+    uint16             MaskBit;
     uint16             TableIndex;
     bool               AnyTablesInMask = false;
 
     Status = CFE_SUCCESS;
 
-    for (TableId = 1; TableId <= MD_INTERFACE_NUM_DWELL_TABLES; TableId++)
+    for (MaskBit = 1; MaskBit <= 16; MaskBit++)
     {
-        if (MD_TableIsInMask(TableId, Msg->Payload.TableMask))
+        TableId = (uint32)Msg->Payload.MaskOffset + MaskBit;
+
+        if ((TableId <= MD_INTERFACE_NUM_DWELL_TABLES) && MD_TableIsInMask(MaskBit, Msg->Payload.TableMask))
         {
             NumTblInMask++;
-            TableIndex                                         = TableId - 1;
+            TableIndex                                         = (uint16)(TableId - 1);
             MD_AppData.MD_DwellTables[TableIndex].Enabled      = MD_Dwell_States_DISABLED;
             MD_AppData.MD_DwellTables[TableIndex].Countdown    = 0;
             MD_AppData.MD_DwellTables[TableIndex].CurrentEntry = 0;
             MD_AppData.MD_DwellTables[TableIndex].PktOffset    = 0;
 
+            MD_UnscheduleDwellTable(TableIndex);
+
+            /* Cycles already batched or summarized are complete, send them now */
+            MD_SendDwellBatchPkt(TableIndex);
+            MD_SendDwellStatsPkt(TableIndex);
+
+            /* A stopped table won't complete a capture */
+            MD_CancelCapture(TableIndex);
+
+            /* Don't hold a software bus buffer for a stopped table */
+            MD_ReleaseDwellPktBuf(TableIndex);
+
             AnyTablesInMask = true;
 
             /* Change value in Table Services managed buffer */
@@ -203,8 +243,8 @@ CFE_Status_t MD_StopDwellCmd(const MD_StopDwellCmd_t *Msg)
         if (ErrorCount == 0)
         {
             CFE_EVS_SendEvent(MD_STOP_DWELL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                              "Stop Dwell Table command processed successfully for table mask 0x%04X",
-                              Msg->Payload.TableMask);
+                              "Stop Dwell Table command processed successfully for table mask 0x%04X offset %d",
+                              Msg->Payload.TableMask, Msg->Payload.MaskOffset);
 
             MD_AppData.CmdCounter++;
         }
@@ -213,15 +253,15 @@ CFE_Status_t MD_StopDwellCmd(const MD_StopDwellCmd_t *Msg)
             MD_AppData.ErrCounter++;
 
             CFE_EVS_SendEvent(MD_STOP_DWELL_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Stop Dwell Table for mask 0x%04X failed for %d of %d tables", Msg->Payload.TableMask,
-                              (int)ErrorCount, (int)NumTblInMask);
+                              "Stop Dwell Table for mask 0x%04X offset %d failed for %d of %d tables",
+                              Msg->Payload.TableMask, Msg->Payload.MaskOffset, (int)ErrorCount, (int)NumTblInMask);
         }
     }
     else
     {
         CFE_EVS_SendEvent(MD_EMPTY_TBLMASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s command rejected because no tables were specified in table mask (0x%04X)", "Stop Dwell",
-                          Msg->Payload.TableMask);
+                          "%s command rejected because no tables were specified in table mask (0x%04X) offset %d",
+                          "Stop Dwell", Msg->Payload.TableMask, Msg->Payload.MaskOffset);
         MD_AppData.ErrCounter++;
     }
     return Status;
@@ -237,7 +277,7 @@ CFE_Status_t MD_JamDwellCmd(const MD_JamDwellCmd_t *Msg)
     cpuaddr                 ResolvedAddr   = 0;
     MD_DwellControlEntry_t *DwellEntryPtr; /* points to local task data */
     uint16                  EntryIndex;
-    uint8                   TableIndex = 0;
+    uint16                  TableIndex = 0;
     MD_SymAddr_t            NewDwellAddress;
 
     Status = CFE_SUCCESS;
@@ -258,11 +298,11 @@ CFE_Status_t MD_JamDwellCmd(const MD_JamDwellCmd_t *Msg)
         AllInputsValid = false;
     }
 
-    else if (!MD_ValidEntryId(Msg->Payload.EntryId))
+    else if (!MD_ValidEntryId(Msg->Payload.TableId - 1, Msg->Payload.EntryId))
     {
         CFE_EVS_SendEvent(MD_INVALID_ENTRY_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Jam Cmd rejected due to invalid Entry Id arg = %d (Expect 1.. %d)", Msg->Payload.EntryId,
-                          MD_INTERFACE_DWELL_TABLE_SIZE);
+                          MD_AppData.MD_DwellTables[Msg->Payload.TableId - 1].Capacity);
 
         AllInputsValid = false;
     }
@@ -291,10 +331,12 @@ CFE_Status_t MD_JamDwellCmd(const MD_JamDwellCmd_t *Msg)
             DwellEntryPtr->Length          = 0;
             DwellEntryPtr->Delay           = 0;
 
+            MD_AppData.DwellReportControl[TableIndex].Deadband[EntryIndex] = 0;
+
             /* Update Table Services buffer */
             NewDwellAddress.Offset     = 0;
             NewDwellAddress.SymName[0] = '\0';
-            Status                     = MD_UpdateTableDwellEntry(TableIndex, EntryIndex, 0, 0, NewDwellAddress);
+            Status                     = MD_UpdateTableDwellEntry(TableIndex, EntryIndex, 0, 0, NewDwellAddress, 0);
 
             /* Issue event */
             if (Status == CFE_SUCCESS)
@@ -322,53 +364,28 @@ CFE_Status_t MD_JamDwellCmd(const MD_JamDwellCmd_t *Msg)
             */
 
             /* Resolve and Validate Dwell Address */
-            if (MD_ResolveSymAddr(&Msg->Payload.DwellAddress, &ResolvedAddr) == false)
-            {
-                /* If DwellAddress argument couldn't be resolved, issue error event */
-                CFE_EVS_SendEvent(MD_CANT_RESOLVE_JAM_ADDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Jam Cmd rejected because symbolic address '%s' couldn't be resolved",
-                                  Msg->Payload.DwellAddress.SymName);
-                AllInputsValid = false;
-            }
-            else if (!MD_ValidFieldLength(Msg->Payload.FieldLength))
-            {
-                CFE_EVS_SendEvent(MD_INVALID_LEN_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Jam Cmd rejected due to invalid Field Length arg = %d (Expect 0,1,2,or 4)",
-                                  Msg->Payload.FieldLength);
-                AllInputsValid = false;
-            }
-            else if (!MD_ValidAddrRange(ResolvedAddr, Msg->Payload.FieldLength))
-            {
-                /* Issue event message that ResolvedAddr is invalid */
-                CFE_EVS_SendEvent(MD_INVALID_JAM_ADDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Jam Cmd rejected because address 0x%08X is not in a valid range",
-                                  (unsigned int)ResolvedAddr);
-                AllInputsValid = false;
-            }
-#if MD_INTERFACE_ENFORCE_DWORD_ALIGN == 0
-            else if ((Jam->Payload.FieldLength == 4) &&
-                     MD_Verify16Aligned(ResolvedAddr, (uint32)Jam->Payload.FieldLength) != true)
+            MD_RefreshSymCache();
+
+            if (!MD_ValidJamAddress(&Msg->Payload.DwellAddress, Msg->Payload.FieldLength, &ResolvedAddr))
             {
-                CFE_EVS_SendEvent(MD_JAM_ADDR_NOT_16BIT_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Jam Cmd rejected because address 0x%08X is not 16-bit aligned", ResolvedAddr);
                 AllInputsValid = false;
             }
-#else
-            else if ((Msg->Payload.FieldLength == 4) &&
-                     MD_Verify32Aligned(ResolvedAddr, (uint32)Msg->Payload.FieldLength) != true)
+            else if (MD_DwellDataSizeWithEntry(TableIndex, EntryIndex, Msg->Payload.FieldLength) >
+                     MD_INTERFACE_DWELL_PKT_DATA_SIZE)
             {
-                CFE_EVS_SendEvent(MD_JAM_ADDR_NOT_32BIT_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Jam Cmd rejected because address 0x%08X is not 32-bit aligned",
-                                  (unsigned int)ResolvedAddr);
+                CFE_EVS_SendEvent(MD_JAM_DATA_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Jam Cmd rejected because dwell data would exceed the %d byte dwell packet",
+                                  MD_INTERFACE_DWELL_PKT_DATA_SIZE);
                 AllInputsValid = false;
             }
-#endif
-            else if ((Msg->Payload.FieldLength == 2) &&
-                     MD_Verify16Aligned(ResolvedAddr, (uint32)Msg->Payload.FieldLength) != true)
+            else if (!MD_ValidBatchFactor(MD_AppData.MD_DwellTables[TableIndex].BatchFactor,
+                                          MD_DwellDataSizeWithEntry(TableIndex, EntryIndex, Msg->Payload.FieldLength)))
             {
-                CFE_EVS_SendEvent(MD_JAM_ADDR_NOT_16BIT_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Jam Cmd rejected because address 0x%08X is not 16-bit aligned",
-                                  (unsigned int)ResolvedAddr);
+                CFE_EVS_SendEvent(MD_JAM_BATCH_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Jam Cmd rejected because %d batched cycles would exceed the %d byte batched dwell "
+                                  "packet",
+                                  MD_AppData.MD_DwellTables[TableIndex].BatchFactor,
+                                  MD_INTERFACE_DWELL_BATCH_DATA_SIZE);
                 AllInputsValid = false;
             }
             else
@@ -388,6 +405,8 @@ CFE_Status_t MD_JamDwellCmd(const MD_JamDwellCmd_t *Msg)
                 DwellEntryPtr->Length          = Msg->Payload.FieldLength;
                 DwellEntryPtr->Delay           = Msg->Payload.DwellDelay;
 
+                MD_AppData.DwellReportControl[TableIndex].Deadband[EntryIndex] = Msg->Payload.Deadband;
+
                 /* Update values in Table Services buffer */
                 NewDwellAddress.Offset = Msg->Payload.DwellAddress.Offset;
 
@@ -395,7 +414,7 @@ CFE_Status_t MD_JamDwellCmd(const MD_JamDwellCmd_t *Msg)
                     sizeof(NewDwellAddress.SymName), sizeof(Msg->Payload.DwellAddress.SymName));
 
                 Status = MD_UpdateTableDwellEntry(TableIndex, EntryIndex, Msg->Payload.FieldLength,
-                                                  Msg->Payload.DwellDelay, NewDwellAddress);
+                                                  Msg->Payload.DwellDelay, NewDwellAddress, Msg->Payload.Deadband);
 
                 /* Issue event */
                 if (Status == CFE_SUCCESS)
@@ -428,8 +447,235 @@ CFE_Status_t MD_JamDwellCmd(const MD_JamDwellCmd_t *Msg)
         /* Update Dwell Table Control Info, including rate */
         MD_UpdateDwellControlInfo(TableIndex);
 
-        /* If table contains a rate of zero, and it enabled report that no processing will occur */
-        if ((MD_AppData.MD_DwellTables[TableIndex].Rate == 0) &&
+        /* If table contains a rate of zero, isn't timed and is enabled, report that no processing will occur */
+        if ((MD_AppData.MD_DwellTables[TableIndex].Rate == 0) && !MD_DwellTableIsTimed(TableIndex) &&
+            (MD_AppData.MD_DwellTables[TableIndex].Enabled == MD_Dwell_States_ENABLED))
+        {
+            CFE_EVS_SendEvent(MD_ZERO_RATE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Dwell Table %d is enabled with a delay of zero so no processing will occur",
+                              Msg->Payload.TableId);
+        }
+    }
+    else
+    {
+        MD_AppData.ErrCounter++;
+    }
+    return Status;
+}
+
+/******************************************************************************/
+
+bool MD_ValidJamAddress(const MD_SymAddr_t *DwellAddress, uint16 FieldLength, cpuaddr *ResolvedAddrPtr)
+{
+    bool    IsValid      = true;
+    cpuaddr ResolvedAddr = 0;
+
+    if (MD_ResolveSymAddr(DwellAddress, &ResolvedAddr) == false)
+    {
+        /* If DwellAddress argument couldn't be resolved, issue error event */
+        CFE_EVS_SendEvent(MD_CANT_RESOLVE_JAM_ADDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Jam Cmd rejected because symbolic address '%s' couldn't be resolved",
+                          DwellAddress->SymName);
+        IsValid = false;
+    }
+    else if (!MD_ValidFieldLength(FieldLength))
+    {
+        CFE_EVS_SendEvent(MD_INVALID_LEN_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Jam Cmd rejected due to invalid Field Length arg = %d (Expect 0,1,2,4,or %d..%d)",
+                          FieldLength, MD_MIN_BLOCK_DWELL_LENGTH, MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH);
+        IsValid = false;
+    }
+    else if (!MD_ValidAddrRange(ResolvedAddr, FieldLength))
+    {
+        /* Issue event message that ResolvedAddr is invalid */
+        CFE_EVS_SendEvent(MD_INVALID_JAM_ADDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Jam Cmd rejected because address 0x%08X is not in a valid range",
+                          (unsigned int)ResolvedAddr);
+        IsValid = false;
+    }
+#if MD_INTERFACE_ENFORCE_DWORD_ALIGN == 0
+    else if ((FieldLength == 4) && MD_Verify16Aligned(ResolvedAddr, (uint32)FieldLength) != true)
+    {
+        CFE_EVS_SendEvent(MD_JAM_ADDR_NOT_16BIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Jam Cmd rejected because address 0x%08X is not 16-bit aligned",
+                          (unsigned int)ResolvedAddr);
+        IsValid = false;
+    }
+#else
+    else if ((FieldLength == 4) && MD_Verify32Aligned(ResolvedAddr, (uint32)FieldLength) != true)
+    {
+        CFE_EVS_SendEvent(MD_JAM_ADDR_NOT_32BIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Jam Cmd rejected because address 0x%08X is not 32-bit aligned",
+                          (unsigned int)ResolvedAddr);
+        IsValid = false;
+    }
+#endif
+    else if ((FieldLength == 2) && MD_Verify16Aligned(ResolvedAddr, (uint32)FieldLength) != true)
+    {
+        CFE_EVS_SendEvent(MD_JAM_ADDR_NOT_16BIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Jam Cmd rejected because address 0x%08X is not 16-bit aligned",
+                          (unsigned int)ResolvedAddr);
+        IsValid = false;
+    }
+
+    *ResolvedAddrPtr = ResolvedAddr;
+
+    return IsValid;
+}
+
+/******************************************************************************/
+
+CFE_Status_t MD_JamMultiDwellCmd(const MD_JamMultiDwellCmd_t *Msg)
+{
+    CFE_Status_t              Status;
+    bool                      AllInputsValid = true;
+    cpuaddr                   ResolvedAddr[MD_INTERFACE_MAX_JAM_ENTRIES];
+    const MD_JamMultiEntry_t *JamEntryPtr   = NULL;
+    uint32 *                  DeadbandPtr   = NULL; /* points to local task data */
+    MD_DwellControlEntry_t *  DwellEntryPtr = NULL; /* points to local task data */
+    uint16                    JamIndex      = 0;
+    uint16                    TableIndex    = 0;
+    uint32                    DataSize      = 0;
+
+    Status = CFE_SUCCESS;
+
+    /*
+    **  Check the TableId and NumEntries command arguments,
+    **  which are used as an array index and an array size.
+    */
+    if (!MD_ValidTableId(Msg->Payload.TableId))
+    {
+        CFE_EVS_SendEvent(MD_INVALID_JAM_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Jam Multi Cmd rejected due to invalid Tbl Id arg = %d (Expect 1.. %d)",
+                          Msg->Payload.TableId, MD_INTERFACE_NUM_DWELL_TABLES);
+
+        AllInputsValid = false;
+    }
+    else if ((Msg->Payload.NumEntries < 1) || (Msg->Payload.NumEntries > MD_INTERFACE_MAX_JAM_ENTRIES))
+    {
+        CFE_EVS_SendEvent(MD_JAM_MULTI_COUNT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Jam Multi Cmd rejected due to invalid entry count = %d (Expect 1.. %d)",
+                          Msg->Payload.NumEntries, MD_INTERFACE_MAX_JAM_ENTRIES);
+
+        AllInputsValid = false;
+    }
+    else
+    {
+        TableIndex = Msg->Payload.TableId - 1;
+
+        MD_RefreshSymCache();
+
+        /*
+        **  Check every entry before any of them is applied.
+        */
+        while ((AllInputsValid == true) && (JamIndex < Msg->Payload.NumEntries))
+        {
+            JamEntryPtr            = &Msg->Payload.Entry[JamIndex];
+            ResolvedAddr[JamIndex] = 0;
+
+            if (!MD_ValidEntryId(TableIndex, JamEntryPtr->EntryId))
+            {
+                CFE_EVS_SendEvent(MD_INVALID_ENTRY_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Jam Multi Cmd rejected due to invalid Entry Id arg = %d in entry %d (Expect 1.. %d)",
+                                  JamEntryPtr->EntryId, JamIndex + 1, MD_AppData.MD_DwellTables[TableIndex].Capacity);
+
+                AllInputsValid = false;
+            }
+            else if ((JamEntryPtr->FieldLength != 0) &&
+                     !MD_ValidJamAddress(&JamEntryPtr->DwellAddress, JamEntryPtr->FieldLength,
+                                         &ResolvedAddr[JamIndex]))
+            {
+                AllInputsValid = false;
+            }
+
+            JamIndex++;
+        }
+
+        /*
+        **  Check the table as it would be with every entry in place.
+        */
+        if (AllInputsValid == true)
+        {
+            DataSize = MD_DwellDataSizeWithJam(TableIndex, Msg->Payload.Entry, Msg->Payload.NumEntries);
+
+            if (DataSize > MD_INTERFACE_DWELL_PKT_DATA_SIZE)
+            {
+                CFE_EVS_SendEvent(MD_JAM_DATA_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Jam Multi Cmd rejected because dwell data would exceed the %d byte dwell packet",
+                                  MD_INTERFACE_DWELL_PKT_DATA_SIZE);
+                AllInputsValid = false;
+            }
+            else if (!MD_ValidBatchFactor(MD_AppData.MD_DwellTables[TableIndex].BatchFactor, DataSize))
+            {
+                CFE_EVS_SendEvent(MD_JAM_BATCH_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Jam Multi Cmd rejected because %d batched cycles would exceed the %d byte batched "
+                                  "dwell packet",
+                                  MD_AppData.MD_DwellTables[TableIndex].BatchFactor,
+                                  MD_INTERFACE_DWELL_BATCH_DATA_SIZE);
+                AllInputsValid = false;
+            }
+        }
+    }
+
+    /*
+    **  Update the Table Services buffer first so that if it fails,
+    **  neither copy of the table has changed.
+    */
+    if (AllInputsValid == true)
+    {
+        Status = MD_UpdateTableDwellEntries(TableIndex, Msg->Payload.Entry, Msg->Payload.NumEntries);
+
+        if (Status == CFE_SUCCESS)
+        {
+            for (JamIndex = 0; JamIndex < Msg->Payload.NumEntries; JamIndex++)
+            {
+                JamEntryPtr   = &Msg->Payload.Entry[JamIndex];
+                DwellEntryPtr = &MD_AppData.MD_DwellTables[TableIndex].Entry[JamEntryPtr->EntryId - 1];
+                DeadbandPtr   = &MD_AppData.DwellReportControl[TableIndex].Deadband[JamEntryPtr->EntryId - 1];
+
+                if (JamEntryPtr->FieldLength == 0)
+                {
+                    /* Null entry, all fields are zero */
+                    DwellEntryPtr->ResolvedAddress = 0;
+                    DwellEntryPtr->Length          = 0;
+                    DwellEntryPtr->Delay           = 0;
+                    *DeadbandPtr                   = 0;
+                }
+                else
+                {
+                    DwellEntryPtr->ResolvedAddress = ResolvedAddr[JamIndex];
+                    DwellEntryPtr->Length          = JamEntryPtr->FieldLength;
+                    DwellEntryPtr->Delay           = JamEntryPtr->DwellDelay;
+                    *DeadbandPtr                   = JamEntryPtr->Deadband;
+                }
+            }
+
+            CFE_EVS_SendEvent(MD_JAM_MULTI_DWELL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Successful Jam of %d entries to Dwell Tbl#%d", Msg->Payload.NumEntries,
+                              Msg->Payload.TableId);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(MD_JAM_MULTI_DWELL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Failed Jam of %d entries to Dwell Tbl#%d", Msg->Payload.NumEntries,
+                              Msg->Payload.TableId);
+
+            AllInputsValid = false;
+        }
+    }
+
+    /*
+    **  Handle bookkeeping.
+    */
+    if (AllInputsValid == true)
+    {
+        MD_AppData.CmdCounter++;
+
+        /* Update Dwell Table Control Info, including rate */
+        MD_UpdateDwellControlInfo(TableIndex);
+
+        /* If table contains a rate of zero, isn't timed and is enabled, report that no processing will occur */
+        if ((MD_AppData.MD_DwellTables[TableIndex].Rate == 0) && !MD_DwellTableIsTimed(TableIndex) &&
             (MD_AppData.MD_DwellTables[TableIndex].Enabled == MD_Dwell_States_ENABLED))
         {
             CFE_EVS_SendEvent(MD_ZERO_RATE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
@@ -493,9 +739,16 @@ CFE_Status_t MD_SetSignatureCmd(const MD_SetSignatureCmd_t *Msg)
     */
     {
         /* Copy signature field to local dwell control structure */
-        strncpy(MD_AppData.MD_DwellTables[TblId - 1].Signature, Msg->Payload.Signature,
+        strncpy(MD_AppData.DwellReportControl[TblId - 1].Signature, Msg->Payload.Signature,
                 MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1);
-        MD_AppData.MD_DwellTables[TblId - 1].Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] = '\0';
+        MD_AppData.DwellReportControl[TblId - 1].Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] = '\0';
+
+        /* Cycles already batched or summarized go out with the old signature */
+        MD_SendDwellBatchPkt(TblId - 1);
+        MD_SendDwellStatsPkt(TblId - 1);
+
+        /* Later dwell packets carry the new signature */
+        MD_UpdateDwellPktTemplate(TblId - 1);
 
         /* Update signature in Table Services buffer */
         Status = MD_UpdateTableSignature(TblId - 1, Msg->Payload.Signature);
@@ -520,3 +773,199 @@ CFE_Status_t MD_SetSignatureCmd(const MD_SetSignatureCmd_t *Msg)
 }
 
 #endif
+
+/******************************************************************************/
+
+CFE_Status_t MD_SetBatchFactorCmd(const MD_SetBatchFactorCmd_t *Msg)
+{
+    CFE_Status_t Status;
+    uint16       TblId = 0;
+
+    Status = CFE_SUCCESS;
+
+    TblId = Msg->Payload.TableId;
+
+    /*
+    ** Check for valid TableId argument
+    */
+    if (!MD_ValidTableId(TblId))
+    {
+        CFE_EVS_SendEvent(MD_INVALID_BATCH_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set Batch Factor cmd rejected due to invalid Tbl Id arg = %d (Expect 1.. %d)", TblId,
+                          MD_INTERFACE_NUM_DWELL_TABLES);
+
+        MD_AppData.ErrCounter++;
+    }
+
+    /*
+    ** Check that the batched cycles fit in the batched dwell packet
+    */
+    else if (!MD_ValidBatchFactor(Msg->Payload.BatchFactor, MD_AppData.MD_DwellTables[TblId - 1].DataSize))
+    {
+        CFE_EVS_SendEvent(MD_INVALID_BATCH_FACTOR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set Batch Factor cmd rejected because %d batched cycles of %d bytes exceed the %d byte "
+                          "batched dwell packet",
+                          Msg->Payload.BatchFactor, MD_AppData.MD_DwellTables[TblId - 1].DataSize,
+                          MD_INTERFACE_DWELL_BATCH_DATA_SIZE);
+
+        MD_AppData.ErrCounter++;
+    }
+
+    else
+
+    /*
+    **  Handle nominal case.
+    */
+    {
+        /* Cycles already batched go out before the batch factor changes */
+        MD_SendDwellBatchPkt(TblId - 1);
+
+        MD_AppData.MD_DwellTables[TblId - 1].BatchFactor = Msg->Payload.BatchFactor;
+
+        /* Update batch factor in Table Services buffer */
+        Status = MD_UpdateTableBatchFactor(TblId - 1, Msg->Payload.BatchFactor);
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(MD_SET_BATCH_FACTOR_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Successfully set batch factor for Dwell Tbl#%d to %d", TblId,
+                              Msg->Payload.BatchFactor);
+
+            MD_AppData.CmdCounter++;
+        }
+        else
+        {
+            CFE_EVS_SendEvent(MD_SET_BATCH_FACTOR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Failed to set batch factor for Dwell Tbl#%d. Update returned 0x%08X", (int)TblId,
+                              (unsigned int)Status);
+
+            MD_AppData.ErrCounter++;
+        }
+    }
+    return Status;
+}
+
+/******************************************************************************/
+
+CFE_Status_t MD_ArmCaptureCmd(const MD_ArmCaptureCmd_t *Msg)
+{
+    uint16 TblId = 0;
+
+    TblId = Msg->Payload.TableId;
+
+    /*
+    ** Check for valid TableId argument
+    */
+    if (!MD_ValidTableId(TblId))
+    {
+        CFE_EVS_SendEvent(MD_ARM_CAPTURE_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Arm Capture cmd rejected due to invalid Tbl Id arg = %d (Expect 1.. %d)", TblId,
+                          MD_INTERFACE_NUM_DWELL_TABLES);
+
+        MD_AppData.ErrCounter++;
+    }
+
+    /*
+    ** Check that the watched entry holds a value the trigger can test
+    */
+    else if (!MD_ValidCaptureEntry(TblId - 1, Msg->Payload.EntryId))
+    {
+        CFE_EVS_SendEvent(MD_ARM_CAPTURE_ENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Arm Capture cmd rejected because Entry Id %d of Dwell Tbl#%d isn't an active 1, 2 or 4 "
+                          "byte dwell",
+                          Msg->Payload.EntryId, TblId);
+
+        MD_AppData.ErrCounter++;
+    }
+
+    /*
+    ** Check for valid trigger condition and mask
+    */
+    else if ((Msg->Payload.Condition > MD_Capture_Conditions_CHANGED) || (Msg->Payload.Mask == 0))
+    {
+        CFE_EVS_SendEvent(MD_ARM_CAPTURE_COND_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Arm Capture cmd rejected due to invalid condition %d or mask 0x%08X",
+                          Msg->Payload.Condition, (unsigned int)Msg->Payload.Mask);
+
+        MD_AppData.ErrCounter++;
+    }
+
+    /*
+    ** Check that the captured cycles fit in the capture buffer
+    */
+    else if (!MD_ValidCaptureSize(Msg->Payload.PreTrigger, Msg->Payload.PostTrigger,
+                                  MD_AppData.MD_DwellTables[TblId - 1].DataSize))
+    {
+        CFE_EVS_SendEvent(MD_ARM_CAPTURE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Arm Capture cmd rejected because %d+1+%d cycles of %d bytes exceed the %d byte capture "
+                          "buffer",
+                          Msg->Payload.PreTrigger, Msg->Payload.PostTrigger,
+                          MD_AppData.MD_DwellTables[TblId - 1].DataSize, MD_INTERNAL_CAPTURE_BUFFER_SIZE);
+
+        MD_AppData.ErrCounter++;
+    }
+
+    /*
+    ** Check that the previous capture has finished recording and been written
+    */
+    else if ((MD_AppData.Capture.State == MD_CAPTURE_TRIGGERED) || (MD_AppData.Capture.State == MD_CAPTURE_COMPLETE))
+    {
+        CFE_EVS_SendEvent(MD_ARM_CAPTURE_BUSY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Arm Capture cmd rejected because the capture of Dwell Tbl#%d isn't recorded and written yet",
+                          MD_AppData.Capture.TableIndex + 1);
+
+        MD_AppData.ErrCounter++;
+    }
+
+    else
+
+    /*
+    **  Handle nominal case.
+    */
+    {
+        /* Only one capture is armed at a time */
+        MD_CancelCapture(MD_AppData.Capture.TableIndex);
+
+        MD_ArmCapture(&Msg->Payload);
+
+        CFE_EVS_SendEvent(MD_ARM_CAPTURE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Capture armed on Dwell Tbl#%d Entry #%d, condition %d, %d pre-trigger and %d post-trigger "
+                          "cycles",
+                          TblId, Msg->Payload.EntryId, Msg->Payload.Condition, Msg->Payload.PreTrigger,
+                          Msg->Payload.PostTrigger);
+
+        MD_AppData.CmdCounter++;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/******************************************************************************/
+
+CFE_Status_t MD_TblManageCmd(const MD_TblManageCmd_t *Msg)
+{
+    if (Msg->Payload.Parameter < MD_INTERFACE_NUM_DWELL_TABLES)
+    {
+        MD_ManageDwellTable((uint16)Msg->Payload.Parameter);
+    }
+    else
+    {
+        CFE_EVS_SendEvent(MD_TBL_MANAGE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Table manage request for invalid Dwell Tbl index %u", (unsigned int)Msg->Payload.Parameter);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/******************************************************************************/
+
+CFE_Status_t MD_SendPerfHistCmd(const MD_SendPerfHistCmd_t *Msg)
+{
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(MD_AppData.PerfHistPkt.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(MD_AppData.PerfHistPkt.TelemetryHeader), true);
+
+    CFE_EVS_SendEvent(MD_SEND_PERF_HIST_INF_EID, CFE_EVS_EventType_INFORMATION, "Sent performance histograms");
+
+    MD_AppData.CmdCounter++;
+
+    return CFE_SUCCESS;
+}
@@ -52,6 +52,8 @@ CFE_Status_t MD_NoopCmd(const MD_NoopCmd_t *Msg);
  *       the following MD application counters to zero:
  *         - Command counter
  *         - Command error counter
+ *         - Dwell table counters
+ *       and empties the performance histograms.
  *
  *  \par Assumptions, External Events, and Notes:
  *       None
@@ -107,6 +109,43 @@ CFE_Status_t MD_StopDwellCmd(const MD_StopDwellCmd_t *Msg);
  */
 CFE_Status_t MD_JamDwellCmd(const MD_JamDwellCmd_t *Msg);
 
+/**
+ * \brief Check Jam Dwell Address
+ *
+ * \par Description
+ *          Resolves the dwell address of a non-null jam entry and checks
+ *          the field length, address range and alignment, issuing the
+ *          event for the first check that fails.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The caller has refreshed the symbol cache.
+ *
+ * \param[in]  DwellAddress    Dwell address to resolve
+ * \param[in]  FieldLength     Non-zero length of the dwell field
+ * \param[out] ResolvedAddrPtr Resolved address
+ *
+ * \return Boolean address valid response
+ * \retval true  Address and field length are valid
+ * \retval false Address or field length are not valid
+ */
+bool MD_ValidJamAddress(const MD_SymAddr_t *DwellAddress, uint16 FieldLength, cpuaddr *ResolvedAddrPtr);
+
+/**
+ * \brief Process Memory Dwell Jam Multiple Command
+ *
+ * \par Description
+ *          Checks every entry of the command and, only if all of them are
+ *          valid, jams them into the dwell table, updating its Table
+ *          Services buffer once.  Issues an event, and increments the
+ *          command counter or error counter as appropriate.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Correct message length has been verified.
+ *
+ * \param[in] Msg Pointer to Jam Multiple Dwell Command
+ */
+CFE_Status_t MD_JamMultiDwellCmd(const MD_JamMultiDwellCmd_t *Msg);
+
 /**
  * \brief Process Set Signature Command
  *
@@ -122,4 +161,63 @@ CFE_Status_t MD_JamDwellCmd(const MD_JamDwellCmd_t *Msg);
  */
 CFE_Status_t MD_SetSignatureCmd(const MD_SetSignatureCmd_t *Msg);
 
+/**
+ * \brief Process Set Batch Factor Command
+ *
+ * \par Description
+ *          Extract command arguments, take appropriate actions,
+ *          issue event, and increment the command counter or
+ *          error counter as appropriate.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Correct message length has been verified.
+ *
+ * \param[in] Msg Pointer to Set Batch Factor Command
+ */
+CFE_Status_t MD_SetBatchFactorCmd(const MD_SetBatchFactorCmd_t *Msg);
+
+/**
+ * \brief Process Arm Capture Command
+ *
+ * \par Description
+ *          Extract command arguments, take appropriate actions,
+ *          issue event, and increment the command counter or
+ *          error counter as appropriate.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Correct message length has been verified.
+ *
+ * \param[in] Msg Pointer to Arm Capture Command
+ */
+CFE_Status_t MD_ArmCaptureCmd(const MD_ArmCaptureCmd_t *Msg);
+
+/**
+ * \brief Process Table Manage Command
+ *
+ * \par Description
+ *          Manages the Dwell Table named by a Table Services notification,
+ *          validating or updating it as Table Services requires.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Correct message length has been verified.  Only executed by
+ *          the main task, and doesn't change the command counters.
+ *
+ * \param[in] Msg Pointer to Table Manage Command
+ */
+CFE_Status_t MD_TblManageCmd(const MD_TblManageCmd_t *Msg);
+
+/**
+ * \brief Process Send Performance Histograms Command
+ *
+ * \par Description
+ *          Sends the performance histogram packet, issues an event and
+ *          increments the command counter.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Correct message length has been verified.
+ *
+ * \param[in] Msg Pointer to Send Performance Histograms Command
+ */
+CFE_Status_t MD_SendPerfHistCmd(const MD_SendPerfHistCmd_t *Msg);
+
 #endif /* MD_CMDS_H */
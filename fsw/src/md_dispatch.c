@@ -28,9 +28,11 @@
 #include "md_dispatch.h"
 #include "md_cmds.h"
 #include "md_dwell_pkt.h"
+#include "md_perf.h"
 #include "md_eventids.h"
 #include "md_msgids.h"
 #include "md_msg.h"
+#include <stddef.h>
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
@@ -48,6 +50,11 @@ const MD_CmdHandlerTblRec_t MD_CmdHandlerTbl[] = {
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     {MD_SET_SIGNATURE_CC, sizeof(MD_SetSignatureCmd_t)},
 #endif
+    {MD_SET_BATCH_FACTOR_CC, sizeof(MD_SetBatchFactorCmd_t)},
+    {MD_ARM_CAPTURE_CC, sizeof(MD_ArmCaptureCmd_t)},
+    {MD_TBL_MANAGE_CC, sizeof(MD_TblManageCmd_t)},
+    {MD_JAM_MULTI_DWELL_CC, sizeof(MD_JamMultiDwellCmd_t)},
+    {MD_SEND_PERF_HIST_CC, sizeof(MD_SendPerfHistCmd_t)},
 };
 
 /******************************************************************************/
@@ -55,8 +62,10 @@ void MD_ExecRequest(const CFE_SB_Buffer_t *BufPtr)
 {
     CFE_MSG_FcnCode_t CommandCode  = 0;
     CFE_SB_MsgId_t    MessageID    = CFE_SB_INVALID_MSG_ID;
-    int16             CmdIndx      = 0;
-    size_t            ActualLength = 0;
+    int16             CmdIndx        = 0;
+    size_t            ActualLength   = 0;
+    size_t            ExpectedLength = 0;
+    OS_time_t         StartTime;
 
     /* Extract message info */
     CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
@@ -66,6 +75,11 @@ void MD_ExecRequest(const CFE_SB_Buffer_t *BufPtr)
     /* Find index which will be used to access ExpectedLength data */
     CmdIndx = MD_SearchCmdHndlrTbl(CommandCode);
 
+    if (CmdIndx >= 0)
+    {
+        ExpectedLength = MD_ExpectedCmdLength(BufPtr, ActualLength, CmdIndx);
+    }
+
     if (CmdIndx < 0)
     {
         /*
@@ -76,7 +90,7 @@ void MD_ExecRequest(const CFE_SB_Buffer_t *BufPtr)
                           "Command Code %d not found in MD_CmdHandlerTbl structure", CommandCode);
         MD_AppData.ErrCounter++;
     }
-    else if (ActualLength != MD_CmdHandlerTbl[CmdIndx].ExpectedLength)
+    else if (ActualLength != ExpectedLength)
     {
         /*
          * If Command  Length is inconsistent with command type,
@@ -85,12 +99,18 @@ void MD_ExecRequest(const CFE_SB_Buffer_t *BufPtr)
         CFE_EVS_SendEvent(MD_CMD_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Cmd Msg with Bad length Rcvd: ID = 0x%08lX, CC = %d, Exp Len = %d, Len = %d",
                           (unsigned long)CFE_SB_MsgIdToValue(MessageID), CommandCode,
-                          (int)MD_CmdHandlerTbl[CmdIndx].ExpectedLength, (int)ActualLength);
+                          (int)ExpectedLength, (int)ActualLength);
 
         MD_AppData.ErrCounter++;
     }
     else
     {
+        /* Table manage requests from Table Services are timed as table management */
+        if (CommandCode != MD_TBL_MANAGE_CC)
+        {
+            MD_PerfBegin(MD_Perf_Phases_CMD, &StartTime);
+        }
+
         /* Process command */
         switch (CommandCode)
         {
@@ -124,12 +144,59 @@ void MD_ExecRequest(const CFE_SB_Buffer_t *BufPtr)
                 MD_SetSignatureCmd((const MD_SetSignatureCmd_t *) BufPtr);
                 break;
 #endif
+
+            case MD_SET_BATCH_FACTOR_CC:
+                MD_SetBatchFactorCmd((const MD_SetBatchFactorCmd_t *) BufPtr);
+                break;
+
+            case MD_ARM_CAPTURE_CC:
+                MD_ArmCaptureCmd((const MD_ArmCaptureCmd_t *) BufPtr);
+                break;
+
+            case MD_TBL_MANAGE_CC:
+                MD_TblManageCmd((const MD_TblManageCmd_t *) BufPtr);
+                break;
+
+            case MD_JAM_MULTI_DWELL_CC:
+                MD_JamMultiDwellCmd((const MD_JamMultiDwellCmd_t *) BufPtr);
+                break;
+
+            case MD_SEND_PERF_HIST_CC:
+                MD_SendPerfHistCmd((const MD_SendPerfHistCmd_t *) BufPtr);
+                break;
         } /* End Switch */
+
+        if (CommandCode != MD_TBL_MANAGE_CC)
+        {
+            MD_PerfEnd(MD_Perf_Phases_CMD, &StartTime);
+        }
     }
 }
 
 /******************************************************************************/
 
+size_t MD_ExpectedCmdLength(const CFE_SB_Buffer_t *BufPtr, size_t ActualLength, int16 CmdIndx)
+{
+    size_t ExpectedLength = MD_CmdHandlerTbl[CmdIndx].ExpectedLength;
+    size_t FixedLength    = offsetof(MD_JamMultiDwellCmd_t, Payload.Entry);
+    uint16 NumEntries;
+
+    /* A Jam Multiple Dwell command only carries the entries it uses */
+    if ((MD_CmdHandlerTbl[CmdIndx].CmdCode == MD_JAM_MULTI_DWELL_CC) && (ActualLength >= FixedLength))
+    {
+        NumEntries = ((const MD_JamMultiDwellCmd_t *)BufPtr)->Payload.NumEntries;
+
+        if (NumEntries <= MD_INTERFACE_MAX_JAM_ENTRIES)
+        {
+            ExpectedLength = FixedLength + (NumEntries * sizeof(MD_JamMultiEntry_t));
+        }
+    }
+
+    return ExpectedLength;
+}
+
+/******************************************************************************/
+
 void MD_ProcessCommandPacket(const CFE_SB_Buffer_t *BufPtr)
 {
     CFE_SB_MsgId_t MessageID    = CFE_SB_INVALID_MSG_ID;
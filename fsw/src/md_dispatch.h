@@ -49,4 +49,21 @@ void MD_ExecRequest(const CFE_SB_Buffer_t *BufPtr);
  */
 int16 MD_SearchCmdHndlrTbl(CFE_MSG_FcnCode_t CommandCode);
 
+/**
+ * \brief Find expected length of a command
+ *
+ * \par Description
+ *        Returns the length in the command handler table, except for a
+ *        Jam Multiple Dwell command, whose length follows from its entry
+ *        count.  A count over #MD_INTERFACE_MAX_JAM_ENTRIES expects a full
+ *        length command so the count itself can be rejected.
+ *
+ * \param[in] BufPtr       Pointer to Software Bus message buffer
+ * \param[in] ActualLength Length of the message
+ * \param[in] CmdIndx      Index of the command in the command handler table
+ *
+ * \return Expected length of the message in bytes
+ */
+size_t MD_ExpectedCmdLength(const CFE_SB_Buffer_t *BufPtr, size_t ActualLength, int16 CmdIndx);
+
 #endif /* MD_DISPATCH_H */
\ No newline at end of file
@@ -0,0 +1,168 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to encode Memory Dwell packet data against the previous
+ *   cycle, and the matching reference decoder.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "md_dwell_enc.h"
+#include "md_app.h"
+
+/******************************************************************************/
+
+uint16 MD_EncodeDwellData(uint8 *EncPtr, const uint8 *DataPtr, const uint8 *RefPtr, uint16 DataSize)
+{
+    uint16 EncodedSize  = 0;
+    uint16 LiteralStart = 0;
+    uint16 Pos          = 0;
+    uint16 RunLength;
+    uint8  Value;
+
+    while (Pos < DataSize)
+    {
+        Value     = DataPtr[Pos] ^ RefPtr[Pos];
+        RunLength = 1;
+
+        while (((Pos + RunLength) < DataSize) && (RunLength < MD_ENC_MAX_RUN) &&
+               ((uint8)(DataPtr[Pos + RunLength] ^ RefPtr[Pos + RunLength]) == Value))
+        {
+            RunLength++;
+        }
+
+        if (RunLength >= MD_ENC_MIN_RUN)
+        {
+            /* Bytes since the last run go out ahead of this one */
+            EncodedSize += MD_EncodeDwellLiterals(&EncPtr[EncodedSize], &DataPtr[LiteralStart], &RefPtr[LiteralStart],
+                                                  Pos - LiteralStart);
+
+            EncPtr[EncodedSize++] = (uint8)(257 - RunLength);
+            EncPtr[EncodedSize++] = Value;
+
+            LiteralStart = Pos + RunLength;
+        }
+
+        /* Runs too short to save anything are left to be copied as literals */
+        Pos += RunLength;
+    }
+
+    EncodedSize += MD_EncodeDwellLiterals(&EncPtr[EncodedSize], &DataPtr[LiteralStart], &RefPtr[LiteralStart],
+                                          DataSize - LiteralStart);
+
+    return EncodedSize;
+}
+
+/******************************************************************************/
+
+uint16 MD_EncodeDwellLiterals(uint8 *EncPtr, const uint8 *DataPtr, const uint8 *RefPtr, uint16 Count)
+{
+    uint16 EncodedSize = 0;
+    uint16 Pos         = 0;
+    uint16 RunLength;
+    uint16 i;
+
+    while (Pos < Count)
+    {
+        RunLength = Count - Pos;
+        if (RunLength > MD_ENC_MAX_LITERAL)
+        {
+            RunLength = MD_ENC_MAX_LITERAL;
+        }
+
+        EncPtr[EncodedSize++] = (uint8)(RunLength - 1);
+
+        for (i = 0; i < RunLength; i++)
+        {
+            EncPtr[EncodedSize++] = DataPtr[Pos] ^ RefPtr[Pos];
+            Pos++;
+        }
+    }
+
+    return EncodedSize;
+}
+
+/******************************************************************************/
+
+int32 MD_DecodeDwellData(uint8 *DataPtr, const uint8 *RefPtr, uint16 DataSize, const uint8 *EncPtr,
+                         uint16 EncodedSize)
+{
+    int32  Status = CFE_SUCCESS;
+    uint32 EncPos = 0;
+    uint32 Pos    = 0;
+    uint32 RunLength;
+    uint32 i;
+    uint8  Header;
+
+    while ((Status == CFE_SUCCESS) && (EncPos < EncodedSize))
+    {
+        Header = EncPtr[EncPos++];
+
+        if (Header < 128)
+        {
+            /* Literal run */
+            RunLength = Header + 1;
+
+            if (((EncPos + RunLength) > EncodedSize) || ((Pos + RunLength) > DataSize))
+            {
+                Status = MD_DECODE_ERROR;
+            }
+            else
+            {
+                for (i = 0; i < RunLength; i++)
+                {
+                    DataPtr[Pos] = RefPtr[Pos] ^ EncPtr[EncPos++];
+                    Pos++;
+                }
+            }
+        }
+        else if (Header > 128)
+        {
+            /* Repeated byte */
+            RunLength = 257 - Header;
+
+            if ((EncPos >= EncodedSize) || ((Pos + RunLength) > DataSize))
+            {
+                Status = MD_DECODE_ERROR;
+            }
+            else
+            {
+                for (i = 0; i < RunLength; i++)
+                {
+                    DataPtr[Pos] = RefPtr[Pos] ^ EncPtr[EncPos];
+                    Pos++;
+                }
+                EncPos++;
+            }
+        }
+        else
+        {
+            /* 128 is never written by the encoder and is skipped */
+        }
+    }
+
+    if ((Status == CFE_SUCCESS) && (Pos != DataSize))
+    {
+        Status = MD_DECODE_ERROR;
+    }
+
+    return Status;
+}
@@ -0,0 +1,119 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Dwell packet encoding functions.
+ */
+#ifndef MD_DWELL_ENC_H
+#define MD_DWELL_ENC_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+
+#include "cfe.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \name Encoded dwell data run limits
+ * \{
+ */
+#define MD_ENC_MAX_LITERAL 128 /**< \brief Most bytes copied as is after one header byte */
+#define MD_ENC_MIN_RUN     3   /**< \brief Fewest repeated bytes encoded as a run, shorter runs are copied */
+#define MD_ENC_MAX_RUN     128 /**< \brief Most repeated bytes encoded after one header byte */
+/** \} */
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Encode Dwell Data
+ *
+ * \par Description
+ *          XORs DataSize bytes of dwell data with a reference cycle and
+ *          run-length encodes the result.  Bytes that match the reference
+ *          become runs of zeros, so a cycle where little changed encodes
+ *          to a few bytes.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          EncPtr must have room for DataSize plus one byte for every
+ *          #MD_ENC_MAX_LITERAL bytes of it, rounded up, which is the
+ *          encoded size of data that doesn't repeat at all.  Passing a
+ *          reference of all zeros encodes a keyframe.
+ *
+ * \param[out] EncPtr   Where to write the encoded data
+ * \param[in]  DataPtr  Dwell data to encode
+ * \param[in]  RefPtr   Reference cycle, DataSize bytes
+ * \param[in]  DataSize Number of bytes of dwell data
+ *
+ * \return Number of bytes of encoded data
+ */
+uint16 MD_EncodeDwellData(uint8 *EncPtr, const uint8 *DataPtr, const uint8 *RefPtr, uint16 DataSize);
+
+/**
+ * \brief Encode Dwell Data Literals
+ *
+ * \par Description
+ *          Writes Count bytes of dwell data, XORed with the reference,
+ *          as literal runs of up to #MD_ENC_MAX_LITERAL bytes each.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[out] EncPtr  Where to write the encoded data
+ * \param[in]  DataPtr First byte of dwell data to write
+ * \param[in]  RefPtr  Matching byte of the reference cycle
+ * \param[in]  Count   Number of bytes to write
+ *
+ * \return Number of bytes of encoded data
+ */
+uint16 MD_EncodeDwellLiterals(uint8 *EncPtr, const uint8 *DataPtr, const uint8 *RefPtr, uint16 Count);
+
+/**
+ * \brief Decode Dwell Data
+ *
+ * \par Description
+ *          Reference decoder for encoded dwell packets.  Expands the runs
+ *          written by #MD_EncodeDwellData and XORs them with the reference
+ *          cycle to recover the dwell data.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Flight software doesn't decode its own packets; this shows ground
+ *          software how to and checks the encoder against it.  DataPtr may
+ *          be the same as RefPtr to decode a cycle in place over the previous
+ *          one.  Pass a reference of all zeros for a keyframe.
+ *
+ * \param[out] DataPtr     Where to write the decoded dwell data
+ * \param[in]  RefPtr      Reference cycle, DataSize bytes
+ * \param[in]  DataSize    Number of bytes of dwell data expected
+ * \param[in]  EncPtr      Encoded data
+ * \param[in]  EncodedSize Number of bytes of encoded data
+ *
+ * \return Decode status
+ * \retval #CFE_SUCCESS     \copybrief CFE_SUCCESS
+ * \retval #MD_DECODE_ERROR \copybrief MD_DECODE_ERROR
+ */
+int32 MD_DecodeDwellData(uint8 *DataPtr, const uint8 *RefPtr, uint16 DataSize, const uint8 *EncPtr,
+                         uint16 EncodedSize);
+
+#endif
@@ -0,0 +1,258 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to count, rate limit and summarize dwell read errors,
+ *   and to quarantine dwell entries that keep failing.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "md_dwell_err.h"
+#include "md_dwell_pkt.h"
+#include "md_app.h"
+#include "md_eventids.h"
+#include "md_internal_cfg.h"
+#include <string.h>
+
+extern MD_AppData_t MD_AppData;
+
+/******************************************************************************/
+
+void MD_DwellReadFailed(uint16 TblIndex, uint16 EntryIndex)
+{
+    MD_DwellReadErrEntry_t *ErrPtr = &MD_AppData.DwellReportControl[TblIndex].ReadErr[EntryIndex];
+
+    if (ErrPtr->FailRun == 0)
+    {
+        MD_AppData.MD_DwellTables[TblIndex].FailingEntries++;
+    }
+
+    /* Counts stop at their largest value rather than wrap */
+    if (ErrPtr->FailRun < 0xFFFFFFFF)
+    {
+        ErrPtr->FailRun++;
+    }
+
+    if (ErrPtr->ErrCount < 0xFFFFFFFF)
+    {
+        ErrPtr->ErrCount++;
+    }
+
+    /* Report failures further and further apart, leaving the rest for the summary */
+    if (ErrPtr->ErrCount >= ErrPtr->NextEventCount)
+    {
+        if (ErrPtr->ErrCount > (0xFFFFFFFF / 2))
+        {
+            ErrPtr->NextEventCount = 0xFFFFFFFF;
+        }
+        else
+        {
+            ErrPtr->NextEventCount = ErrPtr->ErrCount * 2;
+        }
+
+        CFE_EVS_SendEvent(MD_DWELL_LOOP_GET_DWELL_DATA_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Dwell Table failed to read entry %d in table %d (%u failures, next reported at %u)",
+                          EntryIndex, TblIndex, (unsigned int)ErrPtr->ErrCount,
+                          (unsigned int)ErrPtr->NextEventCount);
+    }
+    else
+    {
+        MD_AppData.ReadErrSummary.UnreportedCount++;
+    }
+
+#if MD_INTERNAL_READ_ERR_QUARANTINE_COUNT != 0
+    if ((ErrPtr->FailRun >= MD_INTERNAL_READ_ERR_QUARANTINE_COUNT) && !ErrPtr->Quarantined)
+    {
+        MD_QuarantineDwellEntry(TblIndex, EntryIndex);
+
+        /* Failing again on a retry quarantines the entry without another event */
+        if (ErrPtr->FailRun == MD_INTERNAL_READ_ERR_QUARANTINE_COUNT)
+        {
+            CFE_EVS_SendEvent(MD_READ_ERR_QUARANTINE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Dwell Table entry %d in table %d quarantined after %u failures in a row", EntryIndex,
+                              TblIndex, (unsigned int)ErrPtr->FailRun);
+        }
+    }
+#endif
+}
+
+/******************************************************************************/
+
+void MD_DwellReadsSucceeded(uint16 TblIndex, uint16 FirstEntryIndex, uint16 LastEntryIndex)
+{
+    MD_DwellReadErrEntry_t *ErrPtr    = NULL;
+    bool                    Recovered = false;
+    uint16                  EntryIndex;
+
+    for (EntryIndex = FirstEntryIndex; EntryIndex <= LastEntryIndex; EntryIndex++)
+    {
+        ErrPtr = &MD_AppData.DwellReportControl[TblIndex].ReadErr[EntryIndex];
+
+        if ((ErrPtr->FailRun != 0) && !ErrPtr->Quarantined)
+        {
+#if MD_INTERNAL_READ_ERR_QUARANTINE_COUNT != 0
+            /* A run this long was quarantined, and split the blocks around the entry */
+            if (ErrPtr->FailRun >= MD_INTERNAL_READ_ERR_QUARANTINE_COUNT)
+            {
+                Recovered = true;
+            }
+#endif
+
+            ErrPtr->FailRun = 0;
+            MD_AppData.MD_DwellTables[TblIndex].FailingEntries--;
+        }
+    }
+
+    if (Recovered)
+    {
+        MD_RejoinDwellPlan(TblIndex);
+    }
+}
+
+/******************************************************************************/
+
+bool MD_DwellEntryUnread(uint16 TblIndex, uint16 EntryIndex)
+{
+    /* Only a table with failing entries can have entries without a value */
+    return (MD_AppData.MD_DwellTables[TblIndex].FailingEntries != 0) &&
+           (MD_AppData.DwellReportControl[TblIndex].ReadErr[EntryIndex].FailRun != 0);
+}
+
+/******************************************************************************/
+
+void MD_QuarantineDwellEntry(uint16 TblIndex, uint16 EntryIndex)
+{
+    MD_AppData.DwellReportControl[TblIndex].ReadErr[EntryIndex].Quarantined = true;
+    MD_AppData.DwellReportControl[TblIndex].QuarantinedEntries++;
+
+    MD_SplitDwellPlan(TblIndex, EntryIndex);
+}
+
+/******************************************************************************/
+
+void MD_SplitDwellPlan(uint16 TblIndex, uint16 EntryIndex)
+{
+    MD_DwellControlEntry_t *EntryPtr = MD_AppData.MD_DwellTables[TblIndex].Entry;
+    int32                   BlockIndex;
+
+    /* End the blocks running into the entry just before it */
+    for (BlockIndex = (int32)EntryIndex - 1;
+         (BlockIndex >= 0) && (EntryPtr[BlockIndex].BlockEntries > (EntryIndex - BlockIndex)); BlockIndex--)
+    {
+        EntryPtr[BlockIndex].BlockEntries = EntryIndex - BlockIndex;
+        EntryPtr[BlockIndex].BlockBytes -= EntryPtr[EntryIndex].BlockBytes;
+    }
+
+    /* Retries read the entry on its own, leaving the block after it to the next entry */
+    EntryPtr[EntryIndex].BlockEntries = 1;
+    EntryPtr[EntryIndex].BlockBytes   = EntryPtr[EntryIndex].Length;
+}
+
+/******************************************************************************/
+
+void MD_RejoinDwellPlan(uint16 TblIndex)
+{
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TblIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TblIndex];
+#if MD_INTERNAL_READ_ERR_QUARANTINE_COUNT != 0
+    uint16 EntryIndex;
+#endif
+
+    MD_CompileDwellPlan(TblPtr->Entry, ReportPtr->Group, TblPtr->AddrCount);
+
+#if MD_INTERNAL_READ_ERR_QUARANTINE_COUNT != 0
+    /* Entries still quarantined, or waiting on their retry, stay out of the blocks */
+    for (EntryIndex = 0; EntryIndex < TblPtr->AddrCount; EntryIndex++)
+    {
+        if (ReportPtr->ReadErr[EntryIndex].FailRun >= MD_INTERNAL_READ_ERR_QUARANTINE_COUNT)
+        {
+            MD_SplitDwellPlan(TblIndex, EntryIndex);
+        }
+    }
+#endif
+}
+
+/******************************************************************************/
+
+void MD_ReportDwellReadErrors(uint32 Wakeups)
+{
+    MD_ReadErrSummary_t *    SummaryPtr       = &MD_AppData.ReadErrSummary;
+    MD_DwellReportControl_t *ReportPtr        = NULL;
+    uint32                   FailingCount     = 0;
+    uint32                   QuarantinedCount = 0;
+    uint16                   TblIndex;
+    uint16                   EntryIndex;
+
+    if (SummaryPtr->Countdown > Wakeups)
+    {
+        SummaryPtr->Countdown -= Wakeups;
+    }
+    else
+    {
+        SummaryPtr->Countdown = MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL;
+
+        for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+        {
+            ReportPtr = &MD_AppData.DwellReportControl[TblIndex];
+
+            FailingCount += MD_AppData.MD_DwellTables[TblIndex].FailingEntries;
+            QuarantinedCount += ReportPtr->QuarantinedEntries;
+
+            /* Read quarantined entries once more, to see if they recovered */
+            if (ReportPtr->QuarantinedEntries != 0)
+            {
+                for (EntryIndex = 0; EntryIndex < MD_AppData.MD_DwellTables[TblIndex].Capacity; EntryIndex++)
+                {
+                    ReportPtr->ReadErr[EntryIndex].Quarantined = false;
+                }
+
+                ReportPtr->QuarantinedEntries = 0;
+            }
+        }
+
+        if (SummaryPtr->UnreportedCount != 0)
+        {
+            CFE_EVS_SendEvent(MD_READ_ERR_SUMMARY_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Dwell read errors: %u failures not reported since the last summary, %u entries "
+                              "failing, %u quarantined",
+                              (unsigned int)SummaryPtr->UnreportedCount, (unsigned int)FailingCount,
+                              (unsigned int)QuarantinedCount);
+
+            SummaryPtr->UnreportedCount = 0;
+        }
+    }
+}
+
+/******************************************************************************/
+
+void MD_ResetDwellReadErrors(uint16 TblIndex)
+{
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TblIndex];
+    uint16                   EntryIndex;
+
+    for (EntryIndex = 0; EntryIndex < MD_AppData.MD_DwellTables[TblIndex].Capacity; EntryIndex++)
+    {
+        memset(&ReportPtr->ReadErr[EntryIndex], 0, sizeof(ReportPtr->ReadErr[EntryIndex]));
+    }
+
+    MD_AppData.MD_DwellTables[TblIndex].FailingEntries = 0;
+    ReportPtr->QuarantinedEntries                      = 0;
+}
@@ -0,0 +1,175 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Dwell read error reporting functions.
+ */
+#ifndef MD_DWELL_ERR_H
+#define MD_DWELL_ERR_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+
+#include "cfe.h"
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Record a Failed Dwell Read
+ *
+ * \par Description
+ *          Counts a failed read of a dwell entry.  The failure is reported
+ *          in a #MD_DWELL_LOOP_GET_DWELL_DATA_ERR_EID event if it is the
+ *          entry's 1st, 2nd, 4th, 8th and so on since its table was
+ *          updated, and left for the next summary otherwise.  An entry
+ *          that fails #MD_INTERNAL_READ_ERR_QUARANTINE_COUNT times in a
+ *          row is quarantined.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] TblIndex   identifies source dwell table (0..)
+ * \param[in] EntryIndex identifies dwell entry within specified table (0..)
+ */
+void MD_DwellReadFailed(uint16 TblIndex, uint16 EntryIndex);
+
+/**
+ * \brief Record Successful Dwell Reads
+ *
+ * \par Description
+ *          Ends the runs of failures of entries that have now been read,
+ *          so they are no longer counted as failing.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Quarantined entries in the range weren't read and are left
+ *          as they are.  Only needed while the table has failing entries.
+ *          An entry that recovers from quarantine has the blocks around
+ *          it rejoined.
+ *
+ * \param[in] TblIndex        identifies source dwell table (0..)
+ * \param[in] FirstEntryIndex first dwell entry read
+ * \param[in] LastEntryIndex  last dwell entry read
+ */
+void MD_DwellReadsSucceeded(uint16 TblIndex, uint16 FirstEntryIndex, uint16 LastEntryIndex);
+
+/**
+ * \brief Dwell Entry Unread
+ *
+ * \par Description
+ *          Tells whether a dwell entry's data in its table's current cycle
+ *          is missing, because its last read failed or it was quarantined.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Deadbands, statistics and capture triggers leave such entries
+ *          out.
+ *
+ * \param[in] TblIndex   identifies source dwell table (0..)
+ * \param[in] EntryIndex identifies dwell entry within specified table (0..)
+ *
+ * \return Whether the entry has no value in the cycle
+ */
+bool MD_DwellEntryUnread(uint16 TblIndex, uint16 EntryIndex);
+
+/**
+ * \brief Quarantine a Dwell Entry
+ *
+ * \par Description
+ *          Leaves a dwell entry out of its table's reads until the next
+ *          read error summary retries it, and takes it out of the blocks
+ *          read together so the entries around it can still be read as
+ *          blocks.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The blocks stay split until the entry recovers or the table is
+ *          next updated.  A member of a snapshot group is still read with
+ *          its group.
+ *
+ * \param[in] TblIndex   identifies source dwell table (0..)
+ * \param[in] EntryIndex identifies dwell entry within specified table (0..)
+ */
+void MD_QuarantineDwellEntry(uint16 TblIndex, uint16 EntryIndex);
+
+/**
+ * \brief Split the Dwell Sampling Plan
+ *
+ * \par Description
+ *          Takes a dwell entry out of the blocks read together in its
+ *          table's sampling plan, ending the blocks before it and reading
+ *          it on its own.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The entries after it keep the blocks they start.
+ *
+ * \param[in] TblIndex   identifies source dwell table (0..)
+ * \param[in] EntryIndex identifies dwell entry within specified table (0..)
+ */
+void MD_SplitDwellPlan(uint16 TblIndex, uint16 EntryIndex);
+
+/**
+ * \brief Rejoin the Dwell Sampling Plan
+ *
+ * \par Description
+ *          Compiles a dwell table's sampling plan again once a quarantined
+ *          entry recovers, so its blocks are read together as before, and
+ *          splits it again around the entries that haven't recovered.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Blocks are compiled for every entry, so the plan can be
+ *          replaced in the middle of a cycle.
+ *
+ * \param[in] TblIndex identifies dwell table (0..)
+ */
+void MD_RejoinDwellPlan(uint16 TblIndex);
+
+/**
+ * \brief Report Dwell Read Errors
+ *
+ * \par Description
+ *          Counts down the wakeups to the next read error summary.  Each
+ *          #MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL wakeups, the failed reads
+ *          that weren't reported in events of their own are reported in a
+ *          #MD_READ_ERR_SUMMARY_ERR_EID event, and quarantined entries are
+ *          let back into their tables' reads to see if they recovered.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called once per wakeup message, before the dwell tables are
+ *          processed.
+ *
+ * \param[in] Wakeups Number of wakeups the message stands for
+ */
+void MD_ReportDwellReadErrors(uint32 Wakeups);
+
+/**
+ * \brief Reset Dwell Read Errors
+ *
+ * \par Description
+ *          Forgets the read errors of a dwell table's entries, and lets
+ *          any quarantined entries back into its reads.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called whenever the table's entries change.
+ *
+ * \param[in] TblIndex identifies dwell table (0..)
+ */
+void MD_ResetDwellReadErrors(uint16 TblIndex);
+
+#endif
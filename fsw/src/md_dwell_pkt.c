@@ -25,11 +25,18 @@
 ** Includes
 *************************************************************************/
 #include "md_dwell_pkt.h"
+#include "md_dwell_enc.h"
+#include "md_capture.h"
+#include "md_dwell_err.h"
+#include "md_perf.h"
+#include "md_snapshot.h"
 #include "md_utils.h"
 #include "md_app.h"
 #include "md_eventids.h"
 #include <string.h>
+#include <stddef.h>
 #include "md_extern_typedefs.h"
+#include "md_internal_cfg.h"
 
 extern MD_AppData_t MD_AppData;
 
@@ -40,107 +47,371 @@ CFE_Status_t MD_DwellLoop(const MD_Wakeup_t *Msg)
     int32                    Result;
     CFE_Status_t             Status;
     uint16                   TblIndex;
-    uint16                   EntryIndex;
-    uint16                   NumDwellAddresses;
-    MD_DwellPacketControl_t *TblPtr = NULL;
+    uint32                   Wakeups;
+    CFE_MSG_SequenceCount_t  SeqCount = 0;
+    MD_DwellPacketControl_t *TblPtr   = NULL;
 
     Status = CFE_SUCCESS;
 
-    /* Check each dwell table */
-    for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+    /* Find out whether wakeups were missed since the last one */
+    CFE_MSG_GetSequenceCount(CFE_MSG_PTR(Msg->CmdHeader), &SeqCount);
+    Wakeups = MD_CountWakeups(SeqCount);
+
+    /* Summarize read errors left out of events, and retry quarantined entries */
+    MD_ReportDwellReadErrors(Wakeups);
+
+    /* Advance the schedule time base by one wakeup at a time */
+    while (Wakeups > 0)
     {
-        TblPtr            = &MD_AppData.MD_DwellTables[TblIndex];
-        NumDwellAddresses = TblPtr->AddrCount;
+        Wakeups--;
+        MD_AppData.DwellSchedule.WakeupCount++;
 
-        /* Process enabled dwell tables */
-        if ((TblPtr->Enabled == MD_Dwell_States_ENABLED) && (TblPtr->Rate > 0))
+        /* Process only those dwell tables that are due on this wakeup */
+        while (MD_PopDueDwellTable(&TblIndex))
         {
+            TblPtr = &MD_AppData.MD_DwellTables[TblIndex];
+
             /*
-            ** Handle special case that dwell pkt is already full because
-            ** pkt size was shortened after data had been written to the pkt.
+            ** Tables are removed from the schedule when disabled, but check
+            ** again in case the rate was reduced to zero while scheduled.
             */
-
-            if (TblPtr->CurrentEntry >= NumDwellAddresses)
+            if ((TblPtr->Enabled == MD_Dwell_States_ENABLED) && (TblPtr->Rate > 0))
             {
-                MD_SendDwellPkt(TblIndex);
+                Result = MD_SampleDwellTable(TblIndex);
 
-                /* Initialize CurrentEntry index */
-                TblPtr->CurrentEntry = 0;
-                TblPtr->PktOffset    = 0;
-                TblPtr->Countdown    = TblPtr->Entry[NumDwellAddresses - 1].Delay;
+                if (Result != CFE_SUCCESS)
+                {
+                    Status = Result;
+                }
+
+                /* Reschedule the table for its next read */
+                MD_ScheduleDwellTable(TblIndex, TblPtr->Countdown);
             }
 
-            else
-            /*
-            ** Handle nominal processing
-            */
-            {
-                /* Decrement counter */
-                TblPtr->Countdown--;
+        } /* end while tables are due */
+    } /* end while wakeups to process */
+
+    /* Tables timed against CFE_TIME are read once their deadlines pass */
+    Result = MD_ProcessDwellDeadlines();
+
+    if (Result != CFE_SUCCESS)
+    {
+        Status = Result;
+    }
+
+    return Status;
+}
+
+/******************************************************************************/
+
+int32 MD_SampleDwellTable(uint16 TblIndex)
+{
+    int32               Result;
+    uint32              SampleTime;
+    OS_time_t           StartTime;
+    MD_DwellCounters_t *CountersPtr = &MD_AppData.DwellCounters[TblIndex];
+
+    MD_PerfBegin(MD_Perf_Phases_DWELL_SAMPLE, &StartTime);
+
+    Result = MD_ProcessDwellTable(TblIndex);
+
+    SampleTime = MD_PerfEnd(MD_Perf_Phases_DWELL_SAMPLE, &StartTime);
+
+    /* Keep the longest time the table took on any one wakeup */
+    if (SampleTime > CountersPtr->MaxSampleTime)
+    {
+        CountersPtr->MaxSampleTime = SampleTime;
+    }
+
+    return Result;
+}
+
+/******************************************************************************/
+
+int32 MD_ProcessDwellDeadlines(void)
+{
+    MD_DwellDeadlines_t *    DeadlinesPtr = &MD_AppData.DwellDeadlines;
+    MD_DwellPacketControl_t *TblPtr       = NULL;
+    int32                    Result;
+    int32                    Status = CFE_SUCCESS;
+    uint16                   TblIndex;
+    uint64                   Now;
+
+    /* Nothing to look at until the earliest deadline passes */
+    if (DeadlinesPtr->NextDeadline != 0)
+    {
+        Now = MD_GetDeadlineTime();
+
+        if (Now >= DeadlinesPtr->NextDeadline)
+        {
+            /* Every table due is read on this wakeup, and the earliest deadline found again */
+            DeadlinesPtr->NextDeadline = 0;
 
-                /* Check if it's time to collect data */
-                while (TblPtr->Countdown == 0)
+            for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+            {
+                if ((DeadlinesPtr->Deadline[TblIndex] != 0) && (Now >= DeadlinesPtr->Deadline[TblIndex]))
                 {
-                    EntryIndex = TblPtr->CurrentEntry;
+                    TblPtr = &MD_AppData.MD_DwellTables[TblIndex];
 
-                    /* Read data for next address and write it to dwell pkt */
-                    Result = MD_GetDwellData(TblIndex, EntryIndex);
+                    /* Packets of the cycle are time stamped with the deadline it was read for */
+                    DeadlinesPtr->CycleTime[TblIndex] = DeadlinesPtr->Deadline[TblIndex];
 
-                    if (Result != CFE_SUCCESS)
+                    /* A whole period going by after the deadline means at least one cycle was never read */
+                    if ((Now - DeadlinesPtr->Deadline[TblIndex]) >=
+                        ((uint64)DeadlinesPtr->PeriodMsec[TblIndex] * 1000))
                     {
-                        /* Send error event message */
-                        CFE_EVS_SendEvent(MD_DWELL_LOOP_GET_DWELL_DATA_ERR_EID, CFE_EVS_EventType_ERROR,
-                                          "Dwell Table failed to read entry %d in table %d ", EntryIndex, TblIndex);
-                        /* Don't exit here yet, still need to increment counters or send the packet */
-                        Status = Result;
+                        MD_AppData.DwellCounters[TblIndex].CycleOverrunCount++;
                     }
 
-                    /* Check if the dwell pkt is now full */
-                    if (EntryIndex == NumDwellAddresses - 1)
-
-                    /* Case:  Just filled last active entry of dwell table */
+                    if ((TblPtr->Enabled == MD_Dwell_States_ENABLED) && (TblPtr->AddrCount > 0))
                     {
-                        /*
-                        ** Send dwell packet
-                        */
+                        Result = MD_SampleDwellTable(TblIndex);
+
+                        if (Result != CFE_SUCCESS)
+                        {
+                            Status = Result;
+                        }
+                    }
 
-                        MD_SendDwellPkt(TblIndex);
+                    /* Skip straight to the first deadline still to come */
+                    MD_ScheduleDwellDeadline(TblIndex, Now);
+                }
+                else if ((DeadlinesPtr->Deadline[TblIndex] != 0) &&
+                         ((DeadlinesPtr->NextDeadline == 0) ||
+                          (DeadlinesPtr->Deadline[TblIndex] < DeadlinesPtr->NextDeadline)))
+                {
+                    DeadlinesPtr->NextDeadline = DeadlinesPtr->Deadline[TblIndex];
+                }
+            }
+        }
+    }
 
-                        /*
-                        ** Assign control values to cause dwell processing to
-                        ** continue at beginning of dwell control structure.
-                        */
+    return Status;
+}
 
-                        /* Reset countdown timer based on current Delay field */
-                        TblPtr->Countdown = TblPtr->Entry[EntryIndex].Delay;
+/******************************************************************************/
 
-                        /* Initialize CurrentEntry index */
-                        TblPtr->CurrentEntry = 0;
-                        TblPtr->PktOffset    = 0;
-                    }
+uint32 MD_CountWakeups(CFE_MSG_SequenceCount_t SeqCount)
+{
+    MD_DwellSchedule_t *    SchedPtr = &MD_AppData.DwellSchedule;
+    CFE_MSG_SequenceCount_t ExpectedSeqCount;
+    uint32                  Missed  = 0;
+    uint32                  Wakeups = 1;
 
-                    else
-                    /* Case: There are more addresses to read for current pkt.*/
-                    {
-                        /*
-                        ** Assign control values to cause dwell processing to
-                        ** continue at next entry in dwell control structure.
-                        */
+    if (SchedPtr->LastSeqValid && (SeqCount != SchedPtr->LastSeqCount))
+    {
+        /* Step through the sequence counts of missed wakeups, as far as they could be made up for */
+        ExpectedSeqCount = CFE_MSG_GetNextSequenceCount(SchedPtr->LastSeqCount);
+
+        while ((SeqCount != ExpectedSeqCount) && (Missed <= MD_INTERNAL_MAX_CATCHUP_WAKEUPS))
+        {
+            ExpectedSeqCount = CFE_MSG_GetNextSequenceCount(ExpectedSeqCount);
+            Missed++;
+        }
 
-                        /* Reset countdown timer based on current Delay field */
-                        TblPtr->Countdown = TblPtr->Entry[EntryIndex].Delay;
+        if (Missed > 0)
+        {
+            MD_AppData.WakeupCounters.OverrunCount++;
 
-                        /* Increment CurrentEntry index */
-                        TblPtr->CurrentEntry++;
-                    }
+            if (Missed <= MD_INTERNAL_MAX_CATCHUP_WAKEUPS)
+            {
+                MD_AppData.WakeupCounters.CatchupCount += Missed;
+                Wakeups += Missed;
+            }
+            else
+            {
+                /* Not advancing the time base past the gap shifts every schedule with it */
+                MD_CountRephase(SchedPtr->LastSeqCount, SeqCount);
+            }
+        }
+    }
+
+    SchedPtr->LastSeqCount = SeqCount;
+    SchedPtr->LastSeqValid = true;
+
+    return Wakeups;
+}
+
+/******************************************************************************/
+
+void MD_CountRephase(CFE_MSG_SequenceCount_t LastSeqCount, CFE_MSG_SequenceCount_t SeqCount)
+{
+    MD_WakeupCounters_t *CountersPtr = &MD_AppData.WakeupCounters;
+
+    if (CountersPtr->RephaseCount < 0xFFFFFFFF)
+    {
+        CountersPtr->RephaseCount++;
+    }
+
+    /* Report rephases further and further apart, leaving the rest to housekeeping */
+    if (CountersPtr->RephaseCount >= CountersPtr->NextRephaseEvent)
+    {
+        if (CountersPtr->RephaseCount > (0xFFFFFFFF / 2))
+        {
+            CountersPtr->NextRephaseEvent = 0xFFFFFFFF;
+        }
+        else
+        {
+            CountersPtr->NextRephaseEvent = CountersPtr->RephaseCount * 2;
+        }
+
+        CFE_EVS_SendEvent(MD_WAKEUP_REPHASE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Wakeup sequence count jumped from %u to %u, more than %d missed wakeups: schedules "
+                          "shifted (%u rephases, next reported at %u)",
+                          (unsigned int)LastSeqCount, (unsigned int)SeqCount, MD_INTERNAL_MAX_CATCHUP_WAKEUPS,
+                          (unsigned int)CountersPtr->RephaseCount, (unsigned int)CountersPtr->NextRephaseEvent);
+    }
+}
+
+/******************************************************************************/
+
+int32 MD_ProcessDwellTable(uint16 TblIndex)
+{
+    int32                    Result;
+    int32                    Status;
+    uint16                   EntryIndex;
+    uint16                   FirstEntryIndex;
+    uint16                   NumDwellAddresses;
+    MD_DwellPacketControl_t *TblPtr      = &MD_AppData.MD_DwellTables[TblIndex];
+    MD_DwellCounters_t *     CountersPtr = &MD_AppData.DwellCounters[TblIndex];
+    const uint16 *           GroupPtr    = MD_AppData.DwellReportControl[TblIndex].Group;
+    bool                     Timed       = MD_DwellTableIsTimed(TblIndex);
+    bool                     CycleDone   = false;
+    bool                     Skipped;
+
+    Status            = CFE_SUCCESS;
+    NumDwellAddresses = TblPtr->AddrCount;
+
+    /*
+    ** Handle special case that dwell pkt is already full because
+    ** pkt size was shortened after data had been written to the pkt.
+    */
+
+    if (TblPtr->CurrentEntry >= NumDwellAddresses)
+    {
+        MD_SendDwellPkt(TblIndex);
+
+        /* Initialize CurrentEntry index */
+        TblPtr->CurrentEntry = 0;
+        TblPtr->PktOffset    = 0;
+        TblPtr->Countdown    = TblPtr->Entry[NumDwellAddresses - 1].Delay;
+    }
+
+    else
+    /*
+    ** Handle nominal processing
+    */
+    {
+        /* Table is due, so its countdown has expired */
+        TblPtr->Countdown = 0;
+
+        /* Collect data until a non-zero delay is reached, or to the end of the cycle if timed */
+        while (!CycleDone && ((TblPtr->Countdown == 0) || Timed))
+        {
+            FirstEntryIndex = TblPtr->CurrentEntry;
+
+            /* Only a table with failing entries can have quarantined ones */
+            Skipped = (TblPtr->FailingEntries != 0) &&
+                      MD_AppData.DwellReportControl[TblIndex].ReadErr[FirstEntryIndex].Quarantined;
+
+            if (Skipped)
+            {
+                /* Leave a quarantined entry unread until it is retried */
+                MD_SkipDwellData(TblIndex, FirstEntryIndex);
+
+                EntryIndex = FirstEntryIndex;
+                Result     = CFE_SUCCESS;
+            }
+            /* Read contiguous block of addresses and write it to dwell pkt */
+            else if ((TblPtr->Entry[FirstEntryIndex].BlockEntries > 1) &&
+                     (MD_GetDwellBlockData(TblIndex, FirstEntryIndex) == CFE_SUCCESS))
+            {
+                /* Continue as if each entry of the block had been read in turn */
+                EntryIndex           = FirstEntryIndex + TblPtr->Entry[FirstEntryIndex].BlockEntries - 1;
+                TblPtr->CurrentEntry = EntryIndex;
+                Result               = CFE_SUCCESS;
+            }
+            else if (GroupPtr[FirstEntryIndex] != 0)
+            {
+                /* Write the value from the latest pass over the entry's snapshot group */
+                Result = MD_GetSnapshotData(TblIndex, FirstEntryIndex);
+
+                EntryIndex = FirstEntryIndex;
+            }
+            else
+            {
+                /* Read data for next address and write it to dwell pkt */
+                Result = MD_GetDwellData(TblIndex, FirstEntryIndex);
+
+                EntryIndex = FirstEntryIndex;
+            }
+
+            if (!Skipped)
+            {
+                CountersPtr->SampleCount += EntryIndex - FirstEntryIndex + 1;
+            }
+
+            if (Result != CFE_SUCCESS)
+            {
+                CountersPtr->ReadErrCount++;
+
+                /* Report the error, as often as the entry's failures allow */
+                MD_DwellReadFailed(TblIndex, FirstEntryIndex);
+
+                /* Don't exit here yet, still need to increment counters or send the packet */
+                Status = Result;
+            }
+            else if (TblPtr->FailingEntries != 0)
+            {
+                MD_DwellReadsSucceeded(TblIndex, FirstEntryIndex, EntryIndex);
+            }
+
+            /* Check if the dwell pkt is now full */
+            if (EntryIndex == NumDwellAddresses - 1)
+
+            /* Case:  Just filled last active entry of dwell table */
+            {
+                /*
+                ** Send dwell packet
+                */
+
+                MD_SendDwellPkt(TblIndex);
+
+                /*
+                ** Assign control values to cause dwell processing to
+                ** continue at beginning of dwell control structure.
+                */
+
+                /* Reset countdown timer based on current Delay field */
+                TblPtr->Countdown = TblPtr->Entry[EntryIndex].Delay;
+
+                /* Initialize CurrentEntry index */
+                TblPtr->CurrentEntry = 0;
+                TblPtr->PktOffset    = 0;
+
+                /* A timed table reads one cycle per deadline */
+                CycleDone = Timed;
+            }
 
-                } /* end while Countdown == 0 */
+            else
+            /* Case: There are more addresses to read for current pkt.*/
+            {
+                /*
+                ** Assign control values to cause dwell processing to
+                ** continue at next entry in dwell control structure.
+                */
+
+                /* Reset countdown timer based on current Delay field */
+                TblPtr->Countdown = TblPtr->Entry[EntryIndex].Delay;
+
+                /* Increment CurrentEntry index */
+                TblPtr->CurrentEntry++;
+            }
 
-            } /* end else handle nominal processing */
+        } /* end while Countdown == 0 */
 
-        } /* end if current dwell stream enabled */
+    } /* end else handle nominal processing */
 
-    } /* end for each dwell table */
     return Status;
 }
 
@@ -148,7 +419,7 @@ CFE_Status_t MD_DwellLoop(const MD_Wakeup_t *Msg)
 
 int32 MD_GetDwellData(uint16 TblIndex, uint16 EntryIndex)
 {
-    uint8                    NumBytes   = 0; /* Num of bytes to read */
+    uint16                   NumBytes   = 0; /* Num of bytes to read */
     uint32                   MemReadVal = 0; /* 1-, 2-, or 4-byte value */
     MD_DwellPacketControl_t *TblPtr     = &MD_AppData.MD_DwellTables[TblIndex];
     int32                    Status     = CFE_SUCCESS;
@@ -181,18 +452,36 @@ int32 MD_GetDwellData(uint16 TblIndex, uint16 EntryIndex)
             }
             break;
         default:
-            /* Invalid dwell length */
-            /* Shouldn't ever get here unless length value was corrupted. */
-            Status = INVALID_DWELL_ADDR_LEN;
+            if ((NumBytes >= MD_MIN_BLOCK_DWELL_LENGTH) && (NumBytes <= MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH))
+            {
+                /* Block dwell: copy straight into the dwell packet */
+                if (CFE_PSP_MemCpy(&MD_GetDwellPktBuf(TblIndex)->Payload.Data[TblPtr->PktOffset],
+                                   (void *)DwellAddress, NumBytes) != CFE_PSP_SUCCESS)
+                {
+                    Status = BLOCK_MEM_ADDR_READ_ERR;
+                }
+            }
+            else
+            {
+                /* Invalid dwell length */
+                /* Shouldn't ever get here unless length value was corrupted. */
+                Status = INVALID_DWELL_ADDR_LEN;
+            }
             break;
     }
 
     /* If value was read successfully, copy value to dwell packet. */
     /* Wouldn't want to copy, if say, there was an invalid length & we */
-    /* didn't read. */
-    if (Status == CFE_SUCCESS)
+    /* didn't read.  Block dwells were already copied in place. */
+    if ((Status == CFE_SUCCESS) && (NumBytes <= sizeof(MemReadVal)))
+    {
+        memcpy(&MD_GetDwellPktBuf(TblIndex)->Payload.Data[TblPtr->PktOffset], &MemReadVal, NumBytes);
+    }
+    else if ((Status != CFE_SUCCESS) && (Status != INVALID_DWELL_ADDR_LEN) &&
+             (MD_GetDwellPktBuf(TblIndex) != &MD_AppData.MD_DwellPkt[TblIndex]))
     {
-        memcpy(&MD_AppData.MD_DwellPkt[TblIndex].Payload.Data[TblPtr->PktOffset], &MemReadVal, NumBytes);
+        /* Don't telemeter whatever a software bus buffer held before */
+        memset(&TblPtr->PktBuf->Payload.Data[TblPtr->PktOffset], 0, NumBytes);
     }
 
     /* Update write location in dwell packet */
@@ -203,7 +492,119 @@ int32 MD_GetDwellData(uint16 TblIndex, uint16 EntryIndex)
 
 /******************************************************************************/
 
-void MD_SendDwellPkt(uint16 TableIndex)
+int32 MD_GetDwellBlockData(uint16 TblIndex, uint16 EntryIndex)
+{
+    uint16                   NumBytes;
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[TblIndex];
+    int32                    Status = CFE_SUCCESS;
+
+    NumBytes = TblPtr->Entry[EntryIndex].BlockBytes;
+
+    /* Copy the whole block straight into the dwell packet */
+    if (CFE_PSP_MemCpy(&MD_GetDwellPktBuf(TblIndex)->Payload.Data[TblPtr->PktOffset],
+                       (void *)TblPtr->Entry[EntryIndex].ResolvedAddress, NumBytes) != CFE_PSP_SUCCESS)
+    {
+        Status = BLOCK_MEM_ADDR_READ_ERR;
+    }
+    else
+    {
+        /* Update write location in dwell packet */
+        TblPtr->PktOffset += NumBytes;
+    }
+
+    return Status;
+}
+
+/******************************************************************************/
+
+void MD_SkipDwellData(uint16 TblIndex, uint16 EntryIndex)
+{
+    MD_DwellPacketControl_t *TblPtr   = &MD_AppData.MD_DwellTables[TblIndex];
+    uint16                   NumBytes = TblPtr->Entry[EntryIndex].Length;
+
+    /* Sent as zeros whichever buffer the packet is filled in, the housekeeping counts say why */
+    memset(&MD_GetDwellPktBuf(TblIndex)->Payload.Data[TblPtr->PktOffset], 0, NumBytes);
+
+    /* Update write location in dwell packet */
+    TblPtr->PktOffset += NumBytes;
+}
+
+/******************************************************************************/
+
+void MD_CompileDwellPlan(MD_DwellControlEntry_t *EntryPtr, const uint16 *GroupPtr, uint16 AddrCount)
+{
+    int32                   EntryIndex;
+    MD_DwellControlEntry_t *ThisEntry;
+#if MD_INTERNAL_COALESCE_DWELL_READS == 1
+    MD_DwellControlEntry_t *NextEntry;
+#endif
+
+    /* Work back from the last active entry so each entry can extend the block that follows it */
+    for (EntryIndex = (int32)AddrCount - 1; EntryIndex >= 0; EntryIndex--)
+    {
+        ThisEntry = &EntryPtr[EntryIndex];
+
+        ThisEntry->BlockEntries = 1;
+        ThisEntry->BlockBytes   = ThisEntry->Length;
+
+#if MD_INTERNAL_COALESCE_DWELL_READS == 1
+        /* Snapshot group members are read with their group, never in a block */
+        if (((EntryIndex + 1) < AddrCount) && (GroupPtr[EntryIndex] == 0) && (GroupPtr[EntryIndex + 1] == 0))
+        {
+            NextEntry = &EntryPtr[EntryIndex + 1];
+
+            if ((ThisEntry->Delay == 0) && MD_ValidFieldLength(ThisEntry->Length) &&
+                MD_ValidFieldLength(NextEntry->Length) &&
+                ((ThisEntry->ResolvedAddress + ThisEntry->Length) == NextEntry->ResolvedAddress))
+            {
+                ThisEntry->BlockEntries = NextEntry->BlockEntries + 1;
+                ThisEntry->BlockBytes   = NextEntry->BlockBytes + ThisEntry->Length;
+            }
+        }
+#endif
+    }
+}
+
+/******************************************************************************/
+
+MD_DwellPkt_t *MD_GetDwellPktBuf(uint16 TableIndex)
+{
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[TableIndex];
+
+    if (TblPtr->PktBuf == NULL)
+    {
+#if MD_INTERNAL_ZERO_COPY_DWELL_PKTS == 1
+        /* Fill the next packet in place in a software bus buffer */
+        TblPtr->PktBuf = (MD_DwellPkt_t *)CFE_SB_AllocateMessageBuffer(sizeof(MD_DwellPkt_t));
+#endif
+
+        if (TblPtr->PktBuf == NULL)
+        {
+            /* Fall back on filling the template and letting the software bus copy it */
+            TblPtr->PktBuf = &MD_AppData.MD_DwellPkt[TableIndex];
+        }
+    }
+
+    return TblPtr->PktBuf;
+}
+
+/******************************************************************************/
+
+void MD_ReleaseDwellPktBuf(uint16 TableIndex)
+{
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[TableIndex];
+
+    if ((TblPtr->PktBuf != NULL) && (TblPtr->PktBuf != &MD_AppData.MD_DwellPkt[TableIndex]))
+    {
+        CFE_SB_ReleaseMessageBuffer((CFE_SB_Buffer_t *)TblPtr->PktBuf);
+    }
+
+    TblPtr->PktBuf = NULL;
+}
+
+/******************************************************************************/
+
+void MD_UpdateDwellPktTemplate(uint16 TableIndex)
 {
     uint16 DwellPktSize = 0; /* Dwell Packet Size, in bytes */
 
@@ -218,7 +619,8 @@ void MD_SendDwellPkt(uint16 TableIndex)
     PktPtr->Payload.AddrCount = TblPtr->AddrCount;
     PktPtr->Payload.Rate      = TblPtr->Rate;
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
-    strncpy(PktPtr->Payload.Signature, TblPtr->Signature, MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1);
+    strncpy(PktPtr->Payload.Signature, MD_AppData.DwellReportControl[TableIndex].Signature,
+            MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1);
     /* Make sure string is null-terminated. */
     PktPtr->Payload.Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] = '\0';
 #endif
@@ -228,22 +630,829 @@ void MD_SendDwellPkt(uint16 TableIndex)
     ** Set packet length in header.
     */
 
-    DwellPktSize = sizeof(MD_DwellPkt_t) - MD_INTERFACE_DWELL_TABLE_SIZE * 4 + TblPtr->DataSize;
+    DwellPktSize = sizeof(MD_DwellPkt_t) - MD_INTERFACE_DWELL_PKT_DATA_SIZE + TblPtr->DataSize;
 
     CFE_MSG_SetSize(CFE_MSG_PTR(PktPtr->TelemetryHeader), DwellPktSize);
-
-    /*
-    ** Send dwell telemetry packet.
-    */
-    CFE_SB_TimeStampMsg(CFE_MSG_PTR(PktPtr->TelemetryHeader));
-    CFE_SB_TransmitMsg(CFE_MSG_PTR(PktPtr->TelemetryHeader), true);
 }
 
 /******************************************************************************/
 
-void MD_StartDwellStream(uint16 TableIndex)
+void MD_SendDwellPkt(uint16 TableIndex)
 {
-    MD_AppData.MD_DwellTables[TableIndex].Countdown    = 1;
-    MD_AppData.MD_DwellTables[TableIndex].CurrentEntry = 0;
-    MD_AppData.MD_DwellTables[TableIndex].PktOffset    = 0;
+    /* Assign pointers to structures */
+    MD_DwellPacketControl_t *TblPtr      = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr   = &MD_AppData.DwellReportControl[TableIndex];
+    MD_DwellCounters_t *     CountersPtr = &MD_AppData.DwellCounters[TableIndex];
+    MD_DwellPkt_t *          TemplatePtr = &MD_AppData.MD_DwellPkt[TableIndex];
+    MD_DwellPkt_t *          PktPtr      = MD_GetDwellPktBuf(TableIndex);
+    uint32                   WakeupCount = MD_AppData.DwellSchedule.WakeupCount;
+    OS_time_t                StartTime;
+
+    MD_PerfBegin(MD_Perf_Phases_PKT_SEND, &StartTime);
+
+    /* Cycles complete a rate apart, unless wakeups went by without the table being read */
+    if ((ReportPtr->CycleDueWakeup != 0) && ((int32)(WakeupCount - ReportPtr->CycleDueWakeup) > 0))
+    {
+        CountersPtr->CycleOverrunCount++;
+    }
+    if (MD_DwellTableIsTimed(TableIndex))
+    {
+        /* Missed deadlines are counted when the table's deadlines are processed */
+        ReportPtr->CycleDueWakeup = 0;
+    }
+    else
+    {
+        ReportPtr->CycleDueWakeup = WakeupCount + TblPtr->Rate;
+    }
+
+    /* A capture armed on the table records the cycle however it is reported */
+    MD_CaptureDwellCycle(TableIndex, PktPtr->Payload.Data);
+
+    if (TblPtr->StatsWindow > 0)
+    {
+        /* Only the window's statistics are sent, the next cycle refills the same buffer */
+        MD_AccumulateDwellStats(TableIndex);
+    }
+    else if (!MD_DwellPktReportDue(TableIndex))
+    {
+        /* Nothing moved beyond its deadband, the next cycle refills the same buffer */
+        CountersPtr->PktSuppressedCount++;
+    }
+    else if (TblPtr->BatchFactor > 1)
+    {
+        /* The cycle goes out in a batched dwell packet, keep filling the same buffer */
+        MD_BatchDwellPkt(TableIndex);
+    }
+    else
+    {
+        /* Don't hold back cycles batched before batching was turned off */
+        MD_SendDwellBatchPkt(TableIndex);
+
+        /*
+        ** Send dwell telemetry packet.
+        */
+        if (TblPtr->KeyframeInterval > 0)
+        {
+            /* Only the encoded cycle is sent, the next cycle refills the same buffer */
+            MD_SendDwellEncPkt(TableIndex);
+        }
+        else if (PktPtr != TemplatePtr)
+        {
+            /* Everything ahead of the dwell data comes from the template */
+            memcpy(PktPtr, TemplatePtr, offsetof(MD_DwellPkt_t, Payload.Data));
+
+            /* A jam during the cycle can leave the packet longer than the data read */
+            if (TblPtr->PktOffset < TblPtr->DataSize)
+            {
+                memset(&PktPtr->Payload.Data[TblPtr->PktOffset], 0, TblPtr->DataSize - TblPtr->PktOffset);
+            }
+
+            MD_TimeStampDwellPkt(TableIndex, CFE_MSG_PTR(PktPtr->TelemetryHeader));
+
+            if (CFE_SB_TransmitBuffer((CFE_SB_Buffer_t *)PktPtr, true) != CFE_SUCCESS)
+            {
+                /* Buffer is still owned by MD if it wasn't sent */
+                CFE_SB_ReleaseMessageBuffer((CFE_SB_Buffer_t *)PktPtr);
+            }
+            else
+            {
+                CountersPtr->PktSentCount++;
+            }
+        }
+        else
+        {
+            MD_TimeStampDwellPkt(TableIndex, CFE_MSG_PTR(PktPtr->TelemetryHeader));
+            CFE_SB_TransmitMsg(CFE_MSG_PTR(PktPtr->TelemetryHeader), true);
+            CountersPtr->PktSentCount++;
+        }
+
+        if (TblPtr->KeyframeInterval == 0)
+        {
+            /* The next read starts a new packet */
+            TblPtr->PktBuf = NULL;
+        }
+    }
+
+    MD_PerfEnd(MD_Perf_Phases_PKT_SEND, &StartTime);
+}
+
+/******************************************************************************/
+
+void MD_TimeStampDwellPkt(uint16 TableIndex, CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_TIME_SysTime_t CycleTime;
+    uint64             CycleUsec;
+
+    if (MD_DwellTableIsTimed(TableIndex))
+    {
+        /* Streams read on the same deadline carry the same time, free of wakeup jitter */
+        CycleUsec = MD_AppData.DwellDeadlines.CycleTime[TableIndex];
+
+        CycleTime.Seconds    = (uint32)(CycleUsec / 1000000);
+        CycleTime.Subseconds = CFE_TIME_Micro2SubSecs((uint32)(CycleUsec % 1000000));
+
+        CFE_MSG_SetMsgTime(MsgPtr, CycleTime);
+    }
+    else
+    {
+        CFE_SB_TimeStampMsg(MsgPtr);
+    }
+}
+
+/******************************************************************************/
+
+bool MD_DwellPktReportDue(uint16 TableIndex)
+{
+    bool                     ReportDue = true;
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+
+    if (TblPtr->HeartbeatInterval > 0)
+    {
+        if (TblPtr->PktOffset < TblPtr->DataSize)
+        {
+            /* A partly read cycle is reported, but isn't a reference for later cycles */
+            TblPtr->HeartbeatCountdown = 0;
+        }
+        else if ((TblPtr->HeartbeatCountdown == 0) || MD_DwellDataChanged(TableIndex))
+        {
+            MD_SaveReportedDwellData(TableIndex);
+            TblPtr->HeartbeatCountdown = TblPtr->HeartbeatInterval - 1;
+        }
+        else
+        {
+            TblPtr->HeartbeatCountdown--;
+            ReportDue = false;
+        }
+    }
+
+    return ReportDue;
+}
+
+/******************************************************************************/
+
+bool MD_DwellDataChanged(uint16 TableIndex)
+{
+    bool                     Changed    = false;
+    uint16                   EntryIndex = 0;
+    uint16                   Offset     = 0;
+    uint16                   Length;
+    int64                    NewValue;
+    int64                    OldValue;
+    int64                    Diff;
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+    MD_DwellPkt_t *          PktPtr    = MD_GetDwellPktBuf(TableIndex);
+    const uint8 *            NewPtr;
+    const uint8 *            OldPtr;
+
+    while ((Changed == false) && (EntryIndex < TblPtr->AddrCount))
+    {
+        Length = TblPtr->Entry[EntryIndex].Length;
+        NewPtr = &PktPtr->Payload.Data[Offset];
+        OldPtr = &ReportPtr->LastReported[Offset];
+
+        if (MD_DwellEntryUnread(TableIndex, EntryIndex))
+        {
+            /* An entry with no value this cycle hasn't moved */
+            Changed = false;
+        }
+        else if ((Length == 1) || (Length == 2) || (Length == 4))
+        {
+            /* Signed entries are sign-extended, so the distance is between the values the entry holds */
+            NewValue = MD_DwellEntryStatsValue(NewPtr, Length, ReportPtr->Signed[EntryIndex]);
+            OldValue = MD_DwellEntryStatsValue(OldPtr, Length, ReportPtr->Signed[EntryIndex]);
+            Diff     = (NewValue > OldValue) ? (NewValue - OldValue) : (OldValue - NewValue);
+
+            Changed = (Diff > (int64)ReportPtr->Deadband[EntryIndex]);
+        }
+        else
+        {
+            /* Block dwells are reported on any change */
+            Changed = (memcmp(NewPtr, OldPtr, Length) != 0);
+        }
+
+        Offset += Length;
+        EntryIndex++;
+    }
+
+    return Changed;
+}
+
+/******************************************************************************/
+
+void MD_SaveReportedDwellData(uint16 TableIndex)
+{
+    uint16                   EntryIndex;
+    uint16                   Offset    = 0;
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+    MD_DwellPkt_t *          PktPtr    = MD_GetDwellPktBuf(TableIndex);
+
+    if (TblPtr->FailingEntries == 0)
+    {
+        memcpy(ReportPtr->LastReported, PktPtr->Payload.Data, TblPtr->DataSize);
+    }
+    else
+    {
+        for (EntryIndex = 0; EntryIndex < TblPtr->AddrCount; EntryIndex++)
+        {
+            /* An entry with no value this cycle is compared against the value it last had */
+            if (!MD_DwellEntryUnread(TableIndex, EntryIndex))
+            {
+                memcpy(&ReportPtr->LastReported[Offset], &PktPtr->Payload.Data[Offset],
+                       TblPtr->Entry[EntryIndex].Length);
+            }
+
+            Offset += TblPtr->Entry[EntryIndex].Length;
+        }
+    }
+}
+
+/******************************************************************************/
+
+uint32 MD_DwellEntryValue(const uint8 *DataPtr, uint16 Length)
+{
+    uint16 Value16;
+    uint32 Value = 0;
+
+    if (Length == 1)
+    {
+        Value = DataPtr[0];
+    }
+    else if (Length == 2)
+    {
+        memcpy(&Value16, DataPtr, sizeof(Value16));
+        Value = Value16;
+    }
+    else if (Length == 4)
+    {
+        memcpy(&Value, DataPtr, sizeof(Value));
+    }
+
+    return Value;
+}
+
+/******************************************************************************/
+
+int64 MD_DwellEntryStatsValue(const uint8 *DataPtr, uint16 Length, uint16 Signed)
+{
+    uint32 Value = MD_DwellEntryValue(DataPtr, Length);
+    int64  StatsValue;
+
+    if ((Signed != 0) && (Length == 1))
+    {
+        StatsValue = (int8)Value;
+    }
+    else if ((Signed != 0) && (Length == 2))
+    {
+        StatsValue = (int16)Value;
+    }
+    else if ((Signed != 0) && (Length == 4))
+    {
+        StatsValue = (int32)Value;
+    }
+    else
+    {
+        StatsValue = Value;
+    }
+
+    return StatsValue;
+}
+
+/******************************************************************************/
+
+void MD_BatchDwellPkt(uint16 TableIndex)
+{
+    uint32                   Elapsed;
+    uint16                   TimeOffset;
+    uint16                   NumBytes;
+    MD_DwellPacketControl_t *TblPtr      = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellPkt_t *          TemplatePtr = &MD_AppData.MD_DwellPkt[TableIndex];
+    MD_DwellBatchPkt_t *     BatchPtr    = &MD_AppData.MD_DwellBatchPkt[TableIndex];
+    MD_DwellPkt_t *          PktPtr      = MD_GetDwellPktBuf(TableIndex);
+
+    /* Send what has been batched so far if this cycle doesn't fit behind it */
+    if ((TblPtr->BatchOffset + MD_BATCH_CYCLE_HDR_SIZE + TblPtr->DataSize) > MD_INTERFACE_DWELL_BATCH_DATA_SIZE)
+    {
+        MD_SendDwellBatchPkt(TableIndex);
+    }
+
+    if (TblPtr->BatchCycles == 0)
+    {
+        /* Header fields come from the dwell packet template */
+        BatchPtr->Payload.TableId     = TemplatePtr->Payload.TableId;
+        BatchPtr->Payload.AddrCount   = TemplatePtr->Payload.AddrCount;
+        BatchPtr->Payload.ByteCount   = TemplatePtr->Payload.ByteCount;
+        BatchPtr->Payload.Rate        = TemplatePtr->Payload.Rate;
+        BatchPtr->Payload.BatchFactor = TblPtr->BatchFactor;
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+        memcpy(BatchPtr->Payload.Signature, TemplatePtr->Payload.Signature, MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
+#endif
+
+        /* The batched packet is time stamped with its first cycle */
+        MD_TimeStampDwellPkt(TableIndex, CFE_MSG_PTR(BatchPtr->TelemetryHeader));
+
+        TblPtr->BatchStartWakeup = MD_AppData.DwellSchedule.WakeupCount;
+        TblPtr->BatchOffset      = 0;
+    }
+
+    /* Record when this cycle completed relative to the first one */
+    Elapsed = MD_AppData.DwellSchedule.WakeupCount - TblPtr->BatchStartWakeup;
+    if (Elapsed > 0xFFFF)
+    {
+        Elapsed = 0xFFFF;
+    }
+    TimeOffset = (uint16)Elapsed;
+
+    memcpy(&BatchPtr->Payload.Data[TblPtr->BatchOffset], &TimeOffset, MD_BATCH_CYCLE_HDR_SIZE);
+    TblPtr->BatchOffset += MD_BATCH_CYCLE_HDR_SIZE;
+
+    /* A jam during the cycle can leave the cycle longer than the data read */
+    NumBytes = TblPtr->PktOffset;
+    if (NumBytes > TblPtr->DataSize)
+    {
+        NumBytes = TblPtr->DataSize;
+    }
+
+    memcpy(&BatchPtr->Payload.Data[TblPtr->BatchOffset], PktPtr->Payload.Data, NumBytes);
+    memset(&BatchPtr->Payload.Data[TblPtr->BatchOffset + NumBytes], 0, TblPtr->DataSize - NumBytes);
+    TblPtr->BatchOffset += TblPtr->DataSize;
+
+    TblPtr->BatchCycles++;
+
+    if (TblPtr->BatchCycles >= TblPtr->BatchFactor)
+    {
+        MD_SendDwellBatchPkt(TableIndex);
+    }
+}
+
+/******************************************************************************/
+
+void MD_SendDwellBatchPkt(uint16 TableIndex)
+{
+    MD_DwellPacketControl_t *TblPtr   = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellBatchPkt_t *     BatchPtr = &MD_AppData.MD_DwellBatchPkt[TableIndex];
+
+    if (TblPtr->BatchCycles > 0)
+    {
+        BatchPtr->Payload.CycleCount = TblPtr->BatchCycles;
+
+        CFE_MSG_SetSize(CFE_MSG_PTR(BatchPtr->TelemetryHeader),
+                        sizeof(MD_DwellBatchPkt_t) - MD_INTERFACE_DWELL_BATCH_DATA_SIZE + TblPtr->BatchOffset);
+
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(BatchPtr->TelemetryHeader), true);
+        MD_AppData.DwellCounters[TableIndex].PktSentCount++;
+
+        TblPtr->BatchCycles = 0;
+        TblPtr->BatchOffset = 0;
+    }
+}
+
+/******************************************************************************/
+
+void MD_SendDwellEncPkt(uint16 TableIndex)
+{
+    MD_DwellPacketControl_t *TblPtr      = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr   = &MD_AppData.DwellReportControl[TableIndex];
+    MD_DwellPkt_t *          TemplatePtr = &MD_AppData.MD_DwellPkt[TableIndex];
+    MD_DwellEncPkt_t *       EncPtr      = &MD_AppData.MD_DwellEncPkt[TableIndex];
+    MD_DwellPkt_t *          PktPtr      = MD_GetDwellPktBuf(TableIndex);
+
+    /* A jam during the cycle can leave the cycle longer than the data read */
+    if (TblPtr->PktOffset < TblPtr->DataSize)
+    {
+        memset(&PktPtr->Payload.Data[TblPtr->PktOffset], 0, TblPtr->DataSize - TblPtr->PktOffset);
+    }
+
+    if (TblPtr->KeyframeCountdown == 0)
+    {
+        memset(ReportPtr->EncodeRef, 0, TblPtr->DataSize);
+        EncPtr->Payload.Keyframe  = 1;
+        TblPtr->KeyframeCountdown = TblPtr->KeyframeInterval - 1;
+    }
+    else
+    {
+        EncPtr->Payload.Keyframe = 0;
+        TblPtr->KeyframeCountdown--;
+    }
+
+    /* Header fields come from the dwell packet template */
+    EncPtr->Payload.TableId   = TemplatePtr->Payload.TableId;
+    EncPtr->Payload.AddrCount = TemplatePtr->Payload.AddrCount;
+    EncPtr->Payload.ByteCount = TemplatePtr->Payload.ByteCount;
+    EncPtr->Payload.Rate      = TemplatePtr->Payload.Rate;
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+    memcpy(EncPtr->Payload.Signature, TemplatePtr->Payload.Signature, MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
+#endif
+
+    EncPtr->Payload.EncodedSize =
+        MD_EncodeDwellData(EncPtr->Payload.Data, PktPtr->Payload.Data, ReportPtr->EncodeRef, TblPtr->DataSize);
+
+    /* The next cycle is encoded against this one */
+    memcpy(ReportPtr->EncodeRef, PktPtr->Payload.Data, TblPtr->DataSize);
+
+    CFE_MSG_SetSize(CFE_MSG_PTR(EncPtr->TelemetryHeader),
+                    sizeof(MD_DwellEncPkt_t) - MD_INTERFACE_DWELL_ENC_DATA_SIZE + EncPtr->Payload.EncodedSize);
+
+    MD_TimeStampDwellPkt(TableIndex, CFE_MSG_PTR(EncPtr->TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(EncPtr->TelemetryHeader), true);
+    MD_AppData.DwellCounters[TableIndex].PktSentCount++;
+}
+
+/******************************************************************************/
+
+void MD_AccumulateDwellStats(uint16 TableIndex)
+{
+    uint16                   EntryIndex;
+    uint16                   Offset = 0;
+    uint16                   Length;
+    int64                    Value;
+    double                   Delta;
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+    MD_DwellPkt_t *          PktPtr    = MD_GetDwellPktBuf(TableIndex);
+    MD_DwellStatsEntry_t *   StatsPtr;
+
+    /* A cycle cut short by a jam doesn't hold a value for every entry */
+    if (TblPtr->PktOffset == TblPtr->DataSize)
+    {
+        if (TblPtr->StatsCycles == 0)
+        {
+            /* Block entries, and entries never read, keep all zero statistics */
+            memset(ReportPtr->Stats, 0, TblPtr->Capacity * sizeof(ReportPtr->Stats[0]));
+        }
+
+        for (EntryIndex = 0; EntryIndex < TblPtr->AddrCount; EntryIndex++)
+        {
+            Length   = TblPtr->Entry[EntryIndex].Length;
+            StatsPtr = &ReportPtr->Stats[EntryIndex];
+
+            /* An entry that failed or was skipped has no value this cycle */
+            if (((Length == 1) || (Length == 2) || (Length == 4)) && !MD_DwellEntryUnread(TableIndex, EntryIndex))
+            {
+                Value = MD_DwellEntryStatsValue(&PktPtr->Payload.Data[Offset], Length, ReportPtr->Signed[EntryIndex]);
+
+                if (StatsPtr->Samples == 0)
+                {
+                    StatsPtr->Min  = Value;
+                    StatsPtr->Max  = Value;
+                    StatsPtr->Base = Value;
+                }
+                else if (Value < StatsPtr->Min)
+                {
+                    StatsPtr->Min = Value;
+                }
+                else if (Value > StatsPtr->Max)
+                {
+                    StatsPtr->Max = Value;
+                }
+
+                Delta = (double)(Value - StatsPtr->Base);
+                StatsPtr->Sum += Delta;
+                StatsPtr->SumSq += Delta * Delta;
+                StatsPtr->Samples++;
+            }
+
+            Offset += Length;
+        }
+
+        TblPtr->StatsCycles++;
+
+        if (TblPtr->StatsCycles >= TblPtr->StatsWindow)
+        {
+            MD_SendDwellStatsPkt(TableIndex);
+        }
+    }
+}
+
+/******************************************************************************/
+
+void MD_SendDwellStatsPkt(uint16 TableIndex)
+{
+    uint16                   EntryIndex;
+    double                   Mean;
+    double                   Variance;
+    MD_DwellPacketControl_t *TblPtr      = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr   = &MD_AppData.DwellReportControl[TableIndex];
+    MD_DwellPkt_t *          TemplatePtr = &MD_AppData.MD_DwellPkt[TableIndex];
+    MD_DwellStatsPkt_t *     StatsPktPtr = &MD_AppData.MD_DwellStatsPkt[TableIndex];
+    MD_DwellStatsEntry_t *   StatsPtr;
+
+    if (TblPtr->StatsCycles > 0)
+    {
+        /* Header fields come from the dwell packet template */
+        StatsPktPtr->Payload.TableId    = TemplatePtr->Payload.TableId;
+        StatsPktPtr->Payload.AddrCount  = TemplatePtr->Payload.AddrCount;
+        StatsPktPtr->Payload.CycleCount = TblPtr->StatsCycles;
+        StatsPktPtr->Payload.Rate       = TemplatePtr->Payload.Rate;
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+        memcpy(StatsPktPtr->Payload.Signature, TemplatePtr->Payload.Signature, MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
+#endif
+
+        for (EntryIndex = 0; EntryIndex < StatsPktPtr->Payload.AddrCount; EntryIndex++)
+        {
+            StatsPtr = &ReportPtr->Stats[EntryIndex];
+
+            Mean     = 0;
+            Variance = 0;
+            if (StatsPtr->Samples > 0)
+            {
+                Mean     = StatsPtr->Sum / StatsPtr->Samples;
+                Variance = (StatsPtr->SumSq / StatsPtr->Samples) - (Mean * Mean);
+                if (Variance < 0)
+                {
+                    /* Rounding when every value is the same */
+                    Variance = 0;
+                }
+
+                Mean += (double)StatsPtr->Base;
+            }
+
+            /* Signed values go out as their 32 bit two's complement */
+            StatsPktPtr->Payload.Stats[EntryIndex].Min      = (uint32)StatsPtr->Min;
+            StatsPktPtr->Payload.Stats[EntryIndex].Max      = (uint32)StatsPtr->Max;
+            StatsPktPtr->Payload.Stats[EntryIndex].Mean     = (float)Mean;
+            StatsPktPtr->Payload.Stats[EntryIndex].Variance = (float)Variance;
+        }
+
+        CFE_MSG_SetSize(CFE_MSG_PTR(StatsPktPtr->TelemetryHeader),
+                        sizeof(MD_DwellStatsPkt_t) - (sizeof(MD_DwellEntryStats_t) * MD_INTERFACE_DWELL_TABLE_SIZE) +
+                            (sizeof(MD_DwellEntryStats_t) * StatsPktPtr->Payload.AddrCount));
+
+        MD_TimeStampDwellPkt(TableIndex, CFE_MSG_PTR(StatsPktPtr->TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(StatsPktPtr->TelemetryHeader), true);
+        MD_AppData.DwellCounters[TableIndex].PktSentCount++;
+
+        TblPtr->StatsCycles = 0;
+    }
+}
+
+/******************************************************************************/
+
+void MD_StartDwellStream(uint16 TableIndex)
+{
+    MD_AppData.MD_DwellTables[TableIndex].Countdown    = 1;
+    MD_AppData.MD_DwellTables[TableIndex].CurrentEntry = 0;
+    MD_AppData.MD_DwellTables[TableIndex].PktOffset    = 0;
+
+    /* The first cycle is always reported, and encoded as a keyframe */
+    MD_AppData.MD_DwellTables[TableIndex].HeartbeatCountdown = 0;
+    MD_AppData.MD_DwellTables[TableIndex].KeyframeCountdown  = 0;
+
+    /* The restarted cycle isn't late however long the table was stopped */
+    MD_AppData.DwellReportControl[TableIndex].CycleDueWakeup = 0;
+
+    /* Statistics on cycles before the restart go out on their own */
+    MD_SendDwellStatsPkt(TableIndex);
+
+    if (MD_DwellTableIsTimed(TableIndex))
+    {
+        /* First dwell occurs on the next deadline */
+        MD_ScheduleDwellDeadline(TableIndex, MD_GetDeadlineTime());
+    }
+    else
+    {
+        /* First dwell occurs on the next wakeup call */
+        MD_ScheduleDwellTable(TableIndex, 1);
+    }
+}
+
+/******************************************************************************/
+
+void MD_ScheduleDwellTable(uint16 TableIndex, uint32 Delay)
+{
+    MD_DwellSchedule_t *SchedPtr = &MD_AppData.DwellSchedule;
+    uint16              HeapPos;
+
+    if (Delay == 0)
+    {
+        Delay = 1;
+    }
+
+    SchedPtr->DueCount[TableIndex] = SchedPtr->WakeupCount + Delay;
+
+    if (SchedPtr->HeapSlot[TableIndex] == 0)
+    {
+        /* Not yet scheduled, append to end of heap */
+        HeapPos = SchedPtr->NumScheduled;
+        SchedPtr->NumScheduled++;
+
+        SchedPtr->Heap[HeapPos]        = TableIndex;
+        SchedPtr->HeapSlot[TableIndex] = HeapPos + 1;
+    }
+    else
+    {
+        /* Already scheduled, reposition in place */
+        HeapPos = SchedPtr->HeapSlot[TableIndex] - 1;
+    }
+
+    MD_SiftDwellHeap(HeapPos);
+}
+
+/******************************************************************************/
+
+void MD_UnscheduleDwellTable(uint16 TableIndex)
+{
+    MD_DwellSchedule_t *SchedPtr = &MD_AppData.DwellSchedule;
+    uint16              HeapPos;
+    uint16              LastIndex;
+
+    if (SchedPtr->HeapSlot[TableIndex] != 0)
+    {
+        HeapPos = SchedPtr->HeapSlot[TableIndex] - 1;
+
+        SchedPtr->HeapSlot[TableIndex] = 0;
+        SchedPtr->NumScheduled--;
+
+        /* Move last heap entry into the vacated position */
+        if (HeapPos < SchedPtr->NumScheduled)
+        {
+            LastIndex                     = SchedPtr->Heap[SchedPtr->NumScheduled];
+            SchedPtr->Heap[HeapPos]       = LastIndex;
+            SchedPtr->HeapSlot[LastIndex] = HeapPos + 1;
+
+            MD_SiftDwellHeap(HeapPos);
+        }
+    }
+}
+
+/******************************************************************************/
+
+void MD_RefreshDwellSchedule(uint16 TableIndex)
+{
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[TableIndex];
+
+    if ((TblPtr->Enabled == MD_Dwell_States_ENABLED) && MD_DwellTableIsTimed(TableIndex))
+    {
+        if (MD_AppData.DwellDeadlines.Deadline[TableIndex] == 0)
+        {
+            /* Timed tables are read on deadlines rather than off the wakeup schedule */
+            MD_UnscheduleDwellTable(TableIndex);
+            MD_ScheduleDwellDeadline(TableIndex, MD_GetDeadlineTime());
+        }
+    }
+    else if ((TblPtr->Enabled == MD_Dwell_States_ENABLED) && (TblPtr->Rate > 0))
+    {
+        /* Only timed tables wait on deadlines */
+        MD_AppData.DwellDeadlines.Deadline[TableIndex] = 0;
+
+        if (TblPtr->CurrentEntry >= TblPtr->AddrCount)
+        {
+            /* Packet was shortened past the current entry, flush it on next wakeup */
+            MD_ScheduleDwellTable(TableIndex, 1);
+        }
+        else if (MD_AppData.DwellSchedule.HeapSlot[TableIndex] == 0)
+        {
+            MD_ScheduleDwellTable(TableIndex, TblPtr->Countdown);
+        }
+    }
+    else
+    {
+        MD_AppData.DwellDeadlines.Deadline[TableIndex] = 0;
+
+        if (MD_AppData.DwellSchedule.HeapSlot[TableIndex] != 0)
+        {
+            /* Hold the remaining wait so the stream resumes where it left off */
+            TblPtr->Countdown =
+                MD_AppData.DwellSchedule.DueCount[TableIndex] - MD_AppData.DwellSchedule.WakeupCount;
+
+            MD_UnscheduleDwellTable(TableIndex);
+        }
+    }
+}
+
+/******************************************************************************/
+
+bool MD_DwellTableIsTimed(uint16 TableIndex)
+{
+    return MD_AppData.DwellDeadlines.PeriodMsec[TableIndex] != 0;
+}
+
+/******************************************************************************/
+
+uint64 MD_GetDeadlineTime(void)
+{
+    CFE_TIME_SysTime_t Now = CFE_TIME_GetTime();
+
+    return ((uint64)Now.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Now.Subseconds);
+}
+
+/******************************************************************************/
+
+void MD_ScheduleDwellDeadline(uint16 TableIndex, uint64 Now)
+{
+    MD_DwellDeadlines_t *DeadlinesPtr = &MD_AppData.DwellDeadlines;
+    uint64               PeriodUsec   = (uint64)DeadlinesPtr->PeriodMsec[TableIndex] * 1000;
+    uint64               PhaseUsec    = (uint64)DeadlinesPtr->PhaseMsec[TableIndex] * 1000;
+    uint64               Deadline     = 0;
+
+    /* First deadline after Now that falls Phase past a whole multiple of Period */
+    if (PeriodUsec == 0)
+    {
+        /* Not timed, so no deadline */
+    }
+    else if (Now < PhaseUsec)
+    {
+        Deadline = PhaseUsec;
+    }
+    else
+    {
+        Deadline = (((Now - PhaseUsec) / PeriodUsec) + 1) * PeriodUsec + PhaseUsec;
+    }
+
+    DeadlinesPtr->Deadline[TableIndex] = Deadline;
+
+    if ((Deadline != 0) && ((DeadlinesPtr->NextDeadline == 0) || (Deadline < DeadlinesPtr->NextDeadline)))
+    {
+        DeadlinesPtr->NextDeadline = Deadline;
+    }
+}
+
+/******************************************************************************/
+
+bool MD_PopDueDwellTable(uint16 *TableIndexPtr)
+{
+    MD_DwellSchedule_t *SchedPtr = &MD_AppData.DwellSchedule;
+    bool                IsDue    = false;
+
+    if (SchedPtr->NumScheduled > 0)
+    {
+        /* Heap root is the earliest due table; due if its count has been reached */
+        if ((int32)(SchedPtr->WakeupCount - SchedPtr->DueCount[SchedPtr->Heap[0]]) >= 0)
+        {
+            *TableIndexPtr = SchedPtr->Heap[0];
+            MD_UnscheduleDwellTable(*TableIndexPtr);
+            IsDue = true;
+        }
+    }
+
+    return IsDue;
+}
+
+/******************************************************************************/
+
+bool MD_DwellDueBefore(uint16 TableIndexA, uint16 TableIndexB)
+{
+    int32 Difference;
+
+    Difference =
+        (int32)(MD_AppData.DwellSchedule.DueCount[TableIndexA] - MD_AppData.DwellSchedule.DueCount[TableIndexB]);
+
+    return (Difference < 0) || ((Difference == 0) && (TableIndexA < TableIndexB));
+}
+
+/******************************************************************************/
+
+void MD_SiftDwellHeap(uint16 HeapPos)
+{
+    MD_DwellSchedule_t *SchedPtr = &MD_AppData.DwellSchedule;
+    uint16              TableIndex;
+    uint16              ParentPos;
+    uint16              ChildPos;
+
+    TableIndex = SchedPtr->Heap[HeapPos];
+
+    /* Move entry toward the root while it is due before its parent */
+    while (HeapPos > 0)
+    {
+        ParentPos = (HeapPos - 1) / 2;
+
+        if (!MD_DwellDueBefore(TableIndex, SchedPtr->Heap[ParentPos]))
+        {
+            break;
+        }
+
+        SchedPtr->Heap[HeapPos]                     = SchedPtr->Heap[ParentPos];
+        SchedPtr->HeapSlot[SchedPtr->Heap[HeapPos]] = HeapPos + 1;
+        HeapPos                                     = ParentPos;
+    }
+
+    /* Move entry toward the leaves while a child is due before it */
+    while (1)
+    {
+        ChildPos = (2 * HeapPos) + 1;
+
+        if (ChildPos >= SchedPtr->NumScheduled)
+        {
+            break;
+        }
+
+        if (((ChildPos + 1) < SchedPtr->NumScheduled) &&
+            MD_DwellDueBefore(SchedPtr->Heap[ChildPos + 1], SchedPtr->Heap[ChildPos]))
+        {
+            ChildPos++;
+        }
+
+        if (!MD_DwellDueBefore(SchedPtr->Heap[ChildPos], TableIndex))
+        {
+            break;
+        }
+
+        SchedPtr->Heap[HeapPos]                     = SchedPtr->Heap[ChildPos];
+        SchedPtr->HeapSlot[SchedPtr->Heap[HeapPos]] = HeapPos + 1;
+        HeapPos                                     = ChildPos;
+    }
+
+    SchedPtr->Heap[HeapPos]        = TableIndex;
+    SchedPtr->HeapSlot[TableIndex] = HeapPos + 1;
 }
@@ -30,6 +30,7 @@
 #include "common_types.h"
 #include "cfe.h"
 #include "md_msg.h"
+#include "md_app.h"
 
 /************************************************************************
  * Type Definitions
@@ -58,7 +59,12 @@ enum MD_DwellAddrReadError
     /**
      * @brief Default case - Invalid Dwell Address length
      */
-    INVALID_DWELL_ADDR_LEN = -4
+    INVALID_DWELL_ADDR_LEN = -4,
+
+    /**
+     * @brief CFE_PSP_MemCpy error on a block dwell or coalesced block read
+     */
+    BLOCK_MEM_ADDR_READ_ERR = -5
 };
 
 /************************************************************************
@@ -69,16 +75,115 @@ enum MD_DwellAddrReadError
  * \brief Process Dwell Packets
  *
  * \par Description
- *      Look at each table.  If the table is enabled and
- *      its countdown counter times out, add dwell data to dwell packet until a
- *      packet delay is reached or the dwell packet is completed.
- *      If dwell packet is completed, send the packet and reset the counter.
+ *      Advance the dwell schedule by one wakeup, plus any missed wakeups
+ *      that #MD_CountWakeups says to make up for, and process each table
+ *      that has become due.  For each due table, add dwell data to the
+ *      dwell packet until a packet delay is reached or the dwell packet
+ *      is completed.  If dwell packet is completed, send the packet.
+ *      The table is then rescheduled for its next delay.
  *
  * \par Assumptions, External Events, and Notes:
- *          None
+ *          Tables that are not in the schedule are not visited.  Tables
+ *          timed against CFE_TIME are then read by #MD_ProcessDwellDeadlines.
  */
 CFE_Status_t MD_DwellLoop(const MD_Wakeup_t *Msg);
 
+/**
+ * \brief Count wakeups
+ *
+ * \par Description
+ *      Compares the sequence count of a wakeup message with that of the
+ *      last one to find wakeups that never arrived, because the wakeup
+ *      pipe overflowed or the scheduler skipped a slot.  Up to
+ *      #MD_INTERNAL_MAX_CATCHUP_WAKEUPS missed wakeups are made up for.
+ *      A longer gap is skipped, shifting every table's schedule later,
+ *      and is reported by #MD_CountRephase.  Either way the gap is
+ *      counted in #MD_WakeupCounters_t.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      A sender that doesn't count the wakeups it sends repeats the same
+ *      sequence count, which is taken to mean no wakeups were missed.
+ *
+ * \param [in] SeqCount Sequence count of the wakeup message received.
+ *
+ * \return Number of wakeups to process, 1 plus any made up for
+ */
+uint32 MD_CountWakeups(CFE_MSG_SequenceCount_t SeqCount);
+
+/**
+ * \brief Count a rephase
+ *
+ * \par Description
+ *      Counts a gap in the wakeup messages' sequence counts too long to
+ *      make up for, and reports it in #MD_WAKEUP_REPHASE_ERR_EID on the
+ *      1st, 2nd, 4th, 8th and so on rephase since the counters were last
+ *      reset.  The rest are only counted in housekeeping.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      None
+ *
+ * \param [in] LastSeqCount Sequence count of the last wakeup received.
+ * \param [in] SeqCount     Sequence count of the wakeup received after the gap.
+ */
+void MD_CountRephase(CFE_MSG_SequenceCount_t LastSeqCount, CFE_MSG_SequenceCount_t SeqCount);
+
+/**
+ * \brief Sample a Due Dwell Table
+ *
+ * \par Description
+ *      Calls #MD_ProcessDwellTable for the table, timing it with the
+ *      dwell sample performance phase and keeping the longest time it
+ *      took in the table's MaxSampleTime counter.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] TblIndex identifies dwell table (0..)
+ *
+ * \return Execution status from #MD_ProcessDwellTable
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 MD_SampleDwellTable(uint16 TblIndex);
+
+/**
+ * \brief Process Dwell Table Deadlines
+ *
+ * \par Description
+ *      Once CFE_TIME reaches the earliest deadline of the timed tables,
+ *      reads a whole cycle of each enabled table whose deadline has
+ *      passed, records the deadline for time stamping its packets, and
+ *      schedules its first deadline still to come.  A table more than a
+ *      period past its deadline has its CycleOverrunCount incremented.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          CFE_TIME is only read while some table is waiting on a deadline.
+ *
+ * \return Execution status, non-zero if any dwell read failed
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 MD_ProcessDwellDeadlines(void);
+
+/**
+ * \brief Process a Due Dwell Table
+ *
+ * \par Description
+ *      Read dwell entries for the specified table, beginning with the
+ *      current entry, until an entry with a non-zero delay is read.
+ *      Sends the dwell packet each time the last active entry is read.
+ *      On return, the table's Countdown holds the number of wakeups
+ *      until the table is next due.  A timed table is read up to the end
+ *      of its cycle regardless of delays.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Table is enabled and has a non-zero rate, or is timed.
+ *
+ * \param[in] TblIndex identifies dwell table (0..)
+ *
+ * \return Execution status, non-zero if any dwell read failed
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 MD_ProcessDwellTable(uint16 TblIndex);
+
 /**
  * \brief Read a Single Dwell Address
  *
@@ -86,7 +191,8 @@ CFE_Status_t MD_DwellLoop(const MD_Wakeup_t *Msg);
  *          Copy memory value from a single dwell address to a dwell packet.
  *
  * \par Assumptions, External Events, and Notes:
- *          None
+ *          Lengths of 1, 2 and 4 are read with a single memory read of
+ *          that width.  Block dwell lengths are copied with CFE_PSP_MemCpy.
  *
  * \param[in] TblIndex identifies source dwell table (0..)
  * \param[in] EntryIndex identifies dwell entry within specified table (0..)
@@ -96,6 +202,117 @@ CFE_Status_t MD_DwellLoop(const MD_Wakeup_t *Msg);
  */
 int32 MD_GetDwellData(uint16 TblIndex, uint16 EntryIndex);
 
+/**
+ * \brief Read a Block of Contiguous Dwell Addresses
+ *
+ * \par Description
+ *          Copy the memory covered by the block of entries that starts at
+ *          the specified entry, as compiled by #MD_CompileDwellPlan,
+ *          directly into the dwell packet with a single read.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The block was compiled from the current table contents.  On
+ *          failure the packet write location is left unchanged so the
+ *          caller can fall back to reading the entries individually,
+ *          which reports errors exactly as the per-entry path does.
+ *
+ * \param[in] TblIndex identifies source dwell table (0..)
+ * \param[in] EntryIndex identifies first dwell entry of the block (0..)
+ *
+ * \return Execution status, non-zero on failure
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 MD_GetDwellBlockData(uint16 TblIndex, uint16 EntryIndex);
+
+/**
+ * \brief Skip a Dwell Address
+ *
+ * \par Description
+ *          Moves the dwell packet write location past an entry that isn't
+ *          read, as for a quarantined entry.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The entry's bytes are zeroed, whether the packet is filled in
+ *          its template or in a software bus buffer.
+ *
+ * \param[in] TblIndex identifies source dwell table (0..)
+ * \param[in] EntryIndex identifies dwell entry within specified table (0..)
+ */
+void MD_SkipDwellData(uint16 TblIndex, uint16 EntryIndex);
+
+/**
+ * \brief Compile Dwell Table Sampling Plan
+ *
+ * \par Description
+ *          Determine, for each active entry of a dwell table, how many of
+ *          the following entries can be read together with it.  Entries are
+ *          merged when the earlier entry has a zero delay (so both are
+ *          sampled on the same wakeup call) and the later entry's address
+ *          immediately follows the earlier entry's data.  Blocks never
+ *          extend past the last active entry, so packet boundaries are
+ *          unchanged.  Members of a snapshot group are read with their
+ *          group, so they are never merged with other entries.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The entries are either a control structure's or ones being
+ *          compiled by table validation.
+ *          If #MD_INTERNAL_COALESCE_DWELL_READS is 0, the default, every
+ *          entry is read individually with an access of its own width.
+ *
+ * \param[in,out] EntryPtr  First entry of the dwell table
+ * \param[in]     GroupPtr  Snapshot group of each entry, 0 if none
+ * \param[in]     AddrCount Number of active entries
+ */
+void MD_CompileDwellPlan(MD_DwellControlEntry_t *EntryPtr, const uint16 *GroupPtr, uint16 AddrCount);
+
+/**
+ * \brief Get Dwell Packet Being Filled
+ *
+ * \par Description
+ *          Returns the dwell packet that dwell data for a table is written
+ *          to, starting a new one if the table has none.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          If #MD_INTERNAL_ZERO_COPY_DWELL_PKTS is 1 a new packet is a
+ *          software bus buffer.  Otherwise, or if no buffer is available,
+ *          the table's packet template in MD_AppData is used.
+ *
+ * \param[in] TableIndex Identifies dwell table (0..)
+ *
+ * \return Pointer to the dwell packet, never NULL
+ */
+MD_DwellPkt_t *MD_GetDwellPktBuf(uint16 TableIndex);
+
+/**
+ * \brief Release Dwell Packet Being Filled
+ *
+ * \par Description
+ *          Drops the dwell packet a table was filling, returning it to the
+ *          software bus if it was a zero copy buffer.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] TableIndex Identifies dwell table (0..)
+ */
+void MD_ReleaseDwellPktBuf(uint16 TableIndex);
+
+/**
+ * \brief Update Dwell Packet Template
+ *
+ * \par Description
+ *          Fills in the header fields of a table's dwell packet template
+ *          from the table's control information.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Must be called whenever the table's address count, rate, data
+ *          size or signature changes.  Every dwell packet sent for the
+ *          table takes its header from the template.
+ *
+ * \param[in] TableIndex Identifies dwell table (0..)
+ */
+void MD_UpdateDwellPktTemplate(uint16 TableIndex);
+
 /**
  * \brief Send Memory Dwell Packet
  *
@@ -104,12 +321,220 @@ int32 MD_GetDwellData(uint16 TblIndex, uint16 EntryIndex);
  *          telemetry packet.
  *
  * \par Assumptions, External Events, and Notes:
- *          None
+ *          The header is copied from the table's packet template.
+ *          Zero copy buffers are handed to the software bus with
+ *          #CFE_SB_TransmitBuffer.  If the table has a batch factor
+ *          greater than 1 the cycle is added to the batched dwell packet
+ *          instead and the dwell packet buffer is kept for the next cycle.
+ *          Cycles that #MD_DwellPktReportDue suppresses are not sent or
+ *          batched, and their buffer is also kept for the next cycle.
  *
  * \param[in] TableIndex Identifies source dwell table for the dwell packet.
  */
 void MD_SendDwellPkt(uint16 TableIndex);
 
+/**
+ * \brief Check Whether Dwell Cycle Is Reported
+ *
+ * \par Description
+ *          Decides whether the cycle just completed in the table's dwell
+ *          packet is sent.  Tables with a zero heartbeat interval report
+ *          every cycle.  Otherwise a cycle is reported if an entry moved
+ *          beyond its deadband since the last reported cycle, or if the
+ *          heartbeat interval has run out, and the reported data becomes
+ *          the reference for the following cycles.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Partly read cycles, the first cycle after the dwell stream starts
+ *          and the first cycle after the table changes are always reported.
+ *
+ * \param[in] TableIndex Identifies source dwell table for the dwell packet.
+ *
+ * \return Whether the cycle is reported
+ * \retval true  Cycle is sent or batched
+ * \retval false Cycle is suppressed
+ */
+bool MD_DwellPktReportDue(uint16 TableIndex);
+
+/**
+ * \brief Time Stamp Dwell Packet
+ *
+ * \par Description
+ *          Time stamps a dwell, batched, encoded or statistics packet of
+ *          the table.  Packets of a timed table carry the deadline their
+ *          cycle was read for, so the packets of every table read on the
+ *          same deadline carry the same time.  Other packets carry the
+ *          current time.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] TableIndex Identifies source dwell table for the packet.
+ * \param[in] MsgPtr     Packet to time stamp.
+ */
+void MD_TimeStampDwellPkt(uint16 TableIndex, CFE_MSG_Message_t *MsgPtr);
+
+/**
+ * \brief Compare Dwell Data With Last Reported Cycle
+ *
+ * \par Description
+ *          Compares each entry of the table's dwell packet with the same
+ *          entry of the last reported cycle.  Entries of 1, 2 or 4 bytes are
+ *          read as the signed or unsigned integers they hold, and the
+ *          distance between the two values is compared against the
+ *          entry's deadband.  Block entries count as changed if any byte
+ *          differs.  An entry with no value in the cycle, because its read
+ *          failed or it is quarantined, counts as unchanged.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The table's dwell packet holds a completely read cycle.
+ *
+ * \param[in] TableIndex Identifies source dwell table for the dwell packet.
+ *
+ * \return Whether any entry changed
+ * \retval true  An entry moved beyond its deadband
+ * \retval false All entries are within their deadbands
+ */
+bool MD_DwellDataChanged(uint16 TableIndex);
+
+/**
+ * \brief Save Reported Dwell Data
+ *
+ * \par Description
+ *          Keeps the cycle just reported in the table's dwell packet as
+ *          the reference later cycles are compared against.  An entry
+ *          with no value in the cycle keeps the value last reported.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The table's dwell packet holds a completely read cycle.
+ *
+ * \param[in] TableIndex Identifies source dwell table for the dwell packet.
+ */
+void MD_SaveReportedDwellData(uint16 TableIndex);
+
+/**
+ * \brief Dwell Entry Value
+ *
+ * \par Description
+ *          Reads a 1, 2 or 4 byte dwell entry from dwell data as an
+ *          unsigned integer.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          DataPtr need not be aligned.
+ *
+ * \param[in] DataPtr Dwell data of the entry
+ * \param[in] Length  Dwell entry length in bytes
+ *
+ * \return Entry value, 0 for any other length
+ */
+uint32 MD_DwellEntryValue(const uint8 *DataPtr, uint16 Length);
+
+/**
+ * \brief Dwell Entry Statistics Value
+ *
+ * \par Description
+ *          Reads a 1, 2 or 4 byte dwell entry from dwell data as the
+ *          integer its dwell table entry says it holds, sign-extending
+ *          the value of a signed entry.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          DataPtr need not be aligned.
+ *
+ * \param[in] DataPtr Dwell data of the entry
+ * \param[in] Length  Dwell entry length in bytes
+ * \param[in] Signed  Whether the entry holds a two's complement integer
+ *
+ * \return Entry value, 0 for any other length
+ */
+int64 MD_DwellEntryStatsValue(const uint8 *DataPtr, uint16 Length, uint16 Signed);
+
+/**
+ * \brief Batch Memory Dwell Packet
+ *
+ * \par Description
+ *          Appends the cycle just completed in the table's dwell packet
+ *          to the table's batched dwell packet, preceded by its time offset
+ *          from the first cycle in the batch.  The batched dwell packet is
+ *          sent once it holds the table's batch factor worth of cycles.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          If the cycle doesn't fit behind the cycles already batched, those
+ *          are sent first and the cycle starts a new batch.
+ *
+ * \param[in] TableIndex Identifies source dwell table for the dwell packet.
+ */
+void MD_BatchDwellPkt(uint16 TableIndex);
+
+/**
+ * \brief Send Batched Memory Dwell Packet
+ *
+ * \par Description
+ *          Sends the table's batched dwell packet if it holds any cycles,
+ *          and starts a new batch.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called when the batch is full, and whenever the table's contents,
+ *          batch factor or enabled state change so that cycles already
+ *          batched are not held back or mixed with a different layout.
+ *
+ * \param[in] TableIndex Identifies source dwell table for the dwell packet.
+ */
+void MD_SendDwellBatchPkt(uint16 TableIndex);
+
+/**
+ * \brief Send Encoded Memory Dwell Packet
+ *
+ * \par Description
+ *          Encodes the cycle just completed in the table's dwell packet
+ *          against the last cycle encoded for the table and sends it in the
+ *          table's encoded dwell packet.  Every keyframe interval'th packet
+ *          is encoded against zeros instead, so ground software can pick up
+ *          the stream from there.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The keyframe countdown is cleared whenever the table's contents
+ *          change or the table is started, so the first packet after that
+ *          is a keyframe.
+ *
+ * \param[in] TableIndex Identifies source dwell table for the dwell packet.
+ */
+void MD_SendDwellEncPkt(uint16 TableIndex);
+
+/**
+ * \brief Accumulate Memory Dwell Statistics
+ *
+ * \par Description
+ *          Adds the cycle just completed in the table's dwell packet to the
+ *          statistics kept for each of its 1, 2 and 4 byte entries.  The
+ *          statistics are sent once they cover the table's statistics window.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          A cycle cut short by a jam is left out.  An entry whose last read
+ *          failed, or that is quarantined, holds no value in the cycle and
+ *          is left out of its own statistics.
+ *
+ * \param[in] TableIndex Identifies source dwell table for the dwell packet.
+ */
+void MD_AccumulateDwellStats(uint16 TableIndex);
+
+/**
+ * \brief Send Memory Dwell Statistics Packet
+ *
+ * \par Description
+ *          Sends the minimum, maximum, mean and variance of each of the
+ *          table's entries over the cycles accumulated, if there are any,
+ *          and starts a new window.  An entry that wasn't read in any of
+ *          the cycles reports all zero statistics.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called when the window is full, and whenever the table's contents
+ *          or enabled state change so that statistics are not mixed with a
+ *          different layout.
+ *
+ * \param[in] TableIndex Identifies source dwell table for the dwell packet.
+ */
+void MD_SendDwellStatsPkt(uint16 TableIndex);
+
 /**
  * \brief Start Dwell Stream
  *
@@ -117,10 +542,161 @@ void MD_SendDwellPkt(uint16 TableIndex);
  *          Initialize parameters used to control generation of dwell packets.
  *
  * \par Assumptions, External Events, and Notes:
- *          None
+ *          A timed table starts on its next deadline, other tables on the
+ *          next wakeup.
  *
  * \param[in] TableIndex Identifies source dwell table for the dwell packet.
  */
 void MD_StartDwellStream(uint16 TableIndex);
 
+/**
+ * \brief Schedule Dwell Table
+ *
+ * \par Description
+ *          Insert the table into the dwell schedule so that it becomes
+ *          due after the specified number of wakeup calls.  If the table is
+ *          already scheduled its due count is updated in place.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          A delay of zero is treated as one, i.e. due on the next wakeup.
+ *
+ * \param[in] TableIndex Identifies dwell table (0..)
+ * \param[in] Delay      Number of wakeup calls until the table is due.
+ */
+void MD_ScheduleDwellTable(uint16 TableIndex, uint32 Delay);
+
+/**
+ * \brief Unschedule Dwell Table
+ *
+ * \par Description
+ *          Remove the table from the dwell schedule, if present.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] TableIndex Identifies dwell table (0..)
+ */
+void MD_UnscheduleDwellTable(uint16 TableIndex);
+
+/**
+ * \brief Refresh Dwell Table Schedule
+ *
+ * \par Description
+ *          Re-evaluate the schedule entry of a table after its control
+ *          information has changed.  Tables that are disabled or have a zero
+ *          rate are removed, with their remaining wait held in Countdown.
+ *          Tables that are enabled with a non-zero rate are added if not
+ *          already scheduled, and a table whose current entry is now past
+ *          its last active entry is made due on the next wakeup so that its
+ *          pending packet is flushed.  Enabled timed tables are kept out of
+ *          the schedule and given a deadline if they have none, and every
+ *          other table has its deadline cleared.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] TableIndex Identifies dwell table (0..)
+ */
+void MD_RefreshDwellSchedule(uint16 TableIndex);
+
+/**
+ * \brief Remove Next Due Dwell Table
+ *
+ * \par Description
+ *          If the earliest entry in the dwell schedule is due at the current
+ *          wakeup count, remove it from the schedule and return its index.
+ *          Ties are broken by table index so that due tables are processed
+ *          in ascending order.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[out] TableIndexPtr Index of the due table, valid if true is returned.
+ *
+ * \return Boolean table due result
+ * \retval true  A table was due and has been removed from the schedule
+ * \retval false No table is due
+ */
+bool MD_PopDueDwellTable(uint16 *TableIndexPtr);
+
+/**
+ * \brief Check Whether Dwell Table Is Timed
+ *
+ * \par Description
+ *          Determine whether the table's cycles are read on deadlines of
+ *          CFE_TIME rather than paced by its entry delays.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] TableIndex Identifies dwell table (0..)
+ *
+ * \return Boolean timed result
+ * \retval true  Table has a non-zero PeriodMsec
+ * \retval false Table is paced by its entry delays
+ */
+bool MD_DwellTableIsTimed(uint16 TableIndex);
+
+/**
+ * \brief Get Deadline Time
+ *
+ * \par Description
+ *          Reads CFE_TIME as the microsecond count dwell table deadlines
+ *          are kept in.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \return Current time in microseconds
+ */
+uint64 MD_GetDeadlineTime(void);
+
+/**
+ * \brief Schedule Dwell Table Deadline
+ *
+ * \par Description
+ *          Sets the table's deadline to the first time after Now that falls
+ *          PhaseMsec past a whole multiple of PeriodMsec, and brings the
+ *          earliest deadline of all tables forward to it if sooner.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          A table that is not timed is left with no deadline.
+ *
+ * \param[in] TableIndex Identifies dwell table (0..)
+ * \param[in] Now        Current time in microseconds, from #MD_GetDeadlineTime
+ */
+void MD_ScheduleDwellDeadline(uint16 TableIndex, uint64 Now);
+
+/**
+ * \brief Compare Dwell Schedule Entries
+ *
+ * \par Description
+ *          Determine whether one scheduled table is due before another.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Due counts are compared modulo 2^32 so that the wakeup count may wrap.
+ *
+ * \param[in] TableIndexA Identifies first dwell table (0..)
+ * \param[in] TableIndexB Identifies second dwell table (0..)
+ *
+ * \return Boolean ordering result
+ * \retval true  Table A is due before table B
+ * \retval false Table A is not due before table B
+ */
+bool MD_DwellDueBefore(uint16 TableIndexA, uint16 TableIndexB);
+
+/**
+ * \brief Restore Dwell Schedule Heap Order
+ *
+ * \par Description
+ *          Move the entry at the specified heap position up or down until
+ *          the heap ordering is restored.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          HeapPos is less than the number of scheduled tables.
+ *
+ * \param[in] HeapPos Zero-based heap position of the entry to be moved.
+ */
+void MD_SiftDwellHeap(uint16 HeapPos);
+
 #endif
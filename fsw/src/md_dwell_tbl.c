@@ -26,6 +26,9 @@
 *************************************************************************/
 #include "md_dwell_tbl.h"
 #include "md_utils.h"
+#include "md_dwell_pkt.h"
+#include "md_symcache.h"
+#include "md_sampler.h"
 /* Need md_app.h for MD_DwellTableLoad_t defn */
 #include "md_app.h"
 #include "md_eventids.h"
@@ -38,13 +41,11 @@ extern MD_AppData_t MD_AppData;
 /******************************************************************************/
 int32 MD_TableValidationFunc(void *TblPtr)
 {
-    uint16               ActiveEntryCount   = 0;
-    uint16               Size               = 0;
-    uint32               Rate               = 0;
-    int32                Status             = CFE_SUCCESS; /* Initialize to valid table */
-    MD_DwellTableLoad_t *LocalTblPtr        = (MD_DwellTableLoad_t *)TblPtr;
-    uint16               TblErrorEntryIndex = 0; /* Zero-based entry number for error; */
-                                                 /* valid if there is an error.        */
+    int32                    Status             = CFE_SUCCESS; /* Initialize to valid table */
+    MD_DwellTableLoad_t *    LocalTblPtr        = (MD_DwellTableLoad_t *)TblPtr;
+    MD_CompiledDwellTable_t *CompiledPtr        = NULL;
+    uint16                   TblErrorEntryIndex = 0; /* Zero-based entry number for error; */
+                                                     /* valid if there is an error.        */
 
     if (TblPtr == NULL)
     {
@@ -56,6 +57,18 @@ int32 MD_TableValidationFunc(void *TblPtr)
         return Status;
     }
 
+    if (MD_AppData.CompileTblIndex >= MD_INTERFACE_NUM_DWELL_TABLES)
+    {
+        Status = MD_ERROR;
+
+        CFE_EVS_SendEvent(MD_TBL_VAL_NO_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Dwell Table rejected because MD was not validating a dwell table");
+
+        return Status;
+    }
+
+    CompiledPtr = &MD_AppData.CompiledTables[MD_AppData.CompileTblIndex];
+
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
 
     uint16 StringLength;
@@ -92,23 +105,53 @@ int32 MD_TableValidationFunc(void *TblPtr)
 
 #endif
 
+    else if ((LocalTblPtr->PeriodMsec != 0) && (LocalTblPtr->PhaseMsec >= LocalTblPtr->PeriodMsec))
+    {
+        CFE_EVS_SendEvent(MD_TBL_PHASE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Dwell Table rejected because phase (%u ms) is not less than period (%u ms)",
+                          (unsigned int)LocalTblPtr->PhaseMsec, (unsigned int)LocalTblPtr->PeriodMsec);
+
+        Status = MD_PHASE_TBL_ERROR;
+    }
+
     else
     {
-        /* Read Dwell Table to get entry count, byte size, and dwell rate */
-        MD_ReadDwellTable(LocalTblPtr, &ActiveEntryCount, &Size, &Rate);
+        /* Validate entry contents, compiling them along the way while Sequence is odd */
+        CompiledPtr->Sequence++;
+        MD_SAMPLER_BARRIER();
 
-        /* Validate entry contents */
-        Status = MD_CheckTableEntries(LocalTblPtr, &TblErrorEntryIndex);
+        CompiledPtr->Ready = false;
+
+        Status = MD_CheckTableEntries(LocalTblPtr, &TblErrorEntryIndex, CompiledPtr);
 
         if (Status == CFE_SUCCESS)
         {
-            /* Allow ground to uplink a table with 0 delay, but if the table is enabled, report that the table will not
-             * be processed */
-            if ((LocalTblPtr->Enabled == MD_Dwell_States_ENABLED) && (Rate == 0))
+            if (!MD_ValidBatchFactor(LocalTblPtr->BatchFactor, CompiledPtr->DataSize))
+            {
+                CFE_EVS_SendEvent(MD_TBL_BATCH_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Dwell Table rejected because %d batched cycles of %d bytes exceed the %d byte "
+                                  "batched dwell packet",
+                                  LocalTblPtr->BatchFactor, CompiledPtr->DataSize, MD_INTERFACE_DWELL_BATCH_DATA_SIZE);
+
+                Status = MD_BATCH_SIZE_TBL_ERROR;
+            }
+            else
             {
-                CFE_EVS_SendEvent(
-                    MD_ZERO_RATE_TBL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                    "Dwell Table is enabled but no processing will occur for table being loaded (rate is zero)");
+                /* Allow ground to uplink a table with 0 delay, but if the table is enabled and not timed, report
+                 * that the table will not be processed */
+                if ((LocalTblPtr->Enabled == MD_Dwell_States_ENABLED) && (CompiledPtr->Rate == 0) &&
+                    (LocalTblPtr->PeriodMsec == 0))
+                {
+                    CFE_EVS_SendEvent(
+                        MD_ZERO_RATE_TBL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                        "Dwell Table is enabled but no processing will occur for table being loaded (rate is zero)");
+                }
+
+                /* Leave the table ready for MD_CopyUpdatedTbl to install */
+                MD_CompileDwellPlan(CompiledPtr->Entry, CompiledPtr->Group, CompiledPtr->AddrCount);
+
+                memcpy(CompiledPtr->Image, LocalTblPtr->Entry, CompiledPtr->Capacity * sizeof(CompiledPtr->Image[0]));
+                CompiledPtr->Ready = true;
             }
         }
         else if (Status == MD_RESOLVE_ERROR)
@@ -133,6 +176,19 @@ int32 MD_TableValidationFunc(void *TblPtr)
                               "Dwell Table rejected because length (%d) in entry #%d was invalid",
                               LocalTblPtr->Entry[TblErrorEntryIndex].Length, TblErrorEntryIndex + 1);
         }
+        else if (Status == MD_DATA_SIZE_TBL_ERROR)
+        {
+            CFE_EVS_SendEvent(MD_TBL_DATA_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Dwell Table rejected because entry #%d exceeds the %d byte dwell packet",
+                              TblErrorEntryIndex + 1, MD_INTERFACE_DWELL_PKT_DATA_SIZE);
+        }
+        else if (Status == MD_SNAPSHOT_GROUP_ERROR)
+        {
+            CFE_EVS_SendEvent(MD_TBL_SNAPSHOT_GROUP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Dwell Table rejected because snapshot group (%d) in entry #%d exceeds the %d groups",
+                              LocalTblPtr->Entry[TblErrorEntryIndex].SnapshotGroup, TblErrorEntryIndex + 1,
+                              MD_INTERNAL_NUM_SNAPSHOT_GROUPS);
+        }
         else /* Status == MD_NOT_ALIGNED_ERROR is only remaining option */
         {
             CFE_EVS_SendEvent(MD_TBL_ALIGN_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -143,39 +199,28 @@ int32 MD_TableValidationFunc(void *TblPtr)
                               TblErrorEntryIndex + 1, LocalTblPtr->Entry[TblErrorEntryIndex].Length);
         }
 
-    } /* end else MD_ReadDwellTable */
+        MD_SAMPLER_BARRIER();
+        CompiledPtr->Sequence++;
+
+    } /* end else MD_CheckTableEntries */
 
     return Status;
 }
 
 /******************************************************************************/
-CFE_Status_t MD_ReadDwellTable(const MD_DwellTableLoad_t *TblPtr, uint16 *ActiveAddrCountPtr, uint16 *SizePtr,
-                               uint32 *RatePtr)
-{
-    /* parameters cannot be NULL - checked by calling function */
-
-    uint16 EntryId;
-    *ActiveAddrCountPtr = 0;
-    *SizePtr            = 0;
-    *RatePtr            = 0;
-
-    for (EntryId = 0; (EntryId < MD_INTERFACE_DWELL_TABLE_SIZE) && (TblPtr->Entry[EntryId].Length != 0); EntryId++)
-    {
-        /* *ActiveAddrCountPtr++; */
-        (*ActiveAddrCountPtr)++;
-        *SizePtr += TblPtr->Entry[EntryId].Length;
-        *RatePtr += TblPtr->Entry[EntryId].Delay;
-    } /* end while */
-
-    return CFE_SUCCESS;
-}
-/******************************************************************************/
-int32 MD_CheckTableEntries(MD_DwellTableLoad_t *TblPtr, uint16 *ErrorEntryArg)
+int32 MD_CheckTableEntries(MD_DwellTableLoad_t *TblPtr, uint16 *ErrorEntryArg, MD_CompiledDwellTable_t *CompiledPtr)
 {
-    int32  Status;
-    int32  FirstErrorCode = CFE_SUCCESS;
-    uint16 EntryIndex;
-    int32  FirstBadIndex = -1;
+    int32                   Status;
+    int32                   FirstErrorCode = CFE_SUCCESS;
+    uint16                  EntryIndex;
+    uint16                  UnusedIndex;
+    int32                   FirstBadIndex    = -1;
+    int32                   OversizeIndex    = -1;
+    uint32                  DataSize         = 0;
+    uint32                  Rate             = 0;
+    cpuaddr                 ResolvedAddr     = 0;
+    MD_TableLoadEntry_t *   LoadEntryPtr     = NULL;
+    MD_DwellControlEntry_t *CompiledEntryPtr = NULL;
 
     int32 GoodCount   = 0;
     int32 BadCount    = 0;
@@ -185,16 +230,31 @@ int32 MD_CheckTableEntries(MD_DwellTableLoad_t *TblPtr, uint16 *ErrorEntryArg)
 
     /* parameters cannot be NULL - checked by calling function */
 
+    /* Forget symbol addresses from modules that may have been unloaded */
+    MD_RefreshSymCache();
+    CompiledPtr->SymCacheGeneration = MD_AppData.SymCache.Generation;
+
     /*
     **   Check each Dwell Table entry for valid address range
     */
-    for (EntryIndex = 0; EntryIndex < MD_INTERFACE_DWELL_TABLE_SIZE; EntryIndex++)
+    for (EntryIndex = 0; EntryIndex < CompiledPtr->Capacity; EntryIndex++)
     {
-        Status = MD_ValidTableEntry(&TblPtr->Entry[EntryIndex]);
+        LoadEntryPtr = &TblPtr->Entry[EntryIndex];
+
+        Status = MD_ValidTableEntry(LoadEntryPtr, &ResolvedAddr);
+
+        /* Compile the entry as it is checked so the update doesn't have to resolve it again */
+        CompiledEntryPtr                  = &CompiledPtr->Entry[EntryIndex];
+        CompiledEntryPtr->ResolvedAddress = ResolvedAddr;
+        CompiledEntryPtr->Length          = LoadEntryPtr->Length;
+        CompiledEntryPtr->Delay           = LoadEntryPtr->Delay;
+        CompiledPtr->Deadband[EntryIndex] = LoadEntryPtr->Deadband;
+        CompiledPtr->Group[EntryIndex]    = LoadEntryPtr->SnapshotGroup;
+        CompiledPtr->Signed[EntryIndex]   = (LoadEntryPtr->Signed != 0);
 
         if (Status == CFE_SUCCESS)
         {
-            if (TblPtr->Entry[EntryIndex].Length == 0)
+            if (LoadEntryPtr->Length == 0)
             {
                 /*
                 ** Stop reading through the table when the entry length is
@@ -205,6 +265,15 @@ int32 MD_CheckTableEntries(MD_DwellTableLoad_t *TblPtr, uint16 *ErrorEntryArg)
             else
             {
                 GoodCount++;
+
+                Rate += LoadEntryPtr->Delay;
+
+                /* Note the first entry that no longer fits in the dwell packet */
+                DataSize += LoadEntryPtr->Length;
+                if ((DataSize > MD_INTERFACE_DWELL_PKT_DATA_SIZE) && (OversizeIndex == -1))
+                {
+                    OversizeIndex = EntryIndex;
+                }
             }
         }
         else
@@ -224,7 +293,44 @@ int32 MD_CheckTableEntries(MD_DwellTableLoad_t *TblPtr, uint16 *ErrorEntryArg)
         }
     }
 
-    UnusedCount = MD_INTERFACE_DWELL_TABLE_SIZE - EntryIndex;
+    UnusedCount = CompiledPtr->Capacity - EntryIndex;
+
+    /*
+    ** Entries after the first null entry aren't dwelled on, but are kept
+    ** as loaded in case a jam command later fills the null entry
+    */
+    for (UnusedIndex = EntryIndex + 1; UnusedIndex < CompiledPtr->Capacity; UnusedIndex++)
+    {
+        LoadEntryPtr     = &TblPtr->Entry[UnusedIndex];
+        CompiledEntryPtr = &CompiledPtr->Entry[UnusedIndex];
+
+        if (MD_ResolveSymAddr(&LoadEntryPtr->DwellAddress, &ResolvedAddr) != true)
+        {
+            ResolvedAddr = 0;
+        }
+
+        CompiledEntryPtr->ResolvedAddress = ResolvedAddr;
+        CompiledEntryPtr->Length          = LoadEntryPtr->Length;
+        CompiledEntryPtr->Delay           = LoadEntryPtr->Delay;
+
+        CompiledPtr->Deadband[UnusedIndex] = LoadEntryPtr->Deadband;
+        CompiledPtr->Group[UnusedIndex]    = LoadEntryPtr->SnapshotGroup;
+        CompiledPtr->Signed[UnusedIndex]   = (LoadEntryPtr->Signed != 0);
+    }
+
+    CompiledPtr->AddrCount = (uint16)GoodCount;
+    CompiledPtr->DataSize  = (uint16)DataSize;
+    CompiledPtr->Rate      = Rate;
+
+    /* Entries that are valid on their own can still overrun the dwell packet */
+    if ((FirstErrorCode == CFE_SUCCESS) && (OversizeIndex != -1))
+    {
+        *ErrorEntryArg = OversizeIndex;
+        FirstErrorCode = MD_DATA_SIZE_TBL_ERROR;
+
+        CFE_EVS_SendEvent(MD_TBL_ENTRY_ERR_EID, CFE_EVS_EventType_ERROR, "Table entry %d failed with status 0x%08X",
+                          (int)OversizeIndex, (unsigned int)FirstErrorCode);
+    }
 
     /*
     ** Generate informational event with error totals
@@ -237,7 +343,7 @@ int32 MD_CheckTableEntries(MD_DwellTableLoad_t *TblPtr, uint16 *ErrorEntryArg)
 }
 
 /******************************************************************************/
-int32 MD_ValidTableEntry(MD_TableLoadEntry_t *TblEntryPtr)
+int32 MD_ValidTableEntry(MD_TableLoadEntry_t *TblEntryPtr, cpuaddr *ResolvedAddrPtr)
 {
     int32   Status       = MD_ERROR;
     uint16  DwellLength  = 0;
@@ -279,6 +385,10 @@ int32 MD_ValidTableEntry(MD_TableLoadEntry_t *TblEntryPtr)
         {
             Status = MD_NOT_ALIGNED_ERROR;
         }
+        else if (TblEntryPtr->SnapshotGroup > MD_INTERNAL_NUM_SNAPSHOT_GROUPS)
+        {
+            Status = MD_SNAPSHOT_GROUP_ERROR;
+        }
         else
         {
             Status = CFE_SUCCESS;
@@ -286,49 +396,118 @@ int32 MD_ValidTableEntry(MD_TableLoadEntry_t *TblEntryPtr)
 
     } /* end else */
 
+    *ResolvedAddrPtr = ResolvedAddr;
+
     return Status;
 }
 
 /******************************************************************************/
-void MD_CopyUpdatedTbl(MD_DwellTableLoad_t *MD_LoadTablePtr, uint8 TblIndex)
+void MD_CopyUpdatedTbl(MD_DwellTableLoad_t *MD_LoadTablePtr, uint16 TblIndex)
 {
-    uint8                    EntryIndex;
+    uint16                   EntryIndex;
     cpuaddr                  ResolvedAddr       = 0;
     MD_TableLoadEntry_t *    ThisLoadEntry      = NULL;
     MD_DwellPacketControl_t *LocalControlStruct = &MD_AppData.MD_DwellTables[TblIndex];
+    MD_DwellReportControl_t *LocalReportStruct  = &MD_AppData.DwellReportControl[TblIndex];
+    MD_CompiledDwellTable_t *CompiledPtr        = &MD_AppData.CompiledTables[TblIndex];
+    uint32                   Sequence           = 0;
+    uint16                   AddrCount          = 0;
+    uint16                   DataSize           = 0;
+    uint32                   Rate               = 0;
+    bool                     Installed          = false;
 
     /* Null check on MD_LoadTablePtr not necessary - table passed validation */
 
     /* Copy 'Enabled' field from load structure to internal control structure. */
     LocalControlStruct->Enabled = MD_LoadTablePtr->Enabled;
 
+    /* Copy 'BatchFactor' field from load structure to internal control structure. */
+    LocalControlStruct->BatchFactor = MD_LoadTablePtr->BatchFactor;
+
+    /* Copy 'HeartbeatInterval' field from load structure to internal control structure. */
+    LocalControlStruct->HeartbeatInterval = MD_LoadTablePtr->HeartbeatInterval;
+
+    /* Copy 'KeyframeInterval' field from load structure to internal control structure. */
+    LocalControlStruct->KeyframeInterval = MD_LoadTablePtr->KeyframeInterval;
+
+    /* Copy 'StatsWindow' field from load structure to internal control structure. */
+    LocalControlStruct->StatsWindow = MD_LoadTablePtr->StatsWindow;
+
+    /* Copy 'PeriodMsec' and 'PhaseMsec' fields from load structure to the deadline schedule. */
+    MD_AppData.DwellDeadlines.PeriodMsec[TblIndex] = MD_LoadTablePtr->PeriodMsec;
+    MD_AppData.DwellDeadlines.PhaseMsec[TblIndex]  = MD_LoadTablePtr->PhaseMsec;
+    MD_AppData.DwellDeadlines.Deadline[TblIndex]   = 0;
+
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
-    /* Copy 'Signature' field from load structure to internal control structure. */
-    strncpy(LocalControlStruct->Signature, MD_LoadTablePtr->Signature, MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1);
+    /* Copy 'Signature' field from load structure to internal report structure. */
+    strncpy(LocalReportStruct->Signature, MD_LoadTablePtr->Signature, MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1);
 
     /* Ensure that resulting string is null-terminated */
-    LocalControlStruct->Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] = '\0';
+    LocalReportStruct->Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] = '\0';
 #endif
 
-    /* For each row in the table load, */
-    /* copy length, delay, and address fields from load structure to */
-    /* internal control structure. */
-    for (EntryIndex = 0; EntryIndex < MD_INTERFACE_DWELL_TABLE_SIZE; EntryIndex++)
+    /* Forget symbol addresses from modules that may have been unloaded since validation */
+    MD_RefreshSymCache();
+
+    /*
+    ** Install the entries validation compiled from these load entries, unless
+    ** the load was validated some other way, its symbols may have moved or
+    ** the main task validated the table again while it was being copied
+    */
+    Sequence = CompiledPtr->Sequence;
+    MD_SAMPLER_BARRIER();
+
+    if (((Sequence % 2) == 0) && (CompiledPtr->Ready == true) &&
+        (CompiledPtr->SymCacheGeneration == MD_AppData.SymCache.Generation) &&
+        (memcmp(CompiledPtr->Image, MD_LoadTablePtr->Entry,
+                LocalControlStruct->Capacity * sizeof(CompiledPtr->Image[0])) == 0))
+    {
+        memcpy(LocalControlStruct->Entry, CompiledPtr->Entry,
+               LocalControlStruct->Capacity * sizeof(LocalControlStruct->Entry[0]));
+        memcpy(LocalReportStruct->Deadband, CompiledPtr->Deadband,
+               LocalControlStruct->Capacity * sizeof(LocalReportStruct->Deadband[0]));
+        memcpy(LocalReportStruct->Group, CompiledPtr->Group,
+               LocalControlStruct->Capacity * sizeof(LocalReportStruct->Group[0]));
+        memcpy(LocalReportStruct->Signed, CompiledPtr->Signed,
+               LocalControlStruct->Capacity * sizeof(LocalReportStruct->Signed[0]));
+
+        AddrCount = CompiledPtr->AddrCount;
+        DataSize  = CompiledPtr->DataSize;
+        Rate      = CompiledPtr->Rate;
+
+        MD_SAMPLER_BARRIER();
+        Installed = (CompiledPtr->Sequence == Sequence);
+    }
+
+    if (Installed)
+    {
+        MD_SetDwellControlInfo((uint16)TblIndex, AddrCount, DataSize, Rate);
+    }
+    else
     {
-        /* Get ResolvedAddr & insert in local control structure */
+        /* For each row in the table load, */
+        /* copy length, delay, address, deadband, group and signed fields from load structure to */
+        /* internal control and report structures. */
+        for (EntryIndex = 0; EntryIndex < LocalControlStruct->Capacity; EntryIndex++)
+        {
+            /* Get ResolvedAddr & insert in local control structure */
 
-        ThisLoadEntry = &MD_LoadTablePtr->Entry[EntryIndex];
+            ThisLoadEntry = &MD_LoadTablePtr->Entry[EntryIndex];
 
-        MD_ResolveSymAddr(&ThisLoadEntry->DwellAddress, &ResolvedAddr);
+            MD_ResolveSymAddr(&ThisLoadEntry->DwellAddress, &ResolvedAddr);
 
-        MD_AppData.MD_DwellTables[TblIndex].Entry[EntryIndex].ResolvedAddress = ResolvedAddr;
-        MD_AppData.MD_DwellTables[TblIndex].Entry[EntryIndex].Length          = ThisLoadEntry->Length;
-        MD_AppData.MD_DwellTables[TblIndex].Entry[EntryIndex].Delay           = ThisLoadEntry->Delay;
+            LocalControlStruct->Entry[EntryIndex].ResolvedAddress = ResolvedAddr;
+            LocalControlStruct->Entry[EntryIndex].Length          = ThisLoadEntry->Length;
+            LocalControlStruct->Entry[EntryIndex].Delay           = ThisLoadEntry->Delay;
+            LocalReportStruct->Deadband[EntryIndex]               = ThisLoadEntry->Deadband;
+            LocalReportStruct->Group[EntryIndex]                  = ThisLoadEntry->SnapshotGroup;
+            LocalReportStruct->Signed[EntryIndex]                 = (ThisLoadEntry->Signed != 0);
 
-    } /* end for loop */
+        } /* end for loop */
 
-    /* Update Dwell Table Control Info, used to process dwell packets */
-    MD_UpdateDwellControlInfo((uint16)TblIndex);
+        /* Update Dwell Table Control Info, used to process dwell packets */
+        MD_UpdateDwellControlInfo((uint16)TblIndex);
+    }
 }
 
 /******************************************************************************/
@@ -362,7 +541,7 @@ CFE_Status_t MD_UpdateTableEnabledField(uint16 TableIndex, uint16 FieldValue)
 /******************************************************************************/
 
 CFE_Status_t MD_UpdateTableDwellEntry(uint16 TableIndex, uint16 EntryIndex, uint16 NewLength, uint16 NewDelay,
-                                      MD_SymAddr_t NewDwellAddress)
+                                      MD_SymAddr_t NewDwellAddress, uint32 NewDeadband)
 {
     CFE_Status_t         Status          = CFE_SUCCESS;
     MD_DwellTableLoad_t *MD_LoadTablePtr = NULL;
@@ -385,6 +564,7 @@ CFE_Status_t MD_UpdateTableDwellEntry(uint16 TableIndex, uint16 EntryIndex, uint
         /* Copy new numerical values to Table Services buffer */
         EntryPtr->Length              = NewLength;
         EntryPtr->Delay               = NewDelay;
+        EntryPtr->Deadband            = NewDeadband;
 
         /* Copy symbol name to Table Services buffer */
         EntryPtr->DwellAddress = NewDwellAddress;
@@ -401,6 +581,59 @@ CFE_Status_t MD_UpdateTableDwellEntry(uint16 TableIndex, uint16 EntryIndex, uint
     return Status;
 }
 
+/******************************************************************************/
+CFE_Status_t MD_UpdateTableDwellEntries(uint16 TableIndex, const MD_JamMultiEntry_t *JamEntry, uint16 NumEntries)
+{
+    CFE_Status_t         Status          = CFE_SUCCESS;
+    MD_DwellTableLoad_t *MD_LoadTablePtr = NULL;
+    MD_TableLoadEntry_t *EntryPtr        = NULL;
+    uint16               JamIndex;
+
+    /* Get pointer to Table */
+    Status = CFE_TBL_GetAddress((void *)&MD_LoadTablePtr, MD_AppData.MD_TableHandle[TableIndex]);
+
+    if ((Status != CFE_SUCCESS) && (Status != CFE_TBL_INFO_UPDATED))
+    {
+        CFE_EVS_SendEvent(MD_UPDATE_TBL_DWELL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "MD_UpdateTableDwellEntries, TableIndex %d: CFE_TBL_GetAddress Returned 0x%08x",
+                          (int)TableIndex, (unsigned int)Status);
+    }
+    else
+    {
+        for (JamIndex = 0; JamIndex < NumEntries; JamIndex++)
+        {
+            EntryPtr = &MD_LoadTablePtr->Entry[JamEntry[JamIndex].EntryId - 1];
+
+            if (JamEntry[JamIndex].FieldLength == 0)
+            {
+                /* Null entry */
+                memset(EntryPtr, 0, sizeof(*EntryPtr));
+            }
+            else
+            {
+                EntryPtr->Length              = JamEntry[JamIndex].FieldLength;
+                EntryPtr->Delay               = JamEntry[JamIndex].DwellDelay;
+                EntryPtr->Deadband            = JamEntry[JamIndex].Deadband;
+                EntryPtr->DwellAddress.Offset = JamEntry[JamIndex].DwellAddress.Offset;
+
+                CFE_SB_MessageStringGet(EntryPtr->DwellAddress.SymName, JamEntry[JamIndex].DwellAddress.SymName, "",
+                                        sizeof(EntryPtr->DwellAddress.SymName),
+                                        sizeof(JamEntry[JamIndex].DwellAddress.SymName));
+            }
+        }
+
+        /* One notification covers every entry */
+        CFE_TBL_Modified(MD_AppData.MD_TableHandle[TableIndex]);
+
+        /* Release access to Table Services buffer */
+        CFE_TBL_ReleaseAddress(MD_AppData.MD_TableHandle[TableIndex]);
+
+        Status = CFE_SUCCESS;
+    }
+
+    return Status;
+}
+
 /******************************************************************************/
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
 
@@ -438,3 +671,34 @@ CFE_Status_t MD_UpdateTableSignature(uint16 TableIndex, const char NewSignature[
 }
 
 #endif
+
+/******************************************************************************/
+CFE_Status_t MD_UpdateTableBatchFactor(uint16 TableIndex, uint16 NewBatchFactor)
+{
+    CFE_Status_t         Status          = CFE_SUCCESS;
+    MD_DwellTableLoad_t *MD_LoadTablePtr = NULL;
+
+    /* Get pointer to Table */
+    Status = CFE_TBL_GetAddress((void *)&MD_LoadTablePtr, MD_AppData.MD_TableHandle[TableIndex]);
+
+    if ((Status != CFE_SUCCESS) && (Status != CFE_TBL_INFO_UPDATED))
+    {
+        CFE_EVS_SendEvent(MD_UPDATE_TBL_BATCH_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "MD_UpdateTableBatchFactor, TableIndex %d: CFE_TBL_GetAddress Returned 0x%08x",
+                          (int)TableIndex, (unsigned int)Status);
+    }
+    else
+    {
+        MD_LoadTablePtr->BatchFactor = NewBatchFactor;
+
+        /* Notify Table Services that buffer was modified */
+        CFE_TBL_Modified(MD_AppData.MD_TableHandle[TableIndex]);
+
+        /* Release access to Table Services buffer */
+        CFE_TBL_ReleaseAddress(MD_AppData.MD_TableHandle[TableIndex]);
+
+        Status = CFE_SUCCESS;
+    }
+
+    return Status;
+}
@@ -31,6 +31,17 @@
 #include "md_tbldefs.h"
 #include "md_interface_cfg.h"
 #include "md_tblstruct.h"
+#include "md_app.h"
+#include <stddef.h>
+
+/**
+ * \brief Size in bytes of a dwell table load with Capacity entries
+ *
+ *  Entries come last in #MD_DwellTableLoad_t, so a table with fewer
+ *  entries is the same load structure cut short.
+ */
+#define MD_DWELL_TABLE_LOAD_SIZE(Capacity) \
+    (offsetof(MD_DwellTableLoad_t, Entry) + ((size_t)(Capacity) * sizeof(MD_TableLoadEntry_t)))
 
 /**
  * \brief Dwell Table Validation Function
@@ -45,17 +56,26 @@
  *  be in accordance with the call signature specified by Table Services.
  *  In addition, the function is used by Memory Dwell to validate Dwell Tables
  *  that have been recovered from a Critical Data Store.
+ *  A valid table is also compiled, in the same pass over its entries, into
+ *  the #MD_CompiledDwellTable_t of the table MD_AppData.CompileTblIndex
+ *  identifies, which the caller sets before validating and resets to
+ *  #MD_INTERFACE_NUM_DWELL_TABLES after.  A table validated while no
+ *  table is being validated is rejected.
  *
  * \param[in] TblPtr Table pointer
  *
  * \return Table validation response
- * \retval #CFE_SUCCESS            \copydoc CFE_SUCCESS
- * \retval #MD_TBL_ENA_FLAG_ERROR  \copydoc MD_TBL_ENA_FLAG_ERROR
- * \retval #MD_ZERO_RATE_TBL_ERROR \copydoc MD_ZERO_RATE_TBL_ERROR
- * \retval #MD_RESOLVE_ERROR       \copydoc MD_RESOLVE_ERROR
- * \retval #MD_INVALID_ADDR_ERROR  \copydoc MD_INVALID_ADDR_ERROR
- * \retval #MD_INVALID_LEN_ERROR   \copydoc MD_INVALID_LEN_ERROR
- * \retval #MD_NOT_ALIGNED_ERROR   \copydoc MD_NOT_ALIGNED_ERROR
+ * \retval #CFE_SUCCESS             \copydoc CFE_SUCCESS
+ * \retval #MD_ERROR                \copydoc MD_ERROR
+ * \retval #MD_TBL_ENA_FLAG_ERROR   \copydoc MD_TBL_ENA_FLAG_ERROR
+ * \retval #MD_ZERO_RATE_TBL_ERROR  \copydoc MD_ZERO_RATE_TBL_ERROR
+ * \retval #MD_RESOLVE_ERROR        \copydoc MD_RESOLVE_ERROR
+ * \retval #MD_INVALID_ADDR_ERROR   \copydoc MD_INVALID_ADDR_ERROR
+ * \retval #MD_INVALID_LEN_ERROR    \copydoc MD_INVALID_LEN_ERROR
+ * \retval #MD_NOT_ALIGNED_ERROR    \copydoc MD_NOT_ALIGNED_ERROR
+ * \retval #MD_DATA_SIZE_TBL_ERROR  \copydoc MD_DATA_SIZE_TBL_ERROR
+ * \retval #MD_PHASE_TBL_ERROR      \copydoc MD_PHASE_TBL_ERROR
+ * \retval #MD_SNAPSHOT_GROUP_ERROR \copydoc MD_SNAPSHOT_GROUP_ERROR
  */
 int32 MD_TableValidationFunc(void *TblPtr);
 
@@ -65,9 +85,12 @@ int32 MD_TableValidationFunc(void *TblPtr);
  * \par Description
  *          Copies Enabled field.
  *          Copies Signature field.
- *          For each dwell table entry, copies field length, and delay value.
- *          Evaluates and saves resolved dwell address for each dwell entry.
- *          Evaluates and saves additional summary data based on entry contents.
+ *          Installs the dwell entries and summary data compiled when the
+ *          table was validated.  If they were compiled from different
+ *          load entries, the symbol cache has been emptied since, or the
+ *          table was validated again while they were being copied, each
+ *          entry's field length, delay value and resolved dwell address are
+ *          copied and the summary data evaluated again instead.
  *
  * \par Assumptions, External Events, and Notes:
  *          Dwell table contents have been validated before reaching this point.
@@ -78,7 +101,7 @@ int32 MD_TableValidationFunc(void *TblPtr);
  * \param[in] TblIndex An identifier specifying which dwell table is to be
  *             copied.  Internal values [0..MD_INTERFACE_NUM_DWELL_TABLES-1] are used.
  */
-void MD_CopyUpdatedTbl(MD_DwellTableLoad_t *MD_LoadTablePtr, uint8 TblIndex);
+void MD_CopyUpdatedTbl(MD_DwellTableLoad_t *MD_LoadTablePtr, uint16 TblIndex);
 
 /**
  * \brief Update Dwell Table's Enabled Field.
@@ -108,7 +131,7 @@ CFE_Status_t MD_UpdateTableEnabledField(uint16 TableIndex, uint16 FieldValue);
  * \par Assumptions, External Events, and Notes:
  *          TableIndex is in [0..MD_INTERFACE_NUM_DWELL_TABLES-1] range.
  *          EntryIndex is in [0..MD_INTERFACE_DWELL_TABLE_SIZE-1] range.
- *          NewLength is 0, 1, 2, or 4.
+ *          NewLength is 0, 1, 2, 4, or a valid block dwell length.
  *          NewDwellAddress is a valid dwell address.
  *
  * \param[in] TableIndex An identifier specifying which dwell table is to be
@@ -118,12 +141,35 @@ CFE_Status_t MD_UpdateTableEnabledField(uint16 TableIndex, uint16 FieldValue);
  * \param[in] NewLength         Number of bytes to be read.
  * \param[in] NewDelay          Number of counts before next dwell.
  * \param[in] NewDwellAddress   Memory address to be dwelled on.
+ * \param[in] NewDeadband       Change needed to report the entry again.
  *
  *  \return Execution status, see \ref CFEReturnCodes
  *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
  */
 CFE_Status_t MD_UpdateTableDwellEntry(uint16 TableIndex, uint16 EntryIndex, uint16 NewLength, uint16 NewDelay,
-                                      MD_SymAddr_t NewDwellAddress);
+                                      MD_SymAddr_t NewDwellAddress, uint32 NewDeadband);
+
+/**
+ * \brief Update Values for Several Dwell Table Entries.
+ *
+ * \par Description
+ *          Writes each jam entry into the entry of the Table Services
+ *          buffer it names, then notifies Table Services of the change
+ *          once.  A jam entry with a zero field length writes a null entry.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          TableIndex is in [0..MD_INTERFACE_NUM_DWELL_TABLES-1] range.
+ *          Every jam entry has already passed the Jam command checks.
+ *
+ * \param[in] TableIndex An identifier specifying which dwell table is to be
+ *             modified.  Internal values [0..MD_INTERFACE_NUM_DWELL_TABLES-1] are used.
+ * \param[in] JamEntry   Jam entries, applied in order
+ * \param[in] NumEntries Number of jam entries
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t MD_UpdateTableDwellEntries(uint16 TableIndex, const MD_JamMultiEntry_t *JamEntry, uint16 NumEntries);
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
 
@@ -148,26 +194,22 @@ CFE_Status_t MD_UpdateTableSignature(uint16 TableIndex, const char NewSignature[
 #endif
 
 /**
- * \brief Read Dwell Table to extract address count, byte size, and rate.
+ * \brief Update Dwell Table Batch Factor.
  *
  * \par Description
- *          Read active entries and count number of dwell addresses,
- *          number of bytes to be dwelled on, and number of wakeup calls
- *          between sending of dwell packets.
+ *          Update Dwell Table Batch Factor.
  *
  * \par Assumptions, External Events, and Notes:
- *          None
+ *          TableIndex is in [0..MD_INTERFACE_NUM_DWELL_TABLES-1] range.
  *
- * \param[in] TblPtr Table pointer
- * \param[out] *ActiveAddrCountPtr Number of addresses to be sampled.
- * \param[out] *SizePtr            Size, in bytes, of data to be sampled.
- * \param[out] *RatePtr            Rate, in number of wakeup calls, between
+ * \param[in] TableIndex An identifier specifying which dwell table is to be
+ *             modified.  Internal values [0..MD_INTERFACE_NUM_DWELL_TABLES-1] are used.
+ * \param[in] NewBatchFactor New Dwell Table batch factor.
  *
  *  \return Execution status, see \ref CFEReturnCodes
  *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
  */
-CFE_Status_t MD_ReadDwellTable(const MD_DwellTableLoad_t *TblPtr, uint16 *ActiveAddrCountPtr, uint16 *SizePtr,
-                               uint32 *RatePtr);
+CFE_Status_t MD_UpdateTableBatchFactor(uint16 TableIndex, uint16 NewBatchFactor);
 
 /**
  * \brief Validate dwell table entry.
@@ -180,17 +222,19 @@ CFE_Status_t MD_ReadDwellTable(const MD_DwellTableLoad_t *TblPtr, uint16 *Active
  *          (specified by a zero field length) or all of its
  *          address and length fields must pass various checks.
  *
- * \param[in] TblEntryPtr Entry pointer
- *
+ * \param[in]  TblEntryPtr     Entry pointer
+ * \param[out] ResolvedAddrPtr Resolved dwell address, 0 if the entry is a
+ *                             null entry or its symbol couldn't be resolved
  *
  * \return Dwell table entry validation response
- * \retval #CFE_SUCCESS           \copydoc CFE_SUCCESS
- * \retval #MD_RESOLVE_ERROR      \copydoc MD_RESOLVE_ERROR
- * \retval #MD_INVALID_ADDR_ERROR \copydoc MD_INVALID_ADDR_ERROR
- * \retval #MD_INVALID_LEN_ERROR  \copydoc MD_INVALID_LEN_ERROR
- * \retval #MD_NOT_ALIGNED_ERROR  \copydoc MD_NOT_ALIGNED_ERROR
+ * \retval #CFE_SUCCESS             \copydoc CFE_SUCCESS
+ * \retval #MD_RESOLVE_ERROR        \copydoc MD_RESOLVE_ERROR
+ * \retval #MD_INVALID_ADDR_ERROR   \copydoc MD_INVALID_ADDR_ERROR
+ * \retval #MD_INVALID_LEN_ERROR    \copydoc MD_INVALID_LEN_ERROR
+ * \retval #MD_NOT_ALIGNED_ERROR    \copydoc MD_NOT_ALIGNED_ERROR
+ * \retval #MD_SNAPSHOT_GROUP_ERROR \copydoc MD_SNAPSHOT_GROUP_ERROR
  */
-int32 MD_ValidTableEntry(MD_TableLoadEntry_t *TblEntryPtr);
+int32 MD_ValidTableEntry(MD_TableLoadEntry_t *TblEntryPtr, cpuaddr *ResolvedAddrPtr);
 
 /**
  * \brief Validate dwell entries in specified Dwell Table.
@@ -202,18 +246,25 @@ int32 MD_ValidTableEntry(MD_TableLoadEntry_t *TblEntryPtr);
  * \par Assumptions, External Events, and Notes:
  *          For table to be valid, each entry must be a null entry
  *          (specified by a zero field length) or the entry's address
- *          and length field must pass various checks.
+ *          and length field must pass various checks.  The active
+ *          entries must also fit in the dwell packet together.
+ *          Each entry is compiled into CompiledPtr as it is checked, along
+ *          with the active entries' address count, data size and rate.
+ *          The sampling plan and image CRC are left to the caller.
  *
  * \param[in] TblPtr Table pointer
  * \param[out] *ErrorEntryArg  Entry number (0..) of first detected error, if any.
+ * \param[out] *CompiledPtr    Compiled form of the table.
  *
  * \return Check table entry response
- * \retval #CFE_SUCCESS           \copydoc CFE_SUCCESS
- * \retval #MD_RESOLVE_ERROR      \copydoc MD_RESOLVE_ERROR
- * \retval #MD_INVALID_ADDR_ERROR \copydoc MD_INVALID_ADDR_ERROR
- * \retval #MD_INVALID_LEN_ERROR  \copydoc MD_INVALID_LEN_ERROR
- * \retval #MD_NOT_ALIGNED_ERROR  \copydoc MD_NOT_ALIGNED_ERROR
+ * \retval #CFE_SUCCESS             \copydoc CFE_SUCCESS
+ * \retval #MD_RESOLVE_ERROR        \copydoc MD_RESOLVE_ERROR
+ * \retval #MD_INVALID_ADDR_ERROR   \copydoc MD_INVALID_ADDR_ERROR
+ * \retval #MD_INVALID_LEN_ERROR    \copydoc MD_INVALID_LEN_ERROR
+ * \retval #MD_NOT_ALIGNED_ERROR    \copydoc MD_NOT_ALIGNED_ERROR
+ * \retval #MD_DATA_SIZE_TBL_ERROR  \copydoc MD_DATA_SIZE_TBL_ERROR
+ * \retval #MD_SNAPSHOT_GROUP_ERROR \copydoc MD_SNAPSHOT_GROUP_ERROR
  */
-int32 MD_CheckTableEntries(MD_DwellTableLoad_t *TblPtr, uint16 *ErrorEntryArg);
+int32 MD_CheckTableEntries(MD_DwellTableLoad_t *TblPtr, uint16 *ErrorEntryArg, MD_CompiledDwellTable_t *CompiledPtr);
 
 #endif
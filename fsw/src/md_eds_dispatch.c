@@ -30,6 +30,8 @@
 #include "md_eventids.h"
 #include "md_extern_typedefs.h"
 #include "md_dwell_pkt.h"
+#include "md_perf.h"
+#include "md_msgids.h"
 #include "md_msgstruct.h"
 
 #include "md_eds_dispatcher.h"
@@ -43,13 +45,18 @@ static const EdsDispatchTable_EdsComponent_MD_Application_CFE_SB_Telecommand_t M
 {
     .CMD =
     {
-        .NoopCmd_indication          = MD_NoopCmd,
-        .ResetCountersCmd_indication = MD_ResetCountersCmd,
-        .StartDwellCmd_indication    = MD_StartDwellCmd,
-        .StopDwellCmd_indication     = MD_StopDwellCmd,
-        .JamDwellCmd_indication      = MD_JamDwellCmd,
+        .NoopCmd_indication           = MD_NoopCmd,
+        .ResetCountersCmd_indication  = MD_ResetCountersCmd,
+        .StartDwellCmd_indication     = MD_StartDwellCmd,
+        .StopDwellCmd_indication      = MD_StopDwellCmd,
+        .JamDwellCmd_indication       = MD_JamDwellCmd,
+        .JamMultiDwellCmd_indication  = MD_JamMultiDwellCmd,
+        .SetBatchFactorCmd_indication = MD_SetBatchFactorCmd,
+        .ArmCaptureCmd_indication     = MD_ArmCaptureCmd,
+        .TblManageCmd_indication      = MD_TblManageCmd,
+        .SendPerfHistCmd_indication   = MD_SendPerfHistCmd,
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
-        .SetSignatureCmd_indication  = MD_SetSignatureCmd
+        .SetSignatureCmd_indication   = MD_SetSignatureCmd
 #endif
     },
     .SEND_HK =
@@ -76,14 +83,29 @@ void MD_ProcessCommandPacket(const CFE_SB_Buffer_t *BufPtr)
     CFE_SB_MsgId_t    MsgId;
     CFE_MSG_Size_t    MsgSize;
     CFE_MSG_FcnCode_t MsgFc;
+    OS_time_t         StartTime;
+    bool              TimeCmd;
+
+    /* Ground commands are timed, apart from table manage requests from Table Services */
+    CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId);
+    CFE_MSG_GetFcnCode(&BufPtr->Msg, &MsgFc);
+    TimeCmd = CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(MD_CMD_MID)) && (MsgFc != MD_TBL_MANAGE_CC);
+
+    if (TimeCmd)
+    {
+        MD_PerfBegin(MD_Perf_Phases_CMD, &StartTime);
+    }
 
     Status = EdsDispatch_EdsComponent_MD_Application_Telecommand(BufPtr, &MD_TC_DISPATCH_TABLE);
 
+    if (TimeCmd)
+    {
+        MD_PerfEnd(MD_Perf_Phases_CMD, &StartTime);
+    }
+
     if (Status != CFE_SUCCESS)
     {
-        CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId);
         CFE_MSG_GetSize(&BufPtr->Msg, &MsgSize);
-        CFE_MSG_GetFcnCode(&BufPtr->Msg, &MsgFc);
         ++MD_AppData.ErrCounter;
 
         if (Status == CFE_STATUS_UNKNOWN_MSG_ID)
@@ -0,0 +1,110 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to measure how long Memory Dwell spends in each phase
+ *   of its processing.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "md_perf.h"
+#include "md_app.h"
+#include "md_perfids.h"
+#include <string.h>
+
+extern MD_AppData_t MD_AppData;
+
+const uint32 MD_PerfPhaseIds[MD_PERF_NUM_PHASES] = {
+    MD_TBL_MANAGE_PERF_ID,   /* MD_Perf_Phases_TBL_MANAGE */
+    MD_TBL_UPDATE_PERF_ID,   /* MD_Perf_Phases_TBL_UPDATE */
+    MD_DWELL_SAMPLE_PERF_ID, /* MD_Perf_Phases_DWELL_SAMPLE */
+    MD_PKT_SEND_PERF_ID,     /* MD_Perf_Phases_PKT_SEND */
+    MD_CMD_PERF_ID,          /* MD_Perf_Phases_CMD */
+};
+
+/******************************************************************************/
+
+void MD_PerfBegin(uint8 Phase, OS_time_t *StartTimePtr)
+{
+    CFE_ES_PerfLogEntry(MD_PerfPhaseIds[Phase]);
+
+    CFE_PSP_GetTime(StartTimePtr);
+}
+
+/******************************************************************************/
+
+uint32 MD_PerfEnd(uint8 Phase, const OS_time_t *StartTimePtr)
+{
+    OS_time_t      EndTime;
+    int64          ElapsedTime;
+    uint32         Result;
+    MD_PerfHist_t *HistPtr = &MD_AppData.PerfHistPkt.Payload.Hist[Phase];
+
+    CFE_PSP_GetTime(&EndTime);
+
+    CFE_ES_PerfLogExit(MD_PerfPhaseIds[Phase]);
+
+    /* A clock set backwards counts as no time at all */
+    ElapsedTime = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, *StartTimePtr));
+    if (ElapsedTime < 0)
+    {
+        Result = 0;
+    }
+    else if (ElapsedTime > 0xFFFFFFFF)
+    {
+        Result = 0xFFFFFFFF;
+    }
+    else
+    {
+        Result = (uint32)ElapsedTime;
+    }
+
+    HistPtr->Bin[MD_PerfHistBin(Result)]++;
+
+    if (Result > HistPtr->MaxTime)
+    {
+        HistPtr->MaxTime = Result;
+    }
+
+    return Result;
+}
+
+/******************************************************************************/
+
+uint16 MD_PerfHistBin(uint32 ElapsedTime)
+{
+    uint16 Bin = 0;
+
+    while ((ElapsedTime != 0) && (Bin < (MD_INTERFACE_PERF_HIST_BINS - 1)))
+    {
+        ElapsedTime >>= 1;
+        Bin++;
+    }
+
+    return Bin;
+}
+
+/******************************************************************************/
+
+void MD_ResetPerfHist(void)
+{
+    memset(&MD_AppData.PerfHistPkt.Payload, 0, sizeof(MD_AppData.PerfHistPkt.Payload));
+}
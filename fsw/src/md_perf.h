@@ -0,0 +1,106 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Dwell performance measurement functions.
+ */
+#ifndef MD_PERF_H
+#define MD_PERF_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+
+#include "cfe.h"
+#include "md_msg.h"
+
+/*************************************************************************
+ * Exported Data
+ *************************************************************************/
+
+/**
+ * \brief Performance log ID of each phase, indexed by #MD_Perf_Phases
+ */
+extern const uint32 MD_PerfPhaseIds[MD_PERF_NUM_PHASES];
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Begin Performance Phase
+ *
+ * \par Description
+ *          Makes the performance log entry for the phase and reads the PSP
+ *          clock for #MD_PerfEnd.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Each phase only runs on one task, so its histogram is only
+ *          updated by that task.  Different phases may nest.
+ *
+ * \param[in]  Phase        Phase starting, see #MD_Perf_Phases
+ * \param[out] StartTimePtr Time the phase started
+ */
+void MD_PerfBegin(uint8 Phase, OS_time_t *StartTimePtr);
+
+/**
+ * \brief End Performance Phase
+ *
+ * \par Description
+ *          Reads the PSP clock, makes the performance log exit for the
+ *          phase and adds the time since #MD_PerfBegin to its histogram.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] Phase        Phase ending, see #MD_Perf_Phases
+ * \param[in] StartTimePtr Time the phase started
+ *
+ * \return Time the phase took, in microseconds
+ */
+uint32 MD_PerfEnd(uint8 Phase, const OS_time_t *StartTimePtr);
+
+/**
+ * \brief Performance Histogram Bin
+ *
+ * \par Description
+ *          Finds the histogram bin for a time, which is the number of
+ *          significant bits in it, up to the last bin.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] ElapsedTime Time in microseconds
+ *
+ * \return Bin counting the time, 0..#MD_INTERFACE_PERF_HIST_BINS - 1
+ */
+uint16 MD_PerfHistBin(uint32 ElapsedTime);
+
+/**
+ * \brief Reset Performance Histograms
+ *
+ * \par Description
+ *          Empties the histogram of every phase.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ */
+void MD_ResetPerfHist(void);
+
+#endif
@@ -0,0 +1,276 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to sample Memory Dwell tables on a child task and hand
+ *   it requests from the main task.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "md_sampler.h"
+#include "md_app.h"
+#include "md_dispatch.h"
+#include "md_eventids.h"
+#include "md_fcncodes.h"
+#include "md_internal_cfg.h"
+#include "md_msgids.h"
+#include "md_perfids.h"
+#include <string.h>
+
+extern MD_AppData_t MD_AppData;
+
+/******************************************************************************/
+
+CFE_Status_t MD_InitSampler(void)
+{
+    CFE_Status_t Status = CFE_SUCCESS;
+
+    /*
+    **  Create the pipe only the sampler child task reads
+    */
+    Status = CFE_SB_CreatePipe(&MD_AppData.WakeupPipe, MD_INTERNAL_WAKEUP_PIPE_DEPTH, MD_INTERNAL_WAKEUP_PIPE_NAME);
+
+    if (Status == CFE_SUCCESS)
+    {
+        /*
+        ** Subscribe to MD wakeup packets
+        */
+        Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(MD_WAKEUP_MID), MD_AppData.WakeupPipe);
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(MD_SUB_WAKEUP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Failed to subscribe to wakeup messages.  RC = %08x", (unsigned int)Status);
+        }
+    }
+    else
+    {
+        CFE_EVS_SendEvent(MD_CR_PIPE_ERR_EID, CFE_EVS_EventType_ERROR, "Failed to create wakeup pipe.  RC = %d",
+                          (unsigned int)Status);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_CreateChildTask(&MD_AppData.SamplerTaskId, MD_INTERNAL_SAMPLER_TASK_NAME, MD_SamplerTask,
+                                        CFE_ES_TASK_STACK_ALLOCATE, MD_INTERNAL_SAMPLER_TASK_STACK_SIZE,
+                                        MD_INTERNAL_SAMPLER_TASK_PRIORITY, 0);
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(MD_CREATE_SAMPLER_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Failed to create sampler child task.  RC = %08x", (unsigned int)Status);
+        }
+    }
+
+    return Status;
+}
+
+/******************************************************************************/
+
+void MD_SamplerTask(void)
+{
+    CFE_Status_t     Status = CFE_SUCCESS;
+    CFE_SB_Buffer_t *BufPtr = NULL;
+
+    CFE_ES_PerfLogEntry(MD_SAMPLER_PERF_ID);
+
+    while (MD_AppData.RunStatus == CFE_ES_RunStatus_APP_RUN)
+    {
+        CFE_ES_PerfLogExit(MD_SAMPLER_PERF_ID);
+
+        /* Wait for next wakeup */
+        Status = CFE_SB_ReceiveBuffer(&BufPtr, MD_AppData.WakeupPipe, MD_SB_TIMEOUT);
+
+        CFE_ES_PerfLogEntry(MD_SAMPLER_PERF_ID);
+
+        if (Status == CFE_SUCCESS)
+        {
+            /* Sample before any queued request so requests can't delay it */
+            MD_ProcessCommandPacket(BufPtr);
+        }
+        else if (Status != CFE_SB_TIME_OUT)
+        {
+            /*
+            ** Exit on pipe read error
+            */
+            CFE_EVS_SendEvent(MD_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Wakeup Pipe Read Error, App will exit. Pipe Return Status = %08x",
+                              (unsigned int)Status);
+
+            MD_AppData.RunStatus = CFE_ES_RunStatus_APP_ERROR;
+        }
+
+        MD_ProcessSamplerQueue();
+    }
+
+    CFE_ES_PerfLogExit(MD_SAMPLER_PERF_ID);
+
+    CFE_ES_ExitChildTask();
+}
+
+/******************************************************************************/
+
+bool MD_IsMainTaskMsg(const CFE_SB_Buffer_t *BufPtr)
+{
+    CFE_SB_MsgId_t    MessageID   = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_FcnCode_t CommandCode = 0;
+    bool              IsMainTask  = false;
+
+    if (BufPtr != NULL)
+    {
+        CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+
+        if (CFE_SB_MsgIdToValue(MessageID) == MD_CMD_MID)
+        {
+            CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
+
+            /* Table validation stays off the sampler child task */
+            IsMainTask = (CommandCode == MD_TBL_MANAGE_CC);
+        }
+    }
+
+    return IsMainTask;
+}
+
+/******************************************************************************/
+
+void MD_QueueSamplerMsg(const CFE_SB_Buffer_t *BufPtr)
+{
+    MD_SamplerQueue_t *  QueuePtr     = &MD_AppData.SamplerQueue;
+    MD_SamplerRequest_t *RequestPtr   = NULL;
+    CFE_SB_MsgId_t       MessageID    = CFE_SB_INVALID_MSG_ID;
+    size_t               ActualLength = 0;
+
+    if (BufPtr != NULL)
+    {
+        CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+        CFE_MSG_GetSize(&BufPtr->Msg, &ActualLength);
+
+        if (ActualLength > sizeof(MD_SamplerMsg_t))
+        {
+            CFE_EVS_SendEvent(MD_MSG_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Msg with Bad length Rcvd: ID = 0x%08lX, Max Len = %u, Len = %d",
+                              (unsigned long)CFE_SB_MsgIdToValue(MessageID), (unsigned int)sizeof(MD_SamplerMsg_t),
+                              (int)ActualLength);
+        }
+        else if (MD_SamplerQueueFull())
+        {
+            CFE_EVS_SendEvent(MD_SAMPLER_QUEUE_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Sampler queue full, dropped Msg ID = 0x%08lX",
+                              (unsigned long)CFE_SB_MsgIdToValue(MessageID));
+        }
+        else
+        {
+            RequestPtr = &QueuePtr->Request[QueuePtr->WriteCount % MD_INTERNAL_SAMPLER_QUEUE_DEPTH];
+
+            RequestPtr->Type       = MD_SAMPLER_REQ_MSG;
+            RequestPtr->TableIndex = 0;
+            memcpy(&RequestPtr->Msg, BufPtr, ActualLength);
+
+            /* Fill the slot before handing it to the sampler */
+            MD_SAMPLER_BARRIER();
+            QueuePtr->WriteCount++;
+        }
+    }
+}
+
+/******************************************************************************/
+
+CFE_Status_t MD_QueueTableUpdate(uint16 TblIndex)
+{
+    CFE_Status_t         Status     = CFE_SUCCESS;
+    MD_SamplerQueue_t *  QueuePtr   = &MD_AppData.SamplerQueue;
+    MD_SamplerRequest_t *RequestPtr = NULL;
+
+    if (QueuePtr->UpdateRequests[TblIndex] != QueuePtr->UpdatesDone[TblIndex])
+    {
+        /* The update already queued makes the table active */
+    }
+    else if (MD_SamplerQueueFull())
+    {
+        /* Only the first attempt is reported, the main task keeps asking */
+        if (!QueuePtr->UpdateOwed[TblIndex])
+        {
+            CFE_EVS_SendEvent(MD_TBL_UPDATE_QUEUE_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Sampler queue full, update of Dwell Table %d will be retried", TblIndex + 1);
+        }
+
+        Status = MD_QUEUE_FULL_ERROR;
+    }
+    else
+    {
+        RequestPtr = &QueuePtr->Request[QueuePtr->WriteCount % MD_INTERNAL_SAMPLER_QUEUE_DEPTH];
+
+        RequestPtr->Type       = MD_SAMPLER_REQ_TBL_UPDATE;
+        RequestPtr->TableIndex = TblIndex;
+
+        QueuePtr->UpdateRequests[TblIndex]++;
+
+        /* Fill the slot before handing it to the sampler */
+        MD_SAMPLER_BARRIER();
+        QueuePtr->WriteCount++;
+    }
+
+    return Status;
+}
+
+/******************************************************************************/
+
+bool MD_SamplerQueueFull(void)
+{
+    MD_SamplerQueue_t *QueuePtr = &MD_AppData.SamplerQueue;
+
+    return (QueuePtr->WriteCount - QueuePtr->ReadCount) >= MD_INTERNAL_SAMPLER_QUEUE_DEPTH;
+}
+
+/******************************************************************************/
+
+void MD_ProcessSamplerQueue(void)
+{
+    MD_SamplerQueue_t *  QueuePtr   = &MD_AppData.SamplerQueue;
+    MD_SamplerRequest_t *RequestPtr = NULL;
+    uint16               Processed  = 0;
+
+    while ((Processed < MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP) && (QueuePtr->ReadCount != QueuePtr->WriteCount))
+    {
+        /* Read the slot only after seeing the count that handed it over */
+        MD_SAMPLER_BARRIER();
+
+        RequestPtr = &QueuePtr->Request[QueuePtr->ReadCount % MD_INTERNAL_SAMPLER_QUEUE_DEPTH];
+
+        if (RequestPtr->Type == MD_SAMPLER_REQ_TBL_UPDATE)
+        {
+            MD_UpdateDwellTable(RequestPtr->TableIndex);
+
+            QueuePtr->UpdatesDone[RequestPtr->TableIndex]++;
+        }
+        else
+        {
+            MD_ProcessCommandPacket(&RequestPtr->Msg.Buf);
+        }
+
+        /* Finish with the slot before handing it back */
+        MD_SAMPLER_BARRIER();
+        QueuePtr->ReadCount++;
+
+        Processed++;
+    }
+}
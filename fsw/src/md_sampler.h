@@ -0,0 +1,171 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Dwell sampler child task functions.
+ */
+#ifndef MD_SAMPLER_H
+#define MD_SAMPLER_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+
+#include "cfe.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Sampler queue memory barrier
+ *
+ * \par Description
+ *      Keeps a queue slot's contents ordered against the counter that
+ *      hands the slot to the other task.  Targets whose compiler isn't GCC
+ *      compatible run MD on a single core, where the volatile counters are
+ *      enough.
+ */
+#ifdef __GNUC__
+#define MD_SAMPLER_BARRIER() __sync_synchronize()
+#else
+#define MD_SAMPLER_BARRIER()
+#endif
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Initialize the Sampler Child Task
+ *
+ * \par Description
+ *          Creates the wakeup pipe, subscribes it to wakeup messages and
+ *          creates the child task that samples dwell tables.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Dwell tables have been loaded, since the child task may sample
+ *          them as soon as it is created.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t MD_InitSampler(void);
+
+/**
+ * \brief Sampler Child Task
+ *
+ * \par Description
+ *          Samples dwell tables on each wakeup message, then works through
+ *          up to #MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP requests queued by
+ *          the main task.  Runs until the application run status changes.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ */
+void MD_SamplerTask(void);
+
+/**
+ * \brief Main Task Message
+ *
+ * \par Description
+ *          Checks whether a message received on the command pipe is
+ *          executed by the main task rather than queued for the sampler
+ *          child task.  Only the table manage command is, so Table
+ *          Services notifications lead to table validation on the main
+ *          task.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] BufPtr Software bus buffer received on the command pipe
+ *
+ * \return Boolean main task message response
+ * \retval true  The main task executes the message
+ * \retval false The message is queued for the sampler child task
+ */
+bool MD_IsMainTaskMsg(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Queue Message for the Sampler
+ *
+ * \par Description
+ *          Copies a command or housekeeping request received by the main
+ *          task into the sampler queue.  The message is dropped with an
+ *          event if it is too long or the queue is full.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Only called by the main task.
+ *
+ * \param[in] BufPtr Software bus buffer received on the command pipe
+ */
+void MD_QueueSamplerMsg(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Queue Table Update for the Sampler
+ *
+ * \par Description
+ *          Asks the sampler child task to update a validated dwell table
+ *          and copy it into the dwell control structures.  Nothing is
+ *          queued while an update of the table is still queued.  If the
+ *          queue is full, the first attempt for the table is reported in
+ *          an event and #MD_QUEUE_FULL_ERROR is returned, so the main task
+ *          can ask again.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Only called by the main task.
+ *
+ * \param[in] TblIndex Dwell table index, 0..MD_INTERFACE_NUM_DWELL_TABLES-1
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+ *  \retval #MD_QUEUE_FULL_ERROR \copybrief MD_QUEUE_FULL_ERROR
+ */
+CFE_Status_t MD_QueueTableUpdate(uint16 TblIndex);
+
+/**
+ * \brief Sampler Queue Full
+ *
+ * \par Description
+ *          Checks whether every slot of the sampler queue holds a request
+ *          the sampler child task hasn't processed.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \return Boolean queue full response
+ * \retval true  No request can be queued
+ * \retval false At least one request can be queued
+ */
+bool MD_SamplerQueueFull(void);
+
+/**
+ * \brief Process Sampler Queue
+ *
+ * \par Description
+ *          Processes up to #MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP queued
+ *          requests, oldest first.  Messages are dispatched as if received
+ *          on a pipe and table updates are handed to #MD_UpdateDwellTable.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Only called by the sampler child task.
+ */
+void MD_ProcessSamplerQueue(void);
+
+#endif
@@ -0,0 +1,223 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to read the entries of a snapshot group together and
+ *   distribute their values to the dwell packets they belong to.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "md_snapshot.h"
+#include "md_dwell_pkt.h"
+#include "md_app.h"
+#include "md_eventids.h"
+#include "md_internal_cfg.h"
+#include <string.h>
+
+extern MD_AppData_t MD_AppData;
+
+/******************************************************************************/
+
+void MD_BuildSnapshotGroups(void)
+{
+    uint32                   Group;
+    uint16                   TblIndex;
+    uint16                   EntryIndex;
+    uint32                   LeftOutCount = 0;
+    MD_SnapshotGroups_t *    GroupsPtr    = &MD_AppData.SnapshotGroups;
+    MD_DwellPacketControl_t *TblPtr       = NULL;
+    MD_SnapshotMember_t *    MemberPtr    = NULL;
+
+    GroupsPtr->NumMembers = 0;
+
+    /* Place each group's members after the last group's, in table and entry order */
+    for (Group = 1; Group <= MD_INTERNAL_NUM_SNAPSHOT_GROUPS; Group++)
+    {
+        GroupsPtr->FirstMember[Group - 1] = GroupsPtr->NumMembers;
+
+        for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+        {
+            TblPtr = &MD_AppData.MD_DwellTables[TblIndex];
+
+            for (EntryIndex = 0; EntryIndex < TblPtr->AddrCount; EntryIndex++)
+            {
+                if ((MD_AppData.DwellReportControl[TblIndex].Group[EntryIndex] == Group) &&
+                    (GroupsPtr->NumMembers >= MD_INTERNAL_SNAPSHOT_MAX_MEMBERS))
+                {
+                    LeftOutCount++;
+                }
+                else if (MD_AppData.DwellReportControl[TblIndex].Group[EntryIndex] == Group)
+                {
+                    MemberPtr = &GroupsPtr->Member[GroupsPtr->NumMembers];
+
+                    MemberPtr->ResolvedAddress = TblPtr->Entry[EntryIndex].ResolvedAddress;
+                    MemberPtr->Length          = TblPtr->Entry[EntryIndex].Length;
+                    MemberPtr->Group           = (uint16)Group;
+                    MemberPtr->TableIndex      = TblIndex;
+                    MemberPtr->EntryIndex      = EntryIndex;
+                    MemberPtr->Status          = CFE_SUCCESS;
+
+                    /* The first member reached takes the group's first pass */
+                    MemberPtr->Fresh = false;
+
+                    GroupsPtr->NumMembers++;
+                }
+            }
+        }
+
+        GroupsPtr->MemberCount[Group - 1] = GroupsPtr->NumMembers - GroupsPtr->FirstMember[Group - 1];
+    }
+
+    if (LeftOutCount != 0)
+    {
+        CFE_EVS_SendEvent(MD_SNAPSHOT_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Snapshot groups full, %d entries beyond the %d members will be read on their own",
+                          (int)LeftOutCount, MD_INTERNAL_SNAPSHOT_MAX_MEMBERS);
+    }
+}
+
+/******************************************************************************/
+
+void MD_TakeSnapshot(uint16 Group)
+{
+    MD_SnapshotGroups_t *GroupsPtr = &MD_AppData.SnapshotGroups;
+    MD_SnapshotMember_t *MemberPtr = &GroupsPtr->Member[GroupsPtr->FirstMember[Group - 1]];
+    MD_SnapshotMember_t *EndPtr    = MemberPtr + GroupsPtr->MemberCount[Group - 1];
+
+    /* Read the members back to back, leaving anything but the reads for later */
+    while (MemberPtr < EndPtr)
+    {
+        MemberPtr->Status = CFE_SUCCESS;
+
+        switch (MemberPtr->Length)
+        {
+            case 1:
+                if (CFE_PSP_MemRead8(MemberPtr->ResolvedAddress, (uint8 *)MemberPtr->Data) != CFE_PSP_SUCCESS)
+                {
+                    MemberPtr->Status = ONE_BYTE_MEM_ADDR_READ_ERR;
+                }
+                break;
+            case 2:
+                if (CFE_PSP_MemRead16(MemberPtr->ResolvedAddress, (uint16 *)MemberPtr->Data) != CFE_PSP_SUCCESS)
+                {
+                    MemberPtr->Status = TWO_BYTE_MEM_ADDR_READ_ERR;
+                }
+                break;
+            case 4:
+                if (CFE_PSP_MemRead32(MemberPtr->ResolvedAddress, MemberPtr->Data) != CFE_PSP_SUCCESS)
+                {
+                    MemberPtr->Status = FOUR_BYTE_MEM_ADDR_READ_ERR;
+                }
+                break;
+            default:
+                if ((MemberPtr->Length >= MD_MIN_BLOCK_DWELL_LENGTH) &&
+                    (MemberPtr->Length <= MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH))
+                {
+                    if (CFE_PSP_MemCpy(MemberPtr->Data, (void *)MemberPtr->ResolvedAddress, MemberPtr->Length) !=
+                        CFE_PSP_SUCCESS)
+                    {
+                        MemberPtr->Status = BLOCK_MEM_ADDR_READ_ERR;
+                    }
+                }
+                else
+                {
+                    /* Shouldn't ever get here unless length value was corrupted. */
+                    MemberPtr->Status = INVALID_DWELL_ADDR_LEN;
+                }
+                break;
+        }
+
+        MemberPtr->Fresh = true;
+        MemberPtr++;
+    }
+}
+
+/******************************************************************************/
+
+MD_SnapshotMember_t *MD_FindSnapshotMember(uint16 TblIndex, uint16 EntryIndex)
+{
+    MD_SnapshotGroups_t *GroupsPtr = &MD_AppData.SnapshotGroups;
+    MD_SnapshotMember_t *FoundPtr  = NULL;
+    uint16               Group     = MD_AppData.DwellReportControl[TblIndex].Group[EntryIndex];
+    uint16               MemberIndex;
+    uint16               EndIndex;
+
+    if ((Group >= 1) && (Group <= MD_INTERNAL_NUM_SNAPSHOT_GROUPS))
+    {
+        EndIndex = GroupsPtr->FirstMember[Group - 1] + GroupsPtr->MemberCount[Group - 1];
+
+        for (MemberIndex = GroupsPtr->FirstMember[Group - 1]; (MemberIndex < EndIndex) && (FoundPtr == NULL);
+             MemberIndex++)
+        {
+            if ((GroupsPtr->Member[MemberIndex].TableIndex == TblIndex) &&
+                (GroupsPtr->Member[MemberIndex].EntryIndex == EntryIndex))
+            {
+                FoundPtr = &GroupsPtr->Member[MemberIndex];
+            }
+        }
+    }
+
+    return FoundPtr;
+}
+
+/******************************************************************************/
+
+int32 MD_GetSnapshotData(uint16 TblIndex, uint16 EntryIndex)
+{
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TblIndex];
+    MD_SnapshotMember_t *    MemberPtr = MD_FindSnapshotMember(TblIndex, EntryIndex);
+    int32                    Status;
+
+    if (MemberPtr == NULL)
+    {
+        /* Entries that didn't fit in the groups are read on their own */
+        Status = MD_GetDwellData(TblIndex, EntryIndex);
+    }
+    else
+    {
+        /* A member that already reported the last pass starts the next one */
+        if (!MemberPtr->Fresh)
+        {
+            MD_TakeSnapshot(MemberPtr->Group);
+        }
+
+        Status = MemberPtr->Status;
+
+        if (Status == CFE_SUCCESS)
+        {
+            memcpy(&MD_GetDwellPktBuf(TblIndex)->Payload.Data[TblPtr->PktOffset], MemberPtr->Data,
+                   MemberPtr->Length);
+        }
+        else if ((Status != INVALID_DWELL_ADDR_LEN) &&
+                 (MD_GetDwellPktBuf(TblIndex) != &MD_AppData.MD_DwellPkt[TblIndex]))
+        {
+            /* Don't telemeter whatever a software bus buffer held before */
+            memset(&TblPtr->PktBuf->Payload.Data[TblPtr->PktOffset], 0, MemberPtr->Length);
+        }
+
+        MemberPtr->Fresh = false;
+
+        /* Update write location in dwell packet */
+        TblPtr->PktOffset += MemberPtr->Length;
+    }
+
+    return Status;
+}
@@ -0,0 +1,110 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Dwell snapshot group functions.
+ */
+#ifndef MD_SNAPSHOT_H
+#define MD_SNAPSHOT_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+
+#include "cfe.h"
+#include "md_app.h"
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Build the Snapshot Groups
+ *
+ * \par Description
+ *          Collects the active entries of every dwell table that are
+ *          assigned to a snapshot group into the members of the groups,
+ *          kept together by group so each group is read in one pass.
+ *          Entries beyond #MD_INTERNAL_SNAPSHOT_MAX_MEMBERS are left out
+ *          and reported, and are read on their own.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called whenever a table's entries or active entry count
+ *          change.  Every member starts out needing a new pass.
+ */
+void MD_BuildSnapshotGroups(void);
+
+/**
+ * \brief Take a Snapshot of a Group
+ *
+ * \par Description
+ *          Reads every member of a snapshot group back to back, keeping
+ *          each value and read status with the member and marking it
+ *          fresh.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Member lengths were validated when their tables were loaded.
+ *
+ * \param[in] Group Snapshot group to read (1..#MD_INTERNAL_NUM_SNAPSHOT_GROUPS)
+ */
+void MD_TakeSnapshot(uint16 Group);
+
+/**
+ * \brief Find a Snapshot Group Member
+ *
+ * \par Description
+ *          Finds the member a dwell table entry was given in its snapshot
+ *          group.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] TblIndex   identifies source dwell table (0..)
+ * \param[in] EntryIndex identifies dwell entry within specified table (0..)
+ *
+ * \return Pointer to the member, NULL if the entry isn't in a group or
+ *         didn't fit in the groups
+ */
+MD_SnapshotMember_t *MD_FindSnapshotMember(uint16 TblIndex, uint16 EntryIndex);
+
+/**
+ * \brief Copy Snapshot Data to Dwell Packet
+ *
+ * \par Description
+ *          Copies the value a snapshot group member got on the latest pass
+ *          over its group to the dwell packet, taking a new pass first if
+ *          the member already reported the last one.  Entries that didn't
+ *          fit in the groups are read on their own by #MD_GetDwellData.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          A member that couldn't be read is written to a software bus
+ *          buffer as zeros, as #MD_GetDwellData does.  The members of a
+ *          group report values from the same pass as long as each one is
+ *          reached once between passes, as when the tables holding them
+ *          run at the same rate.
+ *
+ * \param[in] TblIndex   identifies source dwell table (0..)
+ * \param[in] EntryIndex identifies dwell entry within specified table (0..)
+ *
+ * \return Execution status, non-zero on failure
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 MD_GetSnapshotData(uint16 TblIndex, uint16 EntryIndex);
+
+#endif
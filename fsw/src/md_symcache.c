@@ -0,0 +1,193 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to remember the addresses of symbols Memory Dwell has
+ *   already looked up.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "md_symcache.h"
+#include "md_app.h"
+#include "md_eventids.h"
+#include "md_internal_cfg.h"
+#include <string.h>
+
+extern MD_AppData_t MD_AppData;
+
+/******************************************************************************/
+
+CFE_Status_t MD_InitSymCache(void)
+{
+    CFE_Status_t         Status  = CFE_SUCCESS;
+    MD_SymCacheModules_t Modules = {0, 0};
+
+    Status = OS_MutSemCreate(&MD_AppData.SymCache.MutexId, MD_INTERNAL_SYM_CACHE_MUTEX_NAME, 0);
+
+    if (Status != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MD_CREATE_SYM_MUTEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Failed to create symbol cache mutex.  RC = %d", (int)Status);
+    }
+    else
+    {
+        MD_InvalidateSymCache();
+
+        OS_ForEachObjectOfType(OS_OBJECT_TYPE_OS_MODULE, OS_OBJECT_CREATOR_ANY, MD_SymCacheModuleCallback,
+                               &Modules);
+
+        MD_AppData.SymCache.ModuleCount = Modules.Count;
+        MD_AppData.SymCache.ModuleIdSum = Modules.IdSum;
+    }
+
+    return Status;
+}
+
+/******************************************************************************/
+
+uint32 MD_SymCacheHash(const char *SymName)
+{
+    uint32 Hash  = 2166136261U;
+    uint16 Index = 0;
+
+    while ((Index < CFE_MISSION_MAX_PATH_LEN) && (SymName[Index] != '\0'))
+    {
+        Hash ^= (uint8)SymName[Index];
+        Hash *= 16777619U;
+        Index++;
+    }
+
+    return Hash;
+}
+
+/******************************************************************************/
+
+bool MD_SymCacheLookup(const char *SymName, cpuaddr *SymAddr)
+{
+    MD_SymCacheEntry_t *EntryPtr   = NULL;
+    MD_SymCacheEntry_t *FreePtr    = NULL;
+    uint32              Hash       = 0;
+    uint32              Generation = 0;
+    uint16              Probe      = 0;
+    bool                Found      = false;
+    bool                Cacheable  = false;
+
+    Hash = MD_SymCacheHash(SymName);
+
+    /* Without the mutex the symbol is still resolved, just without the cache */
+    if (OS_MutSemTake(MD_AppData.SymCache.MutexId) == OS_SUCCESS)
+    {
+        Cacheable = true;
+
+        for (Probe = 0; (Probe < MD_SYM_CACHE_MAX_PROBES) && (Found == false) && (FreePtr == NULL); Probe++)
+        {
+            EntryPtr = &MD_AppData.SymCache.Entry[(Hash + Probe) & (MD_INTERNAL_SYM_CACHE_SIZE - 1)];
+
+            if (EntryPtr->SymName[0] == '\0')
+            {
+                /* Slots are only emptied all at once, so the symbol isn't further on */
+                FreePtr = EntryPtr;
+            }
+            else if ((EntryPtr->Hash == Hash) && (strncmp(EntryPtr->SymName, SymName, CFE_MISSION_MAX_PATH_LEN) == 0))
+            {
+                *SymAddr = EntryPtr->Address;
+                Found    = true;
+            }
+        }
+
+        Generation = MD_AppData.SymCache.Generation;
+
+        OS_MutSemGive(MD_AppData.SymCache.MutexId);
+    }
+
+    if (Found == false)
+    {
+        /* The symbol table scan is slow, so the other task isn't kept waiting on the cache meanwhile */
+        Found = (OS_SymbolLookup(SymAddr, SymName) == OS_SUCCESS);
+
+        if ((Found == true) && (Cacheable == true) && (OS_MutSemTake(MD_AppData.SymCache.MutexId) == OS_SUCCESS))
+        {
+            /* Leave the symbol out if the cache was emptied or its free slot taken during the scan */
+            if ((Generation == MD_AppData.SymCache.Generation) && ((FreePtr == NULL) || (FreePtr->SymName[0] == '\0')))
+            {
+                if (FreePtr == NULL)
+                {
+                    FreePtr = &MD_AppData.SymCache.Entry[Hash & (MD_INTERNAL_SYM_CACHE_SIZE - 1)];
+                }
+
+                FreePtr->Hash    = Hash;
+                FreePtr->Address = *SymAddr;
+                strncpy(FreePtr->SymName, SymName, CFE_MISSION_MAX_PATH_LEN);
+            }
+
+            OS_MutSemGive(MD_AppData.SymCache.MutexId);
+        }
+    }
+
+    return Found;
+}
+
+/******************************************************************************/
+
+void MD_RefreshSymCache(void)
+{
+    MD_SymCacheModules_t Modules = {0, 0};
+
+    OS_ForEachObjectOfType(OS_OBJECT_TYPE_OS_MODULE, OS_OBJECT_CREATOR_ANY, MD_SymCacheModuleCallback, &Modules);
+
+    if (OS_MutSemTake(MD_AppData.SymCache.MutexId) == OS_SUCCESS)
+    {
+        if ((Modules.Count != MD_AppData.SymCache.ModuleCount) || (Modules.IdSum != MD_AppData.SymCache.ModuleIdSum))
+        {
+            MD_InvalidateSymCache();
+
+            MD_AppData.SymCache.ModuleCount = Modules.Count;
+            MD_AppData.SymCache.ModuleIdSum = Modules.IdSum;
+        }
+
+        OS_MutSemGive(MD_AppData.SymCache.MutexId);
+    }
+}
+
+/******************************************************************************/
+
+void MD_SymCacheModuleCallback(osal_id_t ModuleId, void *Arg)
+{
+    MD_SymCacheModules_t *ModulesPtr = (MD_SymCacheModules_t *)Arg;
+
+    ModulesPtr->Count++;
+    ModulesPtr->IdSum += (uint32)OS_ObjectIdToInteger(ModuleId);
+}
+
+/******************************************************************************/
+
+void MD_InvalidateSymCache(void)
+{
+    uint16 Index;
+
+    for (Index = 0; Index < MD_INTERNAL_SYM_CACHE_SIZE; Index++)
+    {
+        MD_AppData.SymCache.Entry[Index].SymName[0] = '\0';
+    }
+
+    /* Anything resolved before now may be stale */
+    MD_AppData.SymCache.Generation++;
+}
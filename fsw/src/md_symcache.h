@@ -0,0 +1,158 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Dwell symbol cache functions.
+ */
+#ifndef MD_SYMCACHE_H
+#define MD_SYMCACHE_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+
+#include "cfe.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Most slots searched for a symbol
+ *
+ * \par Description
+ *      A symbol is looked for in its hash's slot and the slots after it,
+ *      up to this many in all.  A symbol that finds none of them empty
+ *      replaces the one in its hash's slot.
+ */
+#define MD_SYM_CACHE_MAX_PROBES 4
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief Modules loaded, as counted by #MD_SymCacheModuleCallback
+ */
+typedef struct
+{
+    uint32 Count; /**< \brief Number of modules */
+    uint32 IdSum; /**< \brief Sum of the module IDs */
+} MD_SymCacheModules_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Initialize the Symbol Cache
+ *
+ * \par Description
+ *          Creates the mutex that serializes use of the symbol cache,
+ *          empties the cache and records the modules loaded.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called before any dwell table is validated.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t MD_InitSymCache(void);
+
+/**
+ * \brief Symbol Cache Hash
+ *
+ * \par Description
+ *          Computes the FNV-1a hash of a symbol name, which ends at a NUL
+ *          or after #CFE_MISSION_MAX_PATH_LEN characters.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] SymName Symbol name
+ *
+ * \return Hash of the symbol name
+ */
+uint32 MD_SymCacheHash(const char *SymName);
+
+/**
+ * \brief Symbol Cache Lookup
+ *
+ * \par Description
+ *          Finds the address of a symbol in the cache, or looks it up with
+ *          #OS_SymbolLookup and adds it to the cache.  Symbols that aren't
+ *          found aren't cached, since a module loaded later may define them.
+ *          The cache mutex isn't held during #OS_SymbolLookup, so a symbol
+ *          is left out if the cache was emptied, or the slot it would take
+ *          was filled, while it was being looked up.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          SymName isn't an empty string.
+ *
+ * \param[in]  SymName Symbol name
+ * \param[out] SymAddr Address of the symbol
+ *
+ * \return Boolean symbol found response
+ * \retval true  Symbol was found and SymAddr set
+ * \retval false Symbol isn't in the symbol table
+ */
+bool MD_SymCacheLookup(const char *SymName, cpuaddr *SymAddr);
+
+/**
+ * \brief Refresh the Symbol Cache
+ *
+ * \par Description
+ *          Empties the symbol cache if a module has been loaded or
+ *          unloaded since it was last emptied, so addresses in unloaded
+ *          modules aren't used.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called before the entries of a dwell table or jam command are
+ *          resolved, rather than for each entry.
+ */
+void MD_RefreshSymCache(void);
+
+/**
+ * \brief Symbol Cache Module Callback
+ *
+ * \par Description
+ *          Counts one loaded module for #MD_RefreshSymCache.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          Called by #OS_ForEachObjectOfType.
+ *
+ * \param[in]     ModuleId ID of a loaded module
+ * \param[in,out] Arg      Pointer to the #MD_SymCacheModules_t being counted
+ */
+void MD_SymCacheModuleCallback(osal_id_t ModuleId, void *Arg);
+
+/**
+ * \brief Invalidate the Symbol Cache
+ *
+ * \par Description
+ *          Empties every slot of the symbol cache and starts a new
+ *          cache generation.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The caller holds the symbol cache mutex, or no other task
+ *          uses the cache yet.
+ */
+void MD_InvalidateSymCache(void);
+
+#endif
@@ -27,6 +27,11 @@
 #include "cfe.h"
 #include "md_utils.h"
 #include "md_app.h"
+#include "md_dwell_pkt.h"
+#include "md_capture.h"
+#include "md_dwell_err.h"
+#include "md_snapshot.h"
+#include "md_symcache.h"
 #include <string.h>
 extern MD_AppData_t MD_AppData;
 
@@ -65,7 +70,7 @@ void MD_UpdateDwellControlInfo(uint16 TableIndex)
     /*
     ** Sum Address Count, Data Size, and Rate from Dwell Entries
     */
-    while ((EntryIndex < MD_INTERFACE_DWELL_TABLE_SIZE) && (TblPtr->Entry[EntryIndex].Length != 0))
+    while ((EntryIndex < TblPtr->Capacity) && (TblPtr->Entry[EntryIndex].Length != 0))
     {
         NumDwellAddresses++;
         NumDwellDataBytes += TblPtr->Entry[EntryIndex].Length;
@@ -73,10 +78,48 @@ void MD_UpdateDwellControlInfo(uint16 TableIndex)
         EntryIndex++;
     }
 
+    /* Compile the entries into the sampling plan used by the dwell loop */
+    MD_CompileDwellPlan(TblPtr->Entry, MD_AppData.DwellReportControl[TableIndex].Group, NumDwellAddresses);
+
+    MD_SetDwellControlInfo(TableIndex, NumDwellAddresses, NumDwellDataBytes, NumDwellDelayCounts);
+}
+
+/******************************************************************************/
+
+void MD_SetDwellControlInfo(uint16 TableIndex, uint16 AddrCount, uint16 DataSize, uint32 Rate)
+{
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[TableIndex];
+
+    /* A capture can't watch entries that are about to change */
+    MD_CancelCapture(TableIndex);
+
+    /* Cycles batched or summarized under the old table contents go out on their own */
+    MD_SendDwellBatchPkt(TableIndex);
+    MD_SendDwellStatsPkt(TableIndex);
+
     /* Copy totals to dwell control structure. */
-    TblPtr->AddrCount = NumDwellAddresses;
-    TblPtr->DataSize  = NumDwellDataBytes;
-    TblPtr->Rate      = NumDwellDelayCounts;
+    TblPtr->AddrCount = AddrCount;
+    TblPtr->DataSize  = DataSize;
+    TblPtr->Rate      = Rate;
+
+    /* The last reported cycle no longer matches the table, report the next one as a keyframe */
+    TblPtr->HeartbeatCountdown = 0;
+    TblPtr->KeyframeCountdown  = 0;
+
+    /* Cycles of the new table take its new rate */
+    MD_AppData.DwellReportControl[TableIndex].CycleDueWakeup = 0;
+
+    /* Header fields of later dwell packets come from the template */
+    MD_UpdateDwellPktTemplate(TableIndex);
+
+    /* Keep the dwell schedule consistent with the new control info */
+    MD_RefreshDwellSchedule(TableIndex);
+
+    /* The table's entries may have joined or left snapshot groups */
+    MD_BuildSnapshotGroups();
+
+    /* Errors reading the old entries don't carry over to the new ones */
+    MD_ResetDwellReadErrors(TableIndex);
 }
 
 /******************************************************************************/
@@ -85,13 +128,13 @@ void MD_UpdateDwellControlInfo(uint16 TableIndex)
 **  Data Validation Functions
 */
 /******************************************************************************/
-bool MD_ValidEntryId(uint16 EntryId)
+bool MD_ValidEntryId(uint16 TableIndex, uint16 EntryId)
 {
     bool IsValid = false;
 
-    if ((EntryId >= 1) && (EntryId <= MD_INTERFACE_DWELL_TABLE_SIZE))
+    if ((EntryId >= 1) && (EntryId <= MD_AppData.MD_DwellTables[TableIndex].Capacity))
     {
-        /* validate  value (1..MD_INTERFACE_DWELL_TABLE_SIZE ) */
+        /* validate  value (1..table capacity) */
         IsValid = true;
     }
 
@@ -135,6 +178,91 @@ bool MD_ValidFieldLength(uint16 FieldLength)
     {
         IsValid = true;
     }
+    else if ((FieldLength >= MD_MIN_BLOCK_DWELL_LENGTH) && (FieldLength <= MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH))
+    {
+        /* Block dwell */
+        IsValid = true;
+    }
+
+    return IsValid;
+}
+
+/******************************************************************************/
+
+uint32 MD_DwellDataSizeWithEntry(uint16 TableIndex, uint16 EntryIndex, uint16 NewLength)
+{
+    uint16                   ThisIndex = 0;
+    uint16                   ThisLength;
+    uint32                   DataSize = 0;
+    MD_DwellPacketControl_t *TblPtr   = &MD_AppData.MD_DwellTables[TableIndex];
+
+    while (ThisIndex < TblPtr->Capacity)
+    {
+        if (ThisIndex == EntryIndex)
+        {
+            ThisLength = NewLength;
+        }
+        else
+        {
+            ThisLength = TblPtr->Entry[ThisIndex].Length;
+        }
+
+        if (ThisLength == 0)
+        {
+            break;
+        }
+
+        DataSize += ThisLength;
+        ThisIndex++;
+    }
+
+    return DataSize;
+}
+
+/******************************************************************************/
+uint32 MD_DwellDataSizeWithJam(uint16 TableIndex, const MD_JamMultiEntry_t *JamEntry, uint16 NumEntries)
+{
+    uint16                   ThisIndex = 0;
+    uint16                   JamIndex;
+    uint16                   ThisLength;
+    uint32                   DataSize = 0;
+    MD_DwellPacketControl_t *TblPtr   = &MD_AppData.MD_DwellTables[TableIndex];
+
+    while (ThisIndex < TblPtr->Capacity)
+    {
+        ThisLength = TblPtr->Entry[ThisIndex].Length;
+
+        for (JamIndex = 0; JamIndex < NumEntries; JamIndex++)
+        {
+            if (JamEntry[JamIndex].EntryId == (ThisIndex + 1))
+            {
+                ThisLength = JamEntry[JamIndex].FieldLength;
+            }
+        }
+
+        if (ThisLength == 0)
+        {
+            break;
+        }
+
+        DataSize += ThisLength;
+        ThisIndex++;
+    }
+
+    return DataSize;
+}
+
+/******************************************************************************/
+bool MD_ValidBatchFactor(uint16 BatchFactor, uint32 DataSize)
+{
+    bool IsValid = true;
+
+    /* Every batched cycle carries a time offset ahead of its dwell data */
+    if ((BatchFactor > 1) &&
+        ((BatchFactor * (DataSize + MD_BATCH_CYCLE_HDR_SIZE)) > MD_INTERFACE_DWELL_BATCH_DATA_SIZE))
+    {
+        IsValid = false;
+    }
 
     return IsValid;
 }
@@ -187,8 +315,7 @@ bool MD_Verify16Aligned(cpuaddr Address, uint32 Size)
 
 bool MD_ResolveSymAddr(const MD_SymAddr_t *SymAddr, cpuaddr *ResolvedAddr)
 {
-    bool  Valid;
-    int32 OS_Status;
+    bool Valid;
 
     /*
     ** NUL terminate the very end of the symbol name string array as a
@@ -209,10 +336,9 @@ bool MD_ResolveSymAddr(const MD_SymAddr_t *SymAddr, cpuaddr *ResolvedAddr)
     {
         /*
         ** If symbol name is not an empty string look it up
-        ** using the OSAL API and add the offset if it succeeds
+        ** in the symbol cache and add the offset if it succeeds
         */
-        OS_Status = OS_SymbolLookup(ResolvedAddr, SymAddr->SymName);
-        if (OS_Status == OS_SUCCESS)
+        if (MD_SymCacheLookup(SymAddr->SymName, ResolvedAddr))
         {
             *ResolvedAddr += SymAddr->Offset;
             Valid = true;
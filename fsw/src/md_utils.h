@@ -60,23 +60,45 @@ bool MD_TableIsInMask(int16 TableId, uint16 TableMask);
  */
 void MD_UpdateDwellControlInfo(uint16 TableIndex);
 
+/**
+ * \brief Set Dwell Table Control Info
+ *
+ * \par Description
+ *          Sets the address count, data size, and rate in the control
+ *          structure used by the application for dwell packet processing,
+ *          restarts the dwell stream's output for the new entries,
+ *          rebuilds the snapshot groups and forgets the read errors of the
+ *          old entries.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          The control structure's entries, including their sampling plan,
+ *          are already the new ones and agree with the totals given.
+ *
+ * \param[in] TableIndex identifies dwell control structure  (0..#MD_INTERFACE_NUM_DWELL_TABLES-1)
+ * \param[in] AddrCount  Number of active dwell entries
+ * \param[in] DataSize   Total number of data bytes of the active entries
+ * \param[in] Rate       Total delay of the active entries, in task wakeup calls
+ */
+void MD_SetDwellControlInfo(uint16 TableIndex, uint16 AddrCount, uint16 DataSize, uint32 Rate);
+
 /**
  * \brief Validate Entry Index
  *
  * \par Description
- *        Checks for valid value (1..MD_INTERFACE_DWELL_TABLE_SIZE ) for entry id
+ *        Checks for valid value (1..capacity of the table) for entry id
  *        specified in Jam command.
  *
  * \par Assumptions, External Events, and Notes:
- *          None
+ *          TableIndex has already been checked.
  *
- * \param[in] EntryId  EntryId (starting at one) for dwell control structure entry.
+ * \param[in] TableIndex  identifies dwell control structure (0..#MD_INTERFACE_NUM_DWELL_TABLES-1)
+ * \param[in] EntryId     EntryId (starting at one) for dwell control structure entry.
  *
  * \return Boolean entry validation result
  * \retval true  Entry is valid
  * \retval false Entry is not valid
  */
-bool MD_ValidEntryId(uint16 EntryId);
+bool MD_ValidEntryId(uint16 TableIndex, uint16 EntryId);
 
 /**
  * \brief Validate Dwell Address
@@ -124,7 +146,9 @@ bool MD_ValidTableId(uint16 TableId);
  *        Check valid range for dwell field length.
  *
  * \par Assumptions, External Events, and Notes:
- *   Valid values for dwell field length are 0, 1, 2, and 4.
+ *   Valid values for dwell field length are 0, 1, 2, and 4, plus block
+ *   dwell lengths from #MD_MIN_BLOCK_DWELL_LENGTH to
+ *   #MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH.
  *   0 corresponds to a null entry in Dwell Table.
  *
  * \param[in] FieldLength  Length of field, in bytes, to be copied for dwell.
@@ -135,6 +159,67 @@ bool MD_ValidTableId(uint16 TableId);
  */
 bool MD_ValidFieldLength(uint16 FieldLength);
 
+/**
+ * \brief Compute Dwell Data Size With Replaced Entry
+ *
+ * \par Description
+ *        Computes the number of dwell data bytes a dwell table would
+ *        collect if the length of one entry were replaced.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        As in #MD_UpdateDwellControlInfo, the active portion of the table
+ *        ends at the first entry with a zero length.  Used to keep jam
+ *        commands from overrunning the dwell packet.
+ *
+ * \param[in] TableIndex  identifies dwell control structure (0..#MD_INTERFACE_NUM_DWELL_TABLES-1)
+ * \param[in] EntryIndex  identifies entry being replaced (0..capacity of the table - 1)
+ * \param[in] NewLength   Length, in bytes, of the replacement entry.
+ *
+ * \return Number of dwell data bytes
+ */
+uint32 MD_DwellDataSizeWithEntry(uint16 TableIndex, uint16 EntryIndex, uint16 NewLength);
+
+/**
+ * \brief Compute Dwell Data Size With Jammed Entries
+ *
+ * \par Description
+ *        Computes the number of dwell data bytes a dwell table would
+ *        collect once each of the jam entries replaced the length of the
+ *        entry it names.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Entry Ids have already been checked.  When more than one jam entry
+ *        names the same table entry, the last one applies, as it does when
+ *        the entries are jammed.
+ *
+ * \param[in] TableIndex  identifies dwell control structure (0..#MD_INTERFACE_NUM_DWELL_TABLES-1)
+ * \param[in] JamEntry    Jam entries, each with an Entry Id of 1..capacity of the table
+ * \param[in] NumEntries  Number of jam entries
+ *
+ * \return Number of dwell data bytes
+ */
+uint32 MD_DwellDataSizeWithJam(uint16 TableIndex, const MD_JamMultiEntry_t *JamEntry, uint16 NumEntries);
+
+/**
+ * \brief Validate Batch Factor
+ *
+ * \par Description
+ *        Checks that a dwell table collecting the given number of dwell data
+ *        bytes per cycle can batch the given number of cycles into one
+ *        batched dwell packet.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        Batch factors of 0 and 1 turn batching off and are always valid.
+ *
+ * \param[in] BatchFactor Number of cycles per batched dwell packet.
+ * \param[in] DataSize    Number of dwell data bytes collected per cycle.
+ *
+ * \return Boolean batch factor valid result
+ * \retval true  Batch factor valid
+ * \retval false Batch factor not valid
+ */
+bool MD_ValidBatchFactor(uint16 BatchFactor, uint32 DataSize);
+
 /**
  * \brief Verify 32 bit alignment
  *
@@ -188,7 +273,8 @@ bool MD_Verify16Aligned(cpuaddr Address, uint32 Size);
  *
  *  \par Assumptions, External Events, and Notes:
  *       If the symbol name is a NUL (empty) string, then the offset
- *       becomes the absolute address
+ *       becomes the absolute address.  Symbol names are resolved
+ *       through the symbol cache.
  *
  *  \param [in]   SymAddr          A MD_SymAddr_t pointer that holds
  *                                 the symbol name and optional offset
@@ -199,7 +285,7 @@ bool MD_Verify16Aligned(cpuaddr Address, uint32 Size);
  *  \retval true  Symbolic address was resolved
  *  \retval false Symbolic address was not resolved
  *
- *  \sa #OS_SymbolLookup
+ *  \sa #MD_SymCacheLookup
  */
 bool MD_ResolveSymAddr(const MD_SymAddr_t *SymAddr, cpuaddr *ResolvedAddr);
 
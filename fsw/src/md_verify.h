@@ -32,14 +32,24 @@
 
 /*
  * Number of memory dwell tables.
- * Max limitation is restricted by size of telemetry variable (16 bits) used to
- * report dwell stream enable statuses, the size of the mask used for
- * start and stop commands, and the size of variables used in code.
+ * Max limitation is restricted by the size of the Table Id field (8 bits)
+ * in dwell packets.
  */
 #if MD_INTERFACE_NUM_DWELL_TABLES < 1
 #error MD_INTERFACE_NUM_DWELL_TABLES must be at least one.
-#elif MD_INTERFACE_NUM_DWELL_TABLES > 16
-#error MD_INTERFACE_NUM_DWELL_TABLES cannot be greater than 16.
+#elif MD_INTERFACE_NUM_DWELL_TABLES > 255
+#error MD_INTERFACE_NUM_DWELL_TABLES cannot be greater than 255.
+#endif
+
+/*
+ * The housekeeping enabled mask (16 bits) has a bit for each table on a page.
+ */
+#if MD_INTERFACE_HK_TABLES_PER_PAGE < 1
+#error MD_INTERFACE_HK_TABLES_PER_PAGE must be at least one.
+#elif MD_INTERFACE_HK_TABLES_PER_PAGE > 16
+#error MD_INTERFACE_HK_TABLES_PER_PAGE cannot be greater than 16.
+#elif MD_INTERFACE_HK_TABLES_PER_PAGE > MD_INTERFACE_NUM_DWELL_TABLES
+#error MD_INTERFACE_HK_TABLES_PER_PAGE cannot be greater than MD_INTERFACE_NUM_DWELL_TABLES.
 #endif
 
 /*
@@ -52,7 +62,130 @@
 #error MD_INTERFACE_DWELL_TABLE_SIZE cannot be greater than 65535.
 #endif
 
-#if (MD_INTERFACE_ENFORCE_DWORD_ALIGN != 0) && (MD_INTERFACE_ENFORCE_DWORD_ALIGN != 1)
+/*
+ * Every dwell table needs at least one entry from the pool.
+ */
+#if MD_INTERNAL_DWELL_ENTRY_POOL_SIZE < MD_INTERFACE_NUM_DWELL_TABLES
+#error MD_INTERNAL_DWELL_ENTRY_POOL_SIZE must be at least MD_INTERFACE_NUM_DWELL_TABLES.
+#endif
+
+/*
+ * A Jam Multiple Dwell command can't name more entries than a table has.
+ */
+#if MD_INTERFACE_MAX_JAM_ENTRIES < 1
+#error MD_INTERFACE_MAX_JAM_ENTRIES must be at least one.
+#elif MD_INTERFACE_MAX_JAM_ENTRIES > MD_INTERFACE_DWELL_TABLE_SIZE
+#error MD_INTERFACE_MAX_JAM_ENTRIES cannot be greater than MD_INTERFACE_DWELL_TABLE_SIZE.
+#endif
+
+/*
+ * Dwell packet data size is reported in 16 bit telemetry fields and
+ * must have room for at least one 4-byte dwell.
+ */
+#if MD_INTERFACE_DWELL_PKT_DATA_SIZE < 4
+#error MD_INTERFACE_DWELL_PKT_DATA_SIZE must be at least 4.
+#elif MD_INTERFACE_DWELL_PKT_DATA_SIZE > 65535
+#error MD_INTERFACE_DWELL_PKT_DATA_SIZE cannot be greater than 65535.
+#endif
+
+/*
+ * A block dwell entry has to fit in the dwell packet on its own.
+ */
+#if MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH > MD_INTERFACE_DWELL_PKT_DATA_SIZE
+#error MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH cannot be greater than MD_INTERFACE_DWELL_PKT_DATA_SIZE.
+#endif
+
+/*
+ * A batched dwell packet must hold at least one full cycle and its time offset.
+ */
+#if MD_INTERFACE_DWELL_BATCH_DATA_SIZE < (MD_INTERFACE_DWELL_PKT_DATA_SIZE + 2)
+#error MD_INTERFACE_DWELL_BATCH_DATA_SIZE must be at least MD_INTERFACE_DWELL_PKT_DATA_SIZE + 2.
+#elif MD_INTERFACE_DWELL_BATCH_DATA_SIZE > 65535
+#error MD_INTERFACE_DWELL_BATCH_DATA_SIZE cannot be greater than 65535.
+#endif
+
+/*
+ * An encoded dwell packet must hold a full cycle that doesn't compress at all.
+ */
+#if MD_INTERFACE_DWELL_ENC_DATA_SIZE < (MD_INTERFACE_DWELL_PKT_DATA_SIZE + ((MD_INTERFACE_DWELL_PKT_DATA_SIZE + 127) / 128))
+#error MD_INTERFACE_DWELL_ENC_DATA_SIZE must be at least MD_INTERFACE_DWELL_PKT_DATA_SIZE + (MD_INTERFACE_DWELL_PKT_DATA_SIZE + 127) / 128.
+#elif MD_INTERFACE_DWELL_ENC_DATA_SIZE > 65535
+#error MD_INTERFACE_DWELL_ENC_DATA_SIZE cannot be greater than 65535.
+#endif
+
+/*
+ * The capture buffer must hold at least one cycle of the largest dwell table
+ * and its wakeup count.
+ */
+#if MD_INTERNAL_CAPTURE_BUFFER_SIZE < (MD_INTERFACE_DWELL_PKT_DATA_SIZE + 4)
+#error MD_INTERNAL_CAPTURE_BUFFER_SIZE must be at least MD_INTERFACE_DWELL_PKT_DATA_SIZE + 4.
+#endif
+
+#if (MD_INTERNAL_SAMPLER_CHILD_TASK != 0) && (MD_INTERNAL_SAMPLER_CHILD_TASK != 1)
+#error MD_INTERNAL_SAMPLER_CHILD_TASK must be 0 or 1.
+#endif
+
+/*
+ * Sampler queue slots are found from free-running counters, which only stay
+ * in order across the counter wrapping when the depth is a power of two.
+ */
+#if (MD_INTERNAL_SAMPLER_QUEUE_DEPTH < 1) || ((MD_INTERNAL_SAMPLER_QUEUE_DEPTH & (MD_INTERNAL_SAMPLER_QUEUE_DEPTH - 1)) != 0)
+#error MD_INTERNAL_SAMPLER_QUEUE_DEPTH must be a power of two.
+#endif
+
+#if MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP < 1
+#error MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP must be at least 1.
+#endif
+
+/*
+ * A gap in the wakeup messages can only be measured within the 14 bit
+ * sequence count.
+ */
+#if MD_INTERNAL_MAX_CATCHUP_WAKEUPS > 16383
+#error MD_INTERNAL_MAX_CATCHUP_WAKEUPS cannot be greater than 16383.
+#endif
+
+/*
+ * Symbol cache slots are found by masking the name's hash.
+ */
+#if (MD_INTERNAL_SYM_CACHE_SIZE < 1) || ((MD_INTERNAL_SYM_CACHE_SIZE & (MD_INTERNAL_SYM_CACHE_SIZE - 1)) != 0)
+#error MD_INTERNAL_SYM_CACHE_SIZE must be a power of two.
+#endif
+
+/*
+ * Snapshot groups are numbered in the 16 bit SnapshotGroup field of a dwell
+ * table entry, with 0 meaning no group.
+ */
+#if MD_INTERNAL_NUM_SNAPSHOT_GROUPS < 1
+#error MD_INTERNAL_NUM_SNAPSHOT_GROUPS must be at least 1.
+#elif MD_INTERNAL_NUM_SNAPSHOT_GROUPS > 65535
+#error MD_INTERNAL_NUM_SNAPSHOT_GROUPS cannot be greater than 65535.
+#endif
+
+#if MD_INTERNAL_SNAPSHOT_MAX_MEMBERS < 1
+#error MD_INTERNAL_SNAPSHOT_MAX_MEMBERS must be at least 1.
+#elif MD_INTERNAL_SNAPSHOT_MAX_MEMBERS > 65535
+#error MD_INTERNAL_SNAPSHOT_MAX_MEMBERS cannot be greater than 65535.
+#endif
+
+#if MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL < 1
+#error MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL must be at least 1.
+#endif
+
+#if (MD_INTERNAL_CACHE_LINE_SIZE < 1) || ((MD_INTERNAL_CACHE_LINE_SIZE & (MD_INTERNAL_CACHE_LINE_SIZE - 1)) != 0)
+#error MD_INTERNAL_CACHE_LINE_SIZE must be a power of two.
+#endif
+
+/*
+ * A 32 bit time in microseconds has at most 32 significant bits.
+ */
+#if MD_INTERFACE_PERF_HIST_BINS < 2
+#error MD_INTERFACE_PERF_HIST_BINS must be at least 2.
+#elif MD_INTERFACE_PERF_HIST_BINS > 33
+#error MD_INTERFACE_PERF_HIST_BINS cannot be greater than 33.
+#endif
+
+#if (MD_INTERFACE_ENFORCE_DWORD_ALIGN != 0) &&(MD_INTERFACE_ENFORCE_DWORD_ALIGN != 1)
 #error MD_INTERFACE_ENFORCE_DWORD_ALIGN must be 0 or 1.
 #endif
 
@@ -21,8 +21,11 @@
  */
 
 #include "md_app.h"
+#include "md_sampler.h"
+#include "md_symcache.h"
 #include "md_dwell_tbl.h"
 #include "md_dwell_pkt.h"
+#include "md_capture.h"
 #include "md_msg.h"
 #include "md_msgdefs.h"
 #include "md_dispatch.h"
@@ -42,6 +45,7 @@
 /* md_app_tests globals */
 uint8               call_count_CFE_EVS_SendEvent;
 MD_DwellTableLoad_t MD_DWELL_TBL_TEST_GlobalLoadTable;
+uint16              MD_APP_TEST_CompileTblIndex;
 
 CFE_Status_t MD_DWELL_TBL_TEST_CFE_TBL_GetAddressHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
                                                       const UT_StubContext_t *Context)
@@ -53,6 +57,15 @@ CFE_Status_t MD_DWELL_TBL_TEST_CFE_TBL_GetAddressHook(void *UserObj, int32 StubR
     return CFE_SUCCESS;
 }
 
+CFE_Status_t MD_APP_TEST_CFE_TBL_ValidateHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                              const UT_StubContext_t *Context)
+{
+    /* Record the table the validation would compile */
+    MD_APP_TEST_CompileTblIndex = MD_AppData.CompileTblIndex;
+
+    return StubRetcode;
+}
+
 void MD_AppMain_Test_AppInitError(void)
 {
     /* Set to make MD_AppInit return -1, in order to generate log message "Application Init Failed" */
@@ -115,6 +128,12 @@ void MD_AppMain_Test_RcvMsgTimeout(void)
     /* Verify results */
     UtAssert_True(MD_AppData.RunStatus == CFE_ES_RunStatus_APP_RUN, "MD_AppData.RunStatus == CFE_ES_RunStatus_APP_RUN");
 
+    /* Every table is looked over at startup and again on the timeout */
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, 2 * MD_INTERFACE_NUM_DWELL_TABLES);
+
+    /* A completed capture is written while idle */
+    UtAssert_STUB_COUNT(MD_WriteCompletedCapture, 1);
+
     /* Generates 1 event messages we don't care about in this test */
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -122,6 +141,31 @@ void MD_AppMain_Test_RcvMsgTimeout(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_AppMain_Test_RcvMsgTimeoutLostNotification(void)
+{
+    /* Set to prevent unintended error messages */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Set to make loop execute exactly once, timing out */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_TIME_OUT);
+
+    /* Set so the last table is waiting for validation by the time the loop times out, with no notification */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 2 * MD_INTERFACE_NUM_DWELL_TABLES,
+                          CFE_TBL_INFO_VALIDATION_PENDING);
+
+    UT_SetHookFunction(UT_KEY(CFE_TBL_Validate), &MD_APP_TEST_CFE_TBL_ValidateHook, NULL);
+
+    /* Execute the function being tested */
+    MD_AppMain();
+
+    /* Verify results, the table is validated anyway */
+    UtAssert_STUB_COUNT(CFE_TBL_Validate, 1);
+    UtAssert_INT32_EQ(MD_APP_TEST_CompileTblIndex, MD_INTERFACE_NUM_DWELL_TABLES - 1);
+    UtAssert_INT32_EQ(MD_AppData.CompileTblIndex, MD_INTERFACE_NUM_DWELL_TABLES);
+    UtAssert_UINT32_EQ(MD_AppData.RunStatus, CFE_ES_RunStatus_APP_RUN);
+}
+
 void MD_AppMain_Test_RcvMsgNullBuffer(void)
 {
     /* Set to prevent unintended error messages */
@@ -137,6 +181,13 @@ void MD_AppMain_Test_RcvMsgNullBuffer(void)
     MD_AppMain();
 
     /* Verify results */
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+    UtAssert_STUB_COUNT(MD_QueueSamplerMsg, 1);
+#endif
+
+    /* A completed capture is written after each message */
+    UtAssert_STUB_COUNT(MD_WriteCompletedCapture, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     /* Generates 2 event messages we don't care about in this test */
@@ -144,6 +195,42 @@ void MD_AppMain_Test_RcvMsgNullBuffer(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+void MD_AppMain_Test_RcvTblManageMsg(void)
+{
+    /* Set to prevent unintended error messages */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Set to make loop execute exactly once */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
+
+    /* Set to make the message one the main task executes */
+    UT_SetDefaultReturnValue(UT_KEY(MD_IsMainTaskMsg), true);
+
+    /* Execute the function being tested */
+    MD_AppMain();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_ProcessCommandPacket, 1);
+    UtAssert_STUB_COUNT(MD_QueueSamplerMsg, 0);
+}
+#endif
+
+void MD_AppMain_Test_ManageTablesAtStartup(void)
+{
+    /* Set to prevent unintended error messages */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    MD_AppMain();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, MD_INTERFACE_NUM_DWELL_TABLES);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 0);
+}
+
 void MD_AppInit_Test_Nominal(void)
 {
     CFE_Status_t Result;
@@ -176,6 +263,12 @@ void MD_AppInit_Test_Nominal(void)
 
     UtAssert_INT32_EQ(MD_AppData.CmdCounter, 0);
     UtAssert_INT32_EQ(MD_AppData.ErrCounter, 0);
+
+    UtAssert_STUB_COUNT(MD_InitSymCache, 1);
+
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+    UtAssert_STUB_COUNT(MD_InitSampler, 1);
+#endif
 }
 
 void MD_AppInit_Test_EvsRegisterNotSuccess(void)
@@ -226,6 +319,22 @@ void MD_AppInit_Test_InitSoftwareBusServicesNotSuccess(void)
     /* Generates 1 system log message we don't care about in this test */
 }
 
+void MD_AppInit_Test_InitSymCacheNotSuccess(void)
+{
+    CFE_Status_t Result;
+
+    /* Set to make MD_InitSymCache return -1 */
+    UT_SetDefaultReturnValue(UT_KEY(MD_InitSymCache), -1);
+
+    /* Execute the function being tested */
+    Result = MD_AppInit();
+
+    /* Verify results */
+    UtAssert_True(Result == -1, "Result == -1");
+
+    UtAssert_STUB_COUNT(CFE_TBL_Register, 0);
+}
+
 void MD_AppInit_Test_InitTableServicesNotSuccess(void)
 {
     CFE_Status_t Result;
@@ -246,6 +355,28 @@ void MD_AppInit_Test_InitTableServicesNotSuccess(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+void MD_AppInit_Test_InitSamplerNotSuccess(void)
+{
+    CFE_Status_t Result;
+
+    /* Set to make MD_InitSampler return -1 */
+    UT_SetDefaultReturnValue(UT_KEY(MD_InitSampler), -1);
+
+    /* Execute the function being tested */
+    Result = MD_AppInit();
+
+    /* Verify results */
+    UtAssert_True(Result == -1, "Result == -1");
+
+    /* Generates 1 event message we don't care about in this test */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+#endif
+
 void MD_InitControlStructures_Test(void)
 {
     /* Execute the function being tested */
@@ -259,7 +390,7 @@ void MD_InitControlStructures_Test(void)
     UtAssert_True(MD_AppData.MD_DwellTables[0].PktOffset == 0, "MD_AppData.MD_DwellTables[0].PktOffset == 0");
     UtAssert_True(MD_AppData.MD_DwellTables[0].CurrentEntry == 0, "MD_AppData.MD_DwellTables[0].CurrentEntry == 0");
     UtAssert_True(MD_AppData.MD_DwellTables[0].DataSize == 0, "MD_AppData.MD_DwellTables[0].DataSize == 0");
-    UtAssert_True(MD_AppData.MD_DwellTables[0].Filler == 0, "MD_AppData.MD_DwellTables[0].Filler == 0");
+    UtAssert_True(MD_AppData.MD_DwellTables[0].BatchFactor == 0, "MD_AppData.MD_DwellTables[0].BatchFactor == 0");
 
     UtAssert_True(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].Enabled == 0,
                   "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].Enabled == 0");
@@ -275,8 +406,8 @@ void MD_InitControlStructures_Test(void)
                   "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].CurrentEntry == 0");
     UtAssert_True(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].DataSize == 0,
                   "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].DataSize == 0");
-    UtAssert_True(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].Filler == 0,
-                  "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].Filler == 0");
+    UtAssert_True(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].BatchFactor == 0,
+                  "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].BatchFactor == 0");
 
     UtAssert_True(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].Enabled == 0,
                   "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].Enabled == 0");
@@ -292,8 +423,8 @@ void MD_InitControlStructures_Test(void)
                   "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].CurrentEntry == 0");
     UtAssert_True(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].DataSize == 0,
                   "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].DataSize == 0");
-    UtAssert_True(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].Filler == 0,
-                  "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].Filler == 0");
+    UtAssert_True(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].BatchFactor == 0,
+                  "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].BatchFactor == 0");
 
     UtAssert_True(MD_AppData.MD_DwellTables[0].Entry[0].Length == 0,
                   "MD_AppData.MD_DwellTables[0].Entry[0].Length == 0");
@@ -315,17 +446,52 @@ void MD_InitControlStructures_Test(void)
     UtAssert_True(MD_AppData.MD_DwellTables[0].Entry[MD_INTERFACE_DWELL_TABLE_SIZE - 1].ResolvedAddress == 0,
                   "MD_AppData.MD_DwellTables[0].Entry[MD_INTERFACE_DWELL_TABLE_SIZE - 1].ResolvedAddress == 0");
 
+    /* State read on every wakeup starts on cache lines of its own */
+    UtAssert_UINT32_EQ((cpuaddr)&MD_AppData.DwellSchedule % MD_INTERNAL_CACHE_LINE_SIZE, 0);
+    UtAssert_UINT32_EQ((cpuaddr)MD_AppData.MD_DwellTables % MD_INTERNAL_CACHE_LINE_SIZE, 0);
+    UtAssert_UINT32_EQ((cpuaddr)MD_AppData.DwellEntryPool % MD_INTERNAL_CACHE_LINE_SIZE, 0);
+
+    /* Tables take their entries from the pools in table order */
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[1].Capacity, MD_INTERNAL_DWELL_TABLE_CAPACITY(1));
+    UtAssert_ADDRESS_EQ(MD_AppData.MD_DwellTables[1].Entry,
+                        &MD_AppData.DwellEntryPool[MD_INTERNAL_DWELL_TABLE_CAPACITY(0)]);
+    UtAssert_ADDRESS_EQ(MD_AppData.DwellReportControl[1].Deadband,
+                        &MD_AppData.DwellDeadbandPool[MD_INTERNAL_DWELL_TABLE_CAPACITY(0)]);
+    UtAssert_ADDRESS_EQ(MD_AppData.DwellReportControl[1].Group,
+                        &MD_AppData.DwellGroupPool[MD_INTERNAL_DWELL_TABLE_CAPACITY(0)]);
+    UtAssert_ADDRESS_EQ(MD_AppData.DwellReportControl[1].Signed,
+                        &MD_AppData.DwellSignedPool[MD_INTERNAL_DWELL_TABLE_CAPACITY(0)]);
+    UtAssert_ADDRESS_EQ(MD_AppData.DwellReportControl[1].Stats,
+                        &MD_AppData.DwellStatsPool[MD_INTERNAL_DWELL_TABLE_CAPACITY(0)]);
+    UtAssert_ADDRESS_EQ(MD_AppData.DwellReportControl[1].ReadErr,
+                        &MD_AppData.DwellReadErrPool[MD_INTERNAL_DWELL_TABLE_CAPACITY(0)]);
+    UtAssert_UINT32_EQ(MD_AppData.CompiledTables[1].Capacity, MD_INTERNAL_DWELL_TABLE_CAPACITY(1));
+    UtAssert_ADDRESS_EQ(MD_AppData.CompiledTables[1].Entry,
+                        &MD_AppData.CompiledEntryPool[MD_INTERNAL_DWELL_TABLE_CAPACITY(0)]);
+    UtAssert_ADDRESS_EQ(MD_AppData.CompiledTables[1].Deadband,
+                        &MD_AppData.CompiledDeadbandPool[MD_INTERNAL_DWELL_TABLE_CAPACITY(0)]);
+    UtAssert_ADDRESS_EQ(MD_AppData.CompiledTables[1].Group,
+                        &MD_AppData.CompiledGroupPool[MD_INTERNAL_DWELL_TABLE_CAPACITY(0)]);
+    UtAssert_ADDRESS_EQ(MD_AppData.CompiledTables[1].Signed,
+                        &MD_AppData.CompiledSignedPool[MD_INTERNAL_DWELL_TABLE_CAPACITY(0)]);
+    UtAssert_ADDRESS_EQ(MD_AppData.CompiledTables[1].Image,
+                        &MD_AppData.CompiledImagePool[MD_INTERNAL_DWELL_TABLE_CAPACITY(0)]);
+    UtAssert_INT32_EQ(MD_AppData.CompileTblIndex, MD_INTERFACE_NUM_DWELL_TABLES);
+
+    /* The first read error summary is a full interval away */
+    UtAssert_UINT32_EQ(MD_AppData.ReadErrSummary.Countdown, MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL);
+
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
-    UtAssert_True(strncmp(MD_AppData.MD_DwellTables[0].Signature, "", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
-                  "strncmp(MD_AppData.MD_DwellTables[0].Signature, "
+    UtAssert_True(strncmp(MD_AppData.DwellReportControl[0].Signature, "", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
+                  "strncmp(MD_AppData.DwellReportControl[0].Signature, "
                   ", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0");
     UtAssert_True(
-        strncmp(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].Signature, "", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
-        "strncmp(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].Signature, "
+        strncmp(MD_AppData.DwellReportControl[MD_INTERFACE_NUM_DWELL_TABLES / 2].Signature, "", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
+        "strncmp(MD_AppData.DwellReportControl[MD_INTERFACE_NUM_DWELL_TABLES / 2].Signature, "
         ", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0");
     UtAssert_True(
-        strncmp(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].Signature, "", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
-        "strncmp(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].Signature, "
+        strncmp(MD_AppData.DwellReportControl[MD_INTERFACE_NUM_DWELL_TABLES - 1].Signature, "", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
+        "strncmp(MD_AppData.DwellReportControl[MD_INTERFACE_NUM_DWELL_TABLES - 1].Signature, "
         ", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0");
 #endif
 
@@ -477,6 +643,7 @@ void MD_InitSoftwareBusServices_Test_SubscribeCmdError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 0
 void MD_InitSoftwareBusServices_Test_SubscribeWakeupError(void)
 {
     CFE_Status_t Result;
@@ -507,6 +674,7 @@ void MD_InitSoftwareBusServices_Test_SubscribeWakeupError(void)
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 }
+#endif
 
 void MD_InitTableServices_Test_GetAddressErrorAndLoadError(void)
 {
@@ -820,6 +988,33 @@ void MD_InitTableServices_Test_TblTooLarge(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_InitTableServices_Test_TblCapacityCriticalError(void)
+{
+    CFE_Status_t Result;
+
+    /* MD_InitControlStructures couldn't give the second table any entries */
+    MD_AppData.MD_DwellTables[1].Capacity = 0;
+
+    /* Set to reach line "TblInits++" */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    Result = MD_InitTableServices();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, MD_ERROR);
+
+    UtAssert_STUB_COUNT(CFE_TBL_Register, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_DWELL_TBL_CAPACITY_CRIT_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_CRITICAL);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MD_TBL_INIT_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
 void MD_InitTableServices_Test_TblRegisterCriticalError(void)
 {
     CFE_Status_t Result;
@@ -849,6 +1044,31 @@ void MD_InitTableServices_Test_TblRegisterCriticalError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_InitTableServices_Test_TblNotifyCriticalError(void)
+{
+    CFE_Status_t Result;
+
+    /* Set to satisfy condition "Status != CFE_SUCCESS" */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_NotifyByMessage), 1, -1);
+
+    /* Execute the function being tested */
+    Result = MD_InitTableServices();
+
+    /* Verify results */
+    UtAssert_True(Result == -1, "Result == -1");
+
+    UtAssert_STUB_COUNT(CFE_TBL_NotifyByMessage, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_TBL_NOTIFY_CRIT_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_CRITICAL);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MD_TBL_INIT_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
 void MD_InitTableServices_Test_TblNameError(void)
 {
     /* Set to generate snprintf error MD_INIT_TBL_NAME_ERR_EID */
@@ -888,7 +1108,7 @@ void MD_InitTableServices_Test_TblFileNameError(void)
 void MD_ManageDwellTable_Test_ValidationPendingSucceedThenFail(void)
 {
     CFE_Status_t Result;
-    uint8        TblIndex = 0;
+    uint16       TblIndex = MD_INTERFACE_NUM_DWELL_TABLES - 1;
 
     /* Set to satisfy condition "Status == CFE_TBL_INFO_VALIDATION_PENDING" */
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_VALIDATION_PENDING);
@@ -896,11 +1116,164 @@ void MD_ManageDwellTable_Test_ValidationPendingSucceedThenFail(void)
     /* Set to satisfy condition "Status != CFE_SUCCESS" on the 2nd loop */
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Validate), 2, -1);
 
+    UT_SetHookFunction(UT_KEY(CFE_TBL_Validate), &MD_APP_TEST_CFE_TBL_ValidateHook, NULL);
+
+    /* Execute the function being tested */
+    Result = MD_ManageDwellTable(TblIndex);
+
+    /* Verify results */
+    UtAssert_True(Result == -1, "Result == -1");
+
+    /* The validation compiles the table being managed, and no table after it */
+    UtAssert_INT32_EQ(MD_APP_TEST_CompileTblIndex, TblIndex);
+    UtAssert_INT32_EQ(MD_AppData.CompileTblIndex, MD_INTERFACE_NUM_DWELL_TABLES);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ManageDwellTable_Test_UpdatePending(void)
+{
+    CFE_Status_t Result;
+    uint16       TblIndex = 0;
+
+    /* Set to satisfy condition "Status == CFE_TBL_INFO_UPDATE_PENDING" */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_TBL_INFO_UPDATE_PENDING);
+
+    /* Set so an update made here returns without copying the table */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Update), 1, -1);
+
     /* Execute the function being tested */
     Result = MD_ManageDwellTable(TblIndex);
 
     /* Verify results */
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+    /* The sampler child task makes the update */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_STUB_COUNT(MD_QueueTableUpdate, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Update, 0);
+    UtAssert_BOOL_FALSE(MD_AppData.SamplerQueue.UpdateOwed[TblIndex]);
+#else
     UtAssert_True(Result == -1, "Result == -1");
+    UtAssert_STUB_COUNT(CFE_TBL_Update, 1);
+#endif
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+void MD_ManageDwellTable_Test_UpdateQueueFull(void)
+{
+    CFE_Status_t Result;
+    uint16       TblIndex = 1;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_TBL_INFO_UPDATE_PENDING);
+
+    /* Set so the sampler queue has no room for the update */
+    UT_SetDefaultReturnValue(UT_KEY(MD_QueueTableUpdate), MD_QUEUE_FULL_ERROR);
+
+    /* Execute the function being tested */
+    Result = MD_ManageDwellTable(TblIndex);
+
+    /* Verify results, the update is owed until the queue has room */
+    UtAssert_INT32_EQ(Result, MD_QUEUE_FULL_ERROR);
+    UtAssert_BOOL_TRUE(MD_AppData.SamplerQueue.UpdateOwed[TblIndex]);
+
+    /* Managing the table again once the queue has room pays the update */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_TBL_INFO_UPDATE_PENDING);
+    UT_SetDefaultReturnValue(UT_KEY(MD_QueueTableUpdate), CFE_SUCCESS);
+
+    Result = MD_ManageDwellTable(TblIndex);
+
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_BOOL_FALSE(MD_AppData.SamplerQueue.UpdateOwed[TblIndex]);
+    UtAssert_STUB_COUNT(MD_QueueTableUpdate, 2);
+}
+
+void MD_RetryTableUpdates_Test(void)
+{
+    MD_AppData.SamplerQueue.UpdateOwed[1] = true;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_TBL_INFO_UPDATE_PENDING);
+
+    /* Execute the function being tested */
+    MD_RetryTableUpdates();
+
+    /* Verify results, only the table that is owed an update is managed */
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, 1);
+    UtAssert_STUB_COUNT(MD_QueueTableUpdate, 1);
+    UtAssert_BOOL_FALSE(MD_AppData.SamplerQueue.UpdateOwed[1]);
+
+    /* Nothing left to retry */
+    MD_RetryTableUpdates();
+
+    UtAssert_STUB_COUNT(CFE_TBL_GetStatus, 1);
+}
+
+void MD_AppMain_Test_RetryTableUpdates(void)
+{
+    /* Set to prevent unintended error messages */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Set to make loop execute exactly once, receiving a message */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
+
+    /* Set so the first table's update finds the sampler queue full at startup */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetStatus), CFE_TBL_INFO_UPDATE_PENDING);
+    UT_SetDeferredRetcode(UT_KEY(MD_QueueTableUpdate), 1, MD_QUEUE_FULL_ERROR);
+
+    /* Execute the function being tested */
+    MD_AppMain();
+
+    /* Verify results, the first table's update is queued after the message */
+    UtAssert_STUB_COUNT(MD_QueueSamplerMsg, 1);
+    UtAssert_STUB_COUNT(MD_QueueTableUpdate, MD_INTERFACE_NUM_DWELL_TABLES + 1);
+    UtAssert_BOOL_FALSE(MD_AppData.SamplerQueue.UpdateOwed[0]);
+}
+#endif
+
+void MD_ManageDwellTable_Test_TblStatusErr(void)
+{
+    CFE_Status_t Result;
+    uint16       TblIndex = 0;
+
+    /* Set to satisfy condition "(Status & CFE_SEVERITY_BITMASK) == CFE_SEVERITY_ERROR" */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_SEVERITY_BITMASK);
+
+    /* Execute the function being tested */
+    Result = MD_ManageDwellTable(TblIndex);
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SEVERITY_BITMASK, "Result == CFE_SEVERITY_BITMASK");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_TBL_STATUS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ManageDwellTable_Test_OtherStatus(void)
+{
+    CFE_Status_t Result;
+    uint16       TblIndex = 0;
+
+    /* Set to reach final else-case */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, 99);
+
+    /* Execute the function being tested */
+    Result = MD_ManageDwellTable(TblIndex);
+
+    /* Verify results */
+    UtAssert_True(Result == 99, "Result == 99");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -908,15 +1281,13 @@ void MD_ManageDwellTable_Test_ValidationPendingSucceedThenFail(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void MD_ManageDwellTable_Test_UpdatePendingDwellStreamEnabled(void)
+void MD_UpdateDwellTable_Test_DwellStreamEnabled(void)
 {
     CFE_Status_t         Result;
-    uint8                TblIndex = 0;
+    uint16               TblIndex = 0;
     MD_DwellTableLoad_t  LoadTbl;
     MD_DwellTableLoad_t *LoadTblPtr = &LoadTbl;
 
-    /* Set to satisfy condition "Status == CFE_TBL_INFO_UPDATE_PENDING" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_TBL_INFO_UPDATE_PENDING);
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), CFE_SUCCESS);
 
@@ -927,7 +1298,7 @@ void MD_ManageDwellTable_Test_UpdatePendingDwellStreamEnabled(void)
     UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &LoadTblPtr, sizeof(LoadTblPtr), false);
 
     /* Execute the function being tested */
-    Result = MD_ManageDwellTable(TblIndex);
+    Result = MD_UpdateDwellTable(TblIndex);
 
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
@@ -941,15 +1312,13 @@ void MD_ManageDwellTable_Test_UpdatePendingDwellStreamEnabled(void)
     UtAssert_INT32_EQ(call_count_MD_StartDwellStream, 1);
 }
 
-void MD_ManageDwellTable_Test_UpdatePendingDwellStreamDisabled(void)
+void MD_UpdateDwellTable_Test_DwellStreamDisabled(void)
 {
     CFE_Status_t         Result;
-    uint8                TblIndex = 0;
+    uint16               TblIndex = 0;
     MD_DwellTableLoad_t  LoadTbl;
     MD_DwellTableLoad_t *LoadTblPtr = &LoadTbl;
 
-    /* Set to satisfy condition "Status == CFE_TBL_INFO_UPDATE_PENDING" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_TBL_INFO_UPDATE_PENDING);
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), CFE_SUCCESS);
 
@@ -962,7 +1331,7 @@ void MD_ManageDwellTable_Test_UpdatePendingDwellStreamDisabled(void)
     UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &LoadTblPtr, sizeof(LoadTblPtr), false);
 
     /* Execute the function being tested */
-    Result = MD_ManageDwellTable(TblIndex);
+    Result = MD_UpdateDwellTable(TblIndex);
 
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
@@ -976,13 +1345,10 @@ void MD_ManageDwellTable_Test_UpdatePendingDwellStreamDisabled(void)
     UtAssert_INT32_EQ(call_count_MD_StartDwellStream, 0);
 }
 
-void MD_ManageDwellTable_Test_TblNotUpdated(void)
+void MD_UpdateDwellTable_Test_TblNotUpdated(void)
 {
     CFE_Status_t Result;
-    uint8        TblIndex = 0;
-
-    /* Set to satisfy condition "Status == CFE_TBL_INFO_UPDATE_PENDING" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_TBL_INFO_UPDATE_PENDING);
+    uint16       TblIndex = 0;
 
     /* Set to satisfy condition "MD_LoadTablePtr->Enabled == MD_Dwell_States_ENABLED" and to prevent a core dump by
      * assigning MD_LoadTablePtr */
@@ -993,7 +1359,7 @@ void MD_ManageDwellTable_Test_TblNotUpdated(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Update), 1, -1);
 
     /* Execute the function being tested */
-    Result = MD_ManageDwellTable(TblIndex);
+    Result = MD_UpdateDwellTable(TblIndex);
 
     /* Verify results */
     UtAssert_True(Result == -1, "Result == -1");
@@ -1004,19 +1370,16 @@ void MD_ManageDwellTable_Test_TblNotUpdated(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void MD_ManageDwellTable_Test_UpdatePendingTblCopyError(void)
+void MD_UpdateDwellTable_Test_TblCopyError(void)
 {
     CFE_Status_t Result;
-    uint8        TblIndex = 0;
-
-    /* Set to satisfy condition "Status == CFE_TBL_INFO_UPDATE_PENDING" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_TBL_INFO_UPDATE_PENDING);
+    uint16       TblIndex = 0;
 
     /* Set to generate error message MD_NO_TBL_COPY_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, -1);
 
     /* Execute the function being tested */
-    Result = MD_ManageDwellTable(TblIndex);
+    Result = MD_UpdateDwellTable(TblIndex);
 
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
@@ -1030,49 +1393,8 @@ void MD_ManageDwellTable_Test_UpdatePendingTblCopyError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void MD_ManageDwellTable_Test_TblStatusErr(void)
-{
-    CFE_Status_t Result;
-    uint8        TblIndex = 0;
-
-    /* Set to satisfy condition "(Status & CFE_SEVERITY_BITMASK) == CFE_SEVERITY_ERROR" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_SEVERITY_BITMASK);
-
-    /* Execute the function being tested */
-    Result = MD_ManageDwellTable(TblIndex);
-
-    /* Verify results */
-    UtAssert_True(Result == CFE_SEVERITY_BITMASK, "Result == CFE_SEVERITY_BITMASK");
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_TBL_STATUS_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
-}
-
-void MD_ManageDwellTable_Test_OtherStatus(void)
-{
-    CFE_Status_t Result;
-    uint8        TblIndex = 0;
-
-    /* Set to reach final else-case */
-    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, 99);
-
-    /* Execute the function being tested */
-    Result = MD_ManageDwellTable(TblIndex);
-
-    /* Verify results */
-    UtAssert_True(Result == 99, "Result == 99");
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
-                  call_count_CFE_EVS_SendEvent);
-}
-
+/* Every table fits on one page */
+#if MD_INTERFACE_HK_TABLES_PER_PAGE == MD_INTERFACE_NUM_DWELL_TABLES
 void MD_HkStatus_Test(void)
 {
     MD_SendHkCmd_t Msg;
@@ -1080,6 +1402,10 @@ void MD_HkStatus_Test(void)
     MD_AppData.CmdCounter = 1;
     MD_AppData.ErrCounter = 2;
 
+    MD_AppData.WakeupCounters.OverrunCount = 3;
+    MD_AppData.WakeupCounters.CatchupCount = 4;
+    MD_AppData.WakeupCounters.RephaseCount = 5;
+
     MD_AppData.MD_DwellTables[0].Enabled = 1;
 
     MD_AppData.MD_DwellTables[0].AddrCount    = 1;
@@ -1110,6 +1436,10 @@ void MD_HkStatus_Test(void)
     UtAssert_True(MD_AppData.HkPkt.Payload.ValidCmdCntr == 1, "MD_AppData.HkPkt.Payload.ValidCmdCntr == 1");
     UtAssert_True(MD_AppData.HkPkt.Payload.InvalidCmdCntr == 2, "MD_AppData.HkPkt.Payload.InvalidCmdCntr == 2");
 
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.WakeupOverrunCount, 3);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.WakeupCatchupCount, 4);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.WakeupRephaseCount, 5);
+
     UtAssert_True(MD_AppData.HkPkt.Payload.DwellTblAddrCount[0] == 1,
                   "MD_AppData.HkPkt.Payload.DwellTblAddrCount[0] == 1");
     UtAssert_True(MD_AppData.HkPkt.Payload.NumWaitsPerPkt[0] == 2,
@@ -1147,12 +1477,88 @@ void MD_HkStatus_Test(void)
                   "MD_AppData.HkPkt.Payload.Countdown[MD_INTERFACE_NUM_DWELL_TABLES - 1]         == 18");
 
     UtAssert_True(MD_AppData.HkPkt.Payload.DwellEnabledMask == 1, "MD_AppData.HkPkt.Payload.DwellEnabledMask == 1");
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.FirstTableId, 1);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.TableCount, MD_INTERFACE_NUM_DWELL_TABLES);
+    UtAssert_UINT32_EQ(MD_AppData.HkPageTblIndex, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
 }
+#endif
+
+void MD_HkStatus_Test_LastPage(void)
+{
+    MD_SendHkCmd_t Msg;
+    uint16         TblIndex = MD_INTERFACE_NUM_DWELL_TABLES - 1;
+    uint16         PageIndex;
+
+    memset(&Msg, 0, sizeof(Msg));
+
+    /* Leave stale values from an earlier page in the packet */
+    memset(&MD_AppData.HkPkt.Payload, 0xFF, sizeof(MD_AppData.HkPkt.Payload));
+
+    MD_AppData.HkPageTblIndex = TblIndex;
+
+    MD_AppData.MD_DwellTables[TblIndex].Enabled      = MD_Dwell_States_ENABLED;
+    MD_AppData.MD_DwellTables[TblIndex].AddrCount    = 1;
+    MD_AppData.MD_DwellTables[TblIndex].Rate         = 2;
+    MD_AppData.MD_DwellTables[TblIndex].PktOffset    = 3;
+    MD_AppData.MD_DwellTables[TblIndex].DataSize     = 4;
+    MD_AppData.MD_DwellTables[TblIndex].CurrentEntry = 5;
+    MD_AppData.MD_DwellTables[TblIndex].Countdown    = 6;
+
+    MD_AppData.MD_DwellTables[TblIndex].FailingEntries         = 3;
+    MD_AppData.DwellReportControl[TblIndex].QuarantinedEntries = 2;
+
+    MD_AppData.DwellCounters[TblIndex].SampleCount        = 7;
+    MD_AppData.DwellCounters[TblIndex].ReadErrCount       = 8;
+    MD_AppData.DwellCounters[TblIndex].PktSentCount       = 9;
+    MD_AppData.DwellCounters[TblIndex].PktSuppressedCount = 10;
+    MD_AppData.DwellCounters[TblIndex].CycleOverrunCount  = 11;
+    MD_AppData.DwellCounters[TblIndex].MaxSampleTime      = 12;
+
+    /* Execute the function being tested */
+    MD_HkStatus(&Msg);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.FirstTableId, MD_INTERFACE_NUM_DWELL_TABLES);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.TableCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.DwellEnabledMask, 1);
+
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.DwellTblAddrCount[0], 1);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.NumWaitsPerPkt[0], 2);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.DwellPktOffset[0], 3);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.ByteCount[0], 4);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.DwellTblEntry[0], 5);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.Countdown[0], 6);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.FailingEntryCount[0], 3);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.QuarantinedCount[0], 2);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.SampleCount[0], 7);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.ReadErrCount[0], 8);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.PktSentCount[0], 9);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.PktSuppressedCount[0], 10);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.CycleOverrunCount[0], 11);
+    UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.MaxSampleTime[0], 12);
+
+    for (PageIndex = 1; PageIndex < MD_INTERFACE_HK_TABLES_PER_PAGE; PageIndex++)
+    {
+        UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.DwellTblAddrCount[PageIndex], 0);
+        UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.NumWaitsPerPkt[PageIndex], 0);
+        UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.DwellPktOffset[PageIndex], 0);
+        UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.ByteCount[PageIndex], 0);
+        UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.DwellTblEntry[PageIndex], 0);
+        UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.Countdown[PageIndex], 0);
+        UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.QuarantinedCount[PageIndex], 0);
+        UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.SampleCount[PageIndex], 0);
+        UtAssert_UINT32_EQ(MD_AppData.HkPkt.Payload.MaxSampleTime[PageIndex], 0);
+    }
+
+    /* The next packet starts again from table 1 */
+    UtAssert_UINT32_EQ(MD_AppData.HkPageTblIndex, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
 
 /*
  * Register the test cases to execute with the unit test tool
@@ -1162,12 +1568,23 @@ void UtTest_Setup(void)
     UtTest_Add(MD_AppMain_Test_AppInitError, MD_Test_Setup, MD_Test_TearDown, "MD_AppMain_Test_AppInitError");
     UtTest_Add(MD_AppMain_Test_RcvMsgError, MD_Test_Setup, MD_Test_TearDown, "MD_AppMain_Test_RcvMsgError");
     UtTest_Add(MD_AppMain_Test_RcvMsgTimeout, MD_Test_Setup, MD_Test_TearDown, "MD_AppMain_Test_RcvMsgTimeout");
+    UtTest_Add(MD_AppMain_Test_RcvMsgTimeoutLostNotification, MD_Test_Setup, MD_Test_TearDown,
+               "MD_AppMain_Test_RcvMsgTimeoutLostNotification");
     UtTest_Add(MD_AppMain_Test_RcvMsgNullBuffer, MD_Test_Setup, MD_Test_TearDown, "MD_AppMain_Test_RcvMsgNullBuffer");
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+    UtTest_Add(MD_AppMain_Test_RcvTblManageMsg, MD_Test_Setup, MD_Test_TearDown, "MD_AppMain_Test_RcvTblManageMsg");
+#endif
+    UtTest_Add(MD_AppMain_Test_ManageTablesAtStartup, MD_Test_Setup, MD_Test_TearDown, "MD_AppMain_Test_ManageTablesAtStartup");
     
     UtTest_Add(MD_AppInit_Test_Nominal, MD_Test_Setup, MD_Test_TearDown, "MD_AppInit_Test_Nominal");
     UtTest_Add(MD_AppInit_Test_EvsRegisterNotSuccess, MD_Test_Setup, MD_Test_TearDown, "MD_AppInit_Test_EvsRegisterNotSuccess");
     UtTest_Add(MD_AppInit_Test_InitSoftwareBusServicesNotSuccess, MD_Test_Setup, MD_Test_TearDown, "MD_AppInit_Test_InitSoftwareBusServicesNotSuccess");
+    UtTest_Add(MD_AppInit_Test_InitSymCacheNotSuccess, MD_Test_Setup, MD_Test_TearDown,
+               "MD_AppInit_Test_InitSymCacheNotSuccess");
     UtTest_Add(MD_AppInit_Test_InitTableServicesNotSuccess, MD_Test_Setup, MD_Test_TearDown, "MD_AppInit_Test_InitTableServicesNotSuccess");
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+    UtTest_Add(MD_AppInit_Test_InitSamplerNotSuccess, MD_Test_Setup, MD_Test_TearDown, "MD_AppInit_Test_InitSamplerNotSuccess");
+#endif
     
     UtTest_Add(MD_InitControlStructures_Test, MD_Test_Setup, MD_Test_TearDown, "MD_InitControlStructures_Test");
     
@@ -1175,7 +1592,9 @@ void UtTest_Setup(void)
     UtTest_Add(MD_InitSoftwareBusServices_Test_CreatePipeError, MD_Test_Setup, MD_Test_TearDown, "MD_InitSoftwareBusServices_Test_CreatePipeError");
     UtTest_Add(MD_InitSoftwareBusServices_Test_SubscribeHkError, MD_Test_Setup, MD_Test_TearDown, "MD_InitSoftwareBusServices_Test_SubscribeHkError");
     UtTest_Add(MD_InitSoftwareBusServices_Test_SubscribeCmdError, MD_Test_Setup, MD_Test_TearDown, "MD_InitSoftwareBusServices_Test_SubscribeCmdError");
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 0
     UtTest_Add(MD_InitSoftwareBusServices_Test_SubscribeWakeupError, MD_Test_Setup, MD_Test_TearDown, "MD_InitSoftwareBusServices_Test_SubscribeWakeupError");
+#endif
     
     UtTest_Add(MD_InitTableServices_Test_GetAddressErrorAndLoadError, MD_Test_Setup, MD_Test_TearDown, "MD_InitTableServices_Test_GetAddressErrorAndLoadError");
     UtTest_Add(MD_InitTableServices_Test_TblRecoveredValidThenTblInits, MD_Test_Setup, MD_Test_TearDown, "MD_InitTableServices_Test_TblRecoveredValidThenTblInits");
@@ -1183,17 +1602,30 @@ void UtTest_Setup(void)
     UtTest_Add(MD_InitTableServices_Test_DwellStreamEnabled, MD_Test_Setup, MD_Test_TearDown, "MD_InitTableServices_Test_DwellStreamEnabled");
     UtTest_Add(MD_InitTableServices_Test_TblNotRecovered, MD_Test_Setup, MD_Test_TearDown, "MD_InitTableServices_Test_TblNotRecovered");
     UtTest_Add(MD_InitTableServices_Test_TblTooLarge, MD_Test_Setup, MD_Test_TearDown, "MD_InitTableServices_Test_TblTooLarge");
+    UtTest_Add(MD_InitTableServices_Test_TblCapacityCriticalError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_InitTableServices_Test_TblCapacityCriticalError");
     UtTest_Add(MD_InitTableServices_Test_TblRegisterCriticalError, MD_Test_Setup, MD_Test_TearDown, "MD_InitTableServices_Test_TblRegisterCriticalError");
+    UtTest_Add(MD_InitTableServices_Test_TblNotifyCriticalError, MD_Test_Setup, MD_Test_TearDown, "MD_InitTableServices_Test_TblNotifyCriticalError");
     UtTest_Add(MD_InitTableServices_Test_TblNameError, MD_Test_Setup, MD_Test_TearDown, "MD_InitTableServices_Test_TblNameError");
     UtTest_Add(MD_InitTableServices_Test_TblFileNameError, MD_Test_Setup, MD_Test_TearDown, "MD_InitTableServices_Test_TblFileNameError");
     
     UtTest_Add(MD_ManageDwellTable_Test_ValidationPendingSucceedThenFail, MD_Test_Setup, MD_Test_TearDown, "MD_ManageDwellTable_Test_ValidationPendingSucceedThenFail");
-    UtTest_Add(MD_ManageDwellTable_Test_UpdatePendingDwellStreamEnabled, MD_Test_Setup, MD_Test_TearDown, "MD_ManageDwellTable_Test_UpdatePendingDwellStreamEnabled");
-    UtTest_Add(MD_ManageDwellTable_Test_UpdatePendingDwellStreamDisabled, MD_Test_Setup, MD_Test_TearDown, "MD_ManageDwellTable_Test_UpdatePendingDwellStreamDisabled");
-    UtTest_Add(MD_ManageDwellTable_Test_TblNotUpdated, MD_Test_Setup, MD_Test_TearDown, "MD_ManageDwellTable_Test_TblNotUpdated");
-    UtTest_Add(MD_ManageDwellTable_Test_UpdatePendingTblCopyError, MD_Test_Setup, MD_Test_TearDown, "MD_ManageDwellTable_Test_UpdatePendingTblCopyError");
     UtTest_Add(MD_ManageDwellTable_Test_TblStatusErr, MD_Test_Setup, MD_Test_TearDown, "MD_ManageDwellTable_Test_TblStatusErr");
+    UtTest_Add(MD_ManageDwellTable_Test_UpdatePending, MD_Test_Setup, MD_Test_TearDown, "MD_ManageDwellTable_Test_UpdatePending");
     UtTest_Add(MD_ManageDwellTable_Test_OtherStatus, MD_Test_Setup, MD_Test_TearDown, "MD_ManageDwellTable_Test_OtherStatus");
+#if MD_INTERNAL_SAMPLER_CHILD_TASK == 1
+    UtTest_Add(MD_ManageDwellTable_Test_UpdateQueueFull, MD_Test_Setup, MD_Test_TearDown, "MD_ManageDwellTable_Test_UpdateQueueFull");
+    UtTest_Add(MD_RetryTableUpdates_Test, MD_Test_Setup, MD_Test_TearDown, "MD_RetryTableUpdates_Test");
+    UtTest_Add(MD_AppMain_Test_RetryTableUpdates, MD_Test_Setup, MD_Test_TearDown, "MD_AppMain_Test_RetryTableUpdates");
+#endif
     
+    UtTest_Add(MD_UpdateDwellTable_Test_DwellStreamEnabled, MD_Test_Setup, MD_Test_TearDown, "MD_UpdateDwellTable_Test_DwellStreamEnabled");
+    UtTest_Add(MD_UpdateDwellTable_Test_DwellStreamDisabled, MD_Test_Setup, MD_Test_TearDown, "MD_UpdateDwellTable_Test_DwellStreamDisabled");
+    UtTest_Add(MD_UpdateDwellTable_Test_TblNotUpdated, MD_Test_Setup, MD_Test_TearDown, "MD_UpdateDwellTable_Test_TblNotUpdated");
+    UtTest_Add(MD_UpdateDwellTable_Test_TblCopyError, MD_Test_Setup, MD_Test_TearDown, "MD_UpdateDwellTable_Test_TblCopyError");
+    
+#if MD_INTERFACE_HK_TABLES_PER_PAGE == MD_INTERFACE_NUM_DWELL_TABLES
     UtTest_Add(MD_HkStatus_Test, MD_Test_Setup, MD_Test_TearDown, "MD_HkStatus_Test");
+#endif
+    UtTest_Add(MD_HkStatus_Test_LastPage, MD_Test_Setup, MD_Test_TearDown, "MD_HkStatus_Test_LastPage");
 }
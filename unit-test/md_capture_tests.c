@@ -0,0 +1,543 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "md_capture.h"
+#include "md_dwell_pkt.h"
+#include "md_dwell_err.h"
+#include "md_app.h"
+#include "md_eventids.h"
+#include "md_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* Dwell data size of the test table: a 4 byte, an 8 byte block and a 2 byte entry */
+#define MD_CAPTURE_TEST_DATA_SIZE 14
+
+/* Size of each captured record of the test table */
+#define MD_CAPTURE_TEST_RECORD_SIZE (MD_CAPTURE_RECORD_HDR_SIZE + MD_CAPTURE_TEST_DATA_SIZE)
+
+/* md_capture_tests globals */
+uint8  MD_CAPTURE_TEST_Data[MD_CAPTURE_TEST_DATA_SIZE];
+uint8  MD_CAPTURE_TEST_File[sizeof(MD_CaptureFileHdr_t) + (8 * MD_CAPTURE_TEST_RECORD_SIZE)];
+uint32 MD_CAPTURE_TEST_FileSize;
+
+/*
+ * Function Definitions
+ */
+
+/* Collects everything written to the capture file after the cFE file header */
+int32 MD_CAPTURE_TEST_OS_writeHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                   const UT_StubContext_t *Context)
+{
+    const void *buffer = UT_Hook_GetArgValueByName(Context, "buffer", const void *);
+    size_t      nbytes = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+
+    if ((MD_CAPTURE_TEST_FileSize + nbytes) <= sizeof(MD_CAPTURE_TEST_File))
+    {
+        memcpy(&MD_CAPTURE_TEST_File[MD_CAPTURE_TEST_FileSize], buffer, nbytes);
+        MD_CAPTURE_TEST_FileSize += nbytes;
+    }
+
+    return StubRetcode;
+}
+
+/* Sets up table 1 with three active entries */
+void MD_CAPTURE_TEST_SetupTable(void)
+{
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[0];
+
+    TblPtr->Entry[0].Length = 4;
+    TblPtr->Entry[1].Length = 8;
+    TblPtr->Entry[2].Length = 2;
+    TblPtr->AddrCount       = 3;
+    TblPtr->DataSize        = MD_CAPTURE_TEST_DATA_SIZE;
+    TblPtr->PktOffset       = MD_CAPTURE_TEST_DATA_SIZE;
+
+    MD_CAPTURE_TEST_FileSize = 0;
+    memset(MD_CAPTURE_TEST_File, 0, sizeof(MD_CAPTURE_TEST_File));
+}
+
+/* Arms a capture on the 2 byte entry of table 1 */
+void MD_CAPTURE_TEST_Arm(uint8 Condition, uint16 PreTrigger, uint16 PostTrigger)
+{
+    MD_CmdArmCapture_Payload_t Arm;
+
+    memset(&Arm, 0, sizeof(Arm));
+    Arm.TableId     = 1;
+    Arm.EntryId     = 3;
+    Arm.Condition   = Condition;
+    Arm.PreTrigger  = PreTrigger;
+    Arm.PostTrigger = PostTrigger;
+    Arm.Value       = 0x1234;
+    Arm.Mask        = 0xFFFF;
+
+    MD_ArmCapture(&Arm);
+}
+
+/* Completes a cycle whose dwell data bytes are all Fill and whose watched entry reads as Value */
+void MD_CAPTURE_TEST_Cycle(uint8 Fill, uint32 Value)
+{
+    memset(MD_CAPTURE_TEST_Data, Fill, sizeof(MD_CAPTURE_TEST_Data));
+    MD_AppData.DwellSchedule.WakeupCount = 100 + Fill;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_DwellEntryValue), Value);
+
+    MD_CaptureDwellCycle(0, MD_CAPTURE_TEST_Data);
+}
+
+/* Checks that a record written to the capture file holds the cycle filled with Fill */
+void MD_CAPTURE_TEST_CheckRecord(uint16 RecordIndex, uint8 Fill)
+{
+    uint8  Expected[MD_CAPTURE_TEST_DATA_SIZE];
+    uint32 Wakeup;
+    uint8 *RecordPtr = &MD_CAPTURE_TEST_File[sizeof(MD_CaptureFileHdr_t) + (RecordIndex * MD_CAPTURE_TEST_RECORD_SIZE)];
+
+    memset(Expected, Fill, sizeof(Expected));
+    memcpy(&Wakeup, RecordPtr, sizeof(Wakeup));
+
+    UtAssert_UINT32_EQ(Wakeup, 100 + Fill);
+    UtAssert_MemCmp(&RecordPtr[MD_CAPTURE_RECORD_HDR_SIZE], Expected, sizeof(Expected), "Record dwell data");
+}
+
+void MD_ValidCaptureEntry_Test(void)
+{
+    MD_CAPTURE_TEST_SetupTable();
+
+    /* Execute the function being tested */
+    UtAssert_True(!MD_ValidCaptureEntry(0, 0), "Entry 0 is not valid");
+    UtAssert_True(MD_ValidCaptureEntry(0, 1), "4 byte entry is valid");
+    UtAssert_True(!MD_ValidCaptureEntry(0, 2), "Block entry is not valid");
+    UtAssert_True(MD_ValidCaptureEntry(0, 3), "2 byte entry is valid");
+    UtAssert_True(!MD_ValidCaptureEntry(0, 4), "Entry past the last active entry is not valid");
+}
+
+void MD_ValidCaptureSize_Test(void)
+{
+    uint32 MaxRecords = MD_INTERNAL_CAPTURE_BUFFER_SIZE / MD_CAPTURE_TEST_RECORD_SIZE;
+
+    /* Execute the function being tested */
+    UtAssert_True(MD_ValidCaptureSize(0, 0, MD_CAPTURE_TEST_DATA_SIZE), "Trigger cycle alone fits");
+    UtAssert_True(MD_ValidCaptureSize(MaxRecords - 1, 0, MD_CAPTURE_TEST_DATA_SIZE), "Full buffer fits");
+    UtAssert_True(MD_ValidCaptureSize(0, MaxRecords - 1, MD_CAPTURE_TEST_DATA_SIZE), "Full buffer fits");
+    UtAssert_True(!MD_ValidCaptureSize(MaxRecords, 0, MD_CAPTURE_TEST_DATA_SIZE), "One record too many");
+    UtAssert_True(!MD_ValidCaptureSize(1, MaxRecords - 1, MD_CAPTURE_TEST_DATA_SIZE), "One record too many");
+    UtAssert_True(!MD_ValidCaptureSize(0xFFFF, 0xFFFF, 0), "Record count beyond 16 bits");
+}
+
+void MD_ArmCapture_Test(void)
+{
+    MD_CAPTURE_TEST_SetupTable();
+
+    /* Execute the function being tested */
+    MD_CAPTURE_TEST_Arm(MD_Capture_Conditions_GREATER, 3, 4);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_ARMED);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.TableIndex, 0);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.EntryIndex, 2);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.EntryOffset, 12);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.EntryLength, 2);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.Condition, MD_Capture_Conditions_GREATER);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.TriggerValue, 0x1234);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.Mask, 0xFFFF);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.RecordSize, MD_CAPTURE_TEST_RECORD_SIZE);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.MaxRecords, 8);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.PostRemaining, 4);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.NumRecords, 0);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.HaveLast, 0);
+}
+
+void MD_CaptureDwellCycle_Test_Ignored(void)
+{
+    MD_CAPTURE_TEST_SetupTable();
+
+    /* Not armed */
+    MD_CAPTURE_TEST_Cycle(1, 0x1234);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.NumRecords, 0);
+
+    /* Armed on another table */
+    MD_CAPTURE_TEST_Arm(MD_Capture_Conditions_EQUAL, 1, 1);
+    MD_AppData.Capture.TableIndex = 1;
+    MD_CAPTURE_TEST_Cycle(1, 0x1234);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.NumRecords, 0);
+
+    /* Cycle cut short by a jam */
+    MD_AppData.Capture.TableIndex            = 0;
+    MD_AppData.MD_DwellTables[0].PktOffset = 6;
+    MD_CAPTURE_TEST_Cycle(1, 0x1234);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.NumRecords, 0);
+
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_ARMED);
+    UtAssert_STUB_COUNT(MD_DwellEntryValue, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_CaptureDwellCycle_Test_History(void)
+{
+    MD_CaptureFileHdr_t FileHdr;
+
+    MD_CAPTURE_TEST_SetupTable();
+    MD_CAPTURE_TEST_Arm(MD_Capture_Conditions_EQUAL, 2, 2);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, sizeof(MD_CaptureFileHdr_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 2 * MD_CAPTURE_TEST_RECORD_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 3 * MD_CAPTURE_TEST_RECORD_SIZE);
+    UT_SetHookFunction(UT_KEY(OS_write), MD_CAPTURE_TEST_OS_writeHook, NULL);
+
+    /* Only the newest 2 cycles ahead of the trigger are kept */
+    MD_CAPTURE_TEST_Cycle(1, 0);
+    MD_CAPTURE_TEST_Cycle(2, 0);
+    MD_CAPTURE_TEST_Cycle(3, 0);
+    MD_CAPTURE_TEST_Cycle(4, 0);
+    MD_CAPTURE_TEST_Cycle(5, 0);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.NumRecords, 3);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_ARMED);
+
+    /* Trigger */
+    MD_CAPTURE_TEST_Cycle(6, 0x1234);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_TRIGGERED);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.TriggerRecord, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_CAPTURE_TRIGGERED_INF_EID);
+
+    /* Post-trigger cycles are recorded whatever their value */
+    MD_CAPTURE_TEST_Cycle(7, 0);
+    MD_CAPTURE_TEST_Cycle(8, 0x1234);
+
+    /* The sampling task only freezes the ring */
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_COMPLETE);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+    /* Later cycles leave the completed capture alone */
+    MD_CAPTURE_TEST_Cycle(9, 0x1234);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.NumRecords, 5);
+
+    /* The main task writes the file */
+    MD_WriteCompletedCapture();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_IDLE);
+    UtAssert_STUB_COUNT(MD_DwellEntryValue, 6);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_FS_InitHeader, 1);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_write, 3);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MD_CAPTURE_FILE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    UtAssert_UINT32_EQ(MD_CAPTURE_TEST_FileSize, sizeof(MD_CaptureFileHdr_t) + (5 * MD_CAPTURE_TEST_RECORD_SIZE));
+
+    memcpy(&FileHdr, MD_CAPTURE_TEST_File, sizeof(FileHdr));
+    UtAssert_UINT32_EQ(FileHdr.TableId, 1);
+    UtAssert_UINT32_EQ(FileHdr.EntryId, 3);
+    UtAssert_UINT32_EQ(FileHdr.Condition, MD_Capture_Conditions_EQUAL);
+    UtAssert_UINT32_EQ(FileHdr.ByteCount, MD_CAPTURE_TEST_DATA_SIZE);
+    UtAssert_UINT32_EQ(FileHdr.TriggerValue, 0x1234);
+    UtAssert_UINT32_EQ(FileHdr.TriggerMask, 0xFFFF);
+    UtAssert_UINT32_EQ(FileHdr.RecordCount, 5);
+    UtAssert_UINT32_EQ(FileHdr.TriggerRecord, 2);
+
+    /* Records come out oldest first even though the ring wrapped */
+    MD_CAPTURE_TEST_CheckRecord(0, 4);
+    MD_CAPTURE_TEST_CheckRecord(1, 5);
+    MD_CAPTURE_TEST_CheckRecord(2, 6);
+    MD_CAPTURE_TEST_CheckRecord(3, 7);
+    MD_CAPTURE_TEST_CheckRecord(4, 8);
+}
+
+void MD_CaptureDwellCycle_Test_NoPostTrigger(void)
+{
+    MD_CAPTURE_TEST_SetupTable();
+    MD_CAPTURE_TEST_Arm(MD_Capture_Conditions_EQUAL, 2, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, sizeof(MD_CaptureFileHdr_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, MD_CAPTURE_TEST_RECORD_SIZE);
+    UT_SetHookFunction(UT_KEY(OS_write), MD_CAPTURE_TEST_OS_writeHook, NULL);
+
+    /* Execute the function being tested, the first cycle triggers with no history */
+    MD_CAPTURE_TEST_Cycle(9, 0x1234);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_COMPLETE);
+
+    MD_WriteCompletedCapture();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_IDLE);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MD_CAPTURE_FILE_INF_EID);
+    UtAssert_UINT32_EQ(MD_CAPTURE_TEST_FileSize, sizeof(MD_CaptureFileHdr_t) + MD_CAPTURE_TEST_RECORD_SIZE);
+    MD_CAPTURE_TEST_CheckRecord(0, 9);
+}
+
+void MD_CaptureDwellCycle_Test_Unread(void)
+{
+    MD_CAPTURE_TEST_SetupTable();
+    MD_CAPTURE_TEST_Arm(MD_Capture_Conditions_EQUAL, 2, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_DwellEntryUnread), true);
+
+    /* Execute the function being tested, the watched entry has no value to trigger on */
+    MD_CAPTURE_TEST_Cycle(1, 0x1234);
+
+    /* Verify results: the cycle is kept as history */
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_ARMED);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.NumRecords, 1);
+    UtAssert_STUB_COUNT(MD_DwellEntryValue, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_DwellEntryUnread), false);
+
+    MD_CAPTURE_TEST_Cycle(2, 0x1234);
+
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_COMPLETE);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.TriggerRecord, 1);
+}
+
+void MD_CaptureTriggered_Test_Equal(void)
+{
+    MD_AppData.Capture.Condition    = MD_Capture_Conditions_EQUAL;
+    MD_AppData.Capture.TriggerValue = 0x12345678;
+    MD_AppData.Capture.Mask         = 0x0000FF00;
+
+    /* Execute the function being tested */
+    UtAssert_True(MD_CaptureTriggered(0xFFFF56FF), "Masked bits equal");
+    UtAssert_True(!MD_CaptureTriggered(0x12345778), "Masked bits differ");
+    UtAssert_UINT32_EQ(MD_AppData.Capture.LastValue, 0x5700);
+}
+
+void MD_CaptureTriggered_Test_Greater(void)
+{
+    MD_AppData.Capture.Condition    = MD_Capture_Conditions_GREATER;
+    MD_AppData.Capture.TriggerValue = 100;
+    MD_AppData.Capture.Mask         = 0xFFFFFFFF;
+
+    /* Execute the function being tested */
+    UtAssert_True(!MD_CaptureTriggered(99), "Value below");
+    UtAssert_True(!MD_CaptureTriggered(100), "Value equal");
+    UtAssert_True(MD_CaptureTriggered(101), "Value above");
+}
+
+void MD_CaptureTriggered_Test_BitSet(void)
+{
+    MD_AppData.Capture.Condition = MD_Capture_Conditions_BIT_SET;
+    MD_AppData.Capture.Mask      = 0x00000090;
+
+    /* Execute the function being tested */
+    UtAssert_True(!MD_CaptureTriggered(0xFFFFFF6F), "No masked bit set");
+    UtAssert_True(MD_CaptureTriggered(0x00000010), "One masked bit set");
+}
+
+void MD_CaptureTriggered_Test_Changed(void)
+{
+    MD_AppData.Capture.Condition = MD_Capture_Conditions_CHANGED;
+    MD_AppData.Capture.Mask      = 0x000000FF;
+
+    /* Execute the function being tested */
+    UtAssert_True(!MD_CaptureTriggered(0x00000042), "First value never triggers");
+    UtAssert_UINT32_EQ(MD_AppData.Capture.HaveLast, 1);
+    UtAssert_True(!MD_CaptureTriggered(0x00001142), "Unmasked bits changed");
+    UtAssert_True(MD_CaptureTriggered(0x00001143), "Masked bits changed");
+}
+
+void MD_CaptureTriggered_Test_BadCondition(void)
+{
+    MD_AppData.Capture.Condition = MD_Capture_Conditions_CHANGED + 1;
+    MD_AppData.Capture.Mask      = 0xFFFFFFFF;
+
+    /* Execute the function being tested */
+    UtAssert_True(!MD_CaptureTriggered(0), "Unknown condition never triggers");
+    UtAssert_True(!MD_CaptureTriggered(1), "Unknown condition never triggers");
+}
+
+void MD_WriteCaptureFile_Test_OpenError(void)
+{
+    MD_CAPTURE_TEST_SetupTable();
+    MD_CAPTURE_TEST_Arm(MD_Capture_Conditions_EQUAL, 0, 0);
+    MD_AppData.Capture.State = MD_CAPTURE_COMPLETE;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), -1);
+
+    /* Execute the function being tested */
+    MD_WriteCaptureFile();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_IDLE);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_CAPTURE_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MD_WriteCaptureFile_Test_HeaderError(void)
+{
+    MD_CAPTURE_TEST_SetupTable();
+    MD_CAPTURE_TEST_Arm(MD_Capture_Conditions_EQUAL, 0, 0);
+    MD_AppData.Capture.State = MD_CAPTURE_COMPLETE;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t) - 1);
+
+    /* Execute the function being tested */
+    MD_WriteCaptureFile();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_IDLE);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_CAPTURE_FILE_ERR_EID);
+}
+
+void MD_WriteCaptureFile_Test_WriteError(void)
+{
+    MD_CAPTURE_TEST_SetupTable();
+    MD_CAPTURE_TEST_Arm(MD_Capture_Conditions_EQUAL, 0, 0);
+    MD_AppData.Capture.State = MD_CAPTURE_COMPLETE;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+
+    /* Capture header is written, then the disk fills */
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, sizeof(MD_CaptureFileHdr_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
+
+    /* Execute the function being tested */
+    MD_WriteCaptureFile();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_IDLE);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_CAPTURE_FILE_ERR_EID);
+}
+
+void MD_CancelCapture_Test_Armed(void)
+{
+    MD_CAPTURE_TEST_SetupTable();
+    MD_CAPTURE_TEST_Arm(MD_Capture_Conditions_EQUAL, 1, 1);
+
+    /* Execute the function being tested, another table first */
+    MD_CancelCapture(1);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_ARMED);
+
+    MD_CancelCapture(0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_IDLE);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_CAPTURE_CANCELLED_INF_EID);
+
+    /* Nothing left to cancel */
+    MD_CancelCapture(0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void MD_CancelCapture_Test_Triggered(void)
+{
+    MD_CAPTURE_TEST_SetupTable();
+    MD_CAPTURE_TEST_Arm(MD_Capture_Conditions_EQUAL, 1, 3);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, sizeof(MD_CaptureFileHdr_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 2 * MD_CAPTURE_TEST_RECORD_SIZE);
+    UT_SetHookFunction(UT_KEY(OS_write), MD_CAPTURE_TEST_OS_writeHook, NULL);
+
+    MD_CAPTURE_TEST_Cycle(1, 0);
+    MD_CAPTURE_TEST_Cycle(2, 0x1234);
+
+    /* Execute the function being tested */
+    MD_CancelCapture(0);
+
+    /* Verify results, the cycles so far are kept for the main task to write */
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_COMPLETE);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+    /* A completed capture isn't cancelled again */
+    MD_CancelCapture(0);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_COMPLETE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    MD_WriteCompletedCapture();
+
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_IDLE);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MD_CAPTURE_FILE_INF_EID);
+    UtAssert_UINT32_EQ(MD_CAPTURE_TEST_FileSize, sizeof(MD_CaptureFileHdr_t) + (2 * MD_CAPTURE_TEST_RECORD_SIZE));
+    MD_CAPTURE_TEST_CheckRecord(0, 1);
+    MD_CAPTURE_TEST_CheckRecord(1, 2);
+}
+
+void MD_WriteCompletedCapture_Test_NotComplete(void)
+{
+    MD_CAPTURE_TEST_SetupTable();
+    MD_CAPTURE_TEST_Arm(MD_Capture_Conditions_EQUAL, 1, 1);
+
+    /* Execute the function being tested, an armed capture isn't written */
+    MD_WriteCompletedCapture();
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_ARMED);
+
+    MD_AppData.Capture.State = MD_CAPTURE_TRIGGERED;
+    MD_WriteCompletedCapture();
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_TRIGGERED);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(MD_ValidCaptureEntry_Test, MD_Test_Setup, MD_Test_TearDown, "MD_ValidCaptureEntry_Test");
+    UtTest_Add(MD_ValidCaptureSize_Test, MD_Test_Setup, MD_Test_TearDown, "MD_ValidCaptureSize_Test");
+
+    UtTest_Add(MD_ArmCapture_Test, MD_Test_Setup, MD_Test_TearDown, "MD_ArmCapture_Test");
+
+    UtTest_Add(MD_CaptureDwellCycle_Test_Ignored, MD_Test_Setup, MD_Test_TearDown,
+               "MD_CaptureDwellCycle_Test_Ignored");
+    UtTest_Add(MD_CaptureDwellCycle_Test_History, MD_Test_Setup, MD_Test_TearDown,
+               "MD_CaptureDwellCycle_Test_History");
+    UtTest_Add(MD_CaptureDwellCycle_Test_Unread, MD_Test_Setup, MD_Test_TearDown, "MD_CaptureDwellCycle_Test_Unread");
+    UtTest_Add(MD_CaptureDwellCycle_Test_NoPostTrigger, MD_Test_Setup, MD_Test_TearDown,
+               "MD_CaptureDwellCycle_Test_NoPostTrigger");
+
+    UtTest_Add(MD_CaptureTriggered_Test_Equal, MD_Test_Setup, MD_Test_TearDown, "MD_CaptureTriggered_Test_Equal");
+    UtTest_Add(MD_CaptureTriggered_Test_Greater, MD_Test_Setup, MD_Test_TearDown, "MD_CaptureTriggered_Test_Greater");
+    UtTest_Add(MD_CaptureTriggered_Test_BitSet, MD_Test_Setup, MD_Test_TearDown, "MD_CaptureTriggered_Test_BitSet");
+    UtTest_Add(MD_CaptureTriggered_Test_Changed, MD_Test_Setup, MD_Test_TearDown, "MD_CaptureTriggered_Test_Changed");
+    UtTest_Add(MD_CaptureTriggered_Test_BadCondition, MD_Test_Setup, MD_Test_TearDown,
+               "MD_CaptureTriggered_Test_BadCondition");
+
+    UtTest_Add(MD_WriteCaptureFile_Test_OpenError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_WriteCaptureFile_Test_OpenError");
+    UtTest_Add(MD_WriteCaptureFile_Test_HeaderError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_WriteCaptureFile_Test_HeaderError");
+    UtTest_Add(MD_WriteCaptureFile_Test_WriteError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_WriteCaptureFile_Test_WriteError");
+
+    UtTest_Add(MD_WriteCompletedCapture_Test_NotComplete, MD_Test_Setup, MD_Test_TearDown,
+               "MD_WriteCompletedCapture_Test_NotComplete");
+
+    UtTest_Add(MD_CancelCapture_Test_Armed, MD_Test_Setup, MD_Test_TearDown, "MD_CancelCapture_Test_Armed");
+    UtTest_Add(MD_CancelCapture_Test_Triggered, MD_Test_Setup, MD_Test_TearDown, "MD_CancelCapture_Test_Triggered");
+}
@@ -22,7 +22,11 @@
 
 #include "md_cmds.h"
 #include "md_dwell_tbl.h"
+#include "md_dwell_pkt.h"
 #include "md_utils.h"
+#include "md_capture.h"
+#include "md_symcache.h"
+#include "md_perf.h"
 #include "md_msg.h"
 #include "md_msgdefs.h"
 #include "md_eventids.h"
@@ -101,18 +105,41 @@ void MD_ResetCountersCmd_Test(void)
     MD_AppData.CmdCounter = 5;
     MD_AppData.ErrCounter = 3;
 
+    MD_AppData.DwellCounters[0].SampleCount                                  = 4;
+    MD_AppData.DwellCounters[MD_INTERFACE_NUM_DWELL_TABLES - 1].MaxSampleTime = 5;
+    MD_AppData.WakeupCounters.RephaseCount                                   = 6;
+
     /* Call the function directly */
     MD_ResetCountersCmd((MD_ResetCountersCmd_t *) &UT_CmdBuf.Buf);
 
     /* Verify counters were reset */
     UtAssert_UINT8_EQ(MD_AppData.CmdCounter, 0);
     UtAssert_UINT8_EQ(MD_AppData.ErrCounter, 0);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].SampleCount, 0);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[MD_INTERFACE_NUM_DWELL_TABLES - 1].MaxSampleTime, 0);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.RephaseCount, 0);
+    UtAssert_STUB_COUNT(MD_ResetPerfHist, 1);
     
     /* Verify event was sent */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_RESET_INF_EID);
 }
 
+void MD_SendPerfHistCmd_Test(void)
+{
+    /* Call the function directly */
+    MD_SendPerfHistCmd((MD_SendPerfHistCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify the histograms were sent */
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT8_EQ(MD_AppData.CmdCounter, 1);
+
+    /* Verify event was sent */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_SEND_PERF_HIST_INF_EID);
+}
+
 void MD_ProcessStartCmd_Test_ZeroRate(void)
 {
     CFE_SB_MsgId_t TestMsgId;
@@ -123,7 +150,7 @@ void MD_ProcessStartCmd_Test_ZeroRate(void)
              "Dwell Table %%d is enabled with a delay of zero so no processing will occur");
 
     snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Start Dwell Table command processed successfully for table mask 0x%%04X");
+             "Start Dwell Table command processed successfully for table mask 0x%%04X offset %%d");
 
     TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -182,7 +209,7 @@ void MD_ProcessStartCmd_Test_Success(void)
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Start Dwell Table command processed successfully for table mask 0x%%04X");
+             "Start Dwell Table command processed successfully for table mask 0x%%04X offset %%d");
 
     TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -209,6 +236,7 @@ void MD_ProcessStartCmd_Test_Success(void)
     UtAssert_True(MD_AppData.MD_DwellTables[0].Countdown == 1, "MD_AppData.MD_DwellTables[0].Countdown == 1");
     UtAssert_True(MD_AppData.MD_DwellTables[0].CurrentEntry == 0, "MD_AppData.MD_DwellTables[0].CurrentEntry == 0");
     UtAssert_True(MD_AppData.MD_DwellTables[0].PktOffset == 0, "MD_AppData.MD_DwellTables[0].PktOffset == 0");
+    UtAssert_STUB_COUNT(MD_ScheduleDwellTable, 1);
 
     UtAssert_True(MD_AppData.CmdCounter == 1, "MD_AppData.CmdCounter == 1");
 
@@ -225,6 +253,44 @@ void MD_ProcessStartCmd_Test_Success(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_ProcessStartCmd_Test_Timed(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdStartStop.Payload.TableMask = 1;
+
+    /* A timed table needs no delays to be read */
+    MD_AppData.MD_DwellTables[0].Rate = 0;
+    UT_SetDefaultReturnValue(UT_KEY(MD_DwellTableIsTimed), true);
+
+    /* Prevents segmentation fault in call to subfunction MD_UpdateTableEnabledField */
+    UT_SetHookFunction(UT_KEY(CFE_TBL_GetAddress), &MD_CMDS_TEST_CFE_TBL_GetAddressHook, NULL);
+
+    /* Only process one entry per table processing loop */
+    UT_SetDeferredRetcode(UT_KEY(MD_TableIsInMask), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_TableIsInMask), 3, false);
+    UT_SetDeferredRetcode(UT_KEY(MD_TableIsInMask), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_TableIsInMask), 3, false);
+
+    /* Execute the function being tested */
+    MD_StartDwellCmd((MD_StartDwellCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results: first read waits for the table's next deadline */
+    UtAssert_True(MD_AppData.MD_DwellTables[0].Enabled == MD_Dwell_States_ENABLED,
+                  "MD_AppData.MD_DwellTables[0].Enabled == MD_Dwell_States_ENABLED");
+    UtAssert_STUB_COUNT(MD_ScheduleDwellDeadline, 1);
+    UtAssert_STUB_COUNT(MD_ScheduleDwellTable, 0);
+
+    UtAssert_True(MD_AppData.CmdCounter == 1, "MD_AppData.CmdCounter == 1");
+
+    /* No zero rate event */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_START_DWELL_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void MD_ProcessStartCmd_Test_EmptyTableMask(void)
 {
     CFE_SB_MsgId_t TestMsgId;
@@ -232,7 +298,7 @@ void MD_ProcessStartCmd_Test_EmptyTableMask(void)
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "%%s command rejected because no tables were specified in table mask (0x%%04X)");
+             "%%s command rejected because no tables were specified in table mask (0x%%04X) offset %%d");
 
     TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -258,6 +324,33 @@ void MD_ProcessStartCmd_Test_EmptyTableMask(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_ProcessStartCmd_Test_MaskOffset(void)
+{
+    UT_CmdBuf.CmdStartStop.Payload.TableMask  = 1;
+    UT_CmdBuf.CmdStartStop.Payload.MaskOffset = 1;
+
+    MD_AppData.MD_DwellTables[1].Rate = 1;
+
+    /* Prevents segmentation fault in call to subfunction MD_UpdateTableEnabledField */
+    UT_SetHookFunction(UT_KEY(CFE_TBL_GetAddress), &MD_CMDS_TEST_CFE_TBL_GetAddressHook, NULL);
+
+    /* Bit 0 is the only one set, the first table each loop checks */
+    UT_SetDeferredRetcode(UT_KEY(MD_TableIsInMask), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_TableIsInMask), MD_INTERFACE_NUM_DWELL_TABLES - 1, true);
+
+    /* Execute the function being tested */
+    MD_StartDwellCmd((MD_StartDwellCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results, table 2 is started and table 1 is left alone */
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[1].Enabled, MD_Dwell_States_ENABLED);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[0].Enabled, MD_Dwell_States_DISABLED);
+    UtAssert_STUB_COUNT(MD_TableIsInMask, 2 * (MD_INTERFACE_NUM_DWELL_TABLES - 1));
+    UtAssert_STUB_COUNT(MD_ScheduleDwellTable, 1);
+
+    UtAssert_True(MD_AppData.CmdCounter == 1, "MD_AppData.CmdCounter == 1");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_START_DWELL_INF_EID);
+}
+
 void MD_ProcessStartCmd_Test_NoUpdateTableEnabledField(void)
 {
     CFE_SB_MsgId_t TestMsgId;
@@ -265,7 +358,7 @@ void MD_ProcessStartCmd_Test_NoUpdateTableEnabledField(void)
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Start Dwell Table for mask 0x%%04X failed for %%d of %%d tables");
+             "Start Dwell Table for mask 0x%%04X offset %%d failed for %%d of %%d tables");
 
     TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -309,7 +402,7 @@ void MD_ProcessStopCmd_Test_Success(void)
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Stop Dwell Table command processed successfully for table mask 0x%%04X");
+             "Stop Dwell Table command processed successfully for table mask 0x%%04X offset %%d");
 
     TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -334,6 +427,11 @@ void MD_ProcessStopCmd_Test_Success(void)
     UtAssert_True(MD_AppData.MD_DwellTables[0].Countdown == 0, "MD_AppData.MD_DwellTables[0].Countdown == 0");
     UtAssert_True(MD_AppData.MD_DwellTables[0].CurrentEntry == 0, "MD_AppData.MD_DwellTables[0].CurrentEntry == 0");
     UtAssert_True(MD_AppData.MD_DwellTables[0].PktOffset == 0, "MD_AppData.MD_DwellTables[0].PktOffset == 0");
+    UtAssert_STUB_COUNT(MD_UnscheduleDwellTable, 1);
+    UtAssert_STUB_COUNT(MD_SendDwellBatchPkt, 1);
+    UtAssert_STUB_COUNT(MD_SendDwellStatsPkt, 1);
+    UtAssert_STUB_COUNT(MD_ReleaseDwellPktBuf, 1);
+    UtAssert_STUB_COUNT(MD_CancelCapture, 1);
 
     UtAssert_True(MD_AppData.CmdCounter == 1, "MD_AppData.CmdCounter == 1");
 
@@ -357,7 +455,7 @@ void MD_ProcessStopCmd_Test_EmptyTableMask(void)
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "%%s command rejected because no tables were specified in table mask (0x%%04X)");
+             "%%s command rejected because no tables were specified in table mask (0x%%04X) offset %%d");
 
     TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -383,6 +481,23 @@ void MD_ProcessStopCmd_Test_EmptyTableMask(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_ProcessStopCmd_Test_MaskOffsetPastLastTable(void)
+{
+    UT_CmdBuf.CmdStartStop.Payload.TableMask  = 0xFFFF;
+    UT_CmdBuf.CmdStartStop.Payload.MaskOffset = MD_INTERFACE_NUM_DWELL_TABLES;
+
+    /* Execute the function being tested */
+    MD_StopDwellCmd((MD_StopDwellCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results, no table is past the last one */
+    UtAssert_STUB_COUNT(MD_TableIsInMask, 0);
+    UtAssert_STUB_COUNT(MD_UnscheduleDwellTable, 0);
+
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_EMPTY_TBLMASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void MD_ProcessStopCmd_Test_NoUpdateTableEnabledField(void)
 {
     CFE_SB_MsgId_t TestMsgId;
@@ -390,7 +505,7 @@ void MD_ProcessStopCmd_Test_NoUpdateTableEnabledField(void)
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Stop Dwell Table for mask 0x%%04X failed for %%d of %%d tables");
+             "Stop Dwell Table for mask 0x%%04X offset %%d failed for %%d of %%d tables");
 
     TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -640,6 +755,7 @@ void MD_ProcessJamCmd_Test_NoUpdateTableDwell(void)
     UT_SetDeferredRetcode(UT_KEY(MD_ValidFieldLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(MD_ValidAddrRange), 1, true);
     UT_SetDeferredRetcode(UT_KEY(MD_UpdateTableDwellEntry), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidBatchFactor), 1, true);
 
     /* Execute the function being tested */
     MD_JamDwellCmd((MD_JamDwellCmd_t *) &UT_CmdBuf.Buf);
@@ -695,6 +811,8 @@ void MD_ProcessJamCmd_Test_CantResolveJamAddr(void)
     /* Verify results */
     UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
 
+    UtAssert_STUB_COUNT(MD_RefreshSymCache, 1);
+
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_CANT_RESOLVE_JAM_ADDR_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
@@ -715,7 +833,7 @@ void MD_ProcessJamCmd_Test_InvalidLenArg(void)
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Jam Cmd rejected due to invalid Field Length arg = %%d (Expect 0,1,2,or 4)");
+             "Jam Cmd rejected due to invalid Field Length arg = %%d (Expect 0,1,2,4,or %%d..%%d)");
 
     TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -929,6 +1047,146 @@ void MD_ProcessJamCmd_Test_JamAddrNot16BitFieldLength2(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_ProcessJamCmd_Test_DataSizeTooLarge(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Jam Cmd rejected because dwell data would exceed the %%d byte dwell packet");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdJam.Payload.TableId             = 1;
+    UT_CmdBuf.CmdJam.Payload.EntryId             = 2;
+    UT_CmdBuf.CmdJam.Payload.FieldLength         = MD_MIN_BLOCK_DWELL_LENGTH;
+    UT_CmdBuf.CmdJam.Payload.DwellAddress.Offset = 1;
+
+    /* Set to satisfy condition "MD_ResolveSymAddr(&Jam->DwellAddress,&ResolvedAddr) == TRUE" */
+    UT_SetDeferredRetcode(UT_KEY(MD_ResolveSymAddr), 1, true);
+
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidTableId), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidEntryId), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidFieldLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidAddrRange), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_DwellDataSizeWithEntry), 1, MD_INTERFACE_DWELL_PKT_DATA_SIZE + 1);
+
+    /* Execute the function being tested */
+    MD_JamDwellCmd((MD_JamDwellCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+    UtAssert_True(MD_AppData.MD_DwellTables[0].Entry[1].Length == 0,
+                  "MD_AppData.MD_DwellTables[0].Entry[1].Length == 0");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_JAM_DATA_SIZE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ProcessJamCmd_Test_BatchSizeTooLarge(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Jam Cmd rejected because %%d batched cycles would exceed the %%d byte batched dwell packet");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdJam.Payload.TableId             = 1;
+    UT_CmdBuf.CmdJam.Payload.EntryId             = 2;
+    UT_CmdBuf.CmdJam.Payload.FieldLength         = MD_MIN_BLOCK_DWELL_LENGTH;
+    UT_CmdBuf.CmdJam.Payload.DwellAddress.Offset = 1;
+
+    MD_AppData.MD_DwellTables[0].BatchFactor = 2;
+
+    /* Set to satisfy condition "MD_ResolveSymAddr(&Jam->DwellAddress,&ResolvedAddr) == TRUE" */
+    UT_SetDeferredRetcode(UT_KEY(MD_ResolveSymAddr), 1, true);
+
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidTableId), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidEntryId), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidFieldLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidAddrRange), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidBatchFactor), 1, false);
+
+    /* Execute the function being tested */
+    MD_JamDwellCmd((MD_JamDwellCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+    UtAssert_True(MD_AppData.MD_DwellTables[0].Entry[1].Length == 0,
+                  "MD_AppData.MD_DwellTables[0].Entry[1].Length == 0");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_JAM_BATCH_SIZE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ProcessJamCmd_Test_SuccessBlockLength(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    /* Block dwells need no alignment */
+    UT_CmdBuf.CmdJam.Payload.TableId             = 1;
+    UT_CmdBuf.CmdJam.Payload.EntryId             = 2;
+    UT_CmdBuf.CmdJam.Payload.FieldLength         = MD_MIN_BLOCK_DWELL_LENGTH;
+    UT_CmdBuf.CmdJam.Payload.DwellAddress.Offset = 1;
+    UT_CmdBuf.CmdJam.Payload.DwellDelay          = 3;
+
+    /* Set to satisfy condition "MD_ResolveSymAddr(&Jam->DwellAddress,&ResolvedAddr) == TRUE" */
+    UT_SetDeferredRetcode(UT_KEY(MD_ResolveSymAddr), 1, true);
+
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidTableId), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidEntryId), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidFieldLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidAddrRange), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_DwellDataSizeWithEntry), 1, MD_INTERFACE_DWELL_PKT_DATA_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidBatchFactor), 1, true);
+
+    /* Execute the function being tested */
+    MD_JamDwellCmd((MD_JamDwellCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.CmdCounter == 1, "MD_AppData.CmdCounter == 1");
+    UtAssert_True(MD_AppData.MD_DwellTables[0].Entry[1].Length == MD_MIN_BLOCK_DWELL_LENGTH,
+                  "MD_AppData.MD_DwellTables[0].Entry[1].Length == MD_MIN_BLOCK_DWELL_LENGTH");
+
+    UtAssert_STUB_COUNT(MD_Verify16Aligned, 0);
+    UtAssert_STUB_COUNT(MD_Verify32Aligned, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_JAM_DWELL_INF_EID);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+#if MD_INTERFACE_ENFORCE_DWORD_ALIGN == 1
 void MD_ProcessJamCmd_Test_JamAddrNot16BitNot32Aligned(void)
 {
     CFE_SB_MsgId_t TestMsgId;
@@ -973,6 +1231,7 @@ void MD_ProcessJamCmd_Test_JamAddrNot16BitNot32Aligned(void)
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 }
+#endif
 
 void MD_ProcessJamCmd_Test_JamFieldLength4Addr32Aligned(void)
 {
@@ -998,6 +1257,8 @@ void MD_ProcessJamCmd_Test_JamFieldLength4Addr32Aligned(void)
     UT_SetDeferredRetcode(UT_KEY(MD_ValidFieldLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(MD_ValidAddrRange), 1, true);
     UT_SetDeferredRetcode(UT_KEY(MD_Verify32Aligned), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_Verify16Aligned), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidBatchFactor), 1, true);
 
     /* Execute the function being tested */
     MD_JamDwellCmd((MD_JamDwellCmd_t *) &UT_CmdBuf.Buf);
@@ -1049,6 +1310,7 @@ void MD_ProcessJamCmd_Test_SuccessNonNullZeroRate(void)
     UT_SetDeferredRetcode(UT_KEY(MD_ValidFieldLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(MD_ValidAddrRange), 1, true);
     UT_SetDeferredRetcode(UT_KEY(MD_Verify16Aligned), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidBatchFactor), 1, true);
 
     /* Execute the function being tested */
     MD_JamDwellCmd((MD_JamDwellCmd_t *) &UT_CmdBuf.Buf);
@@ -1111,6 +1373,7 @@ void MD_ProcessJamCmd_Test_SuccessZeroRateStreamDisabled(void)
     UT_SetDeferredRetcode(UT_KEY(MD_ValidFieldLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(MD_ValidAddrRange), 1, true);
     UT_SetDeferredRetcode(UT_KEY(MD_Verify16Aligned), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidBatchFactor), 1, true);
 
     /* Execute the function being tested */
     MD_JamDwellCmd((MD_JamDwellCmd_t *) &UT_CmdBuf.Buf);
@@ -1153,6 +1416,7 @@ void MD_ProcessJamCmd_Test_SuccessRateNotZero(void)
     UT_CmdBuf.CmdJam.Payload.EntryId     = 2;
     UT_CmdBuf.CmdJam.Payload.FieldLength = 2;
     UT_CmdBuf.CmdJam.Payload.DwellDelay  = 3;
+    UT_CmdBuf.CmdJam.Payload.Deadband    = 10;
 
     MD_AppData.MD_DwellTables[0].Entry[1].Delay = 1;
 
@@ -1166,6 +1430,7 @@ void MD_ProcessJamCmd_Test_SuccessRateNotZero(void)
     UT_SetDeferredRetcode(UT_KEY(MD_ValidFieldLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(MD_ValidAddrRange), 1, true);
     UT_SetDeferredRetcode(UT_KEY(MD_Verify16Aligned), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidBatchFactor), 1, true);
 
     /* Execute the function being tested */
     MD_JamDwellCmd((MD_JamDwellCmd_t *) &UT_CmdBuf.Buf);
@@ -1177,6 +1442,7 @@ void MD_ProcessJamCmd_Test_SuccessRateNotZero(void)
                   "MD_AppData.MD_DwellTables[0].Entry[1].Length == 2");
     UtAssert_True(MD_AppData.MD_DwellTables[0].Entry[1].Delay == 3,
                   "MD_AppData.MD_DwellTables[0].Entry[1].Delay  == 3");
+    UtAssert_INT32_EQ(MD_AppData.DwellReportControl[0].Deadband[1], 10);
 
     UtAssert_True(MD_AppData.CmdCounter == 1, "MD_AppData.CmdCounter == 1");
 
@@ -1193,77 +1459,334 @@ void MD_ProcessJamCmd_Test_SuccessRateNotZero(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-#if MD_INTERFACE_SIGNATURE_OPTION == 1
-void MD_ProcessSignatureCmd_Test_InvalidSignatureLength(void)
+void MD_JamMultiDwellCmd_Test_InvalidTable(void)
 {
-    uint16         i;
-    CFE_SB_MsgId_t TestMsgId;
-    int32          strCmpResult;
-    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Set Signature cmd rejected due to invalid Signature length");
-
-    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_CmdBuf.CmdJamMulti.Payload.TableId    = 0;
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries = 1;
 
-    for (i = 0; i < sizeof(UT_CmdBuf.CmdSetSignature.Payload.Signature); i++)
-    {
-        UT_CmdBuf.CmdSetSignature.Payload.Signature[i] = 'x';
-    }
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidTableId), 1, false);
 
     /* Execute the function being tested */
-    MD_SetSignatureCmd((MD_SetSignatureCmd_t *) &UT_CmdBuf.Buf);
+    MD_JamMultiDwellCmd(&UT_CmdBuf.CmdJamMulti);
 
     /* Verify results */
-    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_INVALID_SIGNATURE_LENGTH_ERR_EID);
+    UtAssert_UINT32_EQ(MD_AppData.ErrCounter, 1);
+    UtAssert_STUB_COUNT(MD_UpdateTableDwellEntries, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_INVALID_JAM_TABLE_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+void MD_JamMultiDwellCmd_Test_InvalidCount(void)
+{
+    UT_CmdBuf.CmdJamMulti.Payload.TableId = 1;
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    /* No entries */
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries = 0;
+    MD_JamMultiDwellCmd(&UT_CmdBuf.CmdJamMulti);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    /* More entries than the command holds */
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries = MD_INTERFACE_MAX_JAM_ENTRIES + 1;
+    MD_JamMultiDwellCmd(&UT_CmdBuf.CmdJamMulti);
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.ErrCounter, 2);
+    UtAssert_STUB_COUNT(MD_ValidEntryId, 0);
+    UtAssert_STUB_COUNT(MD_UpdateTableDwellEntries, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_JAM_MULTI_COUNT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MD_JAM_MULTI_COUNT_ERR_EID);
 }
-#endif
 
-#if MD_INTERFACE_SIGNATURE_OPTION == 1
-void MD_ProcessSignatureCmd_Test_InvalidSignatureTable(void)
+void MD_JamMultiDwellCmd_Test_InvalidEntryId(void)
 {
-    CFE_SB_MsgId_t TestMsgId;
-    int32          strCmpResult;
-    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    UT_CmdBuf.CmdJamMulti.Payload.TableId             = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries          = 3;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].EntryId     = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].FieldLength = 4;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[1].EntryId     = MD_INTERFACE_DWELL_TABLE_SIZE + 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[1].FieldLength = 4;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_Verify32Aligned), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_Verify16Aligned), true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidEntryId), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidEntryId), 1, false);
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Set Signature cmd rejected due to invalid Tbl Id arg = %%d (Expect 1.. %%d)");
+    /* Execute the function being tested */
+    MD_JamMultiDwellCmd(&UT_CmdBuf.CmdJamMulti);
+
+    /* Verify checking stopped at the bad entry and nothing was applied */
+    UtAssert_UINT32_EQ(MD_AppData.ErrCounter, 1);
+    UtAssert_STUB_COUNT(MD_ValidEntryId, 2);
+    UtAssert_STUB_COUNT(MD_DwellDataSizeWithJam, 0);
+    UtAssert_STUB_COUNT(MD_UpdateTableDwellEntries, 0);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[0].Entry[0].Length, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_INVALID_ENTRY_ARG_ERR_EID);
+}
 
-    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+void MD_JamMultiDwellCmd_Test_CantResolveAddr(void)
+{
+    UT_CmdBuf.CmdJamMulti.Payload.TableId             = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries          = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].EntryId     = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].FieldLength = 4;
 
-    UT_CmdBuf.CmdSetSignature.Payload.TableId = 0;
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidEntryId), true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ResolveSymAddr), 1, false);
 
     /* Execute the function being tested */
-    MD_SetSignatureCmd((MD_SetSignatureCmd_t *) &UT_CmdBuf.Buf);
+    MD_JamMultiDwellCmd(&UT_CmdBuf.CmdJamMulti);
 
     /* Verify results */
-    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+    UtAssert_UINT32_EQ(MD_AppData.ErrCounter, 1);
+    UtAssert_STUB_COUNT(MD_RefreshSymCache, 1);
+    UtAssert_STUB_COUNT(MD_UpdateTableDwellEntries, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_CANT_RESOLVE_JAM_ADDR_ERR_EID);
+}
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_INVALID_SIGNATURE_TABLE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+void MD_JamMultiDwellCmd_Test_DataSizeTooLarge(void)
+{
+    UT_CmdBuf.CmdJamMulti.Payload.TableId             = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries          = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].EntryId     = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].FieldLength = MD_MIN_BLOCK_DWELL_LENGTH;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidEntryId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDeferredRetcode(UT_KEY(MD_DwellDataSizeWithJam), 1, MD_INTERFACE_DWELL_PKT_DATA_SIZE + 1);
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* Execute the function being tested */
+    MD_JamMultiDwellCmd(&UT_CmdBuf.CmdJamMulti);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.ErrCounter, 1);
+    UtAssert_STUB_COUNT(MD_UpdateTableDwellEntries, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_JAM_DATA_SIZE_ERR_EID);
+}
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+void MD_JamMultiDwellCmd_Test_BatchSizeTooLarge(void)
+{
+    UT_CmdBuf.CmdJamMulti.Payload.TableId             = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries          = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].EntryId     = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].FieldLength = MD_MIN_BLOCK_DWELL_LENGTH;
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    MD_AppData.MD_DwellTables[0].BatchFactor = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidEntryId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDeferredRetcode(UT_KEY(MD_DwellDataSizeWithJam), 1, MD_MIN_BLOCK_DWELL_LENGTH);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidBatchFactor), 1, false);
+
+    /* Execute the function being tested */
+    MD_JamMultiDwellCmd(&UT_CmdBuf.CmdJamMulti);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.ErrCounter, 1);
+    UtAssert_STUB_COUNT(MD_UpdateTableDwellEntries, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_JAM_BATCH_SIZE_ERR_EID);
+}
+
+void MD_JamMultiDwellCmd_Test_NoUpdateTableDwellEntries(void)
+{
+    CFE_Status_t Status;
+
+    UT_CmdBuf.CmdJamMulti.Payload.TableId             = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries          = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].EntryId     = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].FieldLength = MD_MIN_BLOCK_DWELL_LENGTH;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidEntryId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidBatchFactor), true);
+    UT_SetDeferredRetcode(UT_KEY(MD_UpdateTableDwellEntries), 1, -1);
+
+    /* Execute the function being tested */
+    Status = MD_JamMultiDwellCmd(&UT_CmdBuf.CmdJamMulti);
+
+    /* Verify the live table wasn't changed */
+    UtAssert_INT32_EQ(Status, -1);
+    UtAssert_UINT32_EQ(MD_AppData.ErrCounter, 1);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[0].Entry[0].Length, 0);
+    UtAssert_STUB_COUNT(MD_UpdateDwellControlInfo, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_JAM_MULTI_DWELL_ERR_EID);
+}
+
+void MD_JamMultiDwellCmd_Test_Success(void)
+{
+    CFE_Status_t Status;
+
+    UT_CmdBuf.CmdJamMulti.Payload.TableId    = 2;
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries = 3;
+
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].EntryId     = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].FieldLength = 4;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].DwellDelay  = 2;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].Deadband    = 5;
+
+    /* A null entry takes no address checks */
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[1].EntryId     = 3;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[1].FieldLength = 0;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[1].DwellDelay  = 7;
+
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[2].EntryId     = 2;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[2].FieldLength = 2;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[2].DwellDelay  = 1;
+
+    MD_AppData.MD_DwellTables[1].Entry[2].Length = 4;
+    MD_AppData.MD_DwellTables[1].Entry[2].Delay  = 3;
+    MD_AppData.MD_DwellTables[1].Rate            = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidEntryId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_Verify32Aligned), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_Verify16Aligned), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidBatchFactor), true);
+    UT_SetDeferredRetcode(UT_KEY(MD_DwellDataSizeWithJam), 1, 6);
+
+    /* Execute the function being tested */
+    Status = MD_JamMultiDwellCmd(&UT_CmdBuf.CmdJamMulti);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Status, CFE_SUCCESS);
+    UtAssert_UINT32_EQ(MD_AppData.CmdCounter, 1);
+    UtAssert_STUB_COUNT(MD_RefreshSymCache, 1);
+    UtAssert_STUB_COUNT(MD_ResolveSymAddr, 2);
+    UtAssert_STUB_COUNT(MD_UpdateTableDwellEntries, 1);
+    UtAssert_STUB_COUNT(MD_UpdateTableDwellEntry, 0);
+    UtAssert_STUB_COUNT(MD_UpdateDwellControlInfo, 1);
+
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[1].Entry[0].Length, 4);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[1].Entry[0].Delay, 2);
+    UtAssert_UINT32_EQ(MD_AppData.DwellReportControl[1].Deadband[0], 5);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[1].Entry[1].Length, 2);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[1].Entry[1].Delay, 1);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[1].Entry[2].Length, 0);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[1].Entry[2].Delay, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_JAM_MULTI_DWELL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void MD_JamMultiDwellCmd_Test_SuccessZeroRate(void)
+{
+    UT_CmdBuf.CmdJamMulti.Payload.TableId              = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries           = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].EntryId     = 1;
+    UT_CmdBuf.CmdJamMulti.Payload.Entry[0].FieldLength = 0;
+
+    UT_SetHookFunction(UT_KEY(MD_UpdateDwellControlInfo), &MD_CMDS_TEST_MD_UpdateDwellControlInfoHook1, NULL);
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidEntryId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidBatchFactor), true);
+
+    /* Execute the function being tested */
+    MD_JamMultiDwellCmd(&UT_CmdBuf.CmdJamMulti);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.CmdCounter, 1);
+    UtAssert_STUB_COUNT(MD_ResolveSymAddr, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_JAM_MULTI_DWELL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MD_ZERO_RATE_CMD_INF_EID);
+}
+
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+void MD_ProcessSignatureCmd_Test_InvalidSignatureLength(void)
+{
+    uint16         i;
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Set Signature cmd rejected due to invalid Signature length");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    for (i = 0; i < sizeof(UT_CmdBuf.CmdSetSignature.Payload.Signature); i++)
+    {
+        UT_CmdBuf.CmdSetSignature.Payload.Signature[i] = 'x';
+    }
+
+    /* Execute the function being tested */
+    MD_SetSignatureCmd((MD_SetSignatureCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_INVALID_SIGNATURE_LENGTH_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+#endif
+
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+void MD_ProcessSignatureCmd_Test_InvalidSignatureTable(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Set Signature cmd rejected due to invalid Tbl Id arg = %%d (Expect 1.. %%d)");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdSetSignature.Payload.TableId = 0;
+
+    /* Execute the function being tested */
+    MD_SetSignatureCmd((MD_SetSignatureCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_INVALID_SIGNATURE_TABLE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
 }
 #endif
 
@@ -1292,8 +1815,9 @@ void MD_ProcessSignatureCmd_Test_Success(void)
     MD_SetSignatureCmd((MD_SetSignatureCmd_t *) &UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(strncmp(MD_AppData.MD_DwellTables[0].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
-                  "strncmp(MD_AppData.MD_DwellTables[0].Signature, 'signature', MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0");
+    UtAssert_True(strncmp(MD_AppData.DwellReportControl[0].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
+                  "strncmp(MD_AppData.DwellReportControl[0].Signature, 'signature', MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0");
+    UtAssert_STUB_COUNT(MD_UpdateDwellPktTemplate, 1);
 
     UtAssert_True(MD_AppData.CmdCounter == 1, "MD_AppData.CmdCounter == 1");
 
@@ -1337,8 +1861,8 @@ void MD_ProcessSignatureCmd_Test_NoUpdateTableSignature(void)
     MD_SetSignatureCmd((MD_SetSignatureCmd_t *) &UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(strncmp(MD_AppData.MD_DwellTables[0].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
-                  "strncmp(MD_AppData.MD_DwellTables[0].Signature, 'signature', MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0");
+    UtAssert_True(strncmp(MD_AppData.DwellReportControl[0].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
+                  "strncmp(MD_AppData.DwellReportControl[0].Signature, 'signature', MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0");
 
     UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
 
@@ -1356,21 +1880,587 @@ void MD_ProcessSignatureCmd_Test_NoUpdateTableSignature(void)
 }
 #endif
 
+void MD_SetBatchFactorCmd_Test_InvalidTable(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Set Batch Factor cmd rejected due to invalid Tbl Id arg = %%d (Expect 1.. %%d)");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdSetBatchFactor.Payload.TableId     = 0;
+    UT_CmdBuf.CmdSetBatchFactor.Payload.BatchFactor = 2;
+
+    /* Execute the function being tested */
+    MD_SetBatchFactorCmd((MD_SetBatchFactorCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+    UtAssert_STUB_COUNT(MD_UpdateTableBatchFactor, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_INVALID_BATCH_TABLE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_SetBatchFactorCmd_Test_InvalidBatchFactor(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Set Batch Factor cmd rejected because %%d batched cycles of %%d bytes exceed the %%d byte batched dwell packet");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdSetBatchFactor.Payload.TableId     = 1;
+    UT_CmdBuf.CmdSetBatchFactor.Payload.BatchFactor = 1000;
+
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidTableId), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidBatchFactor), 1, false);
+
+    /* Execute the function being tested */
+    MD_SetBatchFactorCmd((MD_SetBatchFactorCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].BatchFactor, 0);
+    UtAssert_STUB_COUNT(MD_SendDwellBatchPkt, 0);
+    UtAssert_STUB_COUNT(MD_UpdateTableBatchFactor, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_INVALID_BATCH_FACTOR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_SetBatchFactorCmd_Test_Success(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Successfully set batch factor for Dwell Tbl#%%d to %%d");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdSetBatchFactor.Payload.TableId     = 1;
+    UT_CmdBuf.CmdSetBatchFactor.Payload.BatchFactor = 2;
+
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidTableId), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidBatchFactor), 1, true);
+
+    /* Execute the function being tested */
+    MD_SetBatchFactorCmd((MD_SetBatchFactorCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].BatchFactor, 2);
+    UtAssert_STUB_COUNT(MD_SendDwellBatchPkt, 1);
+    UtAssert_STUB_COUNT(MD_UpdateTableBatchFactor, 1);
+
+    UtAssert_True(MD_AppData.CmdCounter == 1, "MD_AppData.CmdCounter == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_SET_BATCH_FACTOR_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_SetBatchFactorCmd_Test_NoUpdateTableBatchFactor(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Failed to set batch factor for Dwell Tbl#%%d. Update returned 0x%%08X");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdSetBatchFactor.Payload.TableId     = 1;
+    UT_CmdBuf.CmdSetBatchFactor.Payload.BatchFactor = 2;
+
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidTableId), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_ValidBatchFactor), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MD_UpdateTableBatchFactor), 1, -1);
+
+    /* Execute the function being tested */
+    MD_SetBatchFactorCmd((MD_SetBatchFactorCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].BatchFactor, 2);
+
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_SET_BATCH_FACTOR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ArmCaptureCmd_Test_InvalidTable(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Arm Capture cmd rejected due to invalid Tbl Id arg = %%d (Expect 1.. %%d)");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdArmCapture.Payload.TableId     = 1;
+    UT_CmdBuf.CmdArmCapture.Payload.EntryId     = 2;
+    UT_CmdBuf.CmdArmCapture.Payload.Condition   = MD_Capture_Conditions_EQUAL;
+    UT_CmdBuf.CmdArmCapture.Payload.PreTrigger  = 3;
+    UT_CmdBuf.CmdArmCapture.Payload.PostTrigger = 4;
+    UT_CmdBuf.CmdArmCapture.Payload.Value       = 5;
+    UT_CmdBuf.CmdArmCapture.Payload.Mask        = 0xFF;
+
+
+    /* Execute the function being tested */
+    MD_ArmCaptureCmd((MD_ArmCaptureCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_ValidCaptureEntry, 0);
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+    UtAssert_STUB_COUNT(MD_ArmCapture, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_ARM_CAPTURE_TABLE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ArmCaptureCmd_Test_InvalidEntry(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Arm Capture cmd rejected because Entry Id %%d of Dwell Tbl#%%d isn't an active 1, 2 or 4 byte dwell");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdArmCapture.Payload.TableId     = 1;
+    UT_CmdBuf.CmdArmCapture.Payload.EntryId     = 2;
+    UT_CmdBuf.CmdArmCapture.Payload.Condition   = MD_Capture_Conditions_EQUAL;
+    UT_CmdBuf.CmdArmCapture.Payload.PreTrigger  = 3;
+    UT_CmdBuf.CmdArmCapture.Payload.PostTrigger = 4;
+    UT_CmdBuf.CmdArmCapture.Payload.Value       = 5;
+    UT_CmdBuf.CmdArmCapture.Payload.Mask        = 0xFF;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+
+
+    /* Execute the function being tested */
+    MD_ArmCaptureCmd((MD_ArmCaptureCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+    UtAssert_STUB_COUNT(MD_ArmCapture, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_ARM_CAPTURE_ENTRY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ArmCaptureCmd_Test_InvalidCondition(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Arm Capture cmd rejected due to invalid condition %%d or mask 0x%%08X");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdArmCapture.Payload.TableId     = 1;
+    UT_CmdBuf.CmdArmCapture.Payload.EntryId     = 2;
+    UT_CmdBuf.CmdArmCapture.Payload.Condition   = MD_Capture_Conditions_EQUAL;
+    UT_CmdBuf.CmdArmCapture.Payload.PreTrigger  = 3;
+    UT_CmdBuf.CmdArmCapture.Payload.PostTrigger = 4;
+    UT_CmdBuf.CmdArmCapture.Payload.Value       = 5;
+    UT_CmdBuf.CmdArmCapture.Payload.Mask        = 0xFF;
+    UT_CmdBuf.CmdArmCapture.Payload.Condition   = MD_Capture_Conditions_CHANGED + 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidCaptureEntry), true);
+
+
+    /* Execute the function being tested */
+    MD_ArmCaptureCmd((MD_ArmCaptureCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+    UtAssert_STUB_COUNT(MD_ArmCapture, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_ARM_CAPTURE_COND_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ArmCaptureCmd_Test_ZeroMask(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Arm Capture cmd rejected due to invalid condition %%d or mask 0x%%08X");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdArmCapture.Payload.TableId     = 1;
+    UT_CmdBuf.CmdArmCapture.Payload.EntryId     = 2;
+    UT_CmdBuf.CmdArmCapture.Payload.Condition   = MD_Capture_Conditions_EQUAL;
+    UT_CmdBuf.CmdArmCapture.Payload.PreTrigger  = 3;
+    UT_CmdBuf.CmdArmCapture.Payload.PostTrigger = 4;
+    UT_CmdBuf.CmdArmCapture.Payload.Value       = 5;
+    UT_CmdBuf.CmdArmCapture.Payload.Mask        = 0xFF;
+    UT_CmdBuf.CmdArmCapture.Payload.Mask        = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidCaptureEntry), true);
+
+
+    /* Execute the function being tested */
+    MD_ArmCaptureCmd((MD_ArmCaptureCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+    UtAssert_STUB_COUNT(MD_ArmCapture, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_ARM_CAPTURE_COND_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ArmCaptureCmd_Test_InvalidSize(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Arm Capture cmd rejected because %%d+1+%%d cycles of %%d bytes exceed the %%d byte capture buffer");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdArmCapture.Payload.TableId     = 1;
+    UT_CmdBuf.CmdArmCapture.Payload.EntryId     = 2;
+    UT_CmdBuf.CmdArmCapture.Payload.Condition   = MD_Capture_Conditions_EQUAL;
+    UT_CmdBuf.CmdArmCapture.Payload.PreTrigger  = 3;
+    UT_CmdBuf.CmdArmCapture.Payload.PostTrigger = 4;
+    UT_CmdBuf.CmdArmCapture.Payload.Value       = 5;
+    UT_CmdBuf.CmdArmCapture.Payload.Mask        = 0xFF;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidCaptureEntry), true);
+
+
+    /* Execute the function being tested */
+    MD_ArmCaptureCmd((MD_ArmCaptureCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.ErrCounter == 1, "MD_AppData.ErrCounter == 1");
+    UtAssert_STUB_COUNT(MD_ArmCapture, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_ARM_CAPTURE_SIZE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ArmCaptureCmd_Test_NotWritten(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdArmCapture.Payload.TableId     = 1;
+    UT_CmdBuf.CmdArmCapture.Payload.EntryId     = 2;
+    UT_CmdBuf.CmdArmCapture.Payload.Condition   = MD_Capture_Conditions_EQUAL;
+    UT_CmdBuf.CmdArmCapture.Payload.PreTrigger  = 3;
+    UT_CmdBuf.CmdArmCapture.Payload.PostTrigger = 4;
+    UT_CmdBuf.CmdArmCapture.Payload.Value       = 5;
+    UT_CmdBuf.CmdArmCapture.Payload.Mask        = 0xFF;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidCaptureEntry), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidCaptureSize), true);
+
+    /* The main task hasn't written the previous capture of table 2 */
+    MD_AppData.Capture.State      = MD_CAPTURE_COMPLETE;
+    MD_AppData.Capture.TableIndex = 1;
+
+    /* Execute the function being tested */
+    MD_ArmCaptureCmd((MD_ArmCaptureCmd_t *)&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.ErrCounter, 1);
+    UtAssert_STUB_COUNT(MD_CancelCapture, 0);
+    UtAssert_STUB_COUNT(MD_ArmCapture, 0);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_COMPLETE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_ARM_CAPTURE_BUSY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MD_ArmCaptureCmd_Test_Triggered(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdArmCapture.Payload.TableId     = 1;
+    UT_CmdBuf.CmdArmCapture.Payload.EntryId     = 2;
+    UT_CmdBuf.CmdArmCapture.Payload.Condition   = MD_Capture_Conditions_EQUAL;
+    UT_CmdBuf.CmdArmCapture.Payload.PreTrigger  = 3;
+    UT_CmdBuf.CmdArmCapture.Payload.PostTrigger = 4;
+    UT_CmdBuf.CmdArmCapture.Payload.Value       = 5;
+    UT_CmdBuf.CmdArmCapture.Payload.Mask        = 0xFF;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidCaptureEntry), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidCaptureSize), true);
+
+    /* The capture of table 2 has triggered and is recording its post-trigger cycles */
+    MD_AppData.Capture.State      = MD_CAPTURE_TRIGGERED;
+    MD_AppData.Capture.TableIndex = 1;
+
+    /* Execute the function being tested */
+    MD_ArmCaptureCmd((MD_ArmCaptureCmd_t *)&UT_CmdBuf.Buf);
+
+    /* Verify results: the triggered capture is left to finish */
+    UtAssert_INT32_EQ(MD_AppData.ErrCounter, 1);
+    UtAssert_STUB_COUNT(MD_CancelCapture, 0);
+    UtAssert_STUB_COUNT(MD_ArmCapture, 0);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.State, MD_CAPTURE_TRIGGERED);
+    UtAssert_UINT32_EQ(MD_AppData.Capture.TableIndex, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_ARM_CAPTURE_BUSY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MD_ArmCaptureCmd_Test_Success(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Capture armed on Dwell Tbl#%%d Entry #%%d, condition %%d, %%d pre-trigger and %%d post-trigger cycles");
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    UT_CmdBuf.CmdArmCapture.Payload.TableId     = 1;
+    UT_CmdBuf.CmdArmCapture.Payload.EntryId     = 2;
+    UT_CmdBuf.CmdArmCapture.Payload.Condition   = MD_Capture_Conditions_EQUAL;
+    UT_CmdBuf.CmdArmCapture.Payload.PreTrigger  = 3;
+    UT_CmdBuf.CmdArmCapture.Payload.PostTrigger = 4;
+    UT_CmdBuf.CmdArmCapture.Payload.Value       = 5;
+    UT_CmdBuf.CmdArmCapture.Payload.Mask        = 0xFF;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidTableId), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidCaptureEntry), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidCaptureSize), true);
+
+
+    /* Execute the function being tested */
+    MD_ArmCaptureCmd((MD_ArmCaptureCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_CancelCapture, 1);
+    UtAssert_STUB_COUNT(MD_ArmCapture, 1);
+
+    UtAssert_True(MD_AppData.CmdCounter == 1, "MD_AppData.CmdCounter == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_ARM_CAPTURE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+uint8 MD_CMDS_TEST_ManagedTblIndex;
+
+int32 MD_CMDS_TEST_MD_ManageDwellTableHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                           const UT_StubContext_t *Context)
+{
+    MD_CMDS_TEST_ManagedTblIndex = UT_Hook_GetArgValueByName(Context, "TblIndex", uint8);
+
+    return StubRetcode;
+}
+
+void MD_TblManageCmd_Test_Nominal(void)
+{
+    UT_SetHookFunction(UT_KEY(MD_ManageDwellTable), MD_CMDS_TEST_MD_ManageDwellTableHook, NULL);
+
+    UT_CmdBuf.CmdTblManage.Payload.Parameter = MD_INTERFACE_NUM_DWELL_TABLES - 1;
+
+    /* Execute the function being tested */
+    MD_TblManageCmd((MD_TblManageCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_ManageDwellTable, 1);
+    UtAssert_UINT32_EQ(MD_CMDS_TEST_ManagedTblIndex, MD_INTERFACE_NUM_DWELL_TABLES - 1);
+
+    UtAssert_True(MD_AppData.CmdCounter == 0, "MD_AppData.CmdCounter == 0");
+    UtAssert_True(MD_AppData.ErrCounter == 0, "MD_AppData.ErrCounter == 0");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_TblManageCmd_Test_InvalidTable(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Table manage request for invalid Dwell Tbl index %%u");
+
+    UT_CmdBuf.CmdTblManage.Payload.Parameter = MD_INTERFACE_NUM_DWELL_TABLES;
+
+    /* Execute the function being tested */
+    MD_TblManageCmd((MD_TblManageCmd_t *) &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_ManageDwellTable, 0);
+
+    UtAssert_True(MD_AppData.ErrCounter == 0, "MD_AppData.ErrCounter == 0");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_TBL_MANAGE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(MD_NoopCmd_Test, MD_Test_Setup, MD_Test_TearDown, "MD_NoopCmd_Test");
     UtTest_Add(MD_ResetCountersCmd_Test, MD_Test_Setup, MD_Test_TearDown, "MD_ResetCountersCmd_Test");
+    UtTest_Add(MD_SendPerfHistCmd_Test, MD_Test_Setup, MD_Test_TearDown, "MD_SendPerfHistCmd_Test");
 
     UtTest_Add(MD_ProcessStartCmd_Test_ZeroRate, MD_Test_Setup, MD_Test_TearDown, "MD_ProcessStartCmd_Test_ZeroRate");
+    UtTest_Add(MD_ProcessStartCmd_Test_Timed, MD_Test_Setup, MD_Test_TearDown, "MD_ProcessStartCmd_Test_Timed");
     UtTest_Add(MD_ProcessStartCmd_Test_Success, MD_Test_Setup, MD_Test_TearDown, "MD_ProcessStartCmd_Test_Success");
     UtTest_Add(MD_ProcessStartCmd_Test_EmptyTableMask, MD_Test_Setup, MD_Test_TearDown,
                "MD_ProcessStartCmd_Test_EmptyTableMask");
+    UtTest_Add(MD_ProcessStartCmd_Test_MaskOffset, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ProcessStartCmd_Test_MaskOffset");
     UtTest_Add(MD_ProcessStartCmd_Test_NoUpdateTableEnabledField, MD_Test_Setup, MD_Test_TearDown,
                "MD_ProcessStartCmd_Test_NoUpdateTableEnabledField");
 
     UtTest_Add(MD_ProcessStopCmd_Test_Success, MD_Test_Setup, MD_Test_TearDown, "MD_ProcessStopCmd_Test_Success");
     UtTest_Add(MD_ProcessStopCmd_Test_EmptyTableMask, MD_Test_Setup, MD_Test_TearDown,
                "MD_ProcessStopCmd_Test_EmptyTableMask");
+    UtTest_Add(MD_ProcessStopCmd_Test_MaskOffsetPastLastTable, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ProcessStopCmd_Test_MaskOffsetPastLastTable");
     UtTest_Add(MD_ProcessStopCmd_Test_NoUpdateTableEnabledField, MD_Test_Setup, MD_Test_TearDown,
                "MD_ProcessStopCmd_Test_NoUpdateTableEnabledField");
 
@@ -1403,8 +2493,16 @@ void UtTest_Setup(void)
 
     UtTest_Add(MD_ProcessJamCmd_Test_JamAddrNot16BitFieldLength2, MD_Test_Setup, MD_Test_TearDown,
                "MD_ProcessJamCmd_Test_JamAddrNot16BitFieldLength2");
+    UtTest_Add(MD_ProcessJamCmd_Test_DataSizeTooLarge, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ProcessJamCmd_Test_DataSizeTooLarge");
+    UtTest_Add(MD_ProcessJamCmd_Test_BatchSizeTooLarge, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ProcessJamCmd_Test_BatchSizeTooLarge");
+    UtTest_Add(MD_ProcessJamCmd_Test_SuccessBlockLength, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ProcessJamCmd_Test_SuccessBlockLength");
+#if MD_INTERFACE_ENFORCE_DWORD_ALIGN == 1
     UtTest_Add(MD_ProcessJamCmd_Test_JamAddrNot16BitNot32Aligned, MD_Test_Setup, MD_Test_TearDown,
                "MD_ProcessJamCmd_Test_JamAddrNot16BitNot32Aligned");
+#endif
     UtTest_Add(MD_ProcessJamCmd_Test_JamFieldLength4Addr32Aligned, MD_Test_Setup, MD_Test_TearDown,
                "MD_ProcessJamCmd_Test_JamFieldLength4Addr32Aligned");
     UtTest_Add(MD_ProcessJamCmd_Test_SuccessNonNullZeroRate, MD_Test_Setup, MD_Test_TearDown,
@@ -1413,6 +2511,25 @@ void UtTest_Setup(void)
                "MD_ProcessJamCmd_Test_SuccessZeroRateStreamDisabled");
     UtTest_Add(MD_ProcessJamCmd_Test_SuccessRateNotZero, MD_Test_Setup, MD_Test_TearDown,
                "MD_ProcessJamCmd_Test_SuccessRateNotZero");
+    UtTest_Add(MD_JamMultiDwellCmd_Test_InvalidTable, MD_Test_Setup, MD_Test_TearDown,
+               "MD_JamMultiDwellCmd_Test_InvalidTable");
+    UtTest_Add(MD_JamMultiDwellCmd_Test_InvalidCount, MD_Test_Setup, MD_Test_TearDown,
+               "MD_JamMultiDwellCmd_Test_InvalidCount");
+    UtTest_Add(MD_JamMultiDwellCmd_Test_InvalidEntryId, MD_Test_Setup, MD_Test_TearDown,
+               "MD_JamMultiDwellCmd_Test_InvalidEntryId");
+    UtTest_Add(MD_JamMultiDwellCmd_Test_CantResolveAddr, MD_Test_Setup, MD_Test_TearDown,
+               "MD_JamMultiDwellCmd_Test_CantResolveAddr");
+    UtTest_Add(MD_JamMultiDwellCmd_Test_DataSizeTooLarge, MD_Test_Setup, MD_Test_TearDown,
+               "MD_JamMultiDwellCmd_Test_DataSizeTooLarge");
+    UtTest_Add(MD_JamMultiDwellCmd_Test_BatchSizeTooLarge, MD_Test_Setup, MD_Test_TearDown,
+               "MD_JamMultiDwellCmd_Test_BatchSizeTooLarge");
+    UtTest_Add(MD_JamMultiDwellCmd_Test_NoUpdateTableDwellEntries, MD_Test_Setup, MD_Test_TearDown,
+               "MD_JamMultiDwellCmd_Test_NoUpdateTableDwellEntries");
+    UtTest_Add(MD_JamMultiDwellCmd_Test_Success, MD_Test_Setup, MD_Test_TearDown,
+               "MD_JamMultiDwellCmd_Test_Success");
+    UtTest_Add(MD_JamMultiDwellCmd_Test_SuccessZeroRate, MD_Test_Setup, MD_Test_TearDown,
+               "MD_JamMultiDwellCmd_Test_SuccessZeroRate");
+
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     UtTest_Add(MD_ProcessSignatureCmd_Test_InvalidSignatureLength, MD_Test_Setup, MD_Test_TearDown,
                "MD_ProcessSignatureCmd_Test_InvalidSignatureLength");
@@ -1423,4 +2540,35 @@ void UtTest_Setup(void)
     UtTest_Add(MD_ProcessSignatureCmd_Test_NoUpdateTableSignature, MD_Test_Setup, MD_Test_TearDown,
                "MD_ProcessSignatureCmd_Test_NoUpdateTableSignature");
 #endif
+
+    UtTest_Add(MD_SetBatchFactorCmd_Test_InvalidTable, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SetBatchFactorCmd_Test_InvalidTable");
+    UtTest_Add(MD_SetBatchFactorCmd_Test_InvalidBatchFactor, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SetBatchFactorCmd_Test_InvalidBatchFactor");
+    UtTest_Add(MD_SetBatchFactorCmd_Test_Success, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SetBatchFactorCmd_Test_Success");
+    UtTest_Add(MD_SetBatchFactorCmd_Test_NoUpdateTableBatchFactor, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SetBatchFactorCmd_Test_NoUpdateTableBatchFactor");
+
+    UtTest_Add(MD_ArmCaptureCmd_Test_InvalidTable, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ArmCaptureCmd_Test_InvalidTable");
+    UtTest_Add(MD_ArmCaptureCmd_Test_InvalidEntry, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ArmCaptureCmd_Test_InvalidEntry");
+    UtTest_Add(MD_ArmCaptureCmd_Test_InvalidCondition, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ArmCaptureCmd_Test_InvalidCondition");
+    UtTest_Add(MD_ArmCaptureCmd_Test_ZeroMask, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ArmCaptureCmd_Test_ZeroMask");
+    UtTest_Add(MD_ArmCaptureCmd_Test_InvalidSize, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ArmCaptureCmd_Test_InvalidSize");
+    UtTest_Add(MD_ArmCaptureCmd_Test_NotWritten, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ArmCaptureCmd_Test_NotWritten");
+    UtTest_Add(MD_ArmCaptureCmd_Test_Triggered, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ArmCaptureCmd_Test_Triggered");
+    UtTest_Add(MD_ArmCaptureCmd_Test_Success, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ArmCaptureCmd_Test_Success");
+
+    UtTest_Add(MD_TblManageCmd_Test_Nominal, MD_Test_Setup, MD_Test_TearDown,
+               "MD_TblManageCmd_Test_Nominal");
+    UtTest_Add(MD_TblManageCmd_Test_InvalidTable, MD_Test_Setup, MD_Test_TearDown,
+               "MD_TblManageCmd_Test_InvalidTable");
 }
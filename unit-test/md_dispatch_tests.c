@@ -26,6 +26,7 @@
 #include "md_eventids.h"
 #include "md_version.h"
 #include "md_dwell_pkt.h"
+#include "md_perf.h"
 
 #include "md_test_utils.h"
 
@@ -36,6 +37,7 @@
 
 #include <unistd.h>
 #include <stdlib.h>
+#include <stddef.h>
 
 /*
  * Helper functions
@@ -345,6 +347,183 @@ void MD_ExecRequest_Test_SetSignature(void)
 }
 #endif
 
+void MD_ExecRequest_Test_SetBatchFactor(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+    uint8             call_count_MD_SetBatchFactorCmd;
+    uint8             call_count_CFE_EVS_SendEvent;
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    FcnCode   = MD_SET_BATCH_FACTOR_CC;
+    MsgSize   = sizeof(MD_SetBatchFactorCmd_t);
+    MD_Dispatch_Test_SetupMsg(TestMsgId, FcnCode, MsgSize);
+    
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(MD_ExecRequest(&UT_CmdBuf.Buf));
+    
+    /* Verify the command handler was called */
+    call_count_MD_SetBatchFactorCmd = UT_GetStubCount(UT_KEY(MD_SetBatchFactorCmd));
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    
+    UtAssert_True(call_count_MD_SetBatchFactorCmd == 1, "MD_SetBatchFactorCmd was called %u time(s), expected 1",
+                  call_count_MD_SetBatchFactorCmd);
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ExecRequest_Test_ArmCapture(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+    uint8             call_count_MD_ArmCaptureCmd;
+    uint8             call_count_CFE_EVS_SendEvent;
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    FcnCode   = MD_ARM_CAPTURE_CC;
+    MsgSize   = sizeof(MD_ArmCaptureCmd_t);
+    MD_Dispatch_Test_SetupMsg(TestMsgId, FcnCode, MsgSize);
+    
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(MD_ExecRequest(&UT_CmdBuf.Buf));
+    
+    /* Verify the command handler was called */
+    call_count_MD_ArmCaptureCmd = UT_GetStubCount(UT_KEY(MD_ArmCaptureCmd));
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    
+    UtAssert_True(call_count_MD_ArmCaptureCmd == 1, "MD_ArmCaptureCmd was called %u time(s), expected 1",
+                  call_count_MD_ArmCaptureCmd);
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ExecRequest_Test_TblManage(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+    uint8             call_count_MD_TblManageCmd;
+    uint8             call_count_CFE_EVS_SendEvent;
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    FcnCode   = MD_TBL_MANAGE_CC;
+    MsgSize   = sizeof(MD_TblManageCmd_t);
+    MD_Dispatch_Test_SetupMsg(TestMsgId, FcnCode, MsgSize);
+    
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(MD_ExecRequest(&UT_CmdBuf.Buf));
+    
+    /* Verify the command handler was called */
+    call_count_MD_TblManageCmd = UT_GetStubCount(UT_KEY(MD_TblManageCmd));
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    
+    UtAssert_True(call_count_MD_TblManageCmd == 1, "MD_TblManageCmd was called %u time(s), expected 1",
+                  call_count_MD_TblManageCmd);
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+    /* Table management is timed by the main task, not as a command */
+    UtAssert_STUB_COUNT(MD_PerfBegin, 0);
+    UtAssert_STUB_COUNT(MD_PerfEnd, 0);
+}
+
+void MD_ExecRequest_Test_SendPerfHist(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    FcnCode   = MD_SEND_PERF_HIST_CC;
+    MsgSize   = sizeof(MD_SendPerfHistCmd_t);
+    MD_Dispatch_Test_SetupMsg(TestMsgId, FcnCode, MsgSize);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(MD_ExecRequest(&UT_CmdBuf.Buf));
+
+    /* Verify the command handler was called and timed */
+    UtAssert_STUB_COUNT(MD_SendPerfHistCmd, 1);
+    UtAssert_STUB_COUNT(MD_PerfBegin, 1);
+    UtAssert_STUB_COUNT(MD_PerfEnd, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_ExecRequest_Test_JamMultiDwell(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+
+    /* Only the entries in use are sent */
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries = 2;
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    FcnCode   = MD_JAM_MULTI_DWELL_CC;
+    MsgSize   = offsetof(MD_JamMultiDwellCmd_t, Payload.Entry) + (2 * sizeof(MD_JamMultiEntry_t));
+    MD_Dispatch_Test_SetupMsg(TestMsgId, FcnCode, MsgSize);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(MD_ExecRequest(&UT_CmdBuf.Buf));
+
+    /* Verify the command handler was called */
+    UtAssert_STUB_COUNT(MD_JamMultiDwellCmd, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_ExecRequest_Test_JamMultiDwellBadLength(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+
+    /* Length of a full command that claims fewer entries */
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries = 1;
+
+    TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+    FcnCode   = MD_JAM_MULTI_DWELL_CC;
+    MsgSize   = sizeof(MD_JamMultiDwellCmd_t);
+    MD_Dispatch_Test_SetupMsg(TestMsgId, FcnCode, MsgSize);
+
+    MD_AppData.ErrCounter = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(MD_ExecRequest(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_JamMultiDwellCmd, 0);
+    UtAssert_UINT32_EQ(MD_AppData.ErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_CMD_LEN_ERR_EID);
+}
+
+void MD_ExpectedCmdLength_Test(void)
+{
+    int16  CmdIndx;
+    size_t FixedLength = offsetof(MD_JamMultiDwellCmd_t, Payload.Entry);
+
+    /* Fixed length commands use the table */
+    CmdIndx = MD_SearchCmdHndlrTbl(MD_NOOP_CC);
+    UtAssert_UINT32_EQ(MD_ExpectedCmdLength(&UT_CmdBuf.Buf, sizeof(MD_NoopCmd_t), CmdIndx), sizeof(MD_NoopCmd_t));
+
+    CmdIndx = MD_SearchCmdHndlrTbl(MD_JAM_MULTI_DWELL_CC);
+
+    /* Too short to hold the entry count */
+    UtAssert_UINT32_EQ(MD_ExpectedCmdLength(&UT_CmdBuf.Buf, FixedLength - 1, CmdIndx), sizeof(MD_JamMultiDwellCmd_t));
+
+    /* Length follows the entry count */
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries = 0;
+    UtAssert_UINT32_EQ(MD_ExpectedCmdLength(&UT_CmdBuf.Buf, FixedLength, CmdIndx), FixedLength);
+
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries = MD_INTERFACE_MAX_JAM_ENTRIES;
+    UtAssert_UINT32_EQ(MD_ExpectedCmdLength(&UT_CmdBuf.Buf, FixedLength, CmdIndx), sizeof(MD_JamMultiDwellCmd_t));
+
+    /* A count that is too large expects a full command */
+    UT_CmdBuf.CmdJamMulti.Payload.NumEntries = MD_INTERFACE_MAX_JAM_ENTRIES + 1;
+    UtAssert_UINT32_EQ(MD_ExpectedCmdLength(&UT_CmdBuf.Buf, FixedLength, CmdIndx), sizeof(MD_JamMultiDwellCmd_t));
+}
+
 void MD_ExecRequest_Test_InvalidCommandCode(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
@@ -440,8 +619,15 @@ void UtTest_Setup(void)
     UtTest_Add(MD_ExecRequest_Test_SetSignature, MD_Test_Setup, MD_Test_TearDown, "MD_ExecRequest_Test_SetSignature");
 #endif
     
+    UtTest_Add(MD_ExecRequest_Test_SetBatchFactor, MD_Test_Setup, MD_Test_TearDown, "MD_ExecRequest_Test_SetBatchFactor");
+    UtTest_Add(MD_ExecRequest_Test_ArmCapture, MD_Test_Setup, MD_Test_TearDown, "MD_ExecRequest_Test_ArmCapture");
+    UtTest_Add(MD_ExecRequest_Test_TblManage, MD_Test_Setup, MD_Test_TearDown, "MD_ExecRequest_Test_TblManage");
+    UtTest_Add(MD_ExecRequest_Test_JamMultiDwell, MD_Test_Setup, MD_Test_TearDown, "MD_ExecRequest_Test_JamMultiDwell");
+    UtTest_Add(MD_ExecRequest_Test_JamMultiDwellBadLength, MD_Test_Setup, MD_Test_TearDown, "MD_ExecRequest_Test_JamMultiDwellBadLength");
+    UtTest_Add(MD_ExecRequest_Test_SendPerfHist, MD_Test_Setup, MD_Test_TearDown, "MD_ExecRequest_Test_SendPerfHist");
     UtTest_Add(MD_ExecRequest_Test_InvalidCommandCode, MD_Test_Setup, MD_Test_TearDown, "MD_ExecRequest_Test_InvalidCommandCode");
     UtTest_Add(MD_ExecRequest_Test_InvalidMsgLength, MD_Test_Setup, MD_Test_TearDown, "MD_ExecRequest_Test_InvalidMsgLength");
     
     UtTest_Add(MD_SearchCmdHndlrTbl_Test, MD_Test_Setup, MD_Test_TearDown, "MD_SearchCmdHndlrTbl_Test");
+    UtTest_Add(MD_ExpectedCmdLength_Test, MD_Test_Setup, MD_Test_TearDown, "MD_ExpectedCmdLength_Test");
 }
\ No newline at end of file
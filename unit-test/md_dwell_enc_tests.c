@@ -0,0 +1,270 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "md_dwell_enc.h"
+#include "md_app.h"
+#include "md_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/*
+ * Size of the dwell data used by the round trip tests, large enough for
+ * runs and literals longer than one header byte can describe
+ */
+#define MD_DWELL_ENC_TEST_DATA_SIZE 300
+
+/* md_dwell_enc_tests globals */
+uint8 MD_DWELL_ENC_TEST_Data[MD_DWELL_ENC_TEST_DATA_SIZE];
+uint8 MD_DWELL_ENC_TEST_Ref[MD_DWELL_ENC_TEST_DATA_SIZE];
+uint8 MD_DWELL_ENC_TEST_Decoded[MD_DWELL_ENC_TEST_DATA_SIZE];
+uint8 MD_DWELL_ENC_TEST_Enc[MD_DWELL_ENC_TEST_DATA_SIZE + ((MD_DWELL_ENC_TEST_DATA_SIZE + 127) / 128)];
+
+/*
+ * Function Definitions
+ */
+
+/* Fills the reference with bytes that never repeat back to back */
+void MD_DWELL_ENC_TEST_SetupRef(void)
+{
+    uint16 i;
+
+    for (i = 0; i < MD_DWELL_ENC_TEST_DATA_SIZE; i++)
+    {
+        MD_DWELL_ENC_TEST_Ref[i] = (uint8)((i * 7) + 1);
+    }
+
+    memcpy(MD_DWELL_ENC_TEST_Data, MD_DWELL_ENC_TEST_Ref, sizeof(MD_DWELL_ENC_TEST_Data));
+    memset(MD_DWELL_ENC_TEST_Decoded, 0xA5, sizeof(MD_DWELL_ENC_TEST_Decoded));
+}
+
+void MD_EncodeDwellData_Test_Unchanged(void)
+{
+    uint16 EncodedSize;
+
+    MD_DWELL_ENC_TEST_SetupRef();
+
+    /* Execute the function being tested */
+    EncodedSize = MD_EncodeDwellData(MD_DWELL_ENC_TEST_Enc, MD_DWELL_ENC_TEST_Data, MD_DWELL_ENC_TEST_Ref,
+                                     MD_DWELL_ENC_TEST_DATA_SIZE);
+
+    /* Verify results, 300 zeros take runs of 128, 128 and 44 */
+    UtAssert_INT32_EQ(EncodedSize, 6);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[0], 257 - 128);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[1], 0);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[4], 257 - 44);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[5], 0);
+
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Ref, MD_DWELL_ENC_TEST_DATA_SIZE,
+                                         MD_DWELL_ENC_TEST_Enc, EncodedSize),
+                      CFE_SUCCESS);
+    UtAssert_MemCmp(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Data, MD_DWELL_ENC_TEST_DATA_SIZE, "Decoded data");
+}
+
+void MD_EncodeDwellData_Test_SparseChange(void)
+{
+    uint16 EncodedSize;
+
+    MD_DWELL_ENC_TEST_SetupRef();
+    MD_DWELL_ENC_TEST_Data[10]++;
+    MD_DWELL_ENC_TEST_Data[11] ^= 0x80;
+    MD_DWELL_ENC_TEST_Data[MD_DWELL_ENC_TEST_DATA_SIZE - 1] = 0;
+
+    /* Execute the function being tested */
+    EncodedSize = MD_EncodeDwellData(MD_DWELL_ENC_TEST_Enc, MD_DWELL_ENC_TEST_Data, MD_DWELL_ENC_TEST_Ref,
+                                     MD_DWELL_ENC_TEST_DATA_SIZE);
+
+    /* Verify results: run of 10, 2 literals, runs of 128, 128 and 31, 1 literal */
+    UtAssert_INT32_EQ(EncodedSize, 2 + 3 + 2 + 2 + 2 + 2);
+
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Ref, MD_DWELL_ENC_TEST_DATA_SIZE,
+                                         MD_DWELL_ENC_TEST_Enc, EncodedSize),
+                      CFE_SUCCESS);
+    UtAssert_MemCmp(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Data, MD_DWELL_ENC_TEST_DATA_SIZE, "Decoded data");
+}
+
+void MD_EncodeDwellData_Test_Keyframe(void)
+{
+    uint16 EncodedSize;
+
+    MD_DWELL_ENC_TEST_SetupRef();
+    memset(MD_DWELL_ENC_TEST_Ref, 0, sizeof(MD_DWELL_ENC_TEST_Ref));
+
+    /* Execute the function being tested */
+    EncodedSize = MD_EncodeDwellData(MD_DWELL_ENC_TEST_Enc, MD_DWELL_ENC_TEST_Data, MD_DWELL_ENC_TEST_Ref,
+                                     MD_DWELL_ENC_TEST_DATA_SIZE);
+
+    /* Verify results, data that never repeats is the worst case */
+    UtAssert_INT32_EQ(EncodedSize, sizeof(MD_DWELL_ENC_TEST_Enc));
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[0], 127);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[1], MD_DWELL_ENC_TEST_Data[0]);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[129], 127);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[258], 43);
+
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Ref, MD_DWELL_ENC_TEST_DATA_SIZE,
+                                         MD_DWELL_ENC_TEST_Enc, EncodedSize),
+                      CFE_SUCCESS);
+    UtAssert_MemCmp(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Data, MD_DWELL_ENC_TEST_DATA_SIZE, "Decoded data");
+}
+
+void MD_EncodeDwellData_Test_ShortRuns(void)
+{
+    uint16 EncodedSize;
+    uint8  Data[8] = {1, 1, 2, 2, 3, 3, 3, 4};
+    uint8  Ref[8]  = {0};
+
+    /* Execute the function being tested */
+    EncodedSize = MD_EncodeDwellData(MD_DWELL_ENC_TEST_Enc, Data, Ref, sizeof(Data));
+
+    /* Verify results, pairs are copied and the run of 3 is encoded */
+    UtAssert_INT32_EQ(EncodedSize, 5 + 2 + 2);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[0], 3);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[5], 257 - 3);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[6], 3);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[7], 0);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[8], 4);
+
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, Ref, sizeof(Data), MD_DWELL_ENC_TEST_Enc,
+                                         EncodedSize),
+                      CFE_SUCCESS);
+    UtAssert_MemCmp(MD_DWELL_ENC_TEST_Decoded, Data, sizeof(Data), "Decoded data");
+}
+
+void MD_EncodeDwellData_Test_Empty(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_EncodeDwellData(MD_DWELL_ENC_TEST_Enc, MD_DWELL_ENC_TEST_Data, MD_DWELL_ENC_TEST_Ref, 0), 0);
+
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Ref, 0, MD_DWELL_ENC_TEST_Enc, 0),
+                      CFE_SUCCESS);
+}
+
+void MD_EncodeDwellLiterals_Test(void)
+{
+    uint8 Data[3] = {0x12, 0x34, 0x56};
+    uint8 Ref[3]  = {0x10, 0x34, 0xFF};
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_EncodeDwellLiterals(MD_DWELL_ENC_TEST_Enc, Data, Ref, sizeof(Data)), 4);
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[0], 2);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[1], 0x02);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[2], 0x00);
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Enc[3], 0xA9);
+
+    UtAssert_INT32_EQ(MD_EncodeDwellLiterals(MD_DWELL_ENC_TEST_Enc, Data, Ref, 0), 0);
+}
+
+void MD_DecodeDwellData_Test_InPlace(void)
+{
+    uint16 EncodedSize;
+    uint16 Cycle;
+
+    MD_DWELL_ENC_TEST_SetupRef();
+    memset(MD_DWELL_ENC_TEST_Decoded, 0, sizeof(MD_DWELL_ENC_TEST_Decoded));
+    memset(MD_DWELL_ENC_TEST_Ref, 0, sizeof(MD_DWELL_ENC_TEST_Ref));
+
+    /* A keyframe followed by cycles encoded against the one before, decoded over the last */
+    for (Cycle = 0; Cycle < 4; Cycle++)
+    {
+        MD_DWELL_ENC_TEST_Data[Cycle * 50] += Cycle + 1;
+
+        EncodedSize = MD_EncodeDwellData(MD_DWELL_ENC_TEST_Enc, MD_DWELL_ENC_TEST_Data, MD_DWELL_ENC_TEST_Ref,
+                                         MD_DWELL_ENC_TEST_DATA_SIZE);
+        memcpy(MD_DWELL_ENC_TEST_Ref, MD_DWELL_ENC_TEST_Data, sizeof(MD_DWELL_ENC_TEST_Ref));
+
+        UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Decoded,
+                                             MD_DWELL_ENC_TEST_DATA_SIZE, MD_DWELL_ENC_TEST_Enc, EncodedSize),
+                          CFE_SUCCESS);
+        UtAssert_MemCmp(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Data, MD_DWELL_ENC_TEST_DATA_SIZE,
+                        "Decoded data");
+    }
+}
+
+void MD_DecodeDwellData_Test_SkipHeader(void)
+{
+    uint8 Enc[5] = {128, 0, 0x11, 128, 128};
+    uint8 Ref[1] = {0x01};
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, Ref, sizeof(Ref), Enc, sizeof(Enc)), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(MD_DWELL_ENC_TEST_Decoded[0], 0x10);
+}
+
+void MD_DecodeDwellData_Test_Truncated(void)
+{
+    uint8 Literal[3] = {3, 0, 0};
+    uint8 Run[1]     = {257 - 4};
+
+    MD_DWELL_ENC_TEST_SetupRef();
+
+    /* Execute the function being tested, literals and run value cut off */
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Ref, 4, Literal, sizeof(Literal)),
+                      MD_DECODE_ERROR);
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Ref, 4, Run, sizeof(Run)),
+                      MD_DECODE_ERROR);
+}
+
+void MD_DecodeDwellData_Test_WrongSize(void)
+{
+    uint8 Enc[4] = {257 - 4, 0, 0, 0x55};
+
+    MD_DWELL_ENC_TEST_SetupRef();
+
+    /* Execute the function being tested, run then literal decodes to 5 bytes */
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Ref, 6, Enc, sizeof(Enc)),
+                      MD_DECODE_ERROR);
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Ref, 4, Enc, sizeof(Enc)),
+                      MD_DECODE_ERROR);
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Ref, 3, Enc, sizeof(Enc)),
+                      MD_DECODE_ERROR);
+    UtAssert_INT32_EQ(MD_DecodeDwellData(MD_DWELL_ENC_TEST_Decoded, MD_DWELL_ENC_TEST_Ref, 5, Enc, sizeof(Enc)),
+                      CFE_SUCCESS);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(MD_EncodeDwellData_Test_Unchanged, MD_Test_Setup, MD_Test_TearDown,
+               "MD_EncodeDwellData_Test_Unchanged");
+    UtTest_Add(MD_EncodeDwellData_Test_SparseChange, MD_Test_Setup, MD_Test_TearDown,
+               "MD_EncodeDwellData_Test_SparseChange");
+    UtTest_Add(MD_EncodeDwellData_Test_Keyframe, MD_Test_Setup, MD_Test_TearDown, "MD_EncodeDwellData_Test_Keyframe");
+    UtTest_Add(MD_EncodeDwellData_Test_ShortRuns, MD_Test_Setup, MD_Test_TearDown,
+               "MD_EncodeDwellData_Test_ShortRuns");
+    UtTest_Add(MD_EncodeDwellData_Test_Empty, MD_Test_Setup, MD_Test_TearDown, "MD_EncodeDwellData_Test_Empty");
+
+    UtTest_Add(MD_EncodeDwellLiterals_Test, MD_Test_Setup, MD_Test_TearDown, "MD_EncodeDwellLiterals_Test");
+
+    UtTest_Add(MD_DecodeDwellData_Test_InPlace, MD_Test_Setup, MD_Test_TearDown, "MD_DecodeDwellData_Test_InPlace");
+    UtTest_Add(MD_DecodeDwellData_Test_SkipHeader, MD_Test_Setup, MD_Test_TearDown,
+               "MD_DecodeDwellData_Test_SkipHeader");
+    UtTest_Add(MD_DecodeDwellData_Test_Truncated, MD_Test_Setup, MD_Test_TearDown,
+               "MD_DecodeDwellData_Test_Truncated");
+    UtTest_Add(MD_DecodeDwellData_Test_WrongSize, MD_Test_Setup, MD_Test_TearDown,
+               "MD_DecodeDwellData_Test_WrongSize");
+}
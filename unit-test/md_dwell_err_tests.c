@@ -0,0 +1,334 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "md_dwell_err.h"
+#include "md_dwell_pkt.h"
+#include "md_app.h"
+#include "md_eventids.h"
+#include "md_internal_cfg.h"
+#include "md_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/*
+ * Function Definitions
+ */
+
+/* Sets up table 0 with four 4 byte entries read as one block */
+void MD_DWELL_ERR_TEST_SetupBlock(void)
+{
+    MD_DwellControlEntry_t *EntryPtr = MD_AppData.MD_DwellTables[0].Entry;
+    uint16                  EntryIndex;
+
+    MD_AppData.MD_DwellTables[0].AddrCount = 4;
+
+    for (EntryIndex = 0; EntryIndex < 4; EntryIndex++)
+    {
+        EntryPtr[EntryIndex].Length       = 4;
+        EntryPtr[EntryIndex].BlockEntries = 4 - EntryIndex;
+        EntryPtr[EntryIndex].BlockBytes   = 4 * (4 - EntryIndex);
+    }
+}
+
+void MD_DwellReadFailed_Test_Backoff(void)
+{
+    MD_DwellReadErrEntry_t *ErrPtr = &MD_AppData.DwellReportControl[0].ReadErr[2];
+    uint16                  Failure;
+
+    /* Execute the function being tested */
+    for (Failure = 0; Failure < 5; Failure++)
+    {
+        MD_DwellReadFailed(0, 2);
+    }
+
+    /* Verify results: the 1st, 2nd and 4th failures were reported */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_DWELL_LOOP_GET_DWELL_DATA_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, MD_DWELL_LOOP_GET_DWELL_DATA_ERR_EID);
+    UtAssert_UINT32_EQ(MD_AppData.ReadErrSummary.UnreportedCount, 2);
+
+    UtAssert_UINT32_EQ(ErrPtr->ErrCount, 5);
+    UtAssert_UINT32_EQ(ErrPtr->FailRun, 5);
+    UtAssert_UINT32_EQ(ErrPtr->NextEventCount, 8);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].FailingEntries, 1);
+}
+
+void MD_DwellReadFailed_Test_Saturated(void)
+{
+    MD_DwellReadErrEntry_t *ErrPtr = &MD_AppData.DwellReportControl[0].ReadErr[0];
+
+    ErrPtr->ErrCount       = 0xFFFFFFFE;
+    ErrPtr->NextEventCount = 0xFFFFFFFF;
+    ErrPtr->FailRun        = 0xFFFFFFFF;
+    ErrPtr->Quarantined    = true;
+
+    MD_AppData.MD_DwellTables[0].FailingEntries = 1;
+
+    /* Execute the function being tested */
+    MD_DwellReadFailed(0, 0);
+    MD_DwellReadFailed(0, 0);
+
+    /* Verify results: counts stop at their largest value */
+    UtAssert_UINT32_EQ(ErrPtr->ErrCount, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(ErrPtr->FailRun, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(ErrPtr->NextEventCount, 0xFFFFFFFF);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].FailingEntries, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void MD_DwellReadFailed_Test_Quarantine(void)
+{
+#if MD_INTERNAL_READ_ERR_QUARANTINE_COUNT != 0
+    MD_DwellReadErrEntry_t *ErrPtr = &MD_AppData.DwellReportControl[0].ReadErr[2];
+
+    MD_DWELL_ERR_TEST_SetupBlock();
+
+    /* One failure short of quarantine, with its next event still far off */
+    ErrPtr->ErrCount       = MD_INTERNAL_READ_ERR_QUARANTINE_COUNT - 1;
+    ErrPtr->NextEventCount = 0xFFFFFFFF;
+    ErrPtr->FailRun        = MD_INTERNAL_READ_ERR_QUARANTINE_COUNT - 1;
+
+    MD_AppData.MD_DwellTables[0].FailingEntries = 1;
+
+    /* Execute the function being tested */
+    MD_DwellReadFailed(0, 2);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(ErrPtr->Quarantined);
+    UtAssert_INT32_EQ(MD_AppData.DwellReportControl[0].QuarantinedEntries, 1);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].FailingEntries, 1);
+    UtAssert_UINT32_EQ(MD_AppData.ReadErrSummary.UnreportedCount, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_READ_ERR_QUARANTINE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* The entry was taken out of its block */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[0].BlockEntries, 2);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[0].BlockBytes, 8);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[2].BlockEntries, 1);
+
+    /* Failing the retry quarantines it again without another event */
+    ErrPtr->Quarantined                                 = false;
+    MD_AppData.DwellReportControl[0].QuarantinedEntries = 0;
+
+    MD_DwellReadFailed(0, 2);
+
+    UtAssert_BOOL_TRUE(ErrPtr->Quarantined);
+    UtAssert_INT32_EQ(MD_AppData.DwellReportControl[0].QuarantinedEntries, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+#endif
+}
+
+void MD_DwellReadsSucceeded_Test(void)
+{
+    MD_DwellReadErrEntry_t *ErrPtr = MD_AppData.DwellReportControl[0].ReadErr;
+
+    ErrPtr[0].ErrCount    = 3;
+    ErrPtr[0].FailRun     = 3;
+    ErrPtr[1].ErrCount    = 20;
+    ErrPtr[1].FailRun     = 20;
+    ErrPtr[1].Quarantined = true;
+
+    MD_AppData.MD_DwellTables[0].FailingEntries = 2;
+
+    /* Execute the function being tested */
+    MD_DwellReadsSucceeded(0, 0, 2);
+
+    /* Verify results: the quarantined entry wasn't read */
+    UtAssert_UINT32_EQ(ErrPtr[0].FailRun, 0);
+    UtAssert_UINT32_EQ(ErrPtr[0].ErrCount, 3);
+    UtAssert_UINT32_EQ(ErrPtr[1].FailRun, 20);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].FailingEntries, 1);
+    UtAssert_STUB_COUNT(MD_CompileDwellPlan, 0);
+}
+
+void MD_DwellReadsSucceeded_Test_Recovered(void)
+{
+    MD_DwellReadErrEntry_t *ErrPtr   = MD_AppData.DwellReportControl[0].ReadErr;
+    MD_DwellControlEntry_t *EntryPtr = MD_AppData.MD_DwellTables[0].Entry;
+
+    MD_DWELL_ERR_TEST_SetupBlock();
+
+    /* Entry 1 is on its retry, entry 3 is still quarantined */
+    ErrPtr[1].FailRun     = MD_INTERNAL_READ_ERR_QUARANTINE_COUNT;
+    ErrPtr[3].FailRun     = MD_INTERNAL_READ_ERR_QUARANTINE_COUNT + 1;
+    ErrPtr[3].Quarantined = true;
+
+    MD_AppData.MD_DwellTables[0].FailingEntries = 2;
+
+    /* Execute the function being tested */
+    MD_DwellReadsSucceeded(0, 1, 1);
+
+    /* Verify results: the plan is compiled again, split only around entry 3 */
+    UtAssert_UINT32_EQ(ErrPtr[1].FailRun, 0);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].FailingEntries, 1);
+    UtAssert_STUB_COUNT(MD_CompileDwellPlan, 1);
+    UtAssert_INT32_EQ(EntryPtr[0].BlockEntries, 3);
+    UtAssert_INT32_EQ(EntryPtr[0].BlockBytes, 12);
+    UtAssert_INT32_EQ(EntryPtr[1].BlockEntries, 2);
+    UtAssert_INT32_EQ(EntryPtr[2].BlockEntries, 1);
+    UtAssert_INT32_EQ(EntryPtr[3].BlockEntries, 1);
+}
+
+void MD_DwellEntryUnread_Test(void)
+{
+    MD_DwellReadErrEntry_t *ErrPtr = MD_AppData.DwellReportControl[0].ReadErr;
+
+    ErrPtr[1].FailRun = 1;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MD_DwellEntryUnread(0, 1));
+
+    MD_AppData.MD_DwellTables[0].FailingEntries = 1;
+
+    UtAssert_BOOL_TRUE(MD_DwellEntryUnread(0, 1));
+    UtAssert_BOOL_FALSE(MD_DwellEntryUnread(0, 0));
+}
+
+void MD_QuarantineDwellEntry_Test_FirstOfBlock(void)
+{
+    MD_DWELL_ERR_TEST_SetupBlock();
+
+    /* Execute the function being tested */
+    MD_QuarantineDwellEntry(0, 0);
+
+    /* Verify results: the rest of the block is still read together */
+    UtAssert_BOOL_TRUE(MD_AppData.DwellReportControl[0].ReadErr[0].Quarantined);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[0].BlockEntries, 1);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[0].BlockBytes, 4);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[1].BlockEntries, 3);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[1].BlockBytes, 12);
+}
+
+void MD_ReportDwellReadErrors_Test_Countdown(void)
+{
+    MD_AppData.ReadErrSummary.Countdown       = 5;
+    MD_AppData.ReadErrSummary.UnreportedCount = 7;
+
+    /* Execute the function being tested */
+    MD_ReportDwellReadErrors(3);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.ReadErrSummary.Countdown, 2);
+    UtAssert_UINT32_EQ(MD_AppData.ReadErrSummary.UnreportedCount, 7);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_ReportDwellReadErrors_Test_Summary(void)
+{
+    MD_AppData.ReadErrSummary.Countdown       = 2;
+    MD_AppData.ReadErrSummary.UnreportedCount = 7;
+
+    MD_AppData.MD_DwellTables[0].Capacity                  = MD_INTERFACE_DWELL_TABLE_SIZE;
+    MD_AppData.MD_DwellTables[0].FailingEntries            = 2;
+    MD_AppData.DwellReportControl[0].QuarantinedEntries     = 1;
+    MD_AppData.DwellReportControl[0].ReadErr[3].Quarantined = true;
+
+    MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].FailingEntries = 1;
+
+    /* Execute the function being tested: the interval ends within a catch-up */
+    MD_ReportDwellReadErrors(3);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.ReadErrSummary.Countdown, MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL);
+    UtAssert_UINT32_EQ(MD_AppData.ReadErrSummary.UnreportedCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_READ_ERR_SUMMARY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* Quarantined entries are retried, and are still failing until read */
+    UtAssert_BOOL_FALSE(MD_AppData.DwellReportControl[0].ReadErr[3].Quarantined);
+    UtAssert_INT32_EQ(MD_AppData.DwellReportControl[0].QuarantinedEntries, 0);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].FailingEntries, 2);
+}
+
+void MD_ReportDwellReadErrors_Test_NothingUnreported(void)
+{
+    MD_AppData.ReadErrSummary.Countdown = 1;
+
+    /* Execute the function being tested */
+    MD_ReportDwellReadErrors(1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.ReadErrSummary.Countdown, MD_INTERNAL_READ_ERR_SUMMARY_INTERVAL);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_ResetDwellReadErrors_Test(void)
+{
+    MD_AppData.MD_DwellTables[0].Capacity                     = MD_INTERFACE_DWELL_TABLE_SIZE;
+    MD_AppData.MD_DwellTables[0].FailingEntries               = 1;
+    MD_AppData.DwellReportControl[0].QuarantinedEntries        = 1;
+    MD_AppData.DwellReportControl[0].ReadErr[1].ErrCount       = 40;
+    MD_AppData.DwellReportControl[0].ReadErr[1].NextEventCount = 64;
+    MD_AppData.DwellReportControl[0].ReadErr[1].FailRun        = 40;
+    MD_AppData.DwellReportControl[0].ReadErr[1].Quarantined    = true;
+    MD_AppData.DwellReportControl[1].ReadErr[0].ErrCount       = 2;
+
+    /* Execute the function being tested */
+    MD_ResetDwellReadErrors(0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.DwellReportControl[0].ReadErr[1].ErrCount, 0);
+    UtAssert_UINT32_EQ(MD_AppData.DwellReportControl[0].ReadErr[1].NextEventCount, 0);
+    UtAssert_UINT32_EQ(MD_AppData.DwellReportControl[0].ReadErr[1].FailRun, 0);
+    UtAssert_BOOL_FALSE(MD_AppData.DwellReportControl[0].ReadErr[1].Quarantined);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].FailingEntries, 0);
+    UtAssert_INT32_EQ(MD_AppData.DwellReportControl[0].QuarantinedEntries, 0);
+
+    /* Other tables keep their errors */
+    UtAssert_UINT32_EQ(MD_AppData.DwellReportControl[1].ReadErr[0].ErrCount, 2);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(MD_DwellReadFailed_Test_Backoff, MD_Test_Setup, MD_Test_TearDown, "MD_DwellReadFailed_Test_Backoff");
+    UtTest_Add(MD_DwellReadFailed_Test_Saturated, MD_Test_Setup, MD_Test_TearDown,
+               "MD_DwellReadFailed_Test_Saturated");
+    UtTest_Add(MD_DwellReadFailed_Test_Quarantine, MD_Test_Setup, MD_Test_TearDown,
+               "MD_DwellReadFailed_Test_Quarantine");
+
+    UtTest_Add(MD_DwellReadsSucceeded_Test, MD_Test_Setup, MD_Test_TearDown, "MD_DwellReadsSucceeded_Test");
+    UtTest_Add(MD_DwellReadsSucceeded_Test_Recovered, MD_Test_Setup, MD_Test_TearDown,
+               "MD_DwellReadsSucceeded_Test_Recovered");
+    UtTest_Add(MD_DwellEntryUnread_Test, MD_Test_Setup, MD_Test_TearDown, "MD_DwellEntryUnread_Test");
+
+    UtTest_Add(MD_QuarantineDwellEntry_Test_FirstOfBlock, MD_Test_Setup, MD_Test_TearDown,
+               "MD_QuarantineDwellEntry_Test_FirstOfBlock");
+
+    UtTest_Add(MD_ReportDwellReadErrors_Test_Countdown, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ReportDwellReadErrors_Test_Countdown");
+    UtTest_Add(MD_ReportDwellReadErrors_Test_Summary, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ReportDwellReadErrors_Test_Summary");
+    UtTest_Add(MD_ReportDwellReadErrors_Test_NothingUnreported, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ReportDwellReadErrors_Test_NothingUnreported");
+
+    UtTest_Add(MD_ResetDwellReadErrors_Test, MD_Test_Setup, MD_Test_TearDown, "MD_ResetDwellReadErrors_Test");
+}
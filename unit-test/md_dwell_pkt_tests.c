@@ -21,9 +21,16 @@
  */
 
 #include "md_dwell_pkt.h"
+#include "md_dwell_enc.h"
+#include "md_capture.h"
+#include "md_dwell_err.h"
+#include "md_snapshot.h"
+#include "md_perf.h"
 #include "md_msg.h"
 #include "md_msgdefs.h"
 #include "md_eventids.h"
+#include "md_utils.h"
+#include "md_internal_cfg.h"
 #include "md_version.h"
 #include "md_test_utils.h"
 #include <unistd.h>
@@ -37,6 +44,90 @@
 /* md_dwell_pkt_tests globals */
 uint8 call_count_CFE_EVS_SendEvent;
 
+/* Memory dwelled on by the sampling plan tests */
+uint32 MD_DWELL_PKT_TEST_Memory[4] = {0x03020100, 0x07060504, 0x0B0A0908, 0x0F0E0D0C};
+
+/*
+ * Handlers that perform real memory reads, so block and per-entry reads can be compared
+ */
+void MD_DWELL_PKT_TEST_CFE_PSP_MemRead8Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    cpuaddr MemoryAddress = UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+    uint8 * ByteValue     = UT_Hook_GetArgValueByName(Context, "ByteValue", uint8 *);
+
+    *ByteValue = *(uint8 *)MemoryAddress;
+}
+
+void MD_DWELL_PKT_TEST_CFE_PSP_MemRead16Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    cpuaddr MemoryAddress = UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+    uint16 *uint16Value   = UT_Hook_GetArgValueByName(Context, "uint16Value", uint16 *);
+
+    *uint16Value = *(uint16 *)MemoryAddress;
+}
+
+void MD_DWELL_PKT_TEST_CFE_PSP_MemRead32Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    cpuaddr MemoryAddress = UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+    uint32 *uint32Value   = UT_Hook_GetArgValueByName(Context, "uint32Value", uint32 *);
+
+    *uint32Value = *(uint32 *)MemoryAddress;
+}
+
+void MD_DWELL_PKT_TEST_CFE_PSP_MemCpyHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void *      dest = UT_Hook_GetArgValueByName(Context, "dest", void *);
+    const void *src  = UT_Hook_GetArgValueByName(Context, "src", const void *);
+    uint32      n    = UT_Hook_GetArgValueByName(Context, "n", uint32);
+
+    memcpy(dest, src, n);
+}
+
+/* Reports the entry UserObj points to, if any, as having no value this cycle */
+void MD_DWELL_PKT_TEST_MD_DwellEntryUnreadHandler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                  const UT_StubContext_t *Context)
+{
+    uint16 EntryIndex  = UT_Hook_GetArgValueByName(Context, "EntryIndex", uint16);
+    int32 *UnreadEntry = UserObj;
+    bool   Unread      = (*UnreadEntry == EntryIndex);
+
+    UT_Stub_SetReturnValue(FuncKey, Unread);
+}
+
+/* Sets up table 0 with two blocks of contiguous entries separated by a delay */
+void MD_DWELL_PKT_TEST_SetupContiguousTable(void)
+{
+    cpuaddr                  Base   = (cpuaddr)MD_DWELL_PKT_TEST_Memory;
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[0];
+
+    TblPtr->Enabled   = MD_Dwell_States_ENABLED;
+    TblPtr->AddrCount = 5;
+    TblPtr->Rate      = 2;
+    TblPtr->DataSize  = 11;
+
+    TblPtr->Entry[0].Length          = 2;
+    TblPtr->Entry[0].Delay           = 0;
+    TblPtr->Entry[0].ResolvedAddress = Base + 2;
+    TblPtr->Entry[1].Length          = 4;
+    TblPtr->Entry[1].Delay           = 0;
+    TblPtr->Entry[1].ResolvedAddress = Base + 4;
+    TblPtr->Entry[2].Length          = 1;
+    TblPtr->Entry[2].Delay           = 1;
+    TblPtr->Entry[2].ResolvedAddress = Base + 8;
+    TblPtr->Entry[3].Length          = 2;
+    TblPtr->Entry[3].Delay           = 0;
+    TblPtr->Entry[3].ResolvedAddress = Base + 12;
+    TblPtr->Entry[4].Length          = 2;
+    TblPtr->Entry[4].Delay           = 1;
+    TblPtr->Entry[4].ResolvedAddress = Base + 14;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemRead8), MD_DWELL_PKT_TEST_CFE_PSP_MemRead8Handler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemRead16), MD_DWELL_PKT_TEST_CFE_PSP_MemRead16Handler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemRead32), MD_DWELL_PKT_TEST_CFE_PSP_MemRead32Handler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemCpy), MD_DWELL_PKT_TEST_CFE_PSP_MemCpyHandler, NULL);
+}
+
 /*
  * Function Definitions
  */
@@ -65,6 +156,10 @@ void MD_DwellLoop_Test_PacketAlreadyFull(void)
     MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].Entry[0].Delay = 2;
     MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].Entry[0].Delay = 2;
 
+    MD_ScheduleDwellTable(0, 1);
+    MD_ScheduleDwellTable(MD_INTERFACE_NUM_DWELL_TABLES / 2, 1);
+    MD_ScheduleDwellTable(MD_INTERFACE_NUM_DWELL_TABLES - 1, 1);
+
     /* Execute the function being tested */
     MD_DwellLoop(&Msg);
 
@@ -131,6 +226,10 @@ void MD_DwellLoop_Test_SendDwellPacket(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead16), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead32), 1, CFE_SUCCESS);
 
+    MD_ScheduleDwellTable(0, 1);
+    MD_ScheduleDwellTable(MD_INTERFACE_NUM_DWELL_TABLES / 2, 1);
+    MD_ScheduleDwellTable(MD_INTERFACE_NUM_DWELL_TABLES - 1, 1);
+
     /* Execute the function being tested */
     MD_DwellLoop(&Msg);
 
@@ -197,6 +296,10 @@ void MD_DwellLoop_Test_MoreAddressesToRead(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead16), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead32), 1, CFE_SUCCESS);
 
+    MD_ScheduleDwellTable(0, 1);
+    MD_ScheduleDwellTable(MD_INTERFACE_NUM_DWELL_TABLES / 2, 1);
+    MD_ScheduleDwellTable(MD_INTERFACE_NUM_DWELL_TABLES - 1, 1);
+
     /* Execute the function being tested */
     MD_DwellLoop(&Msg);
 
@@ -257,6 +360,10 @@ void MD_DwellLoop_Test_ZeroRate(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead16), 1, CFE_SUCCESS);
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead32), 1, CFE_SUCCESS);
 
+    MD_ScheduleDwellTable(0, 1);
+    MD_ScheduleDwellTable(MD_INTERFACE_NUM_DWELL_TABLES / 2, 1);
+    MD_ScheduleDwellTable(MD_INTERFACE_NUM_DWELL_TABLES - 1, 1);
+
     /* Execute the function being tested */
     MD_DwellLoop(&Msg);
 
@@ -279,6 +386,8 @@ void MD_DwellLoop_Test_ZeroRate(void)
     UtAssert_True(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].Countdown == 1,
                   "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].Countdown == 1");
 
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 0);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -288,11 +397,6 @@ void MD_DwellLoop_Test_ZeroRate(void)
 void MD_DwellLoop_Test_DataError(void)
 {
     MD_Wakeup_t Msg;
-    int32 strCmpResult;
-    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Dwell Table failed to read entry %%d in table %%d ");
 
     MD_AppData.MD_DwellTables[0].AddrCount                       = 1;
     MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES / 2].AddrCount = 1;
@@ -329,6 +433,10 @@ void MD_DwellLoop_Test_DataError(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead16), 1, -2);
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead32), 1, -3);
 
+    MD_ScheduleDwellTable(0, 1);
+    MD_ScheduleDwellTable(MD_INTERFACE_NUM_DWELL_TABLES / 2, 1);
+    MD_ScheduleDwellTable(MD_INTERFACE_NUM_DWELL_TABLES - 1, 1);
+
     /* Execute the function being tested */
     MD_DwellLoop(&Msg);
 
@@ -351,14 +459,183 @@ void MD_DwellLoop_Test_DataError(void)
     UtAssert_True(MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].Countdown == 2,
                   "MD_AppData.MD_DwellTables[MD_INTERFACE_NUM_DWELL_TABLES - 1].Countdown == 2");
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_DWELL_LOOP_GET_DWELL_DATA_ERR_EID);
+    /* Each failure is reported as the entry's read errors allow */
+    UtAssert_STUB_COUNT(MD_DwellReadFailed, 3);
+    UtAssert_STUB_COUNT(MD_DwellReadsSucceeded, 0);
+    UtAssert_STUB_COUNT(MD_ReportDwellReadErrors, 1);
+
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].ReadErrCount, 1);
+}
+
+void MD_DwellLoop_Test_CatchUp(void)
+{
+    MD_Wakeup_t             Msg;
+    CFE_MSG_SequenceCount_t SeqCount = 7;
+
+    MD_AppData.MD_DwellTables[0].AddrCount       = 1;
+    MD_AppData.MD_DwellTables[0].Enabled         = MD_Dwell_States_ENABLED;
+    MD_AppData.MD_DwellTables[0].Rate            = 1;
+    MD_AppData.MD_DwellTables[0].Entry[0].Delay  = 1;
+    MD_AppData.MD_DwellTables[0].Entry[0].Length = 1;
+
+    MD_ScheduleDwellTable(0, 1);
+
+    /* One wakeup, with sequence count 6, was missed */
+    MD_AppData.DwellSchedule.LastSeqCount = 5;
+    MD_AppData.DwellSchedule.LastSeqValid = true;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &SeqCount, sizeof(SeqCount), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_GetNextSequenceCount), 1, 6);
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_GetNextSequenceCount), 1, 7);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_DwellLoop(&Msg), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.DwellSchedule.WakeupCount, 2);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].SampleCount, 2);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.OverrunCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.CatchupCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.DwellSchedule.LastSeqCount, 7);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_CountWakeups_Test_First(void)
+{
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MD_CountWakeups(100), 1);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(MD_AppData.DwellSchedule.LastSeqValid);
+    UtAssert_UINT32_EQ(MD_AppData.DwellSchedule.LastSeqCount, 100);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.OverrunCount, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 0);
+}
+
+void MD_CountWakeups_Test_SameSeqCount(void)
+{
+    MD_AppData.DwellSchedule.LastSeqCount = 100;
+    MD_AppData.DwellSchedule.LastSeqValid = true;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MD_CountWakeups(100), 1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.OverrunCount, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 0);
+}
+
+void MD_CountWakeups_Test_NextSeqCount(void)
+{
+    MD_AppData.DwellSchedule.LastSeqCount = 100;
+    MD_AppData.DwellSchedule.LastSeqValid = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), 101);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MD_CountWakeups(101), 1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.DwellSchedule.LastSeqCount, 101);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.OverrunCount, 0);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.CatchupCount, 0);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.RephaseCount, 0);
+}
+
+void MD_CountWakeups_Test_CatchUp(void)
+{
+    MD_AppData.DwellSchedule.LastSeqCount = 0x3FFE;
+    MD_AppData.DwellSchedule.LastSeqValid = true;
+
+    /* Missed the wakeups with sequence counts 0x3FFF and 0, the count having wrapped */
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_GetNextSequenceCount), 1, 0x3FFF);
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_GetNextSequenceCount), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_GetNextSequenceCount), 1, 1);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MD_CountWakeups(1), 3);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.DwellSchedule.LastSeqCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.OverrunCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.CatchupCount, 2);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.RephaseCount, 0);
+}
+
+void MD_CountWakeups_Test_Rephase(void)
+{
+    MD_AppData.DwellSchedule.LastSeqCount = 100;
+    MD_AppData.DwellSchedule.LastSeqValid = true;
+
+    /* Gap is too long for the sequence count to be reached */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), 101);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MD_CountWakeups(1000), 1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.DwellSchedule.LastSeqCount, 1000);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.OverrunCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.CatchupCount, 0);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.RephaseCount, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, MD_INTERNAL_MAX_CATCHUP_WAKEUPS + 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_WAKEUP_REPHASE_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+void MD_CountWakeups_Test_Wrap(void)
+{
+    /* Largest sequence count, which the next wakeup's wraps around from */
+    MD_AppData.DwellSchedule.LastSeqCount = 0x3FFF;
+    MD_AppData.DwellSchedule.LastSeqValid = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), 0);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MD_CountWakeups(0), 1);
+
+    /* Verify results: the wrap is not a gap */
+    UtAssert_UINT32_EQ(MD_AppData.DwellSchedule.LastSeqCount, 0);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.OverrunCount, 0);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.CatchupCount, 0);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.RephaseCount, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+void MD_CountRephase_Test_Backoff(void)
+{
+    uint16 Rephase;
 
+    /* Execute the function being tested */
+    for (Rephase = 0; Rephase < 5; Rephase++)
+    {
+        MD_CountRephase(100, 1000);
+    }
+
+    /* Verify results: the 1st, 2nd and 4th rephases were reported */
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.RephaseCount, 5);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.NextRephaseEvent, 8);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, MD_WAKEUP_REPHASE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MD_CountRephase_Test_Saturated(void)
+{
+    MD_AppData.WakeupCounters.RephaseCount     = 0xFFFFFFFE;
+    MD_AppData.WakeupCounters.NextRephaseEvent = 0xFFFFFFFF;
+
+    /* Execute the function being tested */
+    MD_CountRephase(100, 1000);
+    MD_CountRephase(100, 1000);
+
+    /* Verify results: counts stop at their largest value */
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.RephaseCount, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.NextRephaseEvent, 0xFFFFFFFF);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
 }
 
 void MD_GetDwellData_Test_MemRead8Error(void)
@@ -490,6 +767,340 @@ void MD_GetDwellData_Test_Success(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_GetDwellData_Test_BlockSuccess(void)
+{
+    int32  Result;
+    uint16 TblIndex   = 1;
+    uint16 EntryIndex = 1;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemCpy), MD_DWELL_PKT_TEST_CFE_PSP_MemCpyHandler, NULL);
+
+    /* Block dwells can start at any byte */
+    MD_AppData.MD_DwellTables[TblIndex].Entry[EntryIndex].Length          = MD_MIN_BLOCK_DWELL_LENGTH;
+    MD_AppData.MD_DwellTables[TblIndex].Entry[EntryIndex].ResolvedAddress = (cpuaddr)MD_DWELL_PKT_TEST_Memory + 1;
+    MD_AppData.MD_DwellTables[TblIndex].PktOffset                         = 2;
+
+    /* Execute the function being tested */
+    Result = MD_GetDwellData(TblIndex, EntryIndex);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TblIndex].PktOffset, 2 + MD_MIN_BLOCK_DWELL_LENGTH);
+    UtAssert_MemCmp(&MD_AppData.MD_DwellTables[TblIndex].PktBuf->Payload.Data[2], (uint8 *)MD_DWELL_PKT_TEST_Memory + 1,
+                    MD_MIN_BLOCK_DWELL_LENGTH, "Block dwell copied into packet");
+
+    UtAssert_STUB_COUNT(CFE_PSP_MemCpy, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_GetDwellData_Test_BlockError(void)
+{
+    int32  Result;
+    uint16 TblIndex   = 1;
+    uint16 EntryIndex = 1;
+
+    MD_AppData.MD_DwellTables[TblIndex].Entry[EntryIndex].Length = MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH;
+    MD_AppData.MD_DwellTables[TblIndex].PktOffset                = 0;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemCpy), 1, -1);
+
+    /* Execute the function being tested */
+    Result = MD_GetDwellData(TblIndex, EntryIndex);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, BLOCK_MEM_ADDR_READ_ERR);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TblIndex].PktOffset, MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_GetDwellBlockData_Test_Success(void)
+{
+    MD_DWELL_PKT_TEST_SetupContiguousTable();
+
+    MD_AppData.MD_DwellTables[0].Entry[0].BlockEntries = 3;
+    MD_AppData.MD_DwellTables[0].Entry[0].BlockBytes   = 7;
+    MD_AppData.MD_DwellTables[0].PktOffset             = 1;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_GetDwellBlockData(0, 0), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].PktOffset, 8);
+    UtAssert_MemCmp(&MD_AppData.MD_DwellTables[0].PktBuf->Payload.Data[1], (uint8 *)MD_DWELL_PKT_TEST_Memory + 2, 7,
+                    "Block copied to dwell packet");
+    UtAssert_STUB_COUNT(CFE_PSP_MemCpy, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_GetDwellBlockData_Test_Error(void)
+{
+    MD_DWELL_PKT_TEST_SetupContiguousTable();
+
+    MD_AppData.MD_DwellTables[0].Entry[0].BlockEntries = 3;
+    MD_AppData.MD_DwellTables[0].Entry[0].BlockBytes   = 7;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemCpy), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_GetDwellBlockData(0, 0), BLOCK_MEM_ADDR_READ_ERR);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].PktOffset, 0);
+}
+
+void MD_CompileDwellPlan_Test(void)
+{
+    MD_DWELL_PKT_TEST_SetupContiguousTable();
+
+    /* Entry 4 is contiguous with entry 3 but beyond the active entries */
+    MD_AppData.MD_DwellTables[0].AddrCount = 4;
+
+    /* Execute the function being tested */
+    MD_CompileDwellPlan(MD_AppData.MD_DwellTables[0].Entry, MD_AppData.DwellReportControl[0].Group,
+                        MD_AppData.MD_DwellTables[0].AddrCount);
+
+    /* Verify results */
+#if MD_INTERNAL_COALESCE_DWELL_READS == 1
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[0].BlockEntries, 3);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[0].BlockBytes, 7);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[1].BlockEntries, 2);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[1].BlockBytes, 5);
+#else
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[0].BlockEntries, 1);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[1].BlockEntries, 1);
+#endif
+
+    /* Entry with a non-zero delay ends a block */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[2].BlockEntries, 1);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[2].BlockBytes, 1);
+
+    /* Last active entry always ends a block */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[3].BlockEntries, 1);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[3].BlockBytes, 2);
+
+    /* Non-contiguous address ends a block */
+    MD_AppData.MD_DwellTables[0].Entry[2].ResolvedAddress += 1;
+    MD_CompileDwellPlan(MD_AppData.MD_DwellTables[0].Entry, MD_AppData.DwellReportControl[0].Group,
+                        MD_AppData.MD_DwellTables[0].AddrCount);
+
+    UtAssert_INT32_LT(MD_AppData.MD_DwellTables[0].Entry[1].BlockEntries, 2);
+}
+
+void MD_CompileDwellPlan_Test_SnapshotGroup(void)
+{
+    MD_DWELL_PKT_TEST_SetupContiguousTable();
+
+    /* Entry 2 is read with its snapshot group */
+    MD_AppData.DwellReportControl[0].Group[1] = 1;
+
+    /* Execute the function being tested */
+    MD_CompileDwellPlan(MD_AppData.MD_DwellTables[0].Entry, MD_AppData.DwellReportControl[0].Group,
+                        MD_AppData.MD_DwellTables[0].AddrCount);
+
+    /* Verify results: the member splits the block it was in */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[0].BlockEntries, 1);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[0].BlockBytes, 2);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[1].BlockEntries, 1);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[1].BlockBytes, 4);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[2].BlockEntries, 1);
+
+#if MD_INTERNAL_COALESCE_DWELL_READS == 1
+    /* Blocks without members are unchanged */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Entry[3].BlockEntries, 2);
+#endif
+}
+
+void MD_DwellLoop_Test_MaxSampleTime(void)
+{
+    MD_Wakeup_t Msg;
+
+    MD_AppData.MD_DwellTables[0].Enabled           = MD_Dwell_States_ENABLED;
+    MD_AppData.MD_DwellTables[0].AddrCount         = 1;
+    MD_AppData.MD_DwellTables[0].Rate              = 1;
+    MD_AppData.MD_DwellTables[0].Entry[0].Length   = 4;
+    MD_AppData.MD_DwellTables[0].Entry[0].Delay    = 1;
+    MD_AppData.DwellCounters[0].MaxSampleTime      = 200;
+
+    /* Each wakeup times sending the packet, then sampling the table */
+    UT_SetDeferredRetcode(UT_KEY(MD_PerfEnd), 2, 250);
+    UT_SetDeferredRetcode(UT_KEY(MD_PerfEnd), 2, 100);
+
+    MD_ScheduleDwellTable(0, 1);
+
+    /* Execute the function being tested */
+    MD_DwellLoop(&Msg);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_PerfBegin, 2);
+    UtAssert_STUB_COUNT(MD_PerfEnd, 2);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].MaxSampleTime, 250);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].SampleCount, 1);
+
+    /* A quicker wakeup leaves the longest time in place */
+    MD_DwellLoop(&Msg);
+
+    UtAssert_STUB_COUNT(MD_PerfEnd, 4);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].MaxSampleTime, 250);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].SampleCount, 2);
+}
+
+void MD_SendDwellPkt_Test_CycleOverrun(void)
+{
+    uint16 TableIndex = 1;
+
+    MD_AppData.MD_DwellTables[TableIndex].Rate = 4;
+
+    /* The first cycle sets when the next should complete */
+    MD_AppData.DwellSchedule.WakeupCount = 10;
+    MD_SendDwellPkt(TableIndex);
+
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[TableIndex].CycleOverrunCount, 0);
+    UtAssert_UINT32_EQ(MD_AppData.DwellReportControl[TableIndex].CycleDueWakeup, 14);
+
+    /* A cycle a rate later is on time */
+    MD_AppData.DwellSchedule.WakeupCount = 14;
+    MD_SendDwellPkt(TableIndex);
+
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[TableIndex].CycleOverrunCount, 0);
+
+    /* A cycle completing later than that overran */
+    MD_AppData.DwellSchedule.WakeupCount = 20;
+    MD_SendDwellPkt(TableIndex);
+
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[TableIndex].CycleOverrunCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.DwellReportControl[TableIndex].CycleDueWakeup, 24);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[TableIndex].PktSentCount, 3);
+}
+
+void MD_ProcessDwellTable_Test_PlanMatchesPerEntry(void)
+{
+    uint8  PerEntryData[11];
+    uint16 Wakeup;
+
+    /* Per-entry reads: no plan compiled */
+    MD_DWELL_PKT_TEST_SetupContiguousTable();
+
+    /* Fill the packet template so it can be inspected after it is sent */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_AllocateMessageBuffer), -1);
+
+    for (Wakeup = 0; Wakeup < 2; Wakeup++)
+    {
+        UtAssert_INT32_EQ(MD_ProcessDwellTable(0), CFE_SUCCESS);
+    }
+
+    UtAssert_STUB_COUNT(CFE_PSP_MemCpy, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    memcpy(PerEntryData, MD_AppData.MD_DwellPkt[0].Payload.Data, sizeof(PerEntryData));
+
+    /* Compiled plan reads */
+    MD_Test_Setup();
+    MD_DWELL_PKT_TEST_SetupContiguousTable();
+    MD_CompileDwellPlan(MD_AppData.MD_DwellTables[0].Entry, MD_AppData.DwellReportControl[0].Group,
+                        MD_AppData.MD_DwellTables[0].AddrCount);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_AllocateMessageBuffer), -1);
+
+    /* Execute the function being tested */
+    for (Wakeup = 0; Wakeup < 2; Wakeup++)
+    {
+        UtAssert_INT32_EQ(MD_ProcessDwellTable(0), CFE_SUCCESS);
+    }
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_MemCmp(MD_AppData.MD_DwellPkt[0].Payload.Data, PerEntryData, sizeof(PerEntryData),
+                    "Dwell packet data matches per-entry reads");
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].CurrentEntry, 0);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Countdown, 1);
+
+    /* Entries read as a block count as samples each */
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].SampleCount, 5);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].ReadErrCount, 0);
+
+#if MD_INTERNAL_COALESCE_DWELL_READS == 1
+    UtAssert_STUB_COUNT(CFE_PSP_MemCpy, 2);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 0);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 0);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead32, 0);
+#endif
+}
+
+void MD_ProcessDwellTable_Test_BlockReadFallback(void)
+{
+    MD_DWELL_PKT_TEST_SetupContiguousTable();
+    MD_CompileDwellPlan(MD_AppData.MD_DwellTables[0].Entry, MD_AppData.DwellReportControl[0].Group,
+                        MD_AppData.MD_DwellTables[0].AddrCount);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemCpy), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_ProcessDwellTable(0), CFE_SUCCESS);
+
+    /* Verify results: entries were read individually instead */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].PktOffset, 7);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].CurrentEntry, 3);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead32, 1);
+    UtAssert_MemCmp(MD_AppData.MD_DwellTables[0].PktBuf->Payload.Data, (uint8 *)MD_DWELL_PKT_TEST_Memory + 2, 7,
+                    "Dwell packet data matches memory");
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_ProcessDwellTable_Test_SnapshotGroup(void)
+{
+    MD_DWELL_PKT_TEST_SetupContiguousTable();
+    MD_AppData.DwellReportControl[0].Group[1] = 1;
+    MD_CompileDwellPlan(MD_AppData.MD_DwellTables[0].Entry, MD_AppData.DwellReportControl[0].Group,
+                        MD_AppData.MD_DwellTables[0].AddrCount);
+
+    UT_SetDeferredRetcode(UT_KEY(MD_GetSnapshotData), 1, FOUR_BYTE_MEM_ADDR_READ_ERR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_ProcessDwellTable(0), FOUR_BYTE_MEM_ADDR_READ_ERR);
+
+    /* Verify results: the member's value came from its group, the others were read here */
+    UtAssert_STUB_COUNT(MD_GetSnapshotData, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead32, 0);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].CurrentEntry, 3);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].SampleCount, 3);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].ReadErrCount, 1);
+    UtAssert_STUB_COUNT(MD_DwellReadFailed, 1);
+}
+
+void MD_ProcessDwellTable_Test_Quarantined(void)
+{
+    MD_DWELL_PKT_TEST_SetupContiguousTable();
+
+    /* Entry 2 has been quarantined */
+    MD_AppData.MD_DwellTables[0].FailingEntries             = 1;
+    MD_AppData.DwellReportControl[0].ReadErr[1].Quarantined = true;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_ProcessDwellTable(0), CFE_SUCCESS);
+
+    /* Verify results: the quarantined entry was skipped and the others read */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].PktOffset, 7);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead32, 0);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 1);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].CurrentEntry, 3);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].SampleCount, 2);
+
+    /* Entries read while the table has failing entries end their runs of failures */
+    UtAssert_STUB_COUNT(MD_DwellReadsSucceeded, 3);
+    UtAssert_STUB_COUNT(MD_DwellReadFailed, 0);
+}
+
 void MD_SendDwellPkt_Test(void)
 {
     uint16 TableIndex                               = 1;
@@ -498,9 +1109,11 @@ void MD_SendDwellPkt_Test(void)
     MD_AppData.MD_DwellTables[TableIndex].DataSize  = 5;
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
-    strncpy(MD_AppData.MD_DwellTables[TableIndex].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1);
+    strncpy(MD_AppData.DwellReportControl[TableIndex].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1);
 #endif
 
+    MD_UpdateDwellPktTemplate(TableIndex);
+
     /* Execute the function being tested */
     MD_SendDwellPkt(TableIndex);
 
@@ -512,15 +1125,16 @@ void MD_SendDwellPkt_Test(void)
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     UtAssert_True(
-        strncmp(MD_AppData.MD_DwellTables[TableIndex].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1) == 0,
+        strncmp(MD_AppData.DwellReportControl[TableIndex].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1) == 0,
         "MD_AppData.MD_DwellTables[TableIndex].Payload.Signature, 'signature', MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1) == 0");
 
-    UtAssert_True(MD_AppData.MD_DwellTables[TableIndex].Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] == '\0',
+    UtAssert_True(MD_AppData.DwellReportControl[TableIndex].Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] == '\0',
                   "MD_AppData.MD_DwellTables[TableIndex].Payload.Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] == ''");
 #endif
 
     UtAssert_True(MD_AppData.MD_DwellTables[TableIndex].DataSize == 5,
                   "MD_AppData.MD_DwellTables[TableIndex].DataSize == 5");
+    UtAssert_STUB_COUNT(MD_CaptureDwellCycle, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -536,9 +1150,11 @@ void MD_NoDwellRate_Test(void)
     MD_AppData.MD_DwellTables[TableIndex].DataSize  = 5;
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
-    strncpy(MD_AppData.MD_DwellTables[TableIndex].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1);
+    strncpy(MD_AppData.DwellReportControl[TableIndex].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1);
 #endif
 
+    MD_UpdateDwellPktTemplate(TableIndex);
+
     /* Execute the function being tested */
     MD_SendDwellPkt(TableIndex);
 
@@ -550,10 +1166,10 @@ void MD_NoDwellRate_Test(void)
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     UtAssert_True(
-        strncmp(MD_AppData.MD_DwellTables[TableIndex].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1) == 0,
+        strncmp(MD_AppData.DwellReportControl[TableIndex].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1) == 0,
         "MD_AppData.MD_DwellTables[TableIndex].Payload.Signature, 'signature', MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1) == 0");
 
-    UtAssert_True(MD_AppData.MD_DwellTables[TableIndex].Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] == '\0',
+    UtAssert_True(MD_AppData.DwellReportControl[TableIndex].Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] == '\0',
                   "MD_AppData.MD_DwellTables[TableIndex].Payload.Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] == ''");
 #endif
 
@@ -566,25 +1182,1388 @@ void MD_NoDwellRate_Test(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void MD_StartDwellStream_Test(void)
+#if MD_INTERNAL_ZERO_COPY_DWELL_PKTS == 1
+void MD_SendDwellPkt_Test_ZeroCopy(void)
 {
-    uint16 TableIndex = 1;
+    uint16         TableIndex = 1;
+    MD_DwellPkt_t *PktPtr;
 
-    /* Execute the function being tested */
-    MD_StartDwellStream(TableIndex);
+    MD_AppData.MD_DwellTables[TableIndex].AddrCount = 3;
+    MD_AppData.MD_DwellTables[TableIndex].Rate      = 4;
+    MD_AppData.MD_DwellTables[TableIndex].DataSize  = 5;
 
-    /* Verify results */
-    UtAssert_True(MD_AppData.MD_DwellTables[TableIndex].Countdown == 1,
-                  "MD_AppData.MD_DwellTables[TableIndex].Countdown == 1");
-    UtAssert_True(MD_AppData.MD_DwellTables[TableIndex].CurrentEntry == 0,
-                  "MD_AppData.MD_DwellTables[TableIndex].CurrentEntry == 0");
-    UtAssert_True(MD_AppData.MD_DwellTables[TableIndex].PktOffset == 0,
-                  "MD_AppData.MD_DwellTables[TableIndex].PktOffset == 0");
+    MD_UpdateDwellPktTemplate(TableIndex);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    PktPtr = MD_GetDwellPktBuf(TableIndex);
+    UtAssert_NOT_NULL(PktPtr);
+    UtAssert_True(PktPtr != &MD_AppData.MD_DwellPkt[TableIndex], "Packet filled in software bus buffer");
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
-                  call_count_CFE_EVS_SendEvent);
+    /* Only part of the data was read, as after a jam during the cycle */
+    memset(PktPtr->Payload.Data, 0xFF, 5);
+    MD_AppData.MD_DwellTables[TableIndex].PktOffset = 2;
+
+    /* Execute the function being tested */
+    MD_SendDwellPkt(TableIndex);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(PktPtr->Payload.TableId, 2);
+    UtAssert_INT32_EQ(PktPtr->Payload.AddrCount, 3);
+    UtAssert_INT32_EQ(PktPtr->Payload.Rate, 4);
+    UtAssert_INT32_EQ(PktPtr->Payload.ByteCount, 5);
+    UtAssert_INT32_EQ(PktPtr->Payload.Data[1], 0xFF);
+    UtAssert_INT32_EQ(PktPtr->Payload.Data[2], 0);
+    UtAssert_INT32_EQ(PktPtr->Payload.Data[4], 0);
+    UtAssert_NULL(MD_AppData.MD_DwellTables[TableIndex].PktBuf);
+
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 0);
+}
+
+void MD_SendDwellPkt_Test_TransmitBufferError(void)
+{
+    uint16 TableIndex = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_TransmitBuffer), -1);
+
+    /* Execute the function being tested */
+    MD_SendDwellPkt(TableIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 1);
+    UtAssert_NULL(MD_AppData.MD_DwellTables[TableIndex].PktBuf);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[TableIndex].PktSentCount, 0);
+}
+
+void MD_GetDwellData_Test_ZeroCopyReadError(void)
+{
+    uint16        TblIndex   = 1;
+    uint16        EntryIndex = 1;
+    MD_DwellPkt_t SbBuf;
+
+    /* Stand in for a software bus buffer holding an earlier message */
+    memset(&SbBuf, 0xFF, sizeof(SbBuf));
+    MD_AppData.MD_DwellTables[TblIndex].PktBuf = &SbBuf;
+
+    MD_AppData.MD_DwellTables[TblIndex].Entry[EntryIndex].Length = 4;
+    MD_AppData.MD_DwellTables[TblIndex].PktOffset                = 2;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead32), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_GetDwellData(TblIndex, EntryIndex), FOUR_BYTE_MEM_ADDR_READ_ERR);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(SbBuf.Payload.Data[1], 0xFF);
+    UtAssert_INT32_EQ(SbBuf.Payload.Data[2], 0);
+    UtAssert_INT32_EQ(SbBuf.Payload.Data[5], 0);
+    UtAssert_INT32_EQ(SbBuf.Payload.Data[6], 0xFF);
+}
+#endif
+
+void MD_SendDwellPkt_Test_Batched(void)
+{
+    uint16         TableIndex = 1;
+    uint16         TimeOffset;
+    MD_DwellPkt_t *PktPtr;
+
+    MD_DwellPacketControl_t *TblPtr   = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellBatchPkt_t *     BatchPtr = &MD_AppData.MD_DwellBatchPkt[TableIndex];
+
+    TblPtr->AddrCount   = 2;
+    TblPtr->Rate        = 4;
+    TblPtr->DataSize    = 3;
+    TblPtr->BatchFactor = 2;
+
+    MD_UpdateDwellPktTemplate(TableIndex);
+
+    /* First cycle */
+    MD_AppData.DwellSchedule.WakeupCount = 10;
+    PktPtr                               = MD_GetDwellPktBuf(TableIndex);
+    PktPtr->Payload.Data[0]              = 1;
+    PktPtr->Payload.Data[1]              = 2;
+    PktPtr->Payload.Data[2]              = 3;
+    TblPtr->PktOffset                    = 3;
+
+    /* Execute the function being tested */
+    MD_SendDwellPkt(TableIndex);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(TblPtr->BatchCycles, 1);
+    UtAssert_INT32_EQ(TblPtr->BatchOffset, MD_BATCH_CYCLE_HDR_SIZE + 3);
+    UtAssert_ADDRESS_EQ(TblPtr->PktBuf, PktPtr);
+    UtAssert_INT32_EQ(BatchPtr->Payload.TableId, 2);
+    UtAssert_INT32_EQ(BatchPtr->Payload.AddrCount, 2);
+    UtAssert_INT32_EQ(BatchPtr->Payload.ByteCount, 3);
+    UtAssert_INT32_EQ(BatchPtr->Payload.Rate, 4);
+    UtAssert_INT32_EQ(BatchPtr->Payload.BatchFactor, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+
+    /* Second cycle, only part of the data read after a jam */
+    MD_AppData.DwellSchedule.WakeupCount = 14;
+    PktPtr->Payload.Data[0]              = 4;
+    TblPtr->PktOffset                    = 1;
+
+    /* Execute the function being tested */
+    MD_SendDwellPkt(TableIndex);
+
+    /* Verify results */
+    memcpy(&TimeOffset, &BatchPtr->Payload.Data[0], sizeof(TimeOffset));
+    UtAssert_INT32_EQ(TimeOffset, 0);
+    UtAssert_INT32_EQ(BatchPtr->Payload.Data[2], 1);
+    UtAssert_INT32_EQ(BatchPtr->Payload.Data[4], 3);
+
+    memcpy(&TimeOffset, &BatchPtr->Payload.Data[5], sizeof(TimeOffset));
+    UtAssert_INT32_EQ(TimeOffset, 4);
+    UtAssert_INT32_EQ(BatchPtr->Payload.Data[7], 4);
+    UtAssert_INT32_EQ(BatchPtr->Payload.Data[8], 0);
+    UtAssert_INT32_EQ(BatchPtr->Payload.Data[9], 0);
+
+    UtAssert_INT32_EQ(BatchPtr->Payload.CycleCount, 2);
+    UtAssert_INT32_EQ(TblPtr->BatchCycles, 0);
+    UtAssert_INT32_EQ(TblPtr->BatchOffset, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 2); /* template update and batched packet */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+}
+
+void MD_SendDwellPkt_Test_FlushBatch(void)
+{
+    uint16 TableIndex = 1;
+
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[TableIndex];
+
+    /* Cycles batched before batching was turned off */
+    TblPtr->DataSize    = 3;
+    TblPtr->BatchFactor = 1;
+    TblPtr->BatchCycles = 1;
+    TblPtr->BatchOffset = MD_BATCH_CYCLE_HDR_SIZE + 3;
+
+    /* Execute the function being tested */
+    MD_SendDwellPkt(TableIndex);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellBatchPkt[TableIndex].Payload.CycleCount, 1);
+    UtAssert_INT32_EQ(TblPtr->BatchCycles, 0);
+    UtAssert_NULL(TblPtr->PktBuf);
+
+#if MD_INTERNAL_ZERO_COPY_DWELL_PKTS == 1
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+#else
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+#endif
+}
+
+void MD_BatchDwellPkt_Test_TimeOffsetLimit(void)
+{
+    uint16 TableIndex = 0;
+    uint16 TimeOffset;
+
+    MD_DwellPacketControl_t *TblPtr   = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellBatchPkt_t *     BatchPtr = &MD_AppData.MD_DwellBatchPkt[TableIndex];
+
+    TblPtr->DataSize    = 4;
+    TblPtr->PktOffset   = 4;
+    TblPtr->BatchFactor = 3;
+
+    MD_AppData.DwellSchedule.WakeupCount = 0xFFFFFFF0;
+    MD_BatchDwellPkt(TableIndex);
+
+    /* More wakeups than fit in the time offset, across the wakeup count wrapping */
+    MD_AppData.DwellSchedule.WakeupCount = 0x00010000;
+
+    /* Execute the function being tested */
+    MD_BatchDwellPkt(TableIndex);
+
+    /* Verify results */
+    memcpy(&TimeOffset, &BatchPtr->Payload.Data[MD_BATCH_CYCLE_HDR_SIZE + 4], sizeof(TimeOffset));
+    UtAssert_INT32_EQ(TimeOffset, 0xFFFF);
+    UtAssert_INT32_EQ(TblPtr->BatchCycles, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+}
+
+void MD_BatchDwellPkt_Test_Full(void)
+{
+    uint16 TableIndex = 0;
+
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[TableIndex];
+
+    /* A shorter table was batched and the next cycle no longer fits */
+    TblPtr->DataSize    = 4;
+    TblPtr->PktOffset   = 4;
+    TblPtr->BatchFactor = 2;
+    TblPtr->BatchCycles = 1;
+    TblPtr->BatchOffset = MD_INTERFACE_DWELL_BATCH_DATA_SIZE - MD_BATCH_CYCLE_HDR_SIZE;
+
+    /* Execute the function being tested */
+    MD_BatchDwellPkt(TableIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_INT32_EQ(TblPtr->BatchCycles, 1);
+    UtAssert_INT32_EQ(TblPtr->BatchOffset, MD_BATCH_CYCLE_HDR_SIZE + 4);
+}
+
+void MD_SendDwellBatchPkt_Test_Empty(void)
+{
+    uint16 TableIndex = 0;
+
+    /* Execute the function being tested */
+    MD_SendDwellBatchPkt(TableIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+}
+
+void MD_DWELL_PKT_TEST_SetupDeadbandTable(uint16 TableIndex)
+{
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+
+    /* 1, 2 and 4 byte entries and a block entry */
+    TblPtr->Entry[0].Length = 1;
+    ReportPtr->Deadband[0]  = 2;
+    TblPtr->Entry[1].Length = 2;
+    ReportPtr->Deadband[1]  = 2;
+    TblPtr->Entry[2].Length = 4;
+    ReportPtr->Deadband[2]  = 2;
+    TblPtr->Entry[3].Length = MD_MIN_BLOCK_DWELL_LENGTH;
+    ReportPtr->Deadband[3]  = 100;
+
+    TblPtr->AddrCount = 4;
+    TblPtr->DataSize  = 1 + 2 + 4 + MD_MIN_BLOCK_DWELL_LENGTH;
+    TblPtr->PktOffset = TblPtr->DataSize;
+}
+
+void MD_DwellDataChanged_Test(void)
+{
+    uint16         TableIndex = 0;
+    uint8          Value8;
+    uint16         Value16;
+    uint32         Value32;
+    MD_DwellPkt_t *PktPtr;
+
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+
+    /* The 1 and 4 byte entries are signed, so they can move across zero */
+    ReportPtr->Signed[0] = 1;
+    ReportPtr->Signed[2] = 1;
+
+    PktPtr = MD_GetDwellPktBuf(TableIndex);
+    memset(PktPtr->Payload.Data, 0, TblPtr->DataSize);
+    memset(ReportPtr->LastReported, 0, TblPtr->DataSize);
+
+    /* Unchanged */
+    UtAssert_BOOL_FALSE(MD_DwellDataChanged(TableIndex));
+
+    /* Within the deadband of the 1 byte entry, including across zero */
+    Value8                  = 0xFE;
+    PktPtr->Payload.Data[0] = Value8;
+    UtAssert_BOOL_FALSE(MD_DwellDataChanged(TableIndex));
+
+    /* Beyond it */
+    Value8                  = 0xFD;
+    PktPtr->Payload.Data[0] = Value8;
+    UtAssert_BOOL_TRUE(MD_DwellDataChanged(TableIndex));
+    PktPtr->Payload.Data[0] = 0;
+
+    /* 2 byte entry */
+    Value16 = 2;
+    memcpy(&PktPtr->Payload.Data[1], &Value16, sizeof(Value16));
+    UtAssert_BOOL_FALSE(MD_DwellDataChanged(TableIndex));
+    Value16 = 3;
+    memcpy(&PktPtr->Payload.Data[1], &Value16, sizeof(Value16));
+    UtAssert_BOOL_TRUE(MD_DwellDataChanged(TableIndex));
+    Value16 = 0;
+    memcpy(&PktPtr->Payload.Data[1], &Value16, sizeof(Value16));
+
+    /* 4 byte entry, within the deadband across zero and beyond it */
+    Value32 = 0xFFFFFFFE;
+    memcpy(&PktPtr->Payload.Data[3], &Value32, sizeof(Value32));
+    UtAssert_BOOL_FALSE(MD_DwellDataChanged(TableIndex));
+    Value32 = 0x80000000;
+    memcpy(&PktPtr->Payload.Data[3], &Value32, sizeof(Value32));
+    UtAssert_BOOL_TRUE(MD_DwellDataChanged(TableIndex));
+    Value32 = 0;
+    memcpy(&PktPtr->Payload.Data[3], &Value32, sizeof(Value32));
+
+    /* Block entry changes on any byte, regardless of its deadband */
+    PktPtr->Payload.Data[7 + MD_MIN_BLOCK_DWELL_LENGTH - 1] = 1;
+    UtAssert_BOOL_TRUE(MD_DwellDataChanged(TableIndex));
+}
+
+void MD_DwellDataChanged_Test_LargeUnsignedStep(void)
+{
+    uint16         TableIndex = 0;
+    uint16         Value16;
+    MD_DwellPkt_t *PktPtr;
+
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+    ReportPtr->Deadband[0] = 60;
+    ReportPtr->Deadband[1] = 30000;
+
+    PktPtr = MD_GetDwellPktBuf(TableIndex);
+    memset(PktPtr->Payload.Data, 0, TblPtr->DataSize);
+    memset(ReportPtr->LastReported, 0, TblPtr->DataSize);
+
+    /* Execute the function being tested, a step of more than half the range isn't taken as a small one */
+    PktPtr->Payload.Data[0] = 200;
+    UtAssert_BOOL_TRUE(MD_DwellDataChanged(TableIndex));
+    PktPtr->Payload.Data[0] = 0;
+
+    /* Unsigned entries don't move across zero either */
+    PktPtr->Payload.Data[0] = 0xFF;
+    UtAssert_BOOL_TRUE(MD_DwellDataChanged(TableIndex));
+    PktPtr->Payload.Data[0] = 0;
+
+    Value16 = 40000;
+    memcpy(&PktPtr->Payload.Data[1], &Value16, sizeof(Value16));
+    UtAssert_BOOL_TRUE(MD_DwellDataChanged(TableIndex));
+
+    Value16 = 30000;
+    memcpy(&PktPtr->Payload.Data[1], &Value16, sizeof(Value16));
+    UtAssert_BOOL_FALSE(MD_DwellDataChanged(TableIndex));
+}
+
+void MD_DwellDataChanged_Test_SignedAcrossZero(void)
+{
+    uint16         TableIndex = 0;
+    int8           Value8;
+    int16          Value16;
+    MD_DwellPkt_t *PktPtr;
+
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+    ReportPtr->Signed[0]   = 1;
+    ReportPtr->Deadband[0] = 60;
+    ReportPtr->Signed[1]   = 1;
+    ReportPtr->Deadband[1] = 30000;
+
+    PktPtr = MD_GetDwellPktBuf(TableIndex);
+    memset(PktPtr->Payload.Data, 0, TblPtr->DataSize);
+    memset(ReportPtr->LastReported, 0, TblPtr->DataSize);
+
+    /* Execute the function being tested, -100 to +100 is a step of 200 */
+    Value8 = -100;
+    memcpy(&ReportPtr->LastReported[0], &Value8, sizeof(Value8));
+    Value8 = 100;
+    memcpy(&PktPtr->Payload.Data[0], &Value8, sizeof(Value8));
+    UtAssert_BOOL_TRUE(MD_DwellDataChanged(TableIndex));
+
+    /* -20 to +20 is within the deadband */
+    Value8 = -20;
+    memcpy(&ReportPtr->LastReported[0], &Value8, sizeof(Value8));
+    Value8 = 20;
+    memcpy(&PktPtr->Payload.Data[0], &Value8, sizeof(Value8));
+    UtAssert_BOOL_FALSE(MD_DwellDataChanged(TableIndex));
+
+    /* Most negative to most positive 2 byte value */
+    Value16 = -32768;
+    memcpy(&ReportPtr->LastReported[1], &Value16, sizeof(Value16));
+    Value16 = 32767;
+    memcpy(&PktPtr->Payload.Data[1], &Value16, sizeof(Value16));
+    UtAssert_BOOL_TRUE(MD_DwellDataChanged(TableIndex));
+}
+
+void MD_DwellDataChanged_Test_Unread(void)
+{
+    uint16         TableIndex  = 0;
+    int32          UnreadEntry = 0;
+    MD_DwellPkt_t *PktPtr;
+
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+
+    PktPtr = MD_GetDwellPktBuf(TableIndex);
+    memset(PktPtr->Payload.Data, 0, TblPtr->DataSize);
+    memset(ReportPtr->LastReported, 0, TblPtr->DataSize);
+
+    UT_SetHandlerFunction(UT_KEY(MD_DwellEntryUnread), MD_DWELL_PKT_TEST_MD_DwellEntryUnreadHandler, &UnreadEntry);
+
+    /* Execute the function being tested, an entry without a value hasn't moved */
+    PktPtr->Payload.Data[0] = 0x40;
+    UtAssert_BOOL_FALSE(MD_DwellDataChanged(TableIndex));
+
+    /* Once it is read again it has */
+    UnreadEntry = -1;
+    UtAssert_BOOL_TRUE(MD_DwellDataChanged(TableIndex));
+}
+
+void MD_SaveReportedDwellData_Test_Unread(void)
+{
+    uint16         TableIndex  = 0;
+    int32          UnreadEntry = 1;
+    MD_DwellPkt_t *PktPtr;
+
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+    TblPtr->FailingEntries = 1;
+
+    PktPtr = MD_GetDwellPktBuf(TableIndex);
+    memset(PktPtr->Payload.Data, 0, TblPtr->DataSize);
+    memset(ReportPtr->LastReported, 0x33, TblPtr->DataSize);
+
+    UT_SetHandlerFunction(UT_KEY(MD_DwellEntryUnread), MD_DWELL_PKT_TEST_MD_DwellEntryUnreadHandler, &UnreadEntry);
+
+    /* Execute the function being tested */
+    MD_SaveReportedDwellData(TableIndex);
+
+    /* Verify results, the 2 byte entry keeps the value last reported */
+    UtAssert_UINT32_EQ(ReportPtr->LastReported[0], 0);
+    UtAssert_UINT32_EQ(ReportPtr->LastReported[1], 0x33);
+    UtAssert_UINT32_EQ(ReportPtr->LastReported[2], 0x33);
+    UtAssert_UINT32_EQ(ReportPtr->LastReported[3], 0);
+    UtAssert_UINT32_EQ(ReportPtr->LastReported[TblPtr->DataSize - 1], 0);
+    UtAssert_STUB_COUNT(MD_DwellEntryUnread, 4);
+}
+
+void MD_DwellPktReportDue_Test_NoHeartbeat(void)
+{
+    uint16 TableIndex = 0;
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MD_DwellPktReportDue(TableIndex));
+    UtAssert_BOOL_TRUE(MD_DwellPktReportDue(TableIndex));
+}
+
+void MD_DwellPktReportDue_Test_Heartbeat(void)
+{
+    uint16         TableIndex = 0;
+    MD_DwellPkt_t *PktPtr;
+
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+    TblPtr->HeartbeatInterval = 3;
+
+    PktPtr = MD_GetDwellPktBuf(TableIndex);
+    memset(PktPtr->Payload.Data, 0x55, TblPtr->DataSize);
+
+    /* First cycle is reported and becomes the reference */
+    UtAssert_BOOL_TRUE(MD_DwellPktReportDue(TableIndex));
+    UtAssert_INT32_EQ(ReportPtr->LastReported[0], 0x55);
+    UtAssert_INT32_EQ(TblPtr->HeartbeatCountdown, 2);
+
+    /* Unchanged cycles are suppressed until the heartbeat */
+    UtAssert_BOOL_FALSE(MD_DwellPktReportDue(TableIndex));
+    UtAssert_BOOL_FALSE(MD_DwellPktReportDue(TableIndex));
+    UtAssert_BOOL_TRUE(MD_DwellPktReportDue(TableIndex));
+    UtAssert_INT32_EQ(TblPtr->HeartbeatCountdown, 2);
+
+    /* A change is reported right away and restarts the heartbeat */
+    UtAssert_BOOL_FALSE(MD_DwellPktReportDue(TableIndex));
+    PktPtr->Payload.Data[0] = 0x60;
+    UtAssert_BOOL_TRUE(MD_DwellPktReportDue(TableIndex));
+    UtAssert_INT32_EQ(ReportPtr->LastReported[0], 0x60);
+    UtAssert_INT32_EQ(TblPtr->HeartbeatCountdown, 2);
+}
+
+void MD_DwellPktReportDue_Test_PartialCycle(void)
+{
+    uint16 TableIndex = 0;
+
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+    TblPtr->HeartbeatInterval  = 3;
+    TblPtr->HeartbeatCountdown = 2;
+    TblPtr->PktOffset          = 1;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MD_DwellPktReportDue(TableIndex));
+
+    /* Verify results */
+    UtAssert_INT32_EQ(TblPtr->HeartbeatCountdown, 0);
+}
+
+void MD_SendDwellPkt_Test_Suppressed(void)
+{
+    uint16         TableIndex = 1;
+    MD_DwellPkt_t *PktPtr;
+
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+    TblPtr->HeartbeatInterval  = 10;
+    TblPtr->HeartbeatCountdown = 5;
+
+    PktPtr = MD_GetDwellPktBuf(TableIndex);
+    memset(PktPtr->Payload.Data, 0, TblPtr->DataSize);
+    memset(ReportPtr->LastReported, 0, TblPtr->DataSize);
+
+    /* Execute the function being tested */
+    MD_SendDwellPkt(TableIndex);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(TblPtr->HeartbeatCountdown, 4);
+    UtAssert_ADDRESS_EQ(TblPtr->PktBuf, PktPtr);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[TableIndex].PktSuppressedCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[TableIndex].PktSentCount, 0);
+}
+
+void MD_SendDwellPkt_Test_Encoded(void)
+{
+    uint16         TableIndex = 1;
+    MD_DwellPkt_t *PktPtr;
+
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+    MD_DwellEncPkt_t *       EncPtr = &MD_AppData.MD_DwellEncPkt[TableIndex];
+
+    TblPtr->AddrCount        = 2;
+    TblPtr->Rate             = 4;
+    TblPtr->DataSize         = 3;
+    TblPtr->KeyframeInterval = 3;
+    TblPtr->PktOffset        = 3;
+
+    MD_UpdateDwellPktTemplate(TableIndex);
+
+    PktPtr                  = MD_GetDwellPktBuf(TableIndex);
+    PktPtr->Payload.Data[0] = 1;
+    PktPtr->Payload.Data[1] = 2;
+    PktPtr->Payload.Data[2] = 3;
+    memset(ReportPtr->EncodeRef, 0xFF, TblPtr->DataSize);
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_EncodeDwellData), 7);
+
+    /* Execute the function being tested */
+    MD_SendDwellPkt(TableIndex);
+
+    /* Verify results, the first packet is a keyframe */
+    UtAssert_INT32_EQ(EncPtr->Payload.TableId, 2);
+    UtAssert_INT32_EQ(EncPtr->Payload.AddrCount, 2);
+    UtAssert_INT32_EQ(EncPtr->Payload.ByteCount, 3);
+    UtAssert_INT32_EQ(EncPtr->Payload.Rate, 4);
+    UtAssert_INT32_EQ(EncPtr->Payload.Keyframe, 1);
+    UtAssert_INT32_EQ(EncPtr->Payload.EncodedSize, 7);
+    UtAssert_INT32_EQ(TblPtr->KeyframeCountdown, 2);
+    UtAssert_MemCmp(ReportPtr->EncodeRef, PktPtr->Payload.Data, 3, "Next cycle encoded against this one");
+    UtAssert_ADDRESS_EQ(TblPtr->PktBuf, PktPtr);
+
+    UtAssert_STUB_COUNT(MD_EncodeDwellData, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 2); /* template update and encoded packet */
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+}
+
+void MD_SendDwellEncPkt_Test_Delta(void)
+{
+    uint16         TableIndex = 0;
+    MD_DwellPkt_t *PktPtr;
+
+    MD_DwellPacketControl_t *TblPtr    = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr = &MD_AppData.DwellReportControl[TableIndex];
+    MD_DwellEncPkt_t *       EncPtr = &MD_AppData.MD_DwellEncPkt[TableIndex];
+
+    TblPtr->DataSize          = 4;
+    TblPtr->KeyframeInterval  = 3;
+    TblPtr->KeyframeCountdown = 2;
+
+    /* Only part of the data was read, as after a jam during the cycle */
+    PktPtr = MD_GetDwellPktBuf(TableIndex);
+    memset(PktPtr->Payload.Data, 0x11, 4);
+    TblPtr->PktOffset = 2;
+
+    /* Execute the function being tested */
+    MD_SendDwellEncPkt(TableIndex);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(EncPtr->Payload.Keyframe, 0);
+    UtAssert_INT32_EQ(TblPtr->KeyframeCountdown, 1);
+    UtAssert_INT32_EQ(PktPtr->Payload.Data[1], 0x11);
+    UtAssert_INT32_EQ(PktPtr->Payload.Data[2], 0);
+    UtAssert_INT32_EQ(PktPtr->Payload.Data[3], 0);
+    UtAssert_MemCmp(ReportPtr->EncodeRef, PktPtr->Payload.Data, 4, "Next cycle encoded against this one");
+
+    UtAssert_STUB_COUNT(MD_EncodeDwellData, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void MD_DwellEntryValue_Test(void)
+{
+    uint8  Data[4] = {0x81, 0x82, 0x83, 0x84};
+    uint16 Value16;
+    uint32 Value32;
+
+    memcpy(&Value16, Data, sizeof(Value16));
+    memcpy(&Value32, Data, sizeof(Value32));
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MD_DwellEntryValue(Data, 1), 0x81);
+    UtAssert_UINT32_EQ(MD_DwellEntryValue(Data, 2), Value16);
+    UtAssert_UINT32_EQ(MD_DwellEntryValue(Data, 4), Value32);
+    UtAssert_UINT32_EQ(MD_DwellEntryValue(Data, 3), 0);
+}
+
+void MD_DwellEntryStatsValue_Test(void)
+{
+    uint8  Data[4] = {0x81, 0x82, 0x83, 0x84};
+    uint16 Value16;
+    uint32 Value32;
+
+    memcpy(&Value16, Data, sizeof(Value16));
+    memcpy(&Value32, Data, sizeof(Value32));
+
+    /* Execute the function being tested */
+    UtAssert_True(MD_DwellEntryStatsValue(Data, 1, 0) == 0x81, "Unsigned 1 byte entry");
+    UtAssert_True(MD_DwellEntryStatsValue(Data, 4, 0) == Value32, "Unsigned 4 byte entry");
+    UtAssert_True(MD_DwellEntryStatsValue(Data, 1, 1) == -127, "Signed 1 byte entry is sign-extended");
+    UtAssert_True(MD_DwellEntryStatsValue(Data, 2, 1) == (int16)Value16, "Signed 2 byte entry is sign-extended");
+    UtAssert_True(MD_DwellEntryStatsValue(Data, 4, 1) == (int32)Value32, "Signed 4 byte entry is sign-extended");
+    UtAssert_True(MD_DwellEntryStatsValue(Data, 3, 1) == 0, "Other lengths have no value");
+}
+
+void MD_SendDwellPkt_Test_Stats(void)
+{
+    uint16                TableIndex = 1;
+    uint16                Cycle;
+    uint16                Value16 = 1000;
+    uint32                Value32;
+    MD_DwellPkt_t *       PktPtr;
+    MD_DwellEntryStats_t *StatsPtr;
+
+    MD_DwellPacketControl_t *TblPtr      = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellStatsPkt_t *     StatsPktPtr = &MD_AppData.MD_DwellStatsPkt[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+    TblPtr->StatsWindow = 3;
+
+    MD_UpdateDwellPktTemplate(TableIndex);
+
+    PktPtr = MD_GetDwellPktBuf(TableIndex);
+    memset(PktPtr->Payload.Data, 0x5A, TblPtr->DataSize);
+
+    /* Execute the function being tested for a window of cycles */
+    for (Cycle = 0; Cycle < 3; Cycle++)
+    {
+        PktPtr->Payload.Data[0] = 10 * (Cycle + 1);
+        memcpy(&PktPtr->Payload.Data[1], &Value16, sizeof(Value16));
+        Value32 = 0xFFFFFFF0 + (2 * Cycle);
+        memcpy(&PktPtr->Payload.Data[3], &Value32, sizeof(Value32));
+
+        MD_SendDwellPkt(TableIndex);
+
+        UtAssert_ADDRESS_EQ(TblPtr->PktBuf, PktPtr);
+    }
+
+    /* Verify results */
+    UtAssert_INT32_EQ(StatsPktPtr->Payload.TableId, 2);
+    UtAssert_INT32_EQ(StatsPktPtr->Payload.AddrCount, 4);
+    UtAssert_INT32_EQ(StatsPktPtr->Payload.CycleCount, 3);
+    UtAssert_INT32_EQ(TblPtr->StatsCycles, 0);
+
+    StatsPtr = &StatsPktPtr->Payload.Stats[0];
+    UtAssert_UINT32_EQ(StatsPtr->Min, 10);
+    UtAssert_UINT32_EQ(StatsPtr->Max, 30);
+    UtAssert_True(StatsPtr->Mean == 20, "Mean of 1 byte entry == 20");
+    UtAssert_True((StatsPtr->Variance > 66.66) && (StatsPtr->Variance < 66.67), "Variance of 1 byte entry == 200/3");
+
+    StatsPtr = &StatsPktPtr->Payload.Stats[1];
+    UtAssert_UINT32_EQ(StatsPtr->Min, 1000);
+    UtAssert_UINT32_EQ(StatsPtr->Max, 1000);
+    UtAssert_True(StatsPtr->Mean == 1000, "Mean of 2 byte entry == 1000");
+    UtAssert_True(StatsPtr->Variance == 0, "Variance of 2 byte entry == 0");
+
+    StatsPtr = &StatsPktPtr->Payload.Stats[2];
+    UtAssert_UINT32_EQ(StatsPtr->Min, 0xFFFFFFF0);
+    UtAssert_UINT32_EQ(StatsPtr->Max, 0xFFFFFFF4);
+    UtAssert_True(StatsPtr->Mean == (float)4294967282.0, "Mean of 4 byte entry == 0xFFFFFFF2");
+    UtAssert_True((StatsPtr->Variance > 2.66) && (StatsPtr->Variance < 2.67), "Variance of 4 byte entry == 8/3");
+
+    StatsPtr = &StatsPktPtr->Payload.Stats[3];
+    UtAssert_UINT32_EQ(StatsPtr->Min, 0);
+    UtAssert_UINT32_EQ(StatsPtr->Max, 0);
+    UtAssert_True(StatsPtr->Mean == 0, "Block entry has no statistics");
+
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 2); /* template update and statistics packet */
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+}
+
+void MD_SendDwellPkt_Test_StatsSignedAndFailed(void)
+{
+    uint16                TableIndex = 1;
+    uint16                Cycle;
+    uint8                 Value8[3]   = {0xFF, 0xFE, 0x01};
+    int32                 UnreadEntry = -1;
+    uint16                Value16;
+    uint32                Value32;
+    MD_DwellPkt_t *       PktPtr;
+    MD_DwellEntryStats_t *StatsPtr;
+
+    MD_DwellPacketControl_t *TblPtr      = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellReportControl_t *ReportPtr   = &MD_AppData.DwellReportControl[TableIndex];
+    MD_DwellStatsPkt_t *     StatsPktPtr = &MD_AppData.MD_DwellStatsPkt[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+    TblPtr->StatsWindow  = 3;
+    ReportPtr->Signed[0] = 1;
+    ReportPtr->Signed[2] = 1;
+
+    UT_SetHandlerFunction(UT_KEY(MD_DwellEntryUnread), MD_DWELL_PKT_TEST_MD_DwellEntryUnreadHandler, &UnreadEntry);
+
+    MD_UpdateDwellPktTemplate(TableIndex);
+
+    PktPtr = MD_GetDwellPktBuf(TableIndex);
+    memset(PktPtr->Payload.Data, 0x5A, TblPtr->DataSize);
+
+    /* Execute the function being tested for a window of cycles, the 2 byte entry failing in the second */
+    for (Cycle = 0; Cycle < 3; Cycle++)
+    {
+        PktPtr->Payload.Data[0] = Value8[Cycle];
+        Value16                 = (Cycle == 1) ? 0 : 1000;
+        memcpy(&PktPtr->Payload.Data[1], &Value16, sizeof(Value16));
+        Value32 = 0xFFFFFFF0 + (2 * Cycle);
+        memcpy(&PktPtr->Payload.Data[3], &Value32, sizeof(Value32));
+
+        UnreadEntry = (Cycle == 1) ? 1 : -1;
+
+        MD_SendDwellPkt(TableIndex);
+    }
+
+    /* Verify results */
+    UtAssert_INT32_EQ(StatsPktPtr->Payload.CycleCount, 3);
+
+    StatsPtr = &StatsPktPtr->Payload.Stats[0];
+    UtAssert_UINT32_EQ(StatsPtr->Min, 0xFFFFFFFE);
+    UtAssert_UINT32_EQ(StatsPtr->Max, 1);
+    UtAssert_True((StatsPtr->Mean > -0.67) && (StatsPtr->Mean < -0.66), "Mean of signed 1 byte entry == -2/3");
+
+    StatsPtr = &StatsPktPtr->Payload.Stats[1];
+    UtAssert_UINT32_EQ(StatsPtr->Min, 1000);
+    UtAssert_UINT32_EQ(StatsPtr->Max, 1000);
+    UtAssert_True(StatsPtr->Mean == 1000, "Failed read left out of mean");
+    UtAssert_True(StatsPtr->Variance == 0, "Failed read left out of variance");
+
+    StatsPtr = &StatsPktPtr->Payload.Stats[2];
+    UtAssert_UINT32_EQ(StatsPtr->Min, 0xFFFFFFF0);
+    UtAssert_UINT32_EQ(StatsPtr->Max, 0xFFFFFFF4);
+    UtAssert_True(StatsPtr->Mean == -14, "Mean of signed 4 byte entry == -14");
+    UtAssert_True((StatsPtr->Variance > 2.66) && (StatsPtr->Variance < 2.67), "Variance of 4 byte entry == 8/3");
+}
+
+void MD_SendDwellStatsPkt_Test_NeverRead(void)
+{
+    uint16                TableIndex  = 1;
+    int32                 UnreadEntry = 0;
+    MD_DwellEntryStats_t *StatsPtr;
+
+    MD_DwellPacketControl_t *TblPtr      = &MD_AppData.MD_DwellTables[TableIndex];
+    MD_DwellStatsPkt_t *     StatsPktPtr = &MD_AppData.MD_DwellStatsPkt[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+    TblPtr->StatsWindow = 1;
+
+    UT_SetHandlerFunction(UT_KEY(MD_DwellEntryUnread), MD_DWELL_PKT_TEST_MD_DwellEntryUnreadHandler, &UnreadEntry);
+
+    MD_UpdateDwellPktTemplate(TableIndex);
+    memset(MD_GetDwellPktBuf(TableIndex)->Payload.Data, 0x5A, TblPtr->DataSize);
+
+    /* Execute the function being tested */
+    MD_SendDwellPkt(TableIndex);
+
+    /* Verify results */
+    StatsPtr = &StatsPktPtr->Payload.Stats[0];
+    UtAssert_UINT32_EQ(StatsPtr->Min, 0);
+    UtAssert_UINT32_EQ(StatsPtr->Max, 0);
+    UtAssert_True(StatsPtr->Mean == 0, "Entry never read has no statistics");
+
+    StatsPtr = &StatsPktPtr->Payload.Stats[1];
+    UtAssert_UINT32_EQ(StatsPtr->Min, 0x5A5A);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void MD_AccumulateDwellStats_Test_PartialCycle(void)
+{
+    uint16 TableIndex = 0;
+
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[TableIndex];
+
+    MD_DWELL_PKT_TEST_SetupDeadbandTable(TableIndex);
+    TblPtr->StatsWindow = 1;
+    TblPtr->PktOffset   = 3;
+
+    /* Execute the function being tested */
+    MD_AccumulateDwellStats(TableIndex);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(TblPtr->StatsCycles, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+}
+
+void MD_SendDwellStatsPkt_Test_Empty(void)
+{
+    uint16 TableIndex = 0;
+
+    /* Execute the function being tested */
+    MD_SendDwellStatsPkt(TableIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+}
+
+void MD_SkipDwellData_Test(void)
+{
+    MD_DwellPkt_t SbPkt;
+
+    MD_AppData.MD_DwellTables[0].Entry[1].Length = 4;
+
+    /* Template is zeroed */
+    memset(MD_AppData.MD_DwellPkt[0].Payload.Data, 0xFF, 8);
+    MD_AppData.MD_DwellTables[0].PktBuf    = &MD_AppData.MD_DwellPkt[0];
+    MD_AppData.MD_DwellTables[0].PktOffset = 2;
+
+    /* Execute the function being tested */
+    MD_SkipDwellData(0, 1);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].PktOffset, 6);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellPkt[0].Payload.Data[1], 0xFF);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellPkt[0].Payload.Data[2], 0);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellPkt[0].Payload.Data[5], 0);
+
+    /* So is a software bus buffer */
+    memset(&SbPkt, 0xFF, sizeof(SbPkt));
+    MD_AppData.MD_DwellTables[0].PktBuf    = &SbPkt;
+    MD_AppData.MD_DwellTables[0].PktOffset = 2;
+
+    MD_SkipDwellData(0, 1);
+
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].PktOffset, 6);
+    UtAssert_UINT32_EQ(SbPkt.Payload.Data[1], 0xFF);
+    UtAssert_UINT32_EQ(SbPkt.Payload.Data[2], 0);
+    UtAssert_UINT32_EQ(SbPkt.Payload.Data[5], 0);
+    UtAssert_UINT32_EQ(SbPkt.Payload.Data[6], 0xFF);
+}
+
+void MD_GetDwellPktBuf_Test_NoBuffer(void)
+{
+    uint16 TableIndex = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_AllocateMessageBuffer), -1);
+
+    /* Execute the function being tested */
+    UtAssert_ADDRESS_EQ(MD_GetDwellPktBuf(TableIndex), &MD_AppData.MD_DwellPkt[TableIndex]);
+
+    /* Same packet until it is sent */
+    UtAssert_ADDRESS_EQ(MD_GetDwellPktBuf(TableIndex), &MD_AppData.MD_DwellPkt[TableIndex]);
+
+    MD_SendDwellPkt(TableIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, MD_INTERNAL_ZERO_COPY_DWELL_PKTS);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+}
+
+void MD_ReleaseDwellPktBuf_Test(void)
+{
+    uint16 TableIndex = 1;
+
+    /* Template packets aren't returned to the software bus */
+    MD_AppData.MD_DwellTables[TableIndex].PktBuf = &MD_AppData.MD_DwellPkt[TableIndex];
+
+    /* Execute the function being tested */
+    MD_ReleaseDwellPktBuf(TableIndex);
+
+    /* Verify results */
+    UtAssert_NULL(MD_AppData.MD_DwellTables[TableIndex].PktBuf);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 0);
+
+    MD_GetDwellPktBuf(TableIndex);
+
+    /* Execute the function being tested */
+    MD_ReleaseDwellPktBuf(TableIndex);
+
+    /* Verify results */
+    UtAssert_NULL(MD_AppData.MD_DwellTables[TableIndex].PktBuf);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, MD_INTERNAL_ZERO_COPY_DWELL_PKTS);
+}
+
+void MD_StartDwellStream_Test(void)
+{
+    uint16 TableIndex = 1;
+
+    /* Execute the function being tested */
+    MD_StartDwellStream(TableIndex);
+
+    /* Verify results */
+    UtAssert_True(MD_AppData.MD_DwellTables[TableIndex].Countdown == 1,
+                  "MD_AppData.MD_DwellTables[TableIndex].Countdown == 1");
+    UtAssert_True(MD_AppData.MD_DwellTables[TableIndex].CurrentEntry == 0,
+                  "MD_AppData.MD_DwellTables[TableIndex].CurrentEntry == 0");
+    UtAssert_True(MD_AppData.MD_DwellTables[TableIndex].PktOffset == 0,
+                  "MD_AppData.MD_DwellTables[TableIndex].PktOffset == 0");
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TableIndex].HeartbeatCountdown, 0);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TableIndex].KeyframeCountdown, 0);
+    UtAssert_UINT32_EQ(MD_AppData.DwellReportControl[TableIndex].CycleDueWakeup, 0);
+
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 1);
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.DueCount[TableIndex], 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_DwellLoop_Test_NotDue(void)
+{
+    MD_Wakeup_t Msg;
+
+    memset(&Msg, 0, sizeof(Msg));
+
+    MD_AppData.MD_DwellTables[0].AddrCount       = 1;
+    MD_AppData.MD_DwellTables[0].Enabled         = MD_Dwell_States_ENABLED;
+    MD_AppData.MD_DwellTables[0].Rate            = 3;
+    MD_AppData.MD_DwellTables[0].CurrentEntry    = 0;
+    MD_AppData.MD_DwellTables[0].Entry[0].Delay  = 3;
+    MD_AppData.MD_DwellTables[0].Entry[0].Length = 1;
+
+    MD_ScheduleDwellTable(0, 3);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_DwellLoop(&Msg), CFE_SUCCESS);
+    UtAssert_INT32_EQ(MD_DwellLoop(&Msg), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 0);
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 1);
+
+    /* Table is read on third wakeup and rescheduled by its delay */
+    UtAssert_INT32_EQ(MD_DwellLoop(&Msg), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 1);
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 1);
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.DueCount[0], 6);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_ScheduleDwellTable_Test_Ordering(void)
+{
+    uint16 TableIndex = 0;
+
+    /* Execute the function being tested */
+    MD_ScheduleDwellTable(0, 3);
+    MD_ScheduleDwellTable(1, 1);
+    MD_ScheduleDwellTable(2, 0); /* zero delay is treated as one */
+    MD_ScheduleDwellTable(3, 2);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 4);
+    UtAssert_BOOL_FALSE(MD_PopDueDwellTable(&TableIndex));
+
+    MD_AppData.DwellSchedule.WakeupCount = 1;
+    UtAssert_BOOL_TRUE(MD_PopDueDwellTable(&TableIndex));
+    UtAssert_INT32_EQ(TableIndex, 1);
+    UtAssert_BOOL_TRUE(MD_PopDueDwellTable(&TableIndex));
+    UtAssert_INT32_EQ(TableIndex, 2);
+    UtAssert_BOOL_FALSE(MD_PopDueDwellTable(&TableIndex));
+
+    MD_AppData.DwellSchedule.WakeupCount = 3;
+    UtAssert_BOOL_TRUE(MD_PopDueDwellTable(&TableIndex));
+    UtAssert_INT32_EQ(TableIndex, 3);
+    UtAssert_BOOL_TRUE(MD_PopDueDwellTable(&TableIndex));
+    UtAssert_INT32_EQ(TableIndex, 0);
+    UtAssert_BOOL_FALSE(MD_PopDueDwellTable(&TableIndex));
+
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 0);
+}
+
+void MD_ScheduleDwellTable_Test_Reschedule(void)
+{
+    uint16 TableIndex = 0;
+
+    MD_ScheduleDwellTable(0, 1);
+    MD_ScheduleDwellTable(1, 2);
+
+    /* Execute the function being tested */
+    MD_ScheduleDwellTable(0, 5);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 2);
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.Heap[0], 1);
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.DueCount[0], 5);
+
+    MD_AppData.DwellSchedule.WakeupCount = 2;
+    UtAssert_BOOL_TRUE(MD_PopDueDwellTable(&TableIndex));
+    UtAssert_INT32_EQ(TableIndex, 1);
+    UtAssert_BOOL_FALSE(MD_PopDueDwellTable(&TableIndex));
+}
+
+void MD_UnscheduleDwellTable_Test(void)
+{
+    uint16 TableIndex = 0;
+
+    MD_ScheduleDwellTable(0, 1);
+    MD_ScheduleDwellTable(1, 2);
+    MD_ScheduleDwellTable(2, 3);
+
+    /* Execute the function being tested */
+    MD_UnscheduleDwellTable(0);
+    MD_UnscheduleDwellTable(0); /* not scheduled, no effect */
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 2);
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.HeapSlot[0], 0);
+
+    MD_AppData.DwellSchedule.WakeupCount = 3;
+    UtAssert_BOOL_TRUE(MD_PopDueDwellTable(&TableIndex));
+    UtAssert_INT32_EQ(TableIndex, 1);
+    UtAssert_BOOL_TRUE(MD_PopDueDwellTable(&TableIndex));
+    UtAssert_INT32_EQ(TableIndex, 2);
+    UtAssert_BOOL_FALSE(MD_PopDueDwellTable(&TableIndex));
+}
+
+void MD_RefreshDwellSchedule_Test(void)
+{
+    MD_AppData.MD_DwellTables[0].Enabled      = MD_Dwell_States_ENABLED;
+    MD_AppData.MD_DwellTables[0].Rate         = 4;
+    MD_AppData.MD_DwellTables[0].AddrCount    = 2;
+    MD_AppData.MD_DwellTables[0].CurrentEntry = 1;
+    MD_AppData.MD_DwellTables[0].Countdown    = 4;
+
+    /* Execute the function being tested: enabled table is scheduled by its countdown */
+    MD_RefreshDwellSchedule(0);
+
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 1);
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.DueCount[0], 4);
+
+    /* Already scheduled table keeps its due count */
+    MD_AppData.DwellSchedule.WakeupCount = 1;
+    MD_RefreshDwellSchedule(0);
+
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.DueCount[0], 4);
+
+    /* Shortened table is flushed on next wakeup */
+    MD_AppData.MD_DwellTables[0].AddrCount = 1;
+    MD_RefreshDwellSchedule(0);
+
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 1);
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.DueCount[0], 2);
+
+    /* Zero rate table is removed */
+    MD_AppData.MD_DwellTables[0].Rate = 0;
+    MD_RefreshDwellSchedule(0);
+
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 0);
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.HeapSlot[0], 0);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].Countdown, 1);
+}
+
+void MD_DwellDueBefore_Test_Wrap(void)
+{
+    /* Execute the function being tested */
+    MD_AppData.DwellSchedule.DueCount[0] = 0xFFFFFFFF;
+    MD_AppData.DwellSchedule.DueCount[1] = 1;
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(MD_DwellDueBefore(0, 1));
+    UtAssert_BOOL_FALSE(MD_DwellDueBefore(1, 0));
+
+    /* Ties are broken by table index */
+    MD_AppData.DwellSchedule.DueCount[1] = 0xFFFFFFFF;
+    UtAssert_BOOL_TRUE(MD_DwellDueBefore(0, 1));
+    UtAssert_BOOL_FALSE(MD_DwellDueBefore(1, 0));
+}
+
+void MD_DWELL_PKT_TEST_SetTime(CFE_TIME_SysTime_t *TimePtr, uint32 Seconds, uint32 Microseconds)
+{
+    TimePtr->Seconds    = Seconds;
+    TimePtr->Subseconds = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), TimePtr, sizeof(*TimePtr), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), Microseconds);
+}
+
+void MD_DWELL_PKT_TEST_SetupTimedTable(uint16 TableIndex, uint32 PeriodMsec, uint32 PhaseMsec)
+{
+    MD_AppData.MD_DwellTables[TableIndex].Enabled         = MD_Dwell_States_ENABLED;
+    MD_AppData.MD_DwellTables[TableIndex].AddrCount       = 2;
+    MD_AppData.MD_DwellTables[TableIndex].DataSize        = 2;
+    MD_AppData.MD_DwellTables[TableIndex].Rate            = 10;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[0].Length = 1;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[0].Delay  = 5;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[1].Length = 1;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[1].Delay  = 5;
+
+    MD_AppData.DwellDeadlines.PeriodMsec[TableIndex] = PeriodMsec;
+    MD_AppData.DwellDeadlines.PhaseMsec[TableIndex]  = PhaseMsec;
+}
+
+void MD_GetDeadlineTime_Test(void)
+{
+    CFE_TIME_SysTime_t Time;
+
+    MD_DWELL_PKT_TEST_SetTime(&Time, 5, 250000);
+
+    /* Execute the function being tested */
+    UtAssert_True(MD_GetDeadlineTime() == 5250000, "MD_GetDeadlineTime() == 5250000");
+}
+
+void MD_ScheduleDwellDeadline_Test_Alignment(void)
+{
+    MD_AppData.DwellDeadlines.PeriodMsec[0] = 100;
+    MD_AppData.DwellDeadlines.PhaseMsec[0]  = 30;
+
+    /* Execute the function being tested: first deadline is the phase itself */
+    MD_ScheduleDwellDeadline(0, 10000);
+
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 30000, "Deadline[0] == 30000");
+    UtAssert_True(MD_AppData.DwellDeadlines.NextDeadline == 30000, "NextDeadline == 30000");
+
+    /* Later deadlines fall a whole number of periods past the phase */
+    MD_ScheduleDwellDeadline(0, 1234567);
+
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 1330000, "Deadline[0] == 1330000");
+    UtAssert_True(MD_AppData.DwellDeadlines.NextDeadline == 30000, "NextDeadline == 30000");
+
+    /* A deadline that has just been reached is not due again */
+    MD_ScheduleDwellDeadline(0, 1330000);
+
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 1430000, "Deadline[0] == 1430000");
+
+    /* A table that isn't timed gets no deadline */
+    MD_AppData.DwellDeadlines.PeriodMsec[0] = 0;
+    MD_ScheduleDwellDeadline(0, 1330000);
+
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 0, "Deadline[0] == 0");
+    UtAssert_True(MD_AppData.DwellDeadlines.NextDeadline == 30000, "NextDeadline == 30000");
+}
+
+void MD_ProcessDwellDeadlines_Test_NotDue(void)
+{
+    CFE_TIME_SysTime_t Time;
+
+    /* Execute the function being tested: no table waiting, time isn't read */
+    UtAssert_INT32_EQ(MD_ProcessDwellDeadlines(), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+
+    /* Earliest deadline not yet reached */
+    MD_DWELL_PKT_TEST_SetupTimedTable(0, 100, 0);
+    MD_AppData.DwellDeadlines.Deadline[0] = 2000000;
+    MD_AppData.DwellDeadlines.NextDeadline = 2000000;
+    MD_DWELL_PKT_TEST_SetTime(&Time, 1, 999999);
+
+    UtAssert_INT32_EQ(MD_ProcessDwellDeadlines(), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 0);
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 2000000, "Deadline[0] == 2000000");
+}
+
+void MD_ProcessDwellDeadlines_Test_Due(void)
+{
+    CFE_TIME_SysTime_t Time;
+
+    /* Tables 0 and 1 share a deadline, table 2 is due later */
+    MD_DWELL_PKT_TEST_SetupTimedTable(0, 100, 0);
+    MD_DWELL_PKT_TEST_SetupTimedTable(1, 100, 0);
+    MD_DWELL_PKT_TEST_SetupTimedTable(2, 100, 50);
+    MD_AppData.DwellDeadlines.Deadline[0]  = 1000000;
+    MD_AppData.DwellDeadlines.Deadline[1]  = 1000000;
+    MD_AppData.DwellDeadlines.Deadline[2]  = 1050000;
+    MD_AppData.DwellDeadlines.NextDeadline = 1000000;
+
+    MD_DWELL_PKT_TEST_SetTime(&Time, 1, 20000);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_ProcessDwellDeadlines(), CFE_SUCCESS);
+
+    /* Verify results: both due tables read a whole cycle despite their delays */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 4);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].PktSentCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[1].PktSentCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[2].PktSentCount, 0);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].CurrentEntry, 0);
+
+    /* Packets carry the deadline rather than the time they were sent */
+    UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 0);
+    UtAssert_True(MD_AppData.DwellDeadlines.CycleTime[0] == 1000000, "CycleTime[0] == 1000000");
+    UtAssert_True(MD_AppData.DwellDeadlines.CycleTime[1] == 1000000, "CycleTime[1] == 1000000");
+    UtAssert_UINT32_EQ(MD_AppData.DwellReportControl[0].CycleDueWakeup, 0);
+
+    /* Due tables move to their next deadline, which leaves table 2 the earliest */
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 1100000, "Deadline[0] == 1100000");
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[1] == 1100000, "Deadline[1] == 1100000");
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[2] == 1050000, "Deadline[2] == 1050000");
+    UtAssert_True(MD_AppData.DwellDeadlines.NextDeadline == 1050000, "NextDeadline == 1050000");
+
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].CycleOverrunCount, 0);
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_ProcessDwellDeadlines_Test_Overrun(void)
+{
+    CFE_TIME_SysTime_t Time;
+
+    MD_DWELL_PKT_TEST_SetupTimedTable(0, 100, 0);
+    MD_DWELL_PKT_TEST_SetupTimedTable(1, 100, 0);
+    MD_AppData.MD_DwellTables[1].AddrCount = 0;
+    MD_AppData.DwellDeadlines.Deadline[0]  = 1000000;
+    MD_AppData.DwellDeadlines.Deadline[1]  = 1000000;
+    MD_AppData.DwellDeadlines.NextDeadline = 1000000;
+
+    /* More than a period past the deadline */
+    MD_DWELL_PKT_TEST_SetTime(&Time, 1, 250000);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead8), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_ProcessDwellDeadlines(), -1);
+
+    /* Verify results: deadlines that went by are skipped, not made up */
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].CycleOverrunCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].ReadErrCount, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 2);
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 1300000, "Deadline[0] == 1300000");
+
+    /* A table with nothing to read keeps its deadlines */
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[1].SampleCount, 0);
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[1] == 1300000, "Deadline[1] == 1300000");
+    UtAssert_True(MD_AppData.DwellDeadlines.NextDeadline == 1300000, "NextDeadline == 1300000");
+}
+
+void MD_DwellLoop_Test_Deadlines(void)
+{
+    MD_Wakeup_t        Msg;
+    CFE_TIME_SysTime_t Time;
+
+    memset(&Msg, 0, sizeof(Msg));
+
+    MD_DWELL_PKT_TEST_SetupTimedTable(0, 100, 0);
+    MD_AppData.DwellDeadlines.Deadline[0]  = 1000000;
+    MD_AppData.DwellDeadlines.NextDeadline = 1000000;
+    MD_DWELL_PKT_TEST_SetTime(&Time, 1, 0);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_DwellLoop(&Msg), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 2);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].PktSentCount, 1);
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 1100000, "Deadline[0] == 1100000");
+}
+
+void MD_TimeStampDwellPkt_Test(void)
+{
+    MD_DwellPkt_t Pkt;
+
+    /* Execute the function being tested: untimed tables carry the current time */
+    MD_TimeStampDwellPkt(0, CFE_MSG_PTR(Pkt.TelemetryHeader));
+
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 0);
+
+    /* Timed tables carry their cycle's deadline */
+    MD_AppData.DwellDeadlines.PeriodMsec[0] = 100;
+    MD_AppData.DwellDeadlines.CycleTime[0]  = 5250000;
+
+    MD_TimeStampDwellPkt(0, CFE_MSG_PTR(Pkt.TelemetryHeader));
+
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_SetMsgTime, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Micro2SubSecs, 1);
+}
+
+void MD_ProcessDwellTable_Test_Timed(void)
+{
+    MD_DWELL_PKT_TEST_SetupTimedTable(0, 100, 0);
+
+    /* Execute the function being tested: the whole cycle is read despite the delays */
+    UtAssert_INT32_EQ(MD_ProcessDwellTable(0), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 2);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].PktSentCount, 1);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[0].CurrentEntry, 0);
+
+    /* A cycle with no delays at all is still only read once */
+    MD_AppData.MD_DwellTables[0].Entry[0].Delay = 0;
+    MD_AppData.MD_DwellTables[0].Entry[1].Delay = 0;
+
+    UtAssert_INT32_EQ(MD_ProcessDwellTable(0), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 4);
+    UtAssert_UINT32_EQ(MD_AppData.DwellCounters[0].PktSentCount, 2);
+}
+
+void MD_RefreshDwellSchedule_Test_Timed(void)
+{
+    CFE_TIME_SysTime_t Time;
+
+    MD_DWELL_PKT_TEST_SetupTimedTable(0, 0, 0);
+    MD_AppData.MD_DwellTables[0].Countdown = 4;
+    MD_RefreshDwellSchedule(0);
+
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 1);
+
+    /* Execute the function being tested: a timed table leaves the wakeup schedule for a deadline */
+    MD_AppData.DwellDeadlines.PeriodMsec[0] = 100;
+    MD_DWELL_PKT_TEST_SetTime(&Time, 1, 0);
+
+    MD_RefreshDwellSchedule(0);
+
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 0);
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 1100000, "Deadline[0] == 1100000");
+
+    /* A table already waiting keeps its deadline */
+    MD_RefreshDwellSchedule(0);
+
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 1100000, "Deadline[0] == 1100000");
+
+    /* Disabled tables stop waiting */
+    MD_AppData.MD_DwellTables[0].Enabled = MD_Dwell_States_DISABLED;
+    MD_RefreshDwellSchedule(0);
+
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 0, "Deadline[0] == 0");
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 0);
+}
+
+void MD_StartDwellStream_Test_Timed(void)
+{
+    CFE_TIME_SysTime_t Time;
+
+    MD_DWELL_PKT_TEST_SetupTimedTable(0, 100, 20);
+    MD_DWELL_PKT_TEST_SetTime(&Time, 1, 0);
+
+    /* Execute the function being tested */
+    MD_StartDwellStream(0);
+
+    /* Verify results: first read is on the next deadline, not the next wakeup */
+    UtAssert_INT32_EQ(MD_AppData.DwellSchedule.NumScheduled, 0);
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[0] == 1020000, "Deadline[0] == 1020000");
 }
 
 void UtTest_Setup(void)
@@ -596,6 +2575,18 @@ void UtTest_Setup(void)
                "MD_DwellLoop_Test_MoreAddressesToRead");
     UtTest_Add(MD_DwellLoop_Test_ZeroRate, MD_Test_Setup, MD_Test_TearDown, "MD_DwellLoop_Test_ZeroRate");
     UtTest_Add(MD_DwellLoop_Test_DataError, MD_Test_Setup, MD_Test_TearDown, "MD_DwellLoop_Test_DataError");
+    UtTest_Add(MD_DwellLoop_Test_CatchUp, MD_Test_Setup, MD_Test_TearDown, "MD_DwellLoop_Test_CatchUp");
+
+    UtTest_Add(MD_CountWakeups_Test_First, MD_Test_Setup, MD_Test_TearDown, "MD_CountWakeups_Test_First");
+    UtTest_Add(MD_CountWakeups_Test_SameSeqCount, MD_Test_Setup, MD_Test_TearDown,
+               "MD_CountWakeups_Test_SameSeqCount");
+    UtTest_Add(MD_CountWakeups_Test_NextSeqCount, MD_Test_Setup, MD_Test_TearDown,
+               "MD_CountWakeups_Test_NextSeqCount");
+    UtTest_Add(MD_CountWakeups_Test_CatchUp, MD_Test_Setup, MD_Test_TearDown, "MD_CountWakeups_Test_CatchUp");
+    UtTest_Add(MD_CountWakeups_Test_Rephase, MD_Test_Setup, MD_Test_TearDown, "MD_CountWakeups_Test_Rephase");
+    UtTest_Add(MD_CountWakeups_Test_Wrap, MD_Test_Setup, MD_Test_TearDown, "MD_CountWakeups_Test_Wrap");
+    UtTest_Add(MD_CountRephase_Test_Backoff, MD_Test_Setup, MD_Test_TearDown, "MD_CountRephase_Test_Backoff");
+    UtTest_Add(MD_CountRephase_Test_Saturated, MD_Test_Setup, MD_Test_TearDown, "MD_CountRephase_Test_Saturated");
 
     UtTest_Add(MD_GetDwellData_Test_MemRead8Error, MD_Test_Setup, MD_Test_TearDown,
                "MD_GetDwellData_Test_MemRead8Error");
@@ -607,8 +2598,100 @@ void UtTest_Setup(void)
     UtTest_Add(MD_GetDwellData_Test_InvalidDwellLength, MD_Test_Setup, MD_Test_TearDown,
                "MD_GetDwellData_Test_InvalidDwellLength");
     UtTest_Add(MD_GetDwellData_Test_Success, MD_Test_Setup, MD_Test_TearDown, "MD_GetDwellData_Test_Success");
+    UtTest_Add(MD_GetDwellData_Test_BlockSuccess, MD_Test_Setup, MD_Test_TearDown,
+               "MD_GetDwellData_Test_BlockSuccess");
+    UtTest_Add(MD_GetDwellData_Test_BlockError, MD_Test_Setup, MD_Test_TearDown, "MD_GetDwellData_Test_BlockError");
 
     UtTest_Add(MD_SendDwellPkt_Test, MD_Test_Setup, MD_Test_TearDown, "MD_SendDwellPkt_Test");
     UtTest_Add(MD_NoDwellRate_Test, MD_Test_Setup, MD_Test_TearDown, "MD_NoDwellRate_Test");
+#if MD_INTERNAL_ZERO_COPY_DWELL_PKTS == 1
+    UtTest_Add(MD_SendDwellPkt_Test_ZeroCopy, MD_Test_Setup, MD_Test_TearDown, "MD_SendDwellPkt_Test_ZeroCopy");
+    UtTest_Add(MD_SendDwellPkt_Test_TransmitBufferError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SendDwellPkt_Test_TransmitBufferError");
+    UtTest_Add(MD_GetDwellData_Test_ZeroCopyReadError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_GetDwellData_Test_ZeroCopyReadError");
+#endif
+
+    UtTest_Add(MD_SendDwellPkt_Test_Batched, MD_Test_Setup, MD_Test_TearDown, "MD_SendDwellPkt_Test_Batched");
+    UtTest_Add(MD_SendDwellPkt_Test_FlushBatch, MD_Test_Setup, MD_Test_TearDown, "MD_SendDwellPkt_Test_FlushBatch");
+    UtTest_Add(MD_BatchDwellPkt_Test_TimeOffsetLimit, MD_Test_Setup, MD_Test_TearDown,
+               "MD_BatchDwellPkt_Test_TimeOffsetLimit");
+    UtTest_Add(MD_BatchDwellPkt_Test_Full, MD_Test_Setup, MD_Test_TearDown, "MD_BatchDwellPkt_Test_Full");
+    UtTest_Add(MD_SendDwellBatchPkt_Test_Empty, MD_Test_Setup, MD_Test_TearDown, "MD_SendDwellBatchPkt_Test_Empty");
+
+    UtTest_Add(MD_DwellDataChanged_Test, MD_Test_Setup, MD_Test_TearDown, "MD_DwellDataChanged_Test");
+    UtTest_Add(MD_DwellDataChanged_Test_LargeUnsignedStep, MD_Test_Setup, MD_Test_TearDown,
+               "MD_DwellDataChanged_Test_LargeUnsignedStep");
+    UtTest_Add(MD_DwellDataChanged_Test_SignedAcrossZero, MD_Test_Setup, MD_Test_TearDown,
+               "MD_DwellDataChanged_Test_SignedAcrossZero");
+    UtTest_Add(MD_DwellDataChanged_Test_Unread, MD_Test_Setup, MD_Test_TearDown, "MD_DwellDataChanged_Test_Unread");
+    UtTest_Add(MD_SaveReportedDwellData_Test_Unread, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SaveReportedDwellData_Test_Unread");
+    UtTest_Add(MD_DwellPktReportDue_Test_NoHeartbeat, MD_Test_Setup, MD_Test_TearDown,
+               "MD_DwellPktReportDue_Test_NoHeartbeat");
+    UtTest_Add(MD_DwellPktReportDue_Test_Heartbeat, MD_Test_Setup, MD_Test_TearDown,
+               "MD_DwellPktReportDue_Test_Heartbeat");
+    UtTest_Add(MD_DwellPktReportDue_Test_PartialCycle, MD_Test_Setup, MD_Test_TearDown,
+               "MD_DwellPktReportDue_Test_PartialCycle");
+    UtTest_Add(MD_SendDwellPkt_Test_Suppressed, MD_Test_Setup, MD_Test_TearDown, "MD_SendDwellPkt_Test_Suppressed");
+
+    UtTest_Add(MD_SendDwellPkt_Test_Encoded, MD_Test_Setup, MD_Test_TearDown, "MD_SendDwellPkt_Test_Encoded");
+    UtTest_Add(MD_SendDwellEncPkt_Test_Delta, MD_Test_Setup, MD_Test_TearDown, "MD_SendDwellEncPkt_Test_Delta");
+
+    UtTest_Add(MD_DwellEntryValue_Test, MD_Test_Setup, MD_Test_TearDown, "MD_DwellEntryValue_Test");
+    UtTest_Add(MD_DwellEntryStatsValue_Test, MD_Test_Setup, MD_Test_TearDown, "MD_DwellEntryStatsValue_Test");
+    UtTest_Add(MD_SendDwellPkt_Test_Stats, MD_Test_Setup, MD_Test_TearDown, "MD_SendDwellPkt_Test_Stats");
+    UtTest_Add(MD_SendDwellPkt_Test_StatsSignedAndFailed, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SendDwellPkt_Test_StatsSignedAndFailed");
+    UtTest_Add(MD_SendDwellStatsPkt_Test_NeverRead, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SendDwellStatsPkt_Test_NeverRead");
+    UtTest_Add(MD_AccumulateDwellStats_Test_PartialCycle, MD_Test_Setup, MD_Test_TearDown,
+               "MD_AccumulateDwellStats_Test_PartialCycle");
+    UtTest_Add(MD_SendDwellStatsPkt_Test_Empty, MD_Test_Setup, MD_Test_TearDown, "MD_SendDwellStatsPkt_Test_Empty");
+
+    UtTest_Add(MD_SkipDwellData_Test, MD_Test_Setup, MD_Test_TearDown, "MD_SkipDwellData_Test");
+    UtTest_Add(MD_GetDwellPktBuf_Test_NoBuffer, MD_Test_Setup, MD_Test_TearDown, "MD_GetDwellPktBuf_Test_NoBuffer");
+    UtTest_Add(MD_ReleaseDwellPktBuf_Test, MD_Test_Setup, MD_Test_TearDown, "MD_ReleaseDwellPktBuf_Test");
     UtTest_Add(MD_StartDwellStream_Test, MD_Test_Setup, MD_Test_TearDown, "MD_StartDwellStream_Test");
+
+    UtTest_Add(MD_DwellLoop_Test_NotDue, MD_Test_Setup, MD_Test_TearDown, "MD_DwellLoop_Test_NotDue");
+    UtTest_Add(MD_ScheduleDwellTable_Test_Ordering, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ScheduleDwellTable_Test_Ordering");
+    UtTest_Add(MD_ScheduleDwellTable_Test_Reschedule, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ScheduleDwellTable_Test_Reschedule");
+    UtTest_Add(MD_UnscheduleDwellTable_Test, MD_Test_Setup, MD_Test_TearDown, "MD_UnscheduleDwellTable_Test");
+    UtTest_Add(MD_RefreshDwellSchedule_Test, MD_Test_Setup, MD_Test_TearDown, "MD_RefreshDwellSchedule_Test");
+    UtTest_Add(MD_DwellDueBefore_Test_Wrap, MD_Test_Setup, MD_Test_TearDown, "MD_DwellDueBefore_Test_Wrap");
+
+    UtTest_Add(MD_GetDwellBlockData_Test_Success, MD_Test_Setup, MD_Test_TearDown, "MD_GetDwellBlockData_Test_Success");
+    UtTest_Add(MD_GetDwellBlockData_Test_Error, MD_Test_Setup, MD_Test_TearDown, "MD_GetDwellBlockData_Test_Error");
+    UtTest_Add(MD_CompileDwellPlan_Test, MD_Test_Setup, MD_Test_TearDown, "MD_CompileDwellPlan_Test");
+    UtTest_Add(MD_CompileDwellPlan_Test_SnapshotGroup, MD_Test_Setup, MD_Test_TearDown,
+               "MD_CompileDwellPlan_Test_SnapshotGroup");
+    UtTest_Add(MD_ProcessDwellTable_Test_PlanMatchesPerEntry, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ProcessDwellTable_Test_PlanMatchesPerEntry");
+    UtTest_Add(MD_ProcessDwellTable_Test_BlockReadFallback, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ProcessDwellTable_Test_BlockReadFallback");
+    UtTest_Add(MD_ProcessDwellTable_Test_SnapshotGroup, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ProcessDwellTable_Test_SnapshotGroup");
+    UtTest_Add(MD_ProcessDwellTable_Test_Quarantined, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ProcessDwellTable_Test_Quarantined");
+    UtTest_Add(MD_DwellLoop_Test_MaxSampleTime, MD_Test_Setup, MD_Test_TearDown, "MD_DwellLoop_Test_MaxSampleTime");
+    UtTest_Add(MD_SendDwellPkt_Test_CycleOverrun, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SendDwellPkt_Test_CycleOverrun");
+
+    UtTest_Add(MD_GetDeadlineTime_Test, MD_Test_Setup, MD_Test_TearDown, "MD_GetDeadlineTime_Test");
+    UtTest_Add(MD_ScheduleDwellDeadline_Test_Alignment, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ScheduleDwellDeadline_Test_Alignment");
+    UtTest_Add(MD_ProcessDwellDeadlines_Test_NotDue, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ProcessDwellDeadlines_Test_NotDue");
+    UtTest_Add(MD_ProcessDwellDeadlines_Test_Due, MD_Test_Setup, MD_Test_TearDown, "MD_ProcessDwellDeadlines_Test_Due");
+    UtTest_Add(MD_ProcessDwellDeadlines_Test_Overrun, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ProcessDwellDeadlines_Test_Overrun");
+    UtTest_Add(MD_DwellLoop_Test_Deadlines, MD_Test_Setup, MD_Test_TearDown, "MD_DwellLoop_Test_Deadlines");
+    UtTest_Add(MD_TimeStampDwellPkt_Test, MD_Test_Setup, MD_Test_TearDown, "MD_TimeStampDwellPkt_Test");
+    UtTest_Add(MD_ProcessDwellTable_Test_Timed, MD_Test_Setup, MD_Test_TearDown, "MD_ProcessDwellTable_Test_Timed");
+    UtTest_Add(MD_RefreshDwellSchedule_Test_Timed, MD_Test_Setup, MD_Test_TearDown,
+               "MD_RefreshDwellSchedule_Test_Timed");
+    UtTest_Add(MD_StartDwellStream_Test_Timed, MD_Test_Setup, MD_Test_TearDown, "MD_StartDwellStream_Test_Timed");
 }
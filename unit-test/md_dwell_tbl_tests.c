@@ -22,6 +22,8 @@
 
 #include "md_dwell_tbl.h"
 #include "md_utils.h"
+#include "md_dwell_pkt.h"
+#include "md_symcache.h"
 #include "md_msg.h"
 #include "md_msgdefs.h"
 #include "md_eventids.h"
@@ -44,6 +46,18 @@ uint8 call_count_CFE_EVS_SendEvent;
 
 MD_DwellTableLoad_t MD_DWELL_TBL_TEST_GlobalLoadTable;
 
+/* Resolves every address to its offset */
+int32 MD_DWELL_TBL_TEST_MD_ResolveSymAddrHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                              const UT_StubContext_t *Context)
+{
+    const MD_SymAddr_t *SymAddr      = UT_Hook_GetArgValueByName(Context, "SymAddr", const MD_SymAddr_t *);
+    cpuaddr *           ResolvedAddr = UT_Hook_GetArgValueByName(Context, "ResolvedAddr", cpuaddr *);
+
+    *ResolvedAddr = SymAddr->Offset;
+
+    return true;
+}
+
 void MD_TableValidationFunc_Test_InvalidEnableFlag(void)
 {
     int32               Result;
@@ -248,6 +262,30 @@ void MD_TableValidationFunc_Test_NullPtr(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_TableValidationFunc_Test_NoTable(void)
+{
+    int32               Result;
+    MD_DwellTableLoad_t Table;
+
+    memset(&Table, 0, sizeof(Table));
+
+    Table.Enabled = MD_Dwell_States_ENABLED;
+
+    /* MD isn't validating any of its tables */
+    MD_AppData.CompileTblIndex = MD_INTERFACE_NUM_DWELL_TABLES;
+
+    /* Execute the function being tested */
+    Result = MD_TableValidationFunc(&Table);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, MD_ERROR);
+    UtAssert_STUB_COUNT(MD_ResolveSymAddr, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_TBL_VAL_NO_TBL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void MD_TableValidationFunc_Test_InvalidLength(void)
 {
     int32               Result;
@@ -295,6 +333,95 @@ void MD_TableValidationFunc_Test_InvalidLength(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_TableValidationFunc_Test_SnapshotGroup(void)
+{
+    int32               Result;
+    MD_DwellTableLoad_t Table;
+
+    memset(&Table, 0, sizeof(Table));
+
+    Table.Enabled = MD_Dwell_States_ENABLED;
+
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+    strncpy(Table.Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
+#endif
+
+    Table.Entry[0].Length        = 1;
+    Table.Entry[0].Delay         = 1;
+    Table.Entry[1].Length        = 1;
+    Table.Entry[1].Delay         = 1;
+    Table.Entry[1].SnapshotGroup = MD_INTERNAL_NUM_SNAPSHOT_GROUPS + 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+
+    /* Execute the function being tested */
+    Result = MD_TableValidationFunc(&Table);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, MD_SNAPSHOT_GROUP_ERROR);
+    UtAssert_BOOL_FALSE(MD_AppData.CompiledTables[0].Ready);
+    UtAssert_UINT32_EQ(MD_AppData.CompiledTables[0].Sequence, 2);
+
+    /* Entry error and totals events come first */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, MD_TBL_SNAPSHOT_GROUP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MD_TableValidationFunc_Test_DataSize(void)
+{
+    int32               Result;
+    MD_DwellTableLoad_t Table;
+    uint16              i;
+    uint32              DataSize = 0;
+    int32               strCmpResult;
+    char                ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    memset(&Table, 0, sizeof(Table));
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Dwell Table rejected because entry #%%d exceeds the %%d byte dwell packet");
+
+    Table.Enabled = MD_Dwell_States_ENABLED;
+
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+    strncpy(Table.Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
+#endif
+
+    /* Block dwells that are each valid but together overrun the dwell packet */
+    for (i = 0; DataSize <= MD_INTERFACE_DWELL_PKT_DATA_SIZE; i++)
+    {
+        Table.Entry[i].Length = MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH;
+        Table.Entry[i].Delay  = 1;
+        DataSize += Table.Entry[i].Length;
+    }
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+
+    /* Execute the function being tested */
+    Result = MD_TableValidationFunc(&Table);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, MD_DATA_SIZE_TBL_ERROR);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, MD_TBL_DATA_SIZE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[2].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[2].Spec);
+
+    /* Generates 2 messages we don't care about */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 3, "CFE_EVS_SendEvent was called %u time(s), expected 3",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void MD_TableValidationFunc_Test_NotAligned(void)
 {
     int32               Result;
@@ -344,6 +471,58 @@ void MD_TableValidationFunc_Test_NotAligned(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_TableValidationFunc_Test_BatchSize(void)
+{
+    int32               Result;
+    MD_DwellTableLoad_t Table;
+    uint16              i;
+    int32               strCmpResult;
+    char                ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    memset(&Table, 0, sizeof(Table));
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Dwell Table rejected because %%d batched cycles of %%d bytes exceed the %%d byte batched dwell packet");
+
+    Table.Enabled     = MD_Dwell_States_ENABLED;
+    Table.BatchFactor = 1000;
+
+#if MD_INTERFACE_SIGNATURE_OPTION == 1
+    strncpy(Table.Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
+#endif
+
+    for (i = 0; i < MD_INTERFACE_DWELL_TABLE_SIZE; i++)
+    {
+        Table.Entry[i].Length = 1;
+        Table.Entry[i].Delay  = 1;
+    }
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidBatchFactor), false);
+
+    /* Execute the function being tested */
+    Result = MD_TableValidationFunc(&Table);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, MD_BATCH_SIZE_TBL_ERROR);
+    UtAssert_BOOL_FALSE(MD_AppData.CompiledTables[0].Ready);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MD_TBL_BATCH_SIZE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    /* Generates 1 message we don't care about here */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void MD_TableValidationFunc_Test_ZeroRate(void)
 {
     int32               Result;
@@ -355,7 +534,8 @@ void MD_TableValidationFunc_Test_ZeroRate(void)
     snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Dwell Table is enabled but no processing will occur for table being loaded (rate is zero)");
 
-    Table.Enabled = MD_Dwell_States_ENABLED;
+    Table.Enabled    = MD_Dwell_States_ENABLED;
+    Table.PeriodMsec = 0;
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     strncpy(Table.Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
@@ -368,12 +548,14 @@ void MD_TableValidationFunc_Test_ZeroRate(void)
         Table.Entry[i].DwellAddress.Offset = 0;
         Table.Entry[i].Length              = 1;
         Table.Entry[i].Delay               = 0;
+        Table.Entry[i].SnapshotGroup       = 0;
     }
 
     /* Set to make MD_CheckTableEntries return SUCCESS */
     UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
     UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
     UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidBatchFactor), true);
 
     /* Execute the function being tested */
     Result = MD_TableValidationFunc(&Table);
@@ -396,13 +578,66 @@ void MD_TableValidationFunc_Test_ZeroRate(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_TableValidationFunc_Test_Phase(void)
+{
+    int32               Result;
+    MD_DwellTableLoad_t Table;
+
+    memset(&Table, 0, sizeof(Table));
+
+    Table.Enabled    = MD_Dwell_States_ENABLED;
+    Table.PeriodMsec = 100;
+    Table.PhaseMsec  = 100;
+
+    /* Execute the function being tested */
+    Result = MD_TableValidationFunc(&Table);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, MD_PHASE_TBL_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_TBL_PHASE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(MD_RefreshSymCache, 0);
+}
+
+void MD_TableValidationFunc_Test_TimedZeroRate(void)
+{
+    int32               Result;
+    MD_DwellTableLoad_t Table;
+
+    memset(&Table, 0, sizeof(Table));
+
+    /* A timed table with no delays is read on its deadlines, so isn't reported */
+    Table.Enabled    = MD_Dwell_States_ENABLED;
+    Table.PeriodMsec = 100;
+    Table.PhaseMsec  = 99;
+
+    strncpy(Table.Entry[0].DwellAddress.SymName, "symname", sizeof(Table.Entry[0].DwellAddress.SymName));
+    Table.Entry[0].Length = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidBatchFactor), true);
+
+    /* Execute the function being tested */
+    Result = MD_TableValidationFunc(&Table);
+
+    /* Verify results: only the entry count event */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_True(context_CFE_EVS_SendEvent[0].EventID != MD_ZERO_RATE_TBL_INF_EID,
+                  "Zero rate event not sent for timed table");
+}
+
 void MD_TableValidationFunc_Test_SuccessStreamDisabled(void)
 {
     int32               Result;
     MD_DwellTableLoad_t Table;
     uint16              i;
 
-    Table.Enabled = MD_Dwell_States_DISABLED;
+    Table.Enabled    = MD_Dwell_States_DISABLED;
+    Table.PeriodMsec = 0;
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     strncpy(Table.Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
@@ -415,12 +650,14 @@ void MD_TableValidationFunc_Test_SuccessStreamDisabled(void)
         Table.Entry[i].DwellAddress.Offset = 0;
         Table.Entry[i].Length              = 1;
         Table.Entry[i].Delay               = 1;
+        Table.Entry[i].SnapshotGroup       = 0;
     }
 
     /* Set to make MD_CheckTableEntries return SUCCESS */
     UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
     UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
     UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidBatchFactor), true);
 
     /* Execute the function being tested */
     Result = MD_TableValidationFunc(&Table);
@@ -441,7 +678,8 @@ void MD_TableValidationFunc_Test_Success(void)
     MD_DwellTableLoad_t Table;
     uint16              i;
 
-    Table.Enabled = MD_Dwell_States_ENABLED;
+    Table.Enabled    = MD_Dwell_States_ENABLED;
+    Table.PeriodMsec = 0;
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     strncpy(Table.Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
@@ -454,12 +692,17 @@ void MD_TableValidationFunc_Test_Success(void)
         Table.Entry[i].DwellAddress.Offset = 0;
         Table.Entry[i].Length              = 1;
         Table.Entry[i].Delay               = 1;
+        Table.Entry[i].SnapshotGroup       = 0;
     }
 
+    /* Validation compiles the table MD_ManageDwellTable is managing */
+    MD_AppData.CompileTblIndex = 1;
+
     /* Set to make MD_CheckTableEntries return SUCCESS */
     UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
     UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
     UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidBatchFactor), true);
 
     /* Execute the function being tested */
     Result = MD_TableValidationFunc(&Table);
@@ -467,6 +710,14 @@ void MD_TableValidationFunc_Test_Success(void)
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
+    UtAssert_BOOL_TRUE(MD_AppData.CompiledTables[1].Ready);
+    UtAssert_BOOL_FALSE(MD_AppData.CompiledTables[0].Ready);
+    UtAssert_UINT32_EQ(MD_AppData.CompiledTables[1].Sequence, 2);
+    UtAssert_UINT32_EQ(MD_AppData.CompiledTables[0].Sequence, 0);
+    UtAssert_INT32_EQ(memcmp(MD_AppData.CompiledTables[1].Image, Table.Entry, sizeof(Table.Entry)), 0);
+    UtAssert_INT32_EQ(MD_AppData.CompiledTables[1].AddrCount, MD_INTERFACE_DWELL_TABLE_SIZE);
+    UtAssert_STUB_COUNT(MD_CompileDwellPlan, 1);
+
     /* Generates 1 message we don't care about here */
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -474,37 +725,6 @@ void MD_TableValidationFunc_Test_Success(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void MD_ReadDwellTable_Test(void)
-{
-    CFE_Status_t        Result;
-    MD_DwellTableLoad_t Table;
-    uint16              i;
-    uint16              ActiveAddrCount = 0;
-    uint16              Size            = 0;
-    uint32              Rate            = 0;
-
-    for (i = 0; i < MD_INTERFACE_DWELL_TABLE_SIZE; i++)
-    {
-        Table.Entry[i].Length = 1;
-        Table.Entry[i].Delay  = 1;
-    }
-
-    /* Execute the function being tested */
-    Result = MD_ReadDwellTable(&Table, &ActiveAddrCount, &Size, &Rate);
-
-    /* Verify results */
-    UtAssert_True(ActiveAddrCount == MD_INTERFACE_DWELL_TABLE_SIZE, "ActiveAddrCount == MD_INTERFACE_DWELL_TABLE_SIZE");
-    UtAssert_True(Size == MD_INTERFACE_DWELL_TABLE_SIZE, "Size == MD_INTERFACE_DWELL_TABLE_SIZE");
-    UtAssert_True(Rate == MD_INTERFACE_DWELL_TABLE_SIZE, "Rate == MD_INTERFACE_DWELL_TABLE_SIZE");
-
-    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
-                  call_count_CFE_EVS_SendEvent);
-}
-
 void MD_CheckTableEntries_Test_Error(void)
 {
     int32               Result;
@@ -534,7 +754,7 @@ void MD_CheckTableEntries_Test_Error(void)
     UT_SetDeferredRetcode(UT_KEY(MD_ValidAddrRange), 1, false);
 
     /* Execute the function being tested */
-    Result = MD_CheckTableEntries(&Table, &ErrorEntryArg);
+    Result = MD_CheckTableEntries(&Table, &ErrorEntryArg, &MD_AppData.CompiledTables[0]);
 
     /* Verify results */
     UtAssert_True(Result == MD_INVALID_ADDR_ERROR, "Result == MD_INVALID_ADDR_ERROR");
@@ -571,7 +791,7 @@ void MD_CheckTableEntries_Test_MultiError(void)
     UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), false);
 
     /* Execute the function being tested */
-    Result = MD_CheckTableEntries(&Table, &ErrorEntryArg);
+    Result = MD_CheckTableEntries(&Table, &ErrorEntryArg, &MD_AppData.CompiledTables[0]);
 
     /* Verify results */
     UtAssert_True(ErrorEntryArg == 0, "ErrorEntryArg == 0");
@@ -621,13 +841,19 @@ void MD_CheckTableEntries_Test_Success(void)
     UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
 
     /* Execute the function being tested */
-    Result = MD_CheckTableEntries(&Table, &ErrorEntryArg);
+    Result = MD_CheckTableEntries(&Table, &ErrorEntryArg, &MD_AppData.CompiledTables[0]);
 
     /* Verify results */
     UtAssert_True(ErrorEntryArg == 0, "ErrorEntryArg == 0");
 
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
+    UtAssert_STUB_COUNT(MD_RefreshSymCache, 1);
+
+    UtAssert_INT32_EQ(MD_AppData.CompiledTables[0].AddrCount, MD_INTERFACE_DWELL_TABLE_SIZE - 1);
+    UtAssert_INT32_EQ(MD_AppData.CompiledTables[0].DataSize, MD_INTERFACE_DWELL_TABLE_SIZE - 1);
+    UtAssert_INT32_EQ(MD_AppData.CompiledTables[0].Rate, MD_INTERFACE_DWELL_TABLE_SIZE - 1);
+
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_DWELL_TBL_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
@@ -641,15 +867,149 @@ void MD_CheckTableEntries_Test_Success(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_CheckTableEntries_Test_Capacity(void)
+{
+    int32               Result;
+    MD_DwellTableLoad_t Table;
+    uint16              ErrorEntryArg = 0;
+    uint16              i;
+
+    /* A table of 3 entries only has 3 entries in its load, whatever follows isn't checked */
+    MD_AppData.CompiledTables[0].Capacity = 3;
+
+    for (i = 0; i < MD_INTERFACE_DWELL_TABLE_SIZE; i++)
+    {
+        Table.Entry[i].DwellAddress.Offset = 0;
+        Table.Entry[i].Length              = 1;
+        Table.Entry[i].Delay               = 1;
+    }
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+
+    /* Execute the function being tested */
+    Result = MD_CheckTableEntries(&Table, &ErrorEntryArg, &MD_AppData.CompiledTables[0]);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(MD_ResolveSymAddr, 3);
+
+    UtAssert_INT32_EQ(MD_AppData.CompiledTables[0].AddrCount, 3);
+    UtAssert_INT32_EQ(MD_AppData.CompiledTables[0].DataSize, 3);
+    UtAssert_INT32_EQ(MD_AppData.CompiledTables[0].Rate, 3);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_DWELL_TBL_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void MD_CheckTableEntries_Test_DataSize(void)
+{
+    int32               Result;
+    MD_DwellTableLoad_t Table;
+    uint16              ErrorEntryArg = 0;
+    uint16              i;
+    uint32              DataSize = 0;
+
+    memset(&Table, 0, sizeof(Table));
+
+    /* Add block dwells until the last one no longer fits in the dwell packet */
+    for (i = 0; DataSize <= MD_INTERFACE_DWELL_PKT_DATA_SIZE; i++)
+    {
+        Table.Entry[i].Length = MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH;
+        DataSize += Table.Entry[i].Length;
+    }
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+
+    /* Execute the function being tested */
+    Result = MD_CheckTableEntries(&Table, &ErrorEntryArg, &MD_AppData.CompiledTables[0]);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, MD_DATA_SIZE_TBL_ERROR);
+    UtAssert_INT32_EQ(ErrorEntryArg, i - 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_TBL_ENTRY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MD_DWELL_TBL_INF_EID);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_CheckTableEntries_Test_Compile(void)
+{
+    MD_DwellTableLoad_t      Table;
+    uint16                   ErrorEntryArg = 0;
+    MD_CompiledDwellTable_t *CompiledPtr   = &MD_AppData.CompiledTables[1];
+
+    memset(&Table, 0, sizeof(Table));
+
+    Table.Entry[0].Length              = 4;
+    Table.Entry[0].Delay               = 2;
+    Table.Entry[0].Deadband            = 5;
+    Table.Entry[0].DwellAddress.Offset = 0x1000;
+    Table.Entry[1].Length              = 2;
+    Table.Entry[1].Delay               = 3;
+    Table.Entry[1].DwellAddress.Offset = 0x2000;
+    Table.Entry[1].SnapshotGroup       = 2;
+    Table.Entry[1].Signed              = 5;
+
+    /* Entry after the null entry is kept but not counted */
+    Table.Entry[3].Length              = 1;
+    Table.Entry[3].Delay               = 7;
+    Table.Entry[3].DwellAddress.Offset = 0x3000;
+    Table.Entry[3].SnapshotGroup       = 1;
+
+    MD_AppData.SymCache.Generation = 4;
+
+    UT_SetHookFunction(UT_KEY(MD_ResolveSymAddr), MD_DWELL_TBL_TEST_MD_ResolveSymAddrHook, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_Verify16Aligned), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_Verify32Aligned), true);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_CheckTableEntries(&Table, &ErrorEntryArg, CompiledPtr), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(CompiledPtr->AddrCount, 2);
+    UtAssert_INT32_EQ(CompiledPtr->DataSize, 6);
+    UtAssert_INT32_EQ(CompiledPtr->Rate, 5);
+    UtAssert_UINT32_EQ(CompiledPtr->SymCacheGeneration, 4);
+
+    UtAssert_UINT32_EQ(CompiledPtr->Entry[0].ResolvedAddress, 0x1000);
+    UtAssert_INT32_EQ(CompiledPtr->Entry[0].Length, 4);
+    UtAssert_INT32_EQ(CompiledPtr->Entry[0].Delay, 2);
+    UtAssert_UINT32_EQ(CompiledPtr->Deadband[0], 5);
+    UtAssert_UINT32_EQ(CompiledPtr->Entry[1].ResolvedAddress, 0x2000);
+    UtAssert_INT32_EQ(CompiledPtr->Group[1], 2);
+    UtAssert_INT32_EQ(CompiledPtr->Signed[0], 0);
+    UtAssert_INT32_EQ(CompiledPtr->Signed[1], 1);
+    UtAssert_INT32_EQ(CompiledPtr->Entry[2].Length, 0);
+    UtAssert_UINT32_EQ(CompiledPtr->Entry[3].ResolvedAddress, 0x3000);
+    UtAssert_INT32_EQ(CompiledPtr->Entry[3].Length, 1);
+    UtAssert_INT32_EQ(CompiledPtr->Entry[3].Delay, 7);
+    UtAssert_INT32_EQ(CompiledPtr->Group[3], 1);
+
+    /* Every entry is resolved once */
+    UtAssert_STUB_COUNT(MD_ResolveSymAddr, MD_INTERFACE_DWELL_TABLE_SIZE - 1);
+}
+
 void MD_ValidTableEntry_Test_SuccessDwellLengthZero(void)
 {
     int32               Result;
     MD_TableLoadEntry_t Entry;
+    cpuaddr             ResolvedAddr = 0;
 
     Entry.Length = 0;
 
     /* Execute the function being tested */
-    Result = MD_ValidTableEntry(&Entry);
+    Result = MD_ValidTableEntry(&Entry, &ResolvedAddr);
 
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
@@ -664,6 +1024,7 @@ void MD_ValidTableEntry_Test_ResolveError(void)
 {
     int32               Result;
     MD_TableLoadEntry_t Entry;
+    cpuaddr             ResolvedAddr = 0;
 
     Entry.Length = 1;
 
@@ -671,7 +1032,7 @@ void MD_ValidTableEntry_Test_ResolveError(void)
     UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), false);
 
     /* Execute the function being tested */
-    Result = MD_ValidTableEntry(&Entry);
+    Result = MD_ValidTableEntry(&Entry, &ResolvedAddr);
 
     /* Verify results */
     UtAssert_True(Result == MD_RESOLVE_ERROR, "Result == MD_RESOLVE_ERROR");
@@ -686,6 +1047,7 @@ void MD_ValidTableEntry_Test_InvalidAddress(void)
 {
     int32               Result;
     MD_TableLoadEntry_t Entry;
+    cpuaddr             ResolvedAddr = 0;
 
     Entry.Length = 1;
 
@@ -694,7 +1056,7 @@ void MD_ValidTableEntry_Test_InvalidAddress(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemValidateRange), 1, -1);
 
     /* Execute the function being tested */
-    Result = MD_ValidTableEntry(&Entry);
+    Result = MD_ValidTableEntry(&Entry, &ResolvedAddr);
 
     /* Verify results */
     UtAssert_True(Result == MD_INVALID_ADDR_ERROR, "Result == MD_INVALID_ADDR_ERROR");
@@ -709,6 +1071,7 @@ void MD_ValidTableEntry_Test_InvalidLength(void)
 {
     int32               Result;
     MD_TableLoadEntry_t Entry;
+    cpuaddr             ResolvedAddr = 0;
 
     Entry.Length = -1;
 
@@ -717,7 +1080,7 @@ void MD_ValidTableEntry_Test_InvalidLength(void)
     UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), false);
 
     /* Execute the function being tested */
-    Result = MD_ValidTableEntry(&Entry);
+    Result = MD_ValidTableEntry(&Entry, &ResolvedAddr);
 
     /* Verify results */
     UtAssert_INT32_EQ(Result, MD_INVALID_LEN_ERROR);
@@ -732,6 +1095,7 @@ void MD_ValidTableEntry_Test_NotAligned16DwellLength4(void)
 {
     int32               Result;
     MD_TableLoadEntry_t Entry;
+    cpuaddr             ResolvedAddr = 0;
 
     Entry.Length              = 4;
     Entry.DwellAddress.Offset = 1;
@@ -741,7 +1105,7 @@ void MD_ValidTableEntry_Test_NotAligned16DwellLength4(void)
     UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
 
     /* Execute the function being tested */
-    Result = MD_ValidTableEntry(&Entry);
+    Result = MD_ValidTableEntry(&Entry, &ResolvedAddr);
 
     /* Verify results */
     UtAssert_True(Result == MD_NOT_ALIGNED_ERROR, "Result == MD_NOT_ALIGNED_ERROR");
@@ -756,9 +1120,11 @@ void MD_ValidTableEntry_Test_Aligned32(void)
 {
     int32               Result;
     MD_TableLoadEntry_t Entry;
+    cpuaddr             ResolvedAddr = 0;
 
     Entry.Length              = 4;
     Entry.DwellAddress.Offset = 1;
+    Entry.SnapshotGroup       = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
     UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
@@ -767,7 +1133,7 @@ void MD_ValidTableEntry_Test_Aligned32(void)
     UT_SetDeferredRetcode(UT_KEY(MD_Verify32Aligned), 1, true);
 
     /* Execute the function being tested */
-    Result = MD_ValidTableEntry(&Entry);
+    Result = MD_ValidTableEntry(&Entry, &ResolvedAddr);
 
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
@@ -782,6 +1148,7 @@ void MD_ValidTableEntry_Test_NotAligned32(void)
 {
     int32               Result;
     MD_TableLoadEntry_t Entry;
+    cpuaddr             ResolvedAddr = 0;
 
     Entry.Length              = 4;
     Entry.DwellAddress.Offset = 1;
@@ -793,7 +1160,7 @@ void MD_ValidTableEntry_Test_NotAligned32(void)
     UT_SetDeferredRetcode(UT_KEY(MD_Verify32Aligned), 1, false);
 
     /* Execute the function being tested */
-    Result = MD_ValidTableEntry(&Entry);
+    Result = MD_ValidTableEntry(&Entry, &ResolvedAddr);
 
     /* Verify results */
     UtAssert_True(Result == MD_NOT_ALIGNED_ERROR, "Result == MD_NOT_ALIGNED_ERROR");
@@ -808,6 +1175,7 @@ void MD_ValidTableEntry_Test_NotAligned16DwellLength2(void)
 {
     int32               Result;
     MD_TableLoadEntry_t Entry;
+    cpuaddr             ResolvedAddr = 0;
 
     Entry.Length              = 2;
     Entry.DwellAddress.Offset = 1;
@@ -818,7 +1186,7 @@ void MD_ValidTableEntry_Test_NotAligned16DwellLength2(void)
     UT_SetDefaultReturnValue(UT_KEY(MD_Verify16Aligned), false);
 
     /* Execute the function being tested */
-    Result = MD_ValidTableEntry(&Entry);
+    Result = MD_ValidTableEntry(&Entry, &ResolvedAddr);
 
     /* Verify results */
     UtAssert_INT32_EQ(Result, MD_NOT_ALIGNED_ERROR);
@@ -829,13 +1197,42 @@ void MD_ValidTableEntry_Test_NotAligned16DwellLength2(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_ValidTableEntry_Test_SnapshotGroup(void)
+{
+    MD_TableLoadEntry_t Entry;
+    cpuaddr             ResolvedAddr = 0;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    Entry.Length = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+
+    /* The last group is valid, the one after it isn't */
+    Entry.SnapshotGroup = MD_INTERNAL_NUM_SNAPSHOT_GROUPS;
+    UtAssert_INT32_EQ(MD_ValidTableEntry(&Entry, &ResolvedAddr), CFE_SUCCESS);
+
+    Entry.SnapshotGroup = MD_INTERNAL_NUM_SNAPSHOT_GROUPS + 1;
+    UtAssert_INT32_EQ(MD_ValidTableEntry(&Entry, &ResolvedAddr), MD_SNAPSHOT_GROUP_ERROR);
+
+    /* A null entry's group isn't checked */
+    Entry.Length = 0;
+    UtAssert_INT32_EQ(MD_ValidTableEntry(&Entry, &ResolvedAddr), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void MD_ValidTableEntry_Test_ElseSuccess(void)
 {
     int32               Result;
     MD_TableLoadEntry_t Entry;
+    cpuaddr             ResolvedAddr = 0;
 
     Entry.Length              = 2;
     Entry.DwellAddress.Offset = 0;
+    Entry.SnapshotGroup       = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
     UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
@@ -843,7 +1240,7 @@ void MD_ValidTableEntry_Test_ElseSuccess(void)
     UT_SetDefaultReturnValue(UT_KEY(MD_Verify16Aligned), true);
 
     /* Execute the function being tested */
-    Result = MD_ValidTableEntry(&Entry);
+    Result = MD_ValidTableEntry(&Entry, &ResolvedAddr);
 
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
@@ -854,12 +1251,56 @@ void MD_ValidTableEntry_Test_ElseSuccess(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_ValidTableEntry_Test_BlockLength(void)
+{
+    int32               Result;
+    MD_TableLoadEntry_t Entry;
+    cpuaddr             ResolvedAddr = 0;
+
+    /* Block dwells have no alignment requirement */
+    Entry.Length              = MD_MIN_BLOCK_DWELL_LENGTH;
+    Entry.DwellAddress.Offset = 1;
+    Entry.SnapshotGroup       = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidAddrRange), true);
+    UT_SetDefaultReturnValue(UT_KEY(MD_ValidFieldLength), true);
+
+    /* Execute the function being tested */
+    Result = MD_ValidTableEntry(&Entry, &ResolvedAddr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(MD_Verify16Aligned, 0);
+    UtAssert_STUB_COUNT(MD_Verify32Aligned, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void MD_CopyUpdatedTbl_Test(void)
 {
     MD_DwellTableLoad_t LoadTable;
-    uint8               TblIndex = 0;
+    uint16              TblIndex = 0;
+
+    memset(&LoadTable, 0, sizeof(LoadTable));
+
+    LoadTable.Enabled           = 1;
+    LoadTable.BatchFactor       = 3;
+    LoadTable.HeartbeatInterval = 6;
+    LoadTable.KeyframeInterval  = 8;
+    LoadTable.StatsWindow       = 9;
+    LoadTable.PeriodMsec        = 250;
+    LoadTable.PhaseMsec         = 40;
+    LoadTable.Entry[0].Deadband = 7;
+
+    LoadTable.Entry[0].SnapshotGroup = 2;
+    LoadTable.Entry[0].Signed        = 1;
 
-    LoadTable.Enabled = 1;
+    MD_AppData.DwellDeadlines.Deadline[TblIndex] = 12345;
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     strncpy(LoadTable.Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH);
@@ -870,14 +1311,30 @@ void MD_CopyUpdatedTbl_Test(void)
 
     /* Verify results */
     UtAssert_True(MD_AppData.MD_DwellTables[TblIndex].Enabled == 1, "MD_AppData.MD_DwellTables[TblIndex].Enabled == 1");
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TblIndex].BatchFactor, 3);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TblIndex].HeartbeatInterval, 6);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TblIndex].KeyframeInterval, 8);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TblIndex].StatsWindow, 9);
+    UtAssert_UINT32_EQ(MD_AppData.DwellDeadlines.PeriodMsec[TblIndex], 250);
+    UtAssert_UINT32_EQ(MD_AppData.DwellDeadlines.PhaseMsec[TblIndex], 40);
+    UtAssert_True(MD_AppData.DwellDeadlines.Deadline[TblIndex] == 0, "Deadline cleared for the new table");
+    UtAssert_INT32_EQ(MD_AppData.DwellReportControl[TblIndex].Deadband[0], 7);
+    UtAssert_INT32_EQ(MD_AppData.DwellReportControl[TblIndex].Group[0], 2);
+    UtAssert_INT32_EQ(MD_AppData.DwellReportControl[TblIndex].Signed[0], 1);
+    UtAssert_STUB_COUNT(MD_RefreshSymCache, 1);
+
+    /* Nothing was compiled, so the entries are resolved again */
+    UtAssert_STUB_COUNT(MD_ResolveSymAddr, MD_INTERFACE_DWELL_TABLE_SIZE);
+    UtAssert_STUB_COUNT(MD_UpdateDwellControlInfo, 1);
+    UtAssert_STUB_COUNT(MD_SetDwellControlInfo, 0);
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     UtAssert_True(
-        strncmp(MD_AppData.MD_DwellTables[TblIndex].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
-        "strncmp(MD_AppData.MD_DwellTables[TblIndex].Signature, 'signature', MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0");
+        strncmp(MD_AppData.DwellReportControl[TblIndex].Signature, "signature", MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0,
+        "strncmp(MD_AppData.DwellReportControl[TblIndex].Signature, 'signature', MD_INTERFACE_SIGNATURE_FIELD_LENGTH) == 0");
 
-    UtAssert_True(MD_AppData.MD_DwellTables[TblIndex].Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] == '\0',
-                  "MD_AppData.MD_DwellTables[TblIndex].Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] == ''");
+    UtAssert_True(MD_AppData.DwellReportControl[TblIndex].Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] == '\0',
+                  "MD_AppData.DwellReportControl[TblIndex].Signature[MD_INTERFACE_SIGNATURE_FIELD_LENGTH - 1] == ''");
 #endif
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -886,6 +1343,146 @@ void MD_CopyUpdatedTbl_Test(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_CopyUpdatedTbl_Test_Compiled(void)
+{
+    MD_DwellTableLoad_t      LoadTable;
+    uint16                   TblIndex    = 1;
+    MD_CompiledDwellTable_t *CompiledPtr = &MD_AppData.CompiledTables[TblIndex];
+
+    memset(&LoadTable, 0, sizeof(LoadTable));
+
+    LoadTable.Enabled           = 1;
+    LoadTable.Entry[0].Length   = 2;
+    LoadTable.Entry[0].Deadband = 7;
+
+    memcpy(CompiledPtr->Image, LoadTable.Entry, sizeof(LoadTable.Entry));
+
+    CompiledPtr->Sequence                 = 2;
+    CompiledPtr->Ready                    = true;
+    CompiledPtr->AddrCount                = 1;
+    CompiledPtr->DataSize                 = 2;
+    CompiledPtr->Rate                     = 3;
+    CompiledPtr->SymCacheGeneration       = 2;
+    CompiledPtr->Entry[0].ResolvedAddress = 0x1000;
+    CompiledPtr->Entry[0].Length          = 2;
+    CompiledPtr->Entry[0].Delay           = 3;
+    CompiledPtr->Entry[0].BlockEntries    = 1;
+    CompiledPtr->Deadband[0]              = 7;
+    CompiledPtr->Group[0]                 = 3;
+    CompiledPtr->Signed[0]                = 1;
+
+    MD_AppData.SymCache.Generation = 2;
+
+    /* Execute the function being tested */
+    MD_CopyUpdatedTbl(&LoadTable, TblIndex);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TblIndex].Enabled, 1);
+    UtAssert_UINT32_EQ(MD_AppData.MD_DwellTables[TblIndex].Entry[0].ResolvedAddress, 0x1000);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TblIndex].Entry[0].Delay, 3);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TblIndex].Entry[0].BlockEntries, 1);
+    UtAssert_UINT32_EQ(MD_AppData.DwellReportControl[TblIndex].Deadband[0], 7);
+    UtAssert_INT32_EQ(MD_AppData.DwellReportControl[TblIndex].Group[0], 3);
+    UtAssert_INT32_EQ(MD_AppData.DwellReportControl[TblIndex].Signed[0], 1);
+
+    UtAssert_STUB_COUNT(MD_ResolveSymAddr, 0);
+    UtAssert_STUB_COUNT(MD_UpdateDwellControlInfo, 0);
+    UtAssert_STUB_COUNT(MD_SetDwellControlInfo, 1);
+
+    /* Only the main task writes the compiled table */
+    UtAssert_BOOL_TRUE(CompiledPtr->Ready);
+    UtAssert_UINT32_EQ(CompiledPtr->Sequence, 2);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_CopyUpdatedTbl_Test_Capacity(void)
+{
+    MD_DwellTableLoad_t LoadTable;
+    uint16              TblIndex = 0;
+
+    memset(&LoadTable, 0, sizeof(LoadTable));
+
+    /* Only the entries of a 2 entry table are copied */
+    MD_AppData.MD_DwellTables[TblIndex].Capacity = 2;
+
+    LoadTable.Entry[2].Length = 4;
+
+    /* Execute the function being tested */
+    MD_CopyUpdatedTbl(&LoadTable, TblIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_ResolveSymAddr, 2);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TblIndex].Entry[2].Length, 0);
+    UtAssert_STUB_COUNT(MD_UpdateDwellControlInfo, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_CopyUpdatedTbl_Test_StaleSymbols(void)
+{
+    MD_DwellTableLoad_t LoadTable;
+    uint16              TblIndex = 0;
+
+    memset(&LoadTable, 0, sizeof(LoadTable));
+
+    MD_AppData.CompiledTables[TblIndex].Ready              = true;
+    MD_AppData.CompiledTables[TblIndex].SymCacheGeneration = 1;
+
+    /* The symbol cache was emptied after validation */
+    MD_AppData.SymCache.Generation = 2;
+
+    /* Execute the function being tested */
+    MD_CopyUpdatedTbl(&LoadTable, TblIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_ResolveSymAddr, MD_INTERFACE_DWELL_TABLE_SIZE);
+    UtAssert_STUB_COUNT(MD_UpdateDwellControlInfo, 1);
+    UtAssert_STUB_COUNT(MD_SetDwellControlInfo, 0);
+}
+
+void MD_CopyUpdatedTbl_Test_OtherImage(void)
+{
+    MD_DwellTableLoad_t LoadTable;
+    uint16              TblIndex = 0;
+
+    memset(&LoadTable, 0, sizeof(LoadTable));
+
+    MD_AppData.CompiledTables[TblIndex].Ready = true;
+
+    /* The entries being installed aren't the ones that were compiled */
+    MD_AppData.CompiledTables[TblIndex].Image[MD_INTERFACE_DWELL_TABLE_SIZE - 1].Delay = 1;
+
+    /* Execute the function being tested */
+    MD_CopyUpdatedTbl(&LoadTable, TblIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_ResolveSymAddr, MD_INTERFACE_DWELL_TABLE_SIZE);
+    UtAssert_STUB_COUNT(MD_UpdateDwellControlInfo, 1);
+    UtAssert_STUB_COUNT(MD_SetDwellControlInfo, 0);
+}
+
+void MD_CopyUpdatedTbl_Test_Compiling(void)
+{
+    MD_DwellTableLoad_t LoadTable;
+    uint16              TblIndex = 0;
+
+    memset(&LoadTable, 0, sizeof(LoadTable));
+
+    MD_AppData.CompiledTables[TblIndex].Ready = true;
+
+    /* The main task is validating the table again */
+    MD_AppData.CompiledTables[TblIndex].Sequence = 3;
+
+    /* Execute the function being tested */
+    MD_CopyUpdatedTbl(&LoadTable, TblIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_ResolveSymAddr, MD_INTERFACE_DWELL_TABLE_SIZE);
+    UtAssert_STUB_COUNT(MD_UpdateDwellControlInfo, 1);
+    UtAssert_STUB_COUNT(MD_SetDwellControlInfo, 0);
+}
+
 void MD_UpdateTableEnabledField_Test_DwellStreamEnabled(void)
 {
     uint16               TableIndex = 0;
@@ -968,10 +1565,11 @@ void MD_UpdateTableEnabledField_Test_Error(void)
 
 void MD_UpdateTableDwellEntry_Test(void)
 {
-    uint16       TableIndex = 0;
-    uint16       EntryIndex = 0;
-    uint16       NewLength  = 1;
-    uint16       NewDelay   = 1;
+    uint16       TableIndex  = 0;
+    uint16       EntryIndex  = 0;
+    uint16       NewLength   = 1;
+    uint16       NewDelay    = 1;
+    uint32       NewDeadband = 5;
     MD_SymAddr_t NewDwellAddress;
 
     NewDwellAddress.Offset = 1;
@@ -984,11 +1582,12 @@ void MD_UpdateTableDwellEntry_Test(void)
     UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &LoadTblPtr, sizeof(LoadTblPtr), false);
 
     /* Execute the function being tested */
-    MD_UpdateTableDwellEntry(TableIndex, EntryIndex, NewLength, NewDelay, NewDwellAddress);
+    MD_UpdateTableDwellEntry(TableIndex, EntryIndex, NewLength, NewDelay, NewDwellAddress, NewDeadband);
 
     /* Verify results */
     UtAssert_True(LoadTblPtr->Entry[EntryIndex].Length == 1, "LoadTblPtr->Entry[EntryIndex].Length == 1");
     UtAssert_True(LoadTblPtr->Entry[EntryIndex].Delay == 1, "LoadTblPtr->Entry[EntryIndex].Delay == 1");
+    UtAssert_INT32_EQ(LoadTblPtr->Entry[EntryIndex].Deadband, 5);
     UtAssert_True(LoadTblPtr->Entry[EntryIndex].DwellAddress.Offset == 1,
                   "LoadTablePtr->Entry[EntryIndex].DwellAddress.Offset == 1");
 
@@ -1003,10 +1602,11 @@ void MD_UpdateTableDwellEntry_Test(void)
 
 void MD_UpdateTableDwellEntry_Test_Updated(void)
 {
-    uint16       TableIndex = 0;
-    uint16       EntryIndex = 0;
-    uint16       NewLength  = 1;
-    uint16       NewDelay   = 1;
+    uint16       TableIndex  = 0;
+    uint16       EntryIndex  = 0;
+    uint16       NewLength   = 1;
+    uint16       NewDelay    = 1;
+    uint32       NewDeadband = 5;
     MD_SymAddr_t NewDwellAddress;
 
     NewDwellAddress.Offset = 1;
@@ -1021,11 +1621,12 @@ void MD_UpdateTableDwellEntry_Test_Updated(void)
     UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &LoadTblPtr, sizeof(LoadTblPtr), false);
 
     /* Execute the function being tested */
-    MD_UpdateTableDwellEntry(TableIndex, EntryIndex, NewLength, NewDelay, NewDwellAddress);
+    MD_UpdateTableDwellEntry(TableIndex, EntryIndex, NewLength, NewDelay, NewDwellAddress, NewDeadband);
 
     /* Verify results */
     UtAssert_True(LoadTblPtr->Entry[EntryIndex].Length == 1, "LoadTblPtr->Entry[EntryIndex].Length == 1");
     UtAssert_True(LoadTblPtr->Entry[EntryIndex].Delay == 1, "LoadTblPtr->Entry[EntryIndex].Delay == 1");
+    UtAssert_INT32_EQ(LoadTblPtr->Entry[EntryIndex].Deadband, 5);
     UtAssert_True(LoadTblPtr->Entry[EntryIndex].DwellAddress.Offset == 1,
                   "LoadTablePtr->Entry[EntryIndex].DwellAddress.Offset == 1");
 
@@ -1040,10 +1641,11 @@ void MD_UpdateTableDwellEntry_Test_Updated(void)
 
 void MD_UpdateTableDwellEntry_Test_Error(void)
 {
-    uint16       TableIndex = 0;
-    uint16       EntryIndex = 0;
-    uint16       NewLength  = 1;
-    uint16       NewDelay   = 1;
+    uint16       TableIndex  = 0;
+    uint16       EntryIndex  = 0;
+    uint16       NewLength   = 1;
+    uint16       NewDelay    = 1;
+    uint32       NewDeadband = 5;
     MD_SymAddr_t NewDwellAddress;
     int32        strCmpResult;
     char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
@@ -1059,7 +1661,7 @@ void MD_UpdateTableDwellEntry_Test_Error(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, -1);
 
     /* Execute the function being tested */
-    MD_UpdateTableDwellEntry(TableIndex, EntryIndex, NewLength, NewDelay, NewDwellAddress);
+    MD_UpdateTableDwellEntry(TableIndex, EntryIndex, NewLength, NewDelay, NewDwellAddress, NewDeadband);
 
     /* Verify results */
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_UPDATE_TBL_DWELL_ERR_EID);
@@ -1075,6 +1677,129 @@ void MD_UpdateTableDwellEntry_Test_Error(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_UpdateTableDwellEntries_Test(void)
+{
+    uint16               TableIndex = 0;
+    MD_JamMultiEntry_t   JamEntry[2];
+    MD_DwellTableLoad_t  LoadTbl;
+    MD_DwellTableLoad_t *LoadTblPtr = &LoadTbl;
+
+    memset(JamEntry, 0, sizeof(JamEntry));
+    memset(&LoadTbl, 0, sizeof(LoadTbl));
+
+    JamEntry[0].EntryId             = 2;
+    JamEntry[0].FieldLength         = 4;
+    JamEntry[0].DwellDelay          = 3;
+    JamEntry[0].Deadband            = 5;
+    JamEntry[0].DwellAddress.Offset = 8;
+
+    /* Null entry clears every field */
+    JamEntry[1].EntryId                  = 1;
+    JamEntry[1].DwellDelay               = 7;
+    LoadTbl.Entry[0].Length              = 2;
+    LoadTbl.Entry[0].Delay               = 1;
+    LoadTbl.Entry[0].DwellAddress.Offset = 4;
+    strncpy(LoadTbl.Entry[0].DwellAddress.SymName, "old", sizeof(LoadTbl.Entry[0].DwellAddress.SymName));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &LoadTblPtr, sizeof(LoadTblPtr), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_UpdateTableDwellEntries(TableIndex, JamEntry, 2), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LoadTbl.Entry[1].Length, 4);
+    UtAssert_UINT32_EQ(LoadTbl.Entry[1].Delay, 3);
+    UtAssert_UINT32_EQ(LoadTbl.Entry[1].Deadband, 5);
+    UtAssert_UINT32_EQ(LoadTbl.Entry[1].DwellAddress.Offset, 8);
+    UtAssert_STUB_COUNT(CFE_SB_MessageStringGet, 1);
+
+    UtAssert_UINT32_EQ(LoadTbl.Entry[0].Length, 0);
+    UtAssert_UINT32_EQ(LoadTbl.Entry[0].Delay, 0);
+    UtAssert_UINT32_EQ(LoadTbl.Entry[0].DwellAddress.Offset, 0);
+    UtAssert_UINT32_EQ(LoadTbl.Entry[0].DwellAddress.SymName[0], '\0');
+
+    /* Table Services hears of the change once */
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_UpdateTableDwellEntries_Test_Error(void)
+{
+    MD_JamMultiEntry_t JamEntry[1];
+
+    memset(JamEntry, 0, sizeof(JamEntry));
+    JamEntry[0].EntryId = 1;
+
+    /* Set to make CFE_TBL_GetAddress != CFE_SUCCESS */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_UpdateTableDwellEntries(0, JamEntry, 1), -1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_UPDATE_TBL_DWELL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MD_UpdateTableBatchFactor_Test(void)
+{
+    uint16 TableIndex = 0;
+
+    MD_DwellTableLoad_t  LoadTbl;
+    MD_DwellTableLoad_t *LoadTblPtr = &LoadTbl;
+
+    LoadTbl.BatchFactor = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &LoadTblPtr, sizeof(LoadTblPtr), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_UpdateTableBatchFactor(TableIndex, 4), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(LoadTblPtr->BatchFactor, 4);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_UpdateTableBatchFactor_Test_Error(void)
+{
+    uint16 TableIndex = 0;
+    int32  strCmpResult;
+    char   ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "MD_UpdateTableBatchFactor, TableIndex %%d: CFE_TBL_GetAddress Returned 0x%%08x");
+
+    /* Set to make CFE_TBL_GetAddress != CFE_SUCCESS */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_UpdateTableBatchFactor(TableIndex, 4), -1);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_UPDATE_TBL_BATCH_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
 void MD_UpdateTableSignature_Test(void)
 {
@@ -1171,22 +1896,37 @@ void UtTest_Setup(void)
                "MD_TableValidationFunc_Test_InvalidAddress");
     UtTest_Add(MD_TableValidationFunc_Test_NullPtr, MD_Test_Setup, MD_Test_TearDown,
                "MD_TableValidationFunc_Test_NullPtr");
+    UtTest_Add(MD_TableValidationFunc_Test_NoTable, MD_Test_Setup, MD_Test_TearDown,
+               "MD_TableValidationFunc_Test_NoTable");
     UtTest_Add(MD_TableValidationFunc_Test_InvalidLength, MD_Test_Setup, MD_Test_TearDown,
                "MD_TableValidationFunc_Test_InvalidLength");
+    UtTest_Add(MD_TableValidationFunc_Test_SnapshotGroup, MD_Test_Setup, MD_Test_TearDown,
+               "MD_TableValidationFunc_Test_SnapshotGroup");
+    UtTest_Add(MD_TableValidationFunc_Test_DataSize, MD_Test_Setup, MD_Test_TearDown,
+               "MD_TableValidationFunc_Test_DataSize");
     UtTest_Add(MD_TableValidationFunc_Test_NotAligned, MD_Test_Setup, MD_Test_TearDown,
                "MD_TableValidationFunc_Test_NotAligned");
+    UtTest_Add(MD_TableValidationFunc_Test_BatchSize, MD_Test_Setup, MD_Test_TearDown,
+               "MD_TableValidationFunc_Test_BatchSize");
     UtTest_Add(MD_TableValidationFunc_Test_ZeroRate, MD_Test_Setup, MD_Test_TearDown,
                "MD_TableValidationFunc_Test_ZeroRate");
+    UtTest_Add(MD_TableValidationFunc_Test_Phase, MD_Test_Setup, MD_Test_TearDown, "MD_TableValidationFunc_Test_Phase");
+    UtTest_Add(MD_TableValidationFunc_Test_TimedZeroRate, MD_Test_Setup, MD_Test_TearDown,
+               "MD_TableValidationFunc_Test_TimedZeroRate");
     UtTest_Add(MD_TableValidationFunc_Test_SuccessStreamDisabled, MD_Test_Setup, MD_Test_TearDown,
                "MD_TableValidationFunc_Test_SuccessStreamDisabled");
     UtTest_Add(MD_TableValidationFunc_Test_Success, MD_Test_Setup, MD_Test_TearDown,
                "MD_TableValidationFunc_Test_Success");
-    UtTest_Add(MD_ReadDwellTable_Test, MD_Test_Setup, MD_Test_TearDown, "MD_ReadDwellTable_Test");
 
     UtTest_Add(MD_CheckTableEntries_Test_Error, MD_Test_Setup, MD_Test_TearDown, "MD_CheckTableEntries_Test_Error");
     UtTest_Add(MD_CheckTableEntries_Test_MultiError, MD_Test_Setup, MD_Test_TearDown,
                "MD_CheckTableEntries_Test_MultiError");
     UtTest_Add(MD_CheckTableEntries_Test_Success, MD_Test_Setup, MD_Test_TearDown, "MD_CheckTableEntries_Test_Success");
+    UtTest_Add(MD_CheckTableEntries_Test_Capacity, MD_Test_Setup, MD_Test_TearDown,
+               "MD_CheckTableEntries_Test_Capacity");
+    UtTest_Add(MD_CheckTableEntries_Test_DataSize, MD_Test_Setup, MD_Test_TearDown,
+               "MD_CheckTableEntries_Test_DataSize");
+    UtTest_Add(MD_CheckTableEntries_Test_Compile, MD_Test_Setup, MD_Test_TearDown, "MD_CheckTableEntries_Test_Compile");
 
     UtTest_Add(MD_ValidTableEntry_Test_SuccessDwellLengthZero, MD_Test_Setup, MD_Test_TearDown,
                "MD_ValidTableEntry_Test_SuccessDwellLengthZero");
@@ -1203,10 +1943,20 @@ void UtTest_Setup(void)
                "MD_ValidTableEntry_Test_NotAligned32");
     UtTest_Add(MD_ValidTableEntry_Test_NotAligned16DwellLength2, MD_Test_Setup, MD_Test_TearDown,
                "MD_ValidTableEntry_Test_NotAligned16DwellLength2");
+    UtTest_Add(MD_ValidTableEntry_Test_SnapshotGroup, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ValidTableEntry_Test_SnapshotGroup");
     UtTest_Add(MD_ValidTableEntry_Test_ElseSuccess, MD_Test_Setup, MD_Test_TearDown,
                "MD_ValidTableEntry_Test_ElseSuccess");
+    UtTest_Add(MD_ValidTableEntry_Test_BlockLength, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ValidTableEntry_Test_BlockLength");
 
     UtTest_Add(MD_CopyUpdatedTbl_Test, MD_Test_Setup, MD_Test_TearDown, "MD_CopyUpdatedTbl_Test");
+    UtTest_Add(MD_CopyUpdatedTbl_Test_Compiled, MD_Test_Setup, MD_Test_TearDown, "MD_CopyUpdatedTbl_Test_Compiled");
+    UtTest_Add(MD_CopyUpdatedTbl_Test_Capacity, MD_Test_Setup, MD_Test_TearDown, "MD_CopyUpdatedTbl_Test_Capacity");
+    UtTest_Add(MD_CopyUpdatedTbl_Test_StaleSymbols, MD_Test_Setup, MD_Test_TearDown,
+               "MD_CopyUpdatedTbl_Test_StaleSymbols");
+    UtTest_Add(MD_CopyUpdatedTbl_Test_OtherImage, MD_Test_Setup, MD_Test_TearDown, "MD_CopyUpdatedTbl_Test_OtherImage");
+    UtTest_Add(MD_CopyUpdatedTbl_Test_Compiling, MD_Test_Setup, MD_Test_TearDown, "MD_CopyUpdatedTbl_Test_Compiling");
 
     UtTest_Add(MD_UpdateTableEnabledField_Test_DwellStreamEnabled, MD_Test_Setup, MD_Test_TearDown,
                "MD_UpdateTableEnabledField_Test_DwellStreamEnabled");
@@ -1220,6 +1970,13 @@ void UtTest_Setup(void)
                "MD_UpdateTableDwellEntry_Test_Updated");
     UtTest_Add(MD_UpdateTableDwellEntry_Test_Error, MD_Test_Setup, MD_Test_TearDown,
                "MD_UpdateTableDwellEntry_Test_Error");
+    UtTest_Add(MD_UpdateTableDwellEntries_Test, MD_Test_Setup, MD_Test_TearDown, "MD_UpdateTableDwellEntries_Test");
+    UtTest_Add(MD_UpdateTableDwellEntries_Test_Error, MD_Test_Setup, MD_Test_TearDown,
+               "MD_UpdateTableDwellEntries_Test_Error");
+
+    UtTest_Add(MD_UpdateTableBatchFactor_Test, MD_Test_Setup, MD_Test_TearDown, "MD_UpdateTableBatchFactor_Test");
+    UtTest_Add(MD_UpdateTableBatchFactor_Test_Error, MD_Test_Setup, MD_Test_TearDown,
+               "MD_UpdateTableBatchFactor_Test_Error");
 
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     UtTest_Add(MD_UpdateTableSignature_Test, MD_Test_Setup, MD_Test_TearDown, "MD_UpdateTableSignature_Test");
@@ -0,0 +1,170 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "md_perf.h"
+#include "md_app.h"
+#include "md_perfids.h"
+#include "md_test_utils.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/*
+ * Function Definitions
+ */
+
+/* Times returned by successive CFE_PSP_GetTime calls, in microseconds */
+int64 MD_PERF_TEST_Times[2];
+
+void MD_PERF_TEST_CFE_PSP_GetTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *LocalTime = UT_Hook_GetArgValueByName(Context, "LocalTime", OS_time_t *);
+    uint32     CallCount = UT_GetStubCount(UT_KEY(CFE_PSP_GetTime));
+
+    *LocalTime = OS_TimeFromTotalMicroseconds(MD_PERF_TEST_Times[(CallCount - 1) % 2]);
+}
+
+void MD_PerfBegin_Test(void)
+{
+    OS_time_t StartTime;
+
+    MD_PERF_TEST_Times[0] = 5000;
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_GetTime), MD_PERF_TEST_CFE_PSP_GetTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    MD_PerfBegin(MD_Perf_Phases_DWELL_SAMPLE, &StartTime);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_GetTime, 1);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(StartTime), 5000);
+}
+
+void MD_PerfEnd_Test_Nominal(void)
+{
+    OS_time_t      StartTime;
+    MD_PerfHist_t *HistPtr = &MD_AppData.PerfHistPkt.Payload.Hist[MD_Perf_Phases_PKT_SEND];
+
+    MD_PERF_TEST_Times[0] = 1000;
+    MD_PERF_TEST_Times[1] = 1006;
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_GetTime), MD_PERF_TEST_CFE_PSP_GetTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    MD_PerfBegin(MD_Perf_Phases_PKT_SEND, &StartTime);
+    UtAssert_UINT32_EQ(MD_PerfEnd(MD_Perf_Phases_PKT_SEND, &StartTime), 6);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 2);
+    UtAssert_UINT32_EQ(HistPtr->Bin[3], 1);
+    UtAssert_UINT32_EQ(HistPtr->MaxTime, 6);
+
+    /* A quicker pass lands in a lower bin and leaves the longest time in place */
+    MD_PERF_TEST_Times[1] = 1001;
+
+    MD_PerfBegin(MD_Perf_Phases_PKT_SEND, &StartTime);
+    UtAssert_UINT32_EQ(MD_PerfEnd(MD_Perf_Phases_PKT_SEND, &StartTime), 1);
+
+    UtAssert_UINT32_EQ(HistPtr->Bin[1], 1);
+    UtAssert_UINT32_EQ(HistPtr->Bin[3], 1);
+    UtAssert_UINT32_EQ(HistPtr->MaxTime, 6);
+
+    /* Other phases are untouched */
+    UtAssert_UINT32_EQ(MD_AppData.PerfHistPkt.Payload.Hist[MD_Perf_Phases_CMD].Bin[1], 0);
+}
+
+void MD_PerfEnd_Test_ClockBackwards(void)
+{
+    OS_time_t      StartTime;
+    MD_PerfHist_t *HistPtr = &MD_AppData.PerfHistPkt.Payload.Hist[MD_Perf_Phases_CMD];
+
+    MD_PERF_TEST_Times[0] = 2000;
+    MD_PERF_TEST_Times[1] = 1500;
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_GetTime), MD_PERF_TEST_CFE_PSP_GetTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    MD_PerfBegin(MD_Perf_Phases_CMD, &StartTime);
+    UtAssert_UINT32_EQ(MD_PerfEnd(MD_Perf_Phases_CMD, &StartTime), 0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HistPtr->Bin[0], 1);
+    UtAssert_UINT32_EQ(HistPtr->MaxTime, 0);
+}
+
+void MD_PerfEnd_Test_Saturate(void)
+{
+    OS_time_t      StartTime;
+    MD_PerfHist_t *HistPtr = &MD_AppData.PerfHistPkt.Payload.Hist[MD_Perf_Phases_TBL_MANAGE];
+
+    MD_PERF_TEST_Times[0] = 0;
+    MD_PERF_TEST_Times[1] = 0x100000000LL;
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_GetTime), MD_PERF_TEST_CFE_PSP_GetTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    MD_PerfBegin(MD_Perf_Phases_TBL_MANAGE, &StartTime);
+    UtAssert_UINT32_EQ(MD_PerfEnd(MD_Perf_Phases_TBL_MANAGE, &StartTime), 0xFFFFFFFF);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HistPtr->Bin[MD_INTERFACE_PERF_HIST_BINS - 1], 1);
+    UtAssert_UINT32_EQ(HistPtr->MaxTime, 0xFFFFFFFF);
+}
+
+void MD_PerfHistBin_Test(void)
+{
+    UtAssert_UINT16_EQ(MD_PerfHistBin(0), 0);
+    UtAssert_UINT16_EQ(MD_PerfHistBin(1), 1);
+    UtAssert_UINT16_EQ(MD_PerfHistBin(2), 2);
+    UtAssert_UINT16_EQ(MD_PerfHistBin(3), 2);
+    UtAssert_UINT16_EQ(MD_PerfHistBin(4), 3);
+    UtAssert_UINT16_EQ(MD_PerfHistBin(1000), 10);
+
+    /* Long times all land in the last bin */
+    UtAssert_UINT16_EQ(MD_PerfHistBin(0xFFFFFFFF), MD_INTERFACE_PERF_HIST_BINS - 1);
+}
+
+void MD_ResetPerfHist_Test(void)
+{
+    MD_AppData.PerfHistPkt.Payload.Hist[0].MaxTime                                                 = 7;
+    MD_AppData.PerfHistPkt.Payload.Hist[MD_PERF_NUM_PHASES - 1].Bin[MD_INTERFACE_PERF_HIST_BINS - 1] = 3;
+
+    /* Execute the function being tested */
+    MD_ResetPerfHist();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.PerfHistPkt.Payload.Hist[0].MaxTime, 0);
+    UtAssert_UINT32_EQ(MD_AppData.PerfHistPkt.Payload.Hist[MD_PERF_NUM_PHASES - 1].Bin[MD_INTERFACE_PERF_HIST_BINS - 1],
+                       0);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(MD_PerfBegin_Test, MD_Test_Setup, MD_Test_TearDown, "MD_PerfBegin_Test");
+
+    UtTest_Add(MD_PerfEnd_Test_Nominal, MD_Test_Setup, MD_Test_TearDown, "MD_PerfEnd_Test_Nominal");
+    UtTest_Add(MD_PerfEnd_Test_ClockBackwards, MD_Test_Setup, MD_Test_TearDown, "MD_PerfEnd_Test_ClockBackwards");
+    UtTest_Add(MD_PerfEnd_Test_Saturate, MD_Test_Setup, MD_Test_TearDown, "MD_PerfEnd_Test_Saturate");
+
+    UtTest_Add(MD_PerfHistBin_Test, MD_Test_Setup, MD_Test_TearDown, "MD_PerfHistBin_Test");
+
+    UtTest_Add(MD_ResetPerfHist_Test, MD_Test_Setup, MD_Test_TearDown, "MD_ResetPerfHist_Test");
+}
@@ -0,0 +1,476 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "md_sampler.h"
+#include "md_app.h"
+#include "md_dispatch.h"
+#include "md_eventids.h"
+#include "md_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/*
+ * Function Definitions
+ */
+
+/* Ends the sampler task loop after the current pass */
+int32 MD_SAMPLER_TEST_CFE_SB_ReceiveBufferHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                               const UT_StubContext_t *Context)
+{
+    MD_AppData.RunStatus = CFE_ES_RunStatus_APP_EXIT;
+
+    return StubRetcode;
+}
+
+/* Makes the message in UT_CmdBuf look like it is MsgSize bytes long */
+void MD_SAMPLER_TEST_SetupMsg(size_t MsgSize)
+{
+    CFE_SB_MsgId_t TestMsgId = CFE_SB_ValueToMsgId(MD_CMD_MID);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), true);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), true);
+}
+
+void MD_InitSampler_Test_Nominal(void)
+{
+    CFE_Status_t Result;
+
+    /* Execute the function being tested */
+    Result = MD_InitSampler();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_SB_CreatePipe, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_InitSampler_Test_CreatePipeError(void)
+{
+    CFE_Status_t Result;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 1, -1);
+
+    /* Execute the function being tested */
+    Result = MD_InitSampler();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, -1);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_CR_PIPE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void MD_InitSampler_Test_SubscribeError(void)
+{
+    CFE_Status_t Result;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 1, -1);
+
+    /* Execute the function being tested */
+    Result = MD_InitSampler();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, -1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_SUB_WAKEUP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void MD_InitSampler_Test_CreateChildTaskError(void)
+{
+    CFE_Status_t Result;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+
+    /* Execute the function being tested */
+    Result = MD_InitSampler();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, -1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_CREATE_SAMPLER_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void MD_SamplerTask_Test_Wakeup(void)
+{
+    MD_AppData.RunStatus = CFE_ES_RunStatus_APP_RUN;
+
+    /* A command is waiting for the sampler */
+    MD_AppData.SamplerQueue.WriteCount = 1;
+
+    UT_SetHookFunction(UT_KEY(CFE_SB_ReceiveBuffer), MD_SAMPLER_TEST_CFE_SB_ReceiveBufferHook, NULL);
+
+    /* Execute the function being tested */
+    MD_SamplerTask();
+
+    /* Verify results, the wakeup and then the command are dispatched */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_STUB_COUNT(MD_ProcessCommandPacket, 2);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.ReadCount, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_SamplerTask_Test_Timeout(void)
+{
+    MD_AppData.RunStatus = CFE_ES_RunStatus_APP_RUN;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_TIME_OUT);
+    UT_SetHookFunction(UT_KEY(CFE_SB_ReceiveBuffer), MD_SAMPLER_TEST_CFE_SB_ReceiveBufferHook, NULL);
+
+    /* Execute the function being tested */
+    MD_SamplerTask();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MD_ProcessCommandPacket, 0);
+    UtAssert_UINT32_EQ(MD_AppData.RunStatus, CFE_ES_RunStatus_APP_EXIT);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_SamplerTask_Test_PipeError(void)
+{
+    MD_AppData.RunStatus = CFE_ES_RunStatus_APP_RUN;
+
+    /* Set to generate error message MD_PIPE_ERR_EID, which also ends the loop */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, -1);
+
+    /* Execute the function being tested */
+    MD_SamplerTask();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_STUB_COUNT(MD_ProcessCommandPacket, 0);
+    UtAssert_UINT32_EQ(MD_AppData.RunStatus, CFE_ES_RunStatus_APP_ERROR);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_PIPE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void MD_SamplerTask_Test_NotRunning(void)
+{
+    MD_AppData.RunStatus = CFE_ES_RunStatus_APP_ERROR;
+
+    /* Execute the function being tested */
+    MD_SamplerTask();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+}
+
+void MD_IsMainTaskMsg_Test_TblManage(void)
+{
+    CFE_MSG_FcnCode_t FcnCode = MD_TBL_MANAGE_CC;
+
+    MD_SAMPLER_TEST_SetupMsg(sizeof(MD_TblManageCmd_t));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MD_IsMainTaskMsg(&UT_CmdBuf.Buf));
+}
+
+void MD_IsMainTaskMsg_Test_OtherCmd(void)
+{
+    CFE_MSG_FcnCode_t FcnCode = MD_JAM_DWELL_CC;
+
+    MD_SAMPLER_TEST_SetupMsg(sizeof(MD_JamDwellCmd_t));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MD_IsMainTaskMsg(&UT_CmdBuf.Buf));
+}
+
+void MD_IsMainTaskMsg_Test_OtherMsgId(void)
+{
+    CFE_SB_MsgId_t TestMsgId = CFE_SB_ValueToMsgId(MD_SEND_HK_MID);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MD_IsMainTaskMsg(&UT_CmdBuf.Buf));
+    UtAssert_STUB_COUNT(CFE_MSG_GetFcnCode, 0);
+}
+
+void MD_IsMainTaskMsg_Test_NullBuffer(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MD_IsMainTaskMsg(NULL));
+}
+
+void MD_QueueSamplerMsg_Test_Nominal(void)
+{
+    MD_SamplerRequest_t *RequestPtr = &MD_AppData.SamplerQueue.Request[3];
+
+    /* Slot 3 is next, after requests that were processed */
+    MD_AppData.SamplerQueue.WriteCount = 3;
+    MD_AppData.SamplerQueue.ReadCount  = 3;
+
+    memset(&UT_CmdBuf, 0x5A, sizeof(UT_CmdBuf));
+    MD_SAMPLER_TEST_SetupMsg(sizeof(MD_ArmCaptureCmd_t));
+
+    /* Execute the function being tested */
+    MD_QueueSamplerMsg(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.WriteCount, 4);
+    UtAssert_UINT32_EQ(RequestPtr->Type, MD_SAMPLER_REQ_MSG);
+    UtAssert_MemCmp(&RequestPtr->Msg, &UT_CmdBuf, sizeof(MD_ArmCaptureCmd_t), "Queued message");
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_QueueSamplerMsg_Test_TooLong(void)
+{
+    MD_SAMPLER_TEST_SetupMsg(sizeof(MD_SamplerMsg_t) + 1);
+
+    /* Execute the function being tested */
+    MD_QueueSamplerMsg(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.WriteCount, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_MSG_LEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void MD_QueueSamplerMsg_Test_QueueFull(void)
+{
+    MD_AppData.SamplerQueue.WriteCount = MD_INTERNAL_SAMPLER_QUEUE_DEPTH;
+
+    MD_SAMPLER_TEST_SetupMsg(sizeof(MD_NoopCmd_t));
+
+    /* Execute the function being tested */
+    MD_QueueSamplerMsg(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.WriteCount, MD_INTERNAL_SAMPLER_QUEUE_DEPTH);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_SAMPLER_QUEUE_FULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void MD_QueueSamplerMsg_Test_NullBuffer(void)
+{
+    /* Execute the function being tested */
+    MD_QueueSamplerMsg(NULL);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.WriteCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_QueueTableUpdate_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_QueueTableUpdate(1), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.WriteCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.UpdateRequests[1], 1);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.Request[0].Type, MD_SAMPLER_REQ_TBL_UPDATE);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.Request[0].TableIndex, 1);
+
+    /* Not queued again while the first is outstanding */
+    UtAssert_INT32_EQ(MD_QueueTableUpdate(1), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.WriteCount, 1);
+
+    /* Queued again once the sampler has made the update */
+    MD_AppData.SamplerQueue.UpdatesDone[1] = 1;
+    UtAssert_INT32_EQ(MD_QueueTableUpdate(1), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.WriteCount, 2);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.UpdateRequests[1], 2);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_QueueTableUpdate_Test_QueueFull(void)
+{
+    uint16 i;
+
+    /* Fill the queue with commands */
+    MD_SAMPLER_TEST_SetupMsg(sizeof(MD_NoopCmd_t));
+
+    for (i = 0; i < MD_INTERNAL_SAMPLER_QUEUE_DEPTH; i++)
+    {
+        MD_QueueSamplerMsg(&UT_CmdBuf.Buf);
+    }
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_QueueTableUpdate(0), MD_QUEUE_FULL_ERROR);
+
+    /* Verify results, the update is reported and left for the main task to ask again */
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.WriteCount, MD_INTERNAL_SAMPLER_QUEUE_DEPTH);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.UpdateRequests[0], 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_TBL_UPDATE_QUEUE_FULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Asking again while the update is owed isn't reported again */
+    MD_AppData.SamplerQueue.UpdateOwed[0] = true;
+
+    UtAssert_INT32_EQ(MD_QueueTableUpdate(0), MD_QUEUE_FULL_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Once the sampler makes room, asking again queues the update */
+    MD_ProcessSamplerQueue();
+
+    UtAssert_INT32_EQ(MD_QueueTableUpdate(0), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.UpdateRequests[0], 1);
+    UtAssert_STUB_COUNT(MD_UpdateDwellTable, 0);
+
+    /* And the sampler applies it after the commands ahead of it */
+    while (MD_AppData.SamplerQueue.ReadCount != MD_AppData.SamplerQueue.WriteCount)
+    {
+        MD_ProcessSamplerQueue();
+    }
+
+    UtAssert_STUB_COUNT(MD_UpdateDwellTable, 1);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.UpdatesDone[0], 1);
+    UtAssert_STUB_COUNT(MD_ProcessCommandPacket, MD_INTERNAL_SAMPLER_QUEUE_DEPTH);
+}
+
+void MD_SamplerQueueFull_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_True(!MD_SamplerQueueFull(), "Empty queue isn't full");
+
+    /* Counters that have wrapped */
+    MD_AppData.SamplerQueue.ReadCount  = 0xFFFFFFFF - (MD_INTERNAL_SAMPLER_QUEUE_DEPTH - 2);
+    MD_AppData.SamplerQueue.WriteCount = 0;
+    UtAssert_True(!MD_SamplerQueueFull(), "One slot left");
+
+    MD_AppData.SamplerQueue.WriteCount = 1;
+    UtAssert_True(MD_SamplerQueueFull(), "No slot left");
+}
+
+void MD_ProcessSamplerQueue_Test(void)
+{
+    uint16 i;
+
+    /* A table update followed by more commands than are processed at once */
+    MD_QueueTableUpdate(2);
+
+    MD_SAMPLER_TEST_SetupMsg(sizeof(MD_NoopCmd_t));
+
+    for (i = 0; i < MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP; i++)
+    {
+        MD_QueueSamplerMsg(&UT_CmdBuf.Buf);
+    }
+
+    /* Execute the function being tested */
+    MD_ProcessSamplerQueue();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.ReadCount, MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP);
+    UtAssert_STUB_COUNT(MD_UpdateDwellTable, 1);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.UpdatesDone[2], 1);
+    UtAssert_STUB_COUNT(MD_ProcessCommandPacket, MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP - 1);
+
+    /* The rest are processed on the next pass */
+    MD_ProcessSamplerQueue();
+
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.ReadCount, MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP + 1);
+    UtAssert_STUB_COUNT(MD_ProcessCommandPacket, MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP);
+
+    MD_ProcessSamplerQueue();
+
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.ReadCount, MD_INTERNAL_SAMPLER_REQUESTS_PER_WAKEUP + 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_ProcessSamplerQueue_Test_Wrap(void)
+{
+    /* The last slot and then the first one */
+    MD_AppData.SamplerQueue.WriteCount = 0xFFFFFFFF;
+    MD_AppData.SamplerQueue.ReadCount  = 0xFFFFFFFF;
+
+    MD_QueueTableUpdate(0);
+    MD_QueueTableUpdate(1);
+
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.WriteCount, 1);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.Request[MD_INTERNAL_SAMPLER_QUEUE_DEPTH - 1].TableIndex, 0);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.Request[0].TableIndex, 1);
+
+    /* Execute the function being tested */
+    MD_ProcessSamplerQueue();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.ReadCount, 1);
+    UtAssert_STUB_COUNT(MD_UpdateDwellTable, 2);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.UpdatesDone[0], 1);
+    UtAssert_UINT32_EQ(MD_AppData.SamplerQueue.UpdatesDone[1], 1);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(MD_InitSampler_Test_Nominal, MD_Test_Setup, MD_Test_TearDown, "MD_InitSampler_Test_Nominal");
+    UtTest_Add(MD_InitSampler_Test_CreatePipeError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_InitSampler_Test_CreatePipeError");
+    UtTest_Add(MD_InitSampler_Test_SubscribeError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_InitSampler_Test_SubscribeError");
+    UtTest_Add(MD_InitSampler_Test_CreateChildTaskError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_InitSampler_Test_CreateChildTaskError");
+
+    UtTest_Add(MD_SamplerTask_Test_Wakeup, MD_Test_Setup, MD_Test_TearDown, "MD_SamplerTask_Test_Wakeup");
+    UtTest_Add(MD_SamplerTask_Test_Timeout, MD_Test_Setup, MD_Test_TearDown, "MD_SamplerTask_Test_Timeout");
+    UtTest_Add(MD_SamplerTask_Test_PipeError, MD_Test_Setup, MD_Test_TearDown, "MD_SamplerTask_Test_PipeError");
+    UtTest_Add(MD_SamplerTask_Test_NotRunning, MD_Test_Setup, MD_Test_TearDown, "MD_SamplerTask_Test_NotRunning");
+
+    UtTest_Add(MD_IsMainTaskMsg_Test_TblManage, MD_Test_Setup, MD_Test_TearDown, "MD_IsMainTaskMsg_Test_TblManage");
+    UtTest_Add(MD_IsMainTaskMsg_Test_OtherCmd, MD_Test_Setup, MD_Test_TearDown, "MD_IsMainTaskMsg_Test_OtherCmd");
+    UtTest_Add(MD_IsMainTaskMsg_Test_OtherMsgId, MD_Test_Setup, MD_Test_TearDown, "MD_IsMainTaskMsg_Test_OtherMsgId");
+    UtTest_Add(MD_IsMainTaskMsg_Test_NullBuffer, MD_Test_Setup, MD_Test_TearDown, "MD_IsMainTaskMsg_Test_NullBuffer");
+
+    UtTest_Add(MD_QueueSamplerMsg_Test_Nominal, MD_Test_Setup, MD_Test_TearDown, "MD_QueueSamplerMsg_Test_Nominal");
+    UtTest_Add(MD_QueueSamplerMsg_Test_TooLong, MD_Test_Setup, MD_Test_TearDown, "MD_QueueSamplerMsg_Test_TooLong");
+    UtTest_Add(MD_QueueSamplerMsg_Test_QueueFull, MD_Test_Setup, MD_Test_TearDown,
+               "MD_QueueSamplerMsg_Test_QueueFull");
+    UtTest_Add(MD_QueueSamplerMsg_Test_NullBuffer, MD_Test_Setup, MD_Test_TearDown,
+               "MD_QueueSamplerMsg_Test_NullBuffer");
+
+    UtTest_Add(MD_QueueTableUpdate_Test, MD_Test_Setup, MD_Test_TearDown, "MD_QueueTableUpdate_Test");
+    UtTest_Add(MD_QueueTableUpdate_Test_QueueFull, MD_Test_Setup, MD_Test_TearDown,
+               "MD_QueueTableUpdate_Test_QueueFull");
+
+    UtTest_Add(MD_SamplerQueueFull_Test, MD_Test_Setup, MD_Test_TearDown, "MD_SamplerQueueFull_Test");
+
+    UtTest_Add(MD_ProcessSamplerQueue_Test, MD_Test_Setup, MD_Test_TearDown, "MD_ProcessSamplerQueue_Test");
+    UtTest_Add(MD_ProcessSamplerQueue_Test_Wrap, MD_Test_Setup, MD_Test_TearDown, "MD_ProcessSamplerQueue_Test_Wrap");
+}
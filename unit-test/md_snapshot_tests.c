@@ -0,0 +1,359 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "md_snapshot.h"
+#include "md_dwell_pkt.h"
+#include "md_app.h"
+#include "md_eventids.h"
+#include "md_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* Memory read by the snapshot tests */
+uint32 MD_SNAPSHOT_TEST_Memory[4] = {0x03020100, 0x07060504, 0x0B0A0908, 0x0F0E0D0C};
+
+/* Software bus buffer a dwell packet can be built in */
+MD_DwellPkt_t MD_SNAPSHOT_TEST_SbPkt;
+
+/*
+ * Function Definitions
+ */
+
+/* Handlers that perform real memory reads */
+void MD_SNAPSHOT_TEST_CFE_PSP_MemRead8Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    cpuaddr MemoryAddress = UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+    uint8 * ByteValue     = UT_Hook_GetArgValueByName(Context, "ByteValue", uint8 *);
+
+    *ByteValue = *(uint8 *)MemoryAddress;
+}
+
+void MD_SNAPSHOT_TEST_CFE_PSP_MemRead32Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    cpuaddr MemoryAddress = UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+    uint32 *uint32Value   = UT_Hook_GetArgValueByName(Context, "uint32Value", uint32 *);
+
+    *uint32Value = *(uint32 *)MemoryAddress;
+}
+
+void MD_SNAPSHOT_TEST_CFE_PSP_MemCpyHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void *      dest = UT_Hook_GetArgValueByName(Context, "dest", void *);
+    const void *src  = UT_Hook_GetArgValueByName(Context, "src", const void *);
+    uint32      n    = UT_Hook_GetArgValueByName(Context, "n", uint32);
+
+    memcpy(dest, src, n);
+}
+
+/* Returns the packet passed as the user object as the table's dwell packet buffer */
+void MD_SNAPSHOT_TEST_MD_GetDwellPktBufHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    MD_DwellPkt_t *PktPtr = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, PktPtr);
+}
+
+/*
+ * Sets up group 1 with a 4 byte entry of table 0 and an 8 byte block entry
+ * of table 1, and group 2 with a 1 byte entry of table 0
+ */
+void MD_SNAPSHOT_TEST_SetupGroups(void)
+{
+    cpuaddr Base = (cpuaddr)MD_SNAPSHOT_TEST_Memory;
+
+    MD_AppData.MD_DwellTables[0].AddrCount                = 3;
+    MD_AppData.MD_DwellTables[0].Entry[0].Length          = 1;
+    MD_AppData.MD_DwellTables[0].Entry[0].ResolvedAddress = Base + 1;
+    MD_AppData.MD_DwellTables[0].Entry[1].Length          = 2;
+    MD_AppData.MD_DwellTables[0].Entry[1].ResolvedAddress = Base + 2;
+    MD_AppData.MD_DwellTables[0].Entry[2].Length          = 4;
+    MD_AppData.MD_DwellTables[0].Entry[2].ResolvedAddress = Base + 4;
+    MD_AppData.DwellReportControl[0].Group[0]             = 2;
+    MD_AppData.DwellReportControl[0].Group[2]             = 1;
+
+    MD_AppData.MD_DwellTables[1].AddrCount                = 1;
+    MD_AppData.MD_DwellTables[1].Entry[0].Length          = 8;
+    MD_AppData.MD_DwellTables[1].Entry[0].ResolvedAddress = Base + 8;
+    MD_AppData.DwellReportControl[1].Group[0]             = 1;
+
+    /* Entries past the active count aren't members */
+    MD_AppData.DwellReportControl[1].Group[1] = 1;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemRead8), MD_SNAPSHOT_TEST_CFE_PSP_MemRead8Handler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemRead32), MD_SNAPSHOT_TEST_CFE_PSP_MemRead32Handler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemCpy), MD_SNAPSHOT_TEST_CFE_PSP_MemCpyHandler, NULL);
+}
+
+void MD_BuildSnapshotGroups_Test(void)
+{
+    MD_SnapshotGroups_t *GroupsPtr = &MD_AppData.SnapshotGroups;
+
+    MD_SNAPSHOT_TEST_SetupGroups();
+
+    /* Execute the function being tested */
+    MD_BuildSnapshotGroups();
+
+    /* Verify results: members are kept together by group, in table and entry order */
+    UtAssert_INT32_EQ(GroupsPtr->NumMembers, 3);
+    UtAssert_INT32_EQ(GroupsPtr->FirstMember[0], 0);
+    UtAssert_INT32_EQ(GroupsPtr->MemberCount[0], 2);
+    UtAssert_INT32_EQ(GroupsPtr->FirstMember[1], 2);
+    UtAssert_INT32_EQ(GroupsPtr->MemberCount[1], 1);
+
+    UtAssert_INT32_EQ(GroupsPtr->Member[0].TableIndex, 0);
+    UtAssert_INT32_EQ(GroupsPtr->Member[0].EntryIndex, 2);
+    UtAssert_INT32_EQ(GroupsPtr->Member[0].Length, 4);
+    UtAssert_INT32_EQ(GroupsPtr->Member[0].Group, 1);
+    UtAssert_BOOL_FALSE(GroupsPtr->Member[0].Fresh);
+    UtAssert_INT32_EQ(GroupsPtr->Member[1].TableIndex, 1);
+    UtAssert_INT32_EQ(GroupsPtr->Member[1].EntryIndex, 0);
+    UtAssert_INT32_EQ(GroupsPtr->Member[1].Length, 8);
+    UtAssert_INT32_EQ(GroupsPtr->Member[2].TableIndex, 0);
+    UtAssert_INT32_EQ(GroupsPtr->Member[2].EntryIndex, 0);
+    UtAssert_INT32_EQ(GroupsPtr->Member[2].Group, 2);
+    UtAssert_True(GroupsPtr->Member[2].ResolvedAddress == MD_AppData.MD_DwellTables[0].Entry[0].ResolvedAddress,
+                  "Member[2].ResolvedAddress == Entry[0].ResolvedAddress");
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_BuildSnapshotGroups_Test_Full(void)
+{
+    MD_SnapshotGroups_t *GroupsPtr = &MD_AppData.SnapshotGroups;
+    uint32               Assigned  = 0;
+    uint16               TblIndex;
+    uint16               EntryIndex;
+
+    /* Put every entry of every table in group 1 */
+    for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+    {
+        MD_AppData.MD_DwellTables[TblIndex].AddrCount = MD_INTERFACE_DWELL_TABLE_SIZE;
+
+        for (EntryIndex = 0; EntryIndex < MD_INTERFACE_DWELL_TABLE_SIZE; EntryIndex++)
+        {
+            MD_AppData.DwellReportControl[TblIndex].Group[EntryIndex] = 1;
+            Assigned++;
+        }
+    }
+
+    /* Execute the function being tested */
+    MD_BuildSnapshotGroups();
+
+    /* Verify results */
+    if (Assigned > MD_INTERNAL_SNAPSHOT_MAX_MEMBERS)
+    {
+        UtAssert_INT32_EQ(GroupsPtr->NumMembers, MD_INTERNAL_SNAPSHOT_MAX_MEMBERS);
+        UtAssert_INT32_EQ(GroupsPtr->MemberCount[0], MD_INTERNAL_SNAPSHOT_MAX_MEMBERS);
+        UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_SNAPSHOT_FULL_ERR_EID);
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+        /* Entries left out aren't found as members */
+        UtAssert_NULL(MD_FindSnapshotMember(MD_INTERFACE_NUM_DWELL_TABLES - 1, MD_INTERFACE_DWELL_TABLE_SIZE - 1));
+    }
+    else
+    {
+        UtAssert_INT32_EQ(GroupsPtr->NumMembers, Assigned);
+        UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    }
+
+    UtAssert_INT32_EQ(GroupsPtr->MemberCount[1], 0);
+}
+
+void MD_TakeSnapshot_Test(void)
+{
+    MD_SnapshotGroups_t *GroupsPtr = &MD_AppData.SnapshotGroups;
+
+    MD_SNAPSHOT_TEST_SetupGroups();
+    MD_BuildSnapshotGroups();
+
+    /* Execute the function being tested */
+    MD_TakeSnapshot(1);
+
+    /* Verify results: only group 1 was read */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead32, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemCpy, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 0);
+
+    UtAssert_INT32_EQ(GroupsPtr->Member[0].Status, CFE_SUCCESS);
+    UtAssert_BOOL_TRUE(GroupsPtr->Member[0].Fresh);
+    UtAssert_MemCmp(GroupsPtr->Member[0].Data, (uint8 *)MD_SNAPSHOT_TEST_Memory + 4, 4, "Member 0 data matches memory");
+    UtAssert_INT32_EQ(GroupsPtr->Member[1].Status, CFE_SUCCESS);
+    UtAssert_BOOL_TRUE(GroupsPtr->Member[1].Fresh);
+    UtAssert_MemCmp(GroupsPtr->Member[1].Data, (uint8 *)MD_SNAPSHOT_TEST_Memory + 8, 8, "Member 1 data matches memory");
+    UtAssert_BOOL_FALSE(GroupsPtr->Member[2].Fresh);
+}
+
+void MD_TakeSnapshot_Test_ReadErrors(void)
+{
+    MD_SnapshotGroups_t *GroupsPtr = &MD_AppData.SnapshotGroups;
+
+    MD_SNAPSHOT_TEST_SetupGroups();
+    MD_AppData.MD_DwellTables[0].AddrCount        = 4;
+    MD_AppData.MD_DwellTables[0].Entry[3].Length  = 3;
+    MD_AppData.DwellReportControl[0].Group[1]     = 2;
+    MD_AppData.DwellReportControl[0].Group[3]     = 2;
+    MD_BuildSnapshotGroups();
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead8), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead16), 1, -1);
+
+    /* Execute the function being tested */
+    MD_TakeSnapshot(2);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(GroupsPtr->MemberCount[1], 3);
+    UtAssert_INT32_EQ(GroupsPtr->Member[2].Status, ONE_BYTE_MEM_ADDR_READ_ERR);
+    UtAssert_INT32_EQ(GroupsPtr->Member[3].Status, TWO_BYTE_MEM_ADDR_READ_ERR);
+    UtAssert_INT32_EQ(GroupsPtr->Member[4].Status, INVALID_DWELL_ADDR_LEN);
+    UtAssert_BOOL_TRUE(GroupsPtr->Member[4].Fresh);
+
+    /* Errors on group 1 */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead32), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemCpy), 1, -1);
+
+    MD_TakeSnapshot(1);
+
+    UtAssert_INT32_EQ(GroupsPtr->Member[0].Status, FOUR_BYTE_MEM_ADDR_READ_ERR);
+    UtAssert_INT32_EQ(GroupsPtr->Member[1].Status, BLOCK_MEM_ADDR_READ_ERR);
+}
+
+void MD_FindSnapshotMember_Test(void)
+{
+    MD_SNAPSHOT_TEST_SetupGroups();
+    MD_BuildSnapshotGroups();
+
+    /* Execute the function being tested */
+    UtAssert_ADDRESS_EQ(MD_FindSnapshotMember(1, 0), &MD_AppData.SnapshotGroups.Member[1]);
+    UtAssert_ADDRESS_EQ(MD_FindSnapshotMember(0, 0), &MD_AppData.SnapshotGroups.Member[2]);
+    UtAssert_NULL(MD_FindSnapshotMember(0, 1));
+
+    /* A group with no members */
+    MD_AppData.DwellReportControl[0].Group[1] = 3;
+    UtAssert_NULL(MD_FindSnapshotMember(0, 1));
+}
+
+void MD_GetSnapshotData_Test(void)
+{
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[0];
+
+    MD_SNAPSHOT_TEST_SetupGroups();
+    MD_BuildSnapshotGroups();
+    UT_SetHandlerFunction(UT_KEY(MD_GetDwellPktBuf), MD_SNAPSHOT_TEST_MD_GetDwellPktBufHandler,
+                          &MD_AppData.MD_DwellPkt[0]);
+
+    TblPtr->PktOffset = 1;
+
+    /* Execute the function being tested: the first member reached takes the pass */
+    UtAssert_INT32_EQ(MD_GetSnapshotData(0, 2), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead32, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemCpy, 1);
+    UtAssert_MemCmp(&MD_AppData.MD_DwellPkt[0].Payload.Data[1], (uint8 *)MD_SNAPSHOT_TEST_Memory + 4, 4,
+                    "Dwell packet data matches memory");
+    UtAssert_INT32_EQ(TblPtr->PktOffset, 5);
+    UtAssert_BOOL_FALSE(MD_AppData.SnapshotGroups.Member[0].Fresh);
+
+    /* The other member reports the same pass */
+    MD_AppData.MD_DwellTables[1].PktOffset = 0;
+    UT_SetHandlerFunction(UT_KEY(MD_GetDwellPktBuf), MD_SNAPSHOT_TEST_MD_GetDwellPktBufHandler,
+                          &MD_AppData.MD_DwellPkt[1]);
+
+    UtAssert_INT32_EQ(MD_GetSnapshotData(1, 0), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_PSP_MemCpy, 1);
+    UtAssert_MemCmp(MD_AppData.MD_DwellPkt[1].Payload.Data, (uint8 *)MD_SNAPSHOT_TEST_Memory + 8, 8,
+                    "Dwell packet data matches memory");
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[1].PktOffset, 8);
+
+    /* Reaching a member again starts the next pass */
+    UtAssert_INT32_EQ(MD_GetSnapshotData(1, 0), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead32, 2);
+    UtAssert_STUB_COUNT(CFE_PSP_MemCpy, 2);
+    UtAssert_BOOL_TRUE(MD_AppData.SnapshotGroups.Member[0].Fresh);
+    UtAssert_STUB_COUNT(MD_GetDwellData, 0);
+}
+
+void MD_GetSnapshotData_Test_NotMember(void)
+{
+    MD_SNAPSHOT_TEST_SetupGroups();
+    MD_BuildSnapshotGroups();
+
+    UT_SetDefaultReturnValue(UT_KEY(MD_GetDwellData), TWO_BYTE_MEM_ADDR_READ_ERR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_GetSnapshotData(0, 1), TWO_BYTE_MEM_ADDR_READ_ERR);
+
+    /* Verify results: the entry was read on its own */
+    UtAssert_STUB_COUNT(MD_GetDwellData, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 0);
+}
+
+void MD_GetSnapshotData_Test_ReadError(void)
+{
+    MD_DwellPacketControl_t *TblPtr = &MD_AppData.MD_DwellTables[0];
+
+    MD_SNAPSHOT_TEST_SetupGroups();
+    MD_BuildSnapshotGroups();
+
+    /* The packet is being built in a software bus buffer */
+    memset(&MD_SNAPSHOT_TEST_SbPkt, 0xFF, sizeof(MD_SNAPSHOT_TEST_SbPkt));
+    TblPtr->PktBuf = &MD_SNAPSHOT_TEST_SbPkt;
+    UT_SetHandlerFunction(UT_KEY(MD_GetDwellPktBuf), MD_SNAPSHOT_TEST_MD_GetDwellPktBufHandler,
+                          &MD_SNAPSHOT_TEST_SbPkt);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead32), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_GetSnapshotData(0, 2), FOUR_BYTE_MEM_ADDR_READ_ERR);
+
+    /* Verify results: the value was zeroed instead */
+    UtAssert_UINT32_EQ(MD_SNAPSHOT_TEST_SbPkt.Payload.Data[0], 0);
+    UtAssert_UINT32_EQ(MD_SNAPSHOT_TEST_SbPkt.Payload.Data[3], 0);
+    UtAssert_UINT32_EQ(MD_SNAPSHOT_TEST_SbPkt.Payload.Data[4], 0xFF);
+    UtAssert_INT32_EQ(TblPtr->PktOffset, 4);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(MD_BuildSnapshotGroups_Test, MD_Test_Setup, MD_Test_TearDown, "MD_BuildSnapshotGroups_Test");
+    UtTest_Add(MD_BuildSnapshotGroups_Test_Full, MD_Test_Setup, MD_Test_TearDown, "MD_BuildSnapshotGroups_Test_Full");
+
+    UtTest_Add(MD_TakeSnapshot_Test, MD_Test_Setup, MD_Test_TearDown, "MD_TakeSnapshot_Test");
+    UtTest_Add(MD_TakeSnapshot_Test_ReadErrors, MD_Test_Setup, MD_Test_TearDown, "MD_TakeSnapshot_Test_ReadErrors");
+
+    UtTest_Add(MD_FindSnapshotMember_Test, MD_Test_Setup, MD_Test_TearDown, "MD_FindSnapshotMember_Test");
+
+    UtTest_Add(MD_GetSnapshotData_Test, MD_Test_Setup, MD_Test_TearDown, "MD_GetSnapshotData_Test");
+    UtTest_Add(MD_GetSnapshotData_Test_NotMember, MD_Test_Setup, MD_Test_TearDown,
+               "MD_GetSnapshotData_Test_NotMember");
+    UtTest_Add(MD_GetSnapshotData_Test_ReadError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_GetSnapshotData_Test_ReadError");
+}
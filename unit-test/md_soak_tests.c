@@ -0,0 +1,569 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Soak test of the dispatcher, commands and dwell engine together
+ *
+ * Feeds MD_ProcessCommandPacket wakeup, housekeeping and command messages
+ * under simulated time, reconfiguring randomized dwell tables as it goes,
+ * and checks every dwell packet arrives exactly when its table's Rate says
+ * it should.  The packets sent are folded into a digest, so changes to the
+ * scheduler or packet packing can be shown not to change what is sent.
+ */
+
+/*
+ * Includes
+ */
+
+#include "md_app.h"
+#include "md_dispatch.h"
+#include "md_msgids.h"
+#include "md_eventids.h"
+#include "md_tblstruct.h"
+#include "md_test_utils.h"
+#include <time.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/*
+ * Definitions
+ */
+
+/* Wakeups the soak test runs, which can be lowered for a quicker check */
+#ifndef MD_SOAK_WAKEUPS
+#define MD_SOAK_WAKEUPS 100000
+#endif
+
+/* Wakeups between housekeeping requests */
+#define MD_SOAK_TEST_HK_PERIOD 64
+
+/* One in this many wakeups is preceded by a command */
+#define MD_SOAK_TEST_CMD_ODDS 256
+
+/* One in this many wakeups is preceded by a gap of wakeups that never arrive */
+#define MD_SOAK_TEST_GAP_ODDS 1024
+
+/* Longest gap injected, about half of them too long to make up for */
+#define MD_SOAK_TEST_MAX_GAP (2 * MD_INTERNAL_MAX_CATCHUP_WAKEUPS)
+
+/* Wakeup sequence counts wrap like the 14 bit CCSDS sequence count */
+#define MD_SOAK_TEST_SEQ_COUNT_MASK 0x3FFF
+
+/* Simulated time between wakeups, in microseconds */
+#define MD_SOAK_TEST_WAKEUP_USEC 10000
+
+/* Size of the memory the dwell tables read, in 32 bit words */
+#define MD_SOAK_TEST_IMAGE_WORDS 1024
+
+/* What the test expects of each table */
+typedef struct
+{
+    bool   Checking;      /* Table is enabled and its packets are being checked */
+    uint32 Rate;          /* Wakeups per dwell cycle */
+    uint32 NextPktWakeup; /* Wakeup the next dwell packet is due on */
+    uint32 PktCount;      /* Dwell packets received */
+} MD_SOAK_TEST_Table_t;
+
+/* Everything the test tracks */
+typedef struct
+{
+    CFE_SB_MsgId_t    MsgId;   /* Message ID of the message being processed */
+    CFE_MSG_FcnCode_t FcnCode; /* Function code of the message being processed */
+    CFE_MSG_Size_t    Size;    /* Size of the message being processed */
+
+    uint32                  Wakeups;  /* Wakeups sent or skipped, the simulated time */
+    uint32                  Schedule; /* Wakeups the dwell schedule should have advanced through */
+    CFE_MSG_SequenceCount_t SeqCount; /* Sequence count of the last wakeup */
+
+    uint32 Random;     /* Random number generator state */
+    uint32 Digest;     /* FNV-1a digest of the dwell packets sent */
+    uint32 HkRequests; /* Housekeeping requests sent */
+    uint32 HkPkts;     /* Housekeeping packets received */
+    uint32 Commands;   /* Commands sent */
+    uint32 ErrEvents;  /* Error events received */
+
+    uint32 Gaps;           /* Gaps injected between wakeups */
+    uint32 CatchupWakeups; /* Wakeups skipped by gaps short enough to make up for */
+    uint32 Rephases;       /* Gaps too long to make up for */
+    uint32 ScheduleErrors; /* Wakeups after which the schedule was not where expected */
+    uint32 RephaseEvents;  /* Rephase events received */
+
+    uint32 EarlyPkts;   /* Dwell packets received before they were due, or from stopped tables */
+    uint32 LatePkts;    /* Dwell packets received after they were due */
+    uint32 MissingPkts; /* Dwell packets that never came */
+
+    MD_SOAK_TEST_Table_t Table[MD_INTERFACE_NUM_DWELL_TABLES];
+    MD_DwellTableLoad_t  TblLoad[MD_INTERFACE_NUM_DWELL_TABLES];
+    uint32               Image[MD_SOAK_TEST_IMAGE_WORDS];
+} MD_SOAK_TEST_State_t;
+
+MD_SOAK_TEST_State_t MD_SOAK_TEST_State;
+
+/*
+ * Function Definitions
+ */
+
+/* Deterministic xorshift generator, so every run is the same */
+uint32 MD_SOAK_TEST_Random(uint32 Range)
+{
+    MD_SOAK_TEST_State.Random ^= MD_SOAK_TEST_State.Random << 13;
+    MD_SOAK_TEST_State.Random ^= MD_SOAK_TEST_State.Random >> 17;
+    MD_SOAK_TEST_State.Random ^= MD_SOAK_TEST_State.Random << 5;
+
+    return MD_SOAK_TEST_State.Random % Range;
+}
+
+void MD_SOAK_TEST_AddToDigest(const void *DataPtr, size_t Size)
+{
+    const uint8 *BytePtr = DataPtr;
+
+    while (Size-- > 0)
+    {
+        MD_SOAK_TEST_State.Digest = (MD_SOAK_TEST_State.Digest ^ *BytePtr++) * 16777619;
+    }
+}
+
+/*
+ * Stub handlers
+ */
+
+void MD_SOAK_TEST_CFE_MSG_GetMsgIdHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    *UT_Hook_GetArgValueByName(Context, "MsgId", CFE_SB_MsgId_t *) = MD_SOAK_TEST_State.MsgId;
+}
+
+void MD_SOAK_TEST_CFE_MSG_GetFcnCodeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    *UT_Hook_GetArgValueByName(Context, "FcnCode", CFE_MSG_FcnCode_t *) = MD_SOAK_TEST_State.FcnCode;
+}
+
+void MD_SOAK_TEST_CFE_MSG_GetSequenceCountHandler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                  const UT_StubContext_t *Context)
+{
+    *UT_Hook_GetArgValueByName(Context, "SeqCnt", CFE_MSG_SequenceCount_t *) = MD_SOAK_TEST_State.SeqCount;
+}
+
+void MD_SOAK_TEST_CFE_MSG_GetNextSequenceCountHandler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                      const UT_StubContext_t *Context)
+{
+    CFE_MSG_SequenceCount_t SeqCnt = UT_Hook_GetArgValueByName(Context, "SeqCnt", CFE_MSG_SequenceCount_t);
+
+    SeqCnt = (SeqCnt + 1) & MD_SOAK_TEST_SEQ_COUNT_MASK;
+    UT_Stub_SetReturnValue(FuncKey, SeqCnt);
+}
+
+void MD_SOAK_TEST_CFE_MSG_GetSizeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    *UT_Hook_GetArgValueByName(Context, "Size", CFE_MSG_Size_t *) = MD_SOAK_TEST_State.Size;
+}
+
+/* Simulated time only moves on between wakeups */
+void MD_SOAK_TEST_CFE_PSP_GetTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    *UT_Hook_GetArgValueByName(Context, "LocalTime", OS_time_t *) =
+        OS_TimeFromTotalMicroseconds((int64)MD_SOAK_TEST_State.Wakeups * MD_SOAK_TEST_WAKEUP_USEC);
+}
+
+void MD_SOAK_TEST_CFE_PSP_MemRead8Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    cpuaddr MemoryAddress = UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+
+    *UT_Hook_GetArgValueByName(Context, "ByteValue", uint8 *) = *(uint8 *)MemoryAddress;
+}
+
+void MD_SOAK_TEST_CFE_PSP_MemRead16Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    cpuaddr MemoryAddress = UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+
+    *UT_Hook_GetArgValueByName(Context, "uint16Value", uint16 *) = *(uint16 *)MemoryAddress;
+}
+
+void MD_SOAK_TEST_CFE_PSP_MemRead32Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    cpuaddr MemoryAddress = UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+
+    *UT_Hook_GetArgValueByName(Context, "uint32Value", uint32 *) = *(uint32 *)MemoryAddress;
+}
+
+void MD_SOAK_TEST_CFE_PSP_MemCpyHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    memcpy(UT_Hook_GetArgValueByName(Context, "dest", void *), UT_Hook_GetArgValueByName(Context, "src", const void *),
+           UT_Hook_GetArgValueByName(Context, "n", uint32));
+}
+
+/* Each table has its own Table Services buffer */
+void MD_SOAK_TEST_CFE_TBL_GetAddressHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TBL_Handle_t TblHandle = UT_Hook_GetArgValueByName(Context, "TblHandle", CFE_TBL_Handle_t);
+
+    *UT_Hook_GetArgValueByName(Context, "TblPtr", void **) = &MD_SOAK_TEST_State.TblLoad[TblHandle];
+}
+
+/* No software bus buffers, so dwell packets are always sent from their templates */
+void MD_SOAK_TEST_CFE_SB_AllocateMessageBufferHandler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                      const UT_StubContext_t *Context)
+{
+}
+
+void MD_SOAK_TEST_CFE_SB_TransmitMsgHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const CFE_MSG_Message_t *MsgPtr = UT_Hook_GetArgValueByName(Context, "MsgPtr", const CFE_MSG_Message_t *);
+    const MD_DwellPkt_t *    PktPtr = (const MD_DwellPkt_t *)MsgPtr;
+    uint32                   SentWakeup = MD_AppData.DwellSchedule.WakeupCount;
+    MD_SOAK_TEST_Table_t *   TablePtr;
+    uint16                   TblIndex;
+
+    if (MsgPtr == CFE_MSG_PTR(MD_AppData.HkPkt.TelemetryHeader))
+    {
+        MD_SOAK_TEST_State.HkPkts++;
+    }
+    else if ((PktPtr >= &MD_AppData.MD_DwellPkt[0]) &&
+             (PktPtr < &MD_AppData.MD_DwellPkt[MD_INTERFACE_NUM_DWELL_TABLES]))
+    {
+        TblIndex = (uint16)(PktPtr - &MD_AppData.MD_DwellPkt[0]);
+        TablePtr = &MD_SOAK_TEST_State.Table[TblIndex];
+
+        TablePtr->PktCount++;
+
+        /* Packets made up for after a gap are timed by the schedule wakeup they were due on */
+        if (!TablePtr->Checking || (SentWakeup < TablePtr->NextPktWakeup))
+        {
+            MD_SOAK_TEST_State.EarlyPkts++;
+        }
+        else if (SentWakeup > TablePtr->NextPktWakeup)
+        {
+            MD_SOAK_TEST_State.LatePkts++;
+        }
+
+        TablePtr->NextPktWakeup = SentWakeup + TablePtr->Rate;
+
+        MD_SOAK_TEST_AddToDigest(&SentWakeup, sizeof(SentWakeup));
+        MD_SOAK_TEST_AddToDigest(&PktPtr->Payload, offsetof(MD_DwellPkt_Payload_t, Data) + PktPtr->Payload.ByteCount);
+    }
+}
+
+void MD_SOAK_TEST_CFE_EVS_SendEventHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context,
+                                           va_list va)
+{
+    /* Rephases are injected on purpose, so they are counted apart from other errors */
+    if (UT_Hook_GetArgValueByName(Context, "EventID", uint16) == MD_WAKEUP_REPHASE_ERR_EID)
+    {
+        MD_SOAK_TEST_State.RephaseEvents++;
+    }
+    else if (UT_Hook_GetArgValueByName(Context, "EventType", uint16) == CFE_EVS_EventType_ERROR)
+    {
+        MD_SOAK_TEST_State.ErrEvents++;
+    }
+}
+
+/*
+ * Message senders
+ */
+
+void MD_SOAK_TEST_SendMsg(CFE_SB_MsgId_t MsgId, CFE_MSG_FcnCode_t FcnCode, CFE_MSG_Size_t Size)
+{
+    MD_SOAK_TEST_State.MsgId   = MsgId;
+    MD_SOAK_TEST_State.FcnCode = FcnCode;
+    MD_SOAK_TEST_State.Size    = Size;
+
+    MD_ProcessCommandPacket(&UT_CmdBuf.Buf);
+
+    memset(&UT_CmdBuf, 0, sizeof(UT_CmdBuf));
+}
+
+void MD_SOAK_TEST_SendCmd(CFE_MSG_FcnCode_t FcnCode, CFE_MSG_Size_t Size)
+{
+    MD_SOAK_TEST_State.Commands++;
+
+    MD_SOAK_TEST_SendMsg(CFE_SB_ValueToMsgId(MD_CMD_MID), FcnCode, Size);
+}
+
+void MD_SOAK_TEST_StartStopTable(uint16 TblIndex, CFE_MSG_FcnCode_t FcnCode)
+{
+    UT_CmdBuf.CmdStartStop.Payload.MaskOffset = TblIndex;
+    UT_CmdBuf.CmdStartStop.Payload.TableMask  = 0x0001;
+
+    MD_SOAK_TEST_SendCmd(FcnCode, sizeof(MD_StartDwellCmd_t));
+}
+
+void MD_SOAK_TEST_StopTable(uint16 TblIndex)
+{
+    MD_SOAK_TEST_StartStopTable(TblIndex, MD_STOP_DWELL_CC);
+
+    MD_SOAK_TEST_State.Table[TblIndex].Checking = false;
+}
+
+void MD_SOAK_TEST_StartTable(uint16 TblIndex)
+{
+    MD_SOAK_TEST_Table_t *        TablePtr   = &MD_SOAK_TEST_State.Table[TblIndex];
+    const MD_DwellPacketControl_t *ControlPtr = &MD_AppData.MD_DwellTables[TblIndex];
+
+    MD_SOAK_TEST_StartStopTable(TblIndex, MD_START_DWELL_CC);
+
+    /* The first cycle starts on the next wakeup and ends when its last entry is read */
+    TablePtr->Checking      = true;
+    TablePtr->Rate          = ControlPtr->Rate;
+    TablePtr->NextPktWakeup = MD_SOAK_TEST_State.Schedule + 1 + ControlPtr->Rate -
+                              ControlPtr->Entry[ControlPtr->AddrCount - 1].Delay;
+}
+
+void MD_SOAK_TEST_JamEntry(uint16 TblIndex, uint16 EntryIndex, uint16 FieldLength, uint16 DwellDelay)
+{
+    uint32 Offset = MD_SOAK_TEST_Random(sizeof(MD_SOAK_TEST_State.Image) - sizeof(uint32)) & ~(uint32)(FieldLength - 1);
+
+    UT_CmdBuf.CmdJam.Payload.TableId             = TblIndex + 1;
+    UT_CmdBuf.CmdJam.Payload.EntryId             = EntryIndex + 1;
+    UT_CmdBuf.CmdJam.Payload.FieldLength         = FieldLength;
+    UT_CmdBuf.CmdJam.Payload.DwellDelay          = DwellDelay;
+    UT_CmdBuf.CmdJam.Payload.DwellAddress.Offset = (cpuaddr)MD_SOAK_TEST_State.Image + Offset;
+
+    if (FieldLength == 0)
+    {
+        UT_CmdBuf.CmdJam.Payload.DwellAddress.Offset = 0;
+    }
+
+    MD_SOAK_TEST_SendCmd(MD_JAM_DWELL_CC, sizeof(MD_JamDwellCmd_t));
+}
+
+/* Stops a table, jams a random set of entries into it and starts it again */
+void MD_SOAK_TEST_ReconfigureTable(uint16 TblIndex)
+{
+    static const uint16 FieldLengths[] = {1, 2, 4};
+    uint16              Capacity       = MD_AppData.MD_DwellTables[TblIndex].Capacity;
+    uint16              MaxEntries     = MD_INTERFACE_DWELL_PKT_DATA_SIZE / sizeof(uint32);
+    uint16              NumEntries;
+    uint16              EntryIndex;
+    uint16              DwellDelay;
+
+    if (MaxEntries > Capacity)
+    {
+        MaxEntries = Capacity;
+    }
+
+    NumEntries = 1 + MD_SOAK_TEST_Random(MaxEntries);
+
+    MD_SOAK_TEST_StopTable(TblIndex);
+
+    for (EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+    {
+        /* Every cycle takes at least one wakeup */
+        DwellDelay = MD_SOAK_TEST_Random(4);
+        if ((EntryIndex == (NumEntries - 1)) && (DwellDelay == 0))
+        {
+            DwellDelay = 1;
+        }
+
+        MD_SOAK_TEST_JamEntry(TblIndex, EntryIndex, FieldLengths[MD_SOAK_TEST_Random(3)], DwellDelay);
+    }
+
+    if (NumEntries < Capacity)
+    {
+        MD_SOAK_TEST_JamEntry(TblIndex, NumEntries, 0, 0);
+    }
+
+    /* Some tables are left stopped until they are next picked */
+    if (MD_SOAK_TEST_Random(4) != 0)
+    {
+        MD_SOAK_TEST_StartTable(TblIndex);
+    }
+}
+
+/* Flags tables whose next packet is overdue, then stops checking them until they restart */
+void MD_SOAK_TEST_CheckOverdue(void)
+{
+    uint16 TblIndex;
+
+    for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+    {
+        if (MD_SOAK_TEST_State.Table[TblIndex].Checking &&
+            (MD_SOAK_TEST_State.Schedule > MD_SOAK_TEST_State.Table[TblIndex].NextPktWakeup))
+        {
+            MD_SOAK_TEST_State.MissingPkts++;
+            MD_SOAK_TEST_State.Table[TblIndex].Checking = false;
+        }
+    }
+}
+
+/* Skips a random number of wakeups, as if the wakeup pipe had overflowed */
+void MD_SOAK_TEST_InjectGap(void)
+{
+    uint32 Gap = 1 + MD_SOAK_TEST_Random(MD_SOAK_TEST_MAX_GAP);
+
+    MD_SOAK_TEST_State.Gaps++;
+    MD_SOAK_TEST_State.Wakeups += Gap;
+    MD_SOAK_TEST_State.SeqCount = (MD_SOAK_TEST_State.SeqCount + Gap) & MD_SOAK_TEST_SEQ_COUNT_MASK;
+
+    /* Short gaps are made up for, longer ones shift every schedule later */
+    if (Gap <= MD_INTERNAL_MAX_CATCHUP_WAKEUPS)
+    {
+        MD_SOAK_TEST_State.CatchupWakeups += Gap;
+        MD_SOAK_TEST_State.Schedule += Gap;
+    }
+    else
+    {
+        MD_SOAK_TEST_State.Rephases++;
+    }
+}
+
+void MD_SOAK_TEST_SendWakeup(void)
+{
+    MD_SOAK_TEST_State.Wakeups++;
+    MD_SOAK_TEST_State.Schedule++;
+    MD_SOAK_TEST_State.SeqCount = (MD_SOAK_TEST_State.SeqCount + 1) & MD_SOAK_TEST_SEQ_COUNT_MASK;
+
+    MD_SOAK_TEST_SendMsg(CFE_SB_ValueToMsgId(MD_WAKEUP_MID), 0, sizeof(MD_Wakeup_t));
+
+    if (MD_AppData.DwellSchedule.WakeupCount != MD_SOAK_TEST_State.Schedule)
+    {
+        MD_SOAK_TEST_State.ScheduleErrors++;
+        MD_SOAK_TEST_State.Schedule = MD_AppData.DwellSchedule.WakeupCount;
+    }
+}
+
+/*
+ * Tests
+ */
+
+void MD_Soak_Test_Cadence(void)
+{
+    uint16       TblIndex;
+    uint32       PktCount = 0;
+    clock_t      StartClock;
+    double       Seconds;
+
+    memset(&MD_SOAK_TEST_State, 0, sizeof(MD_SOAK_TEST_State));
+    MD_SOAK_TEST_State.Random = 0x2545F491;
+    MD_SOAK_TEST_State.Digest = 2166136261;
+
+    /* Start close to the top so the sequence count wraps early */
+    MD_SOAK_TEST_State.SeqCount = MD_SOAK_TEST_SEQ_COUNT_MASK - 100;
+
+    for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+    {
+        MD_AppData.MD_TableHandle[TblIndex] = TblIndex;
+    }
+
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetMsgId), MD_SOAK_TEST_CFE_MSG_GetMsgIdHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetFcnCode), MD_SOAK_TEST_CFE_MSG_GetFcnCodeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), MD_SOAK_TEST_CFE_MSG_GetSizeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSequenceCount), MD_SOAK_TEST_CFE_MSG_GetSequenceCountHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetNextSequenceCount), MD_SOAK_TEST_CFE_MSG_GetNextSequenceCountHandler,
+                          NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_GetTime), MD_SOAK_TEST_CFE_PSP_GetTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemRead8), MD_SOAK_TEST_CFE_PSP_MemRead8Handler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemRead16), MD_SOAK_TEST_CFE_PSP_MemRead16Handler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemRead32), MD_SOAK_TEST_CFE_PSP_MemRead32Handler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemCpy), MD_SOAK_TEST_CFE_PSP_MemCpyHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_GetAddress), MD_SOAK_TEST_CFE_TBL_GetAddressHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_AllocateMessageBuffer), MD_SOAK_TEST_CFE_SB_AllocateMessageBufferHandler,
+                          NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_TransmitMsg), MD_SOAK_TEST_CFE_SB_TransmitMsgHandler, NULL);
+    UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), MD_SOAK_TEST_CFE_EVS_SendEventHandler, NULL);
+
+    for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+    {
+        MD_SOAK_TEST_ReconfigureTable(TblIndex);
+    }
+
+    StartClock = clock();
+
+    while (MD_SOAK_TEST_State.Wakeups < MD_SOAK_WAKEUPS)
+    {
+        if (MD_SOAK_TEST_Random(MD_SOAK_TEST_CMD_ODDS) == 0)
+        {
+            TblIndex = MD_SOAK_TEST_Random(MD_INTERFACE_NUM_DWELL_TABLES);
+
+            switch (MD_SOAK_TEST_Random(4))
+            {
+                case 0:
+                    MD_SOAK_TEST_StopTable(TblIndex);
+                    break;
+
+                case 1:
+                    MD_SOAK_TEST_SendCmd(MD_NOOP_CC, sizeof(MD_NoopCmd_t));
+                    break;
+
+                default:
+                    MD_SOAK_TEST_ReconfigureTable(TblIndex);
+                    break;
+            }
+        }
+
+        if ((MD_SOAK_TEST_State.Wakeups % MD_SOAK_TEST_HK_PERIOD) == 0)
+        {
+            MD_SOAK_TEST_State.HkRequests++;
+            MD_SOAK_TEST_SendMsg(CFE_SB_ValueToMsgId(MD_SEND_HK_MID), 0, sizeof(MD_SendHkCmd_t));
+
+            MD_SOAK_TEST_CheckOverdue();
+        }
+
+        /* Keep the dwelled memory changing */
+        MD_SOAK_TEST_State.Image[MD_SOAK_TEST_Random(MD_SOAK_TEST_IMAGE_WORDS)] = MD_SOAK_TEST_State.Random;
+
+        /* The first wakeup has nothing to compare its sequence count with */
+        if ((MD_SOAK_TEST_State.Wakeups > 0) && (MD_SOAK_TEST_Random(MD_SOAK_TEST_GAP_ODDS) == 0))
+        {
+            MD_SOAK_TEST_InjectGap();
+        }
+
+        MD_SOAK_TEST_SendWakeup();
+    }
+
+    Seconds = (double)(clock() - StartClock) / CLOCKS_PER_SEC;
+
+    MD_SOAK_TEST_CheckOverdue();
+
+    for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+    {
+        PktCount += MD_SOAK_TEST_State.Table[TblIndex].PktCount;
+    }
+
+    UtPrintf("Soak: %lu wakeups, %lu gaps, %lu commands, %lu dwell packets in %.2f s (%.0f wakeups/s), "
+             "digest 0x%08lX",
+             (unsigned long)MD_SOAK_TEST_State.Wakeups, (unsigned long)MD_SOAK_TEST_State.Gaps,
+             (unsigned long)MD_SOAK_TEST_State.Commands, (unsigned long)PktCount, Seconds,
+             (Seconds > 0) ? (MD_SOAK_TEST_State.Wakeups / Seconds) : 0.0, (unsigned long)MD_SOAK_TEST_State.Digest);
+
+    /* Verify every packet came on time, and only when it should */
+    UtAssert_True(PktCount > 0, "Dwell packets were sent");
+    UtAssert_UINT32_EQ(MD_SOAK_TEST_State.EarlyPkts, 0);
+    UtAssert_UINT32_EQ(MD_SOAK_TEST_State.LatePkts, 0);
+    UtAssert_UINT32_EQ(MD_SOAK_TEST_State.MissingPkts, 0);
+
+    /* Verify every gap was made up for or rephased as it should have been */
+    UtAssert_True(MD_SOAK_TEST_State.Gaps > 0, "Gaps were injected");
+    UtAssert_UINT32_EQ(MD_SOAK_TEST_State.ScheduleErrors, 0);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.OverrunCount, MD_SOAK_TEST_State.Gaps);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.CatchupCount, MD_SOAK_TEST_State.CatchupWakeups);
+    UtAssert_UINT32_EQ(MD_AppData.WakeupCounters.RephaseCount, MD_SOAK_TEST_State.Rephases);
+    UtAssert_True((MD_SOAK_TEST_State.RephaseEvents > 0) && (MD_SOAK_TEST_State.RephaseEvents < 32),
+                  "Rephases were reported further and further apart");
+
+    /* Verify every request was carried out */
+    UtAssert_UINT32_EQ(MD_SOAK_TEST_State.HkPkts, MD_SOAK_TEST_State.HkRequests);
+    UtAssert_UINT32_EQ(MD_SOAK_TEST_State.ErrEvents, 0);
+    UtAssert_UINT32_EQ(MD_AppData.ErrCounter, 0);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(MD_Soak_Test_Cadence, MD_Test_Setup, MD_Test_TearDown, "MD_Soak_Test_Cadence");
+}
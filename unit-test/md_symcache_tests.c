@@ -0,0 +1,362 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "md_symcache.h"
+#include "md_app.h"
+#include "md_eventids.h"
+#include "md_test_utils.h"
+#include <string.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/*
+ * Function Definitions
+ */
+
+/* Reports one loaded module to the callback */
+int32 MD_SYMCACHE_TEST_OS_ForEachObjectOfTypeHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                                  const UT_StubContext_t *Context)
+{
+    OS_ArgCallback_t CallbackPtr = UT_Hook_GetArgValueByName(Context, "callback_ptr", OS_ArgCallback_t);
+    void *           CallbackArg = UT_Hook_GetArgValueByName(Context, "callback_arg", void *);
+
+    CallbackPtr(OS_OBJECT_ID_UNDEFINED, CallbackArg);
+
+    return StubRetcode;
+}
+
+/* Puts a symbol in a cache slot */
+void MD_SYMCACHE_TEST_FillSlot(uint32 Slot, const char *SymName, cpuaddr Address)
+{
+    MD_SymCacheEntry_t *EntryPtr = &MD_AppData.SymCache.Entry[Slot & (MD_INTERNAL_SYM_CACHE_SIZE - 1)];
+
+    EntryPtr->Hash    = MD_SymCacheHash(SymName);
+    EntryPtr->Address = Address;
+    strncpy(EntryPtr->SymName, SymName, sizeof(EntryPtr->SymName));
+}
+
+/* Empties the cache while the symbol table is being scanned */
+int32 MD_SYMCACHE_TEST_OS_SymbolLookupInvalidateHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                                     const UT_StubContext_t *Context)
+{
+    MD_InvalidateSymCache();
+
+    return StubRetcode;
+}
+
+/* Fills the slot a symbol would take while the symbol table is being scanned */
+int32 MD_SYMCACHE_TEST_OS_SymbolLookupFillHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                               const UT_StubContext_t *Context)
+{
+    MD_SYMCACHE_TEST_FillSlot(MD_SymCacheHash("symname"), "other", 0x1000);
+
+    return StubRetcode;
+}
+
+void MD_InitSymCache_Test_Nominal(void)
+{
+    MD_SYMCACHE_TEST_FillSlot(0, "stale", 0x1000);
+
+    UT_SetHookFunction(UT_KEY(OS_ForEachObjectOfType), MD_SYMCACHE_TEST_OS_ForEachObjectOfTypeHook, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_InitSymCache(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.Entry[0].SymName[0], '\0');
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.ModuleCount, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MD_InitSymCache_Test_MutexError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MD_InitSymCache(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_ForEachObjectOfType, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MD_CREATE_SYM_MUTEX_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void MD_SymCacheHash_Test(void)
+{
+    char   LongName[CFE_MISSION_MAX_PATH_LEN + 1];
+    uint32 Hash;
+
+    /* FNV-1a reference values */
+    UtAssert_UINT32_EQ(MD_SymCacheHash(""), 2166136261U);
+    UtAssert_UINT32_EQ(MD_SymCacheHash("a"), 0xE40C292CU);
+
+    /* Nothing past CFE_MISSION_MAX_PATH_LEN characters is hashed */
+    memset(LongName, 'x', sizeof(LongName));
+    LongName[CFE_MISSION_MAX_PATH_LEN] = '\0';
+    Hash                               = MD_SymCacheHash(LongName);
+
+    LongName[CFE_MISSION_MAX_PATH_LEN] = 'y';
+    UtAssert_UINT32_EQ(MD_SymCacheHash(LongName), Hash);
+}
+
+void MD_SymCacheLookup_Test_MissThenHit(void)
+{
+    cpuaddr LookupAddr = 0x2000;
+    cpuaddr SymAddr    = 0;
+
+    UT_SetDataBuffer(UT_KEY(OS_SymbolLookup), &LookupAddr, sizeof(LookupAddr), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MD_SymCacheLookup("symname", &SymAddr));
+    UtAssert_UINT32_EQ(SymAddr, 0x2000);
+
+    SymAddr = 0;
+    UtAssert_BOOL_TRUE(MD_SymCacheLookup("symname", &SymAddr));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SymAddr, 0x2000);
+    UtAssert_STUB_COUNT(OS_SymbolLookup, 1);
+
+    /* The miss takes the mutex once to probe and again to insert, the hit once */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 3);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 3);
+}
+
+void MD_SymCacheLookup_Test_NotFound(void)
+{
+    cpuaddr SymAddr = 0;
+    uint32  Hash    = MD_SymCacheHash("missing");
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_SymbolLookup), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MD_SymCacheLookup("missing", &SymAddr));
+    UtAssert_BOOL_FALSE(MD_SymCacheLookup("missing", &SymAddr));
+
+    /* Verify results, symbols that weren't found are looked up again */
+    UtAssert_STUB_COUNT(OS_SymbolLookup, 2);
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.Entry[Hash & (MD_INTERNAL_SYM_CACHE_SIZE - 1)].SymName[0], '\0');
+}
+
+void MD_SymCacheLookup_Test_ProbeHit(void)
+{
+    cpuaddr SymAddr = 0;
+    uint32  Hash    = MD_SymCacheHash("symname");
+
+    MD_SYMCACHE_TEST_FillSlot(Hash, "other", 0x1000);
+    MD_SYMCACHE_TEST_FillSlot(Hash + 1, "symname", 0x3000);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MD_SymCacheLookup("symname", &SymAddr));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SymAddr, 0x3000);
+    UtAssert_STUB_COUNT(OS_SymbolLookup, 0);
+}
+
+void MD_SymCacheLookup_Test_Evict(void)
+{
+    cpuaddr LookupAddr = 0x4000;
+    cpuaddr SymAddr    = 0;
+    uint32  Hash       = MD_SymCacheHash("symname");
+    uint32  Probe;
+
+    for (Probe = 0; Probe < MD_SYM_CACHE_MAX_PROBES; Probe++)
+    {
+        MD_SYMCACHE_TEST_FillSlot(Hash + Probe, "other", 0x1000);
+    }
+
+    UT_SetDataBuffer(UT_KEY(OS_SymbolLookup), &LookupAddr, sizeof(LookupAddr), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MD_SymCacheLookup("symname", &SymAddr));
+
+    /* Verify results, the symbol replaces the one in its hash's slot */
+    UtAssert_UINT32_EQ(SymAddr, 0x4000);
+    UtAssert_STRINGBUF_EQ(MD_AppData.SymCache.Entry[Hash & (MD_INTERNAL_SYM_CACHE_SIZE - 1)].SymName,
+                          CFE_MISSION_MAX_PATH_LEN, "symname", -1);
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.Entry[Hash & (MD_INTERNAL_SYM_CACHE_SIZE - 1)].Address, 0x4000);
+    UtAssert_STRINGBUF_EQ(MD_AppData.SymCache.Entry[(Hash + 1) & (MD_INTERNAL_SYM_CACHE_SIZE - 1)].SymName,
+                          CFE_MISSION_MAX_PATH_LEN, "other", -1);
+}
+
+void MD_SymCacheLookup_Test_Invalidated(void)
+{
+    cpuaddr LookupAddr = 0x6000;
+    cpuaddr SymAddr    = 0;
+    uint32  Hash       = MD_SymCacheHash("symname");
+
+    UT_SetDataBuffer(UT_KEY(OS_SymbolLookup), &LookupAddr, sizeof(LookupAddr), false);
+    UT_SetHookFunction(UT_KEY(OS_SymbolLookup), MD_SYMCACHE_TEST_OS_SymbolLookupInvalidateHook, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MD_SymCacheLookup("symname", &SymAddr));
+
+    /* Verify results, the address may predate the cache being emptied, so it isn't cached */
+    UtAssert_UINT32_EQ(SymAddr, 0x6000);
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.Entry[Hash & (MD_INTERNAL_SYM_CACHE_SIZE - 1)].SymName[0], '\0');
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+}
+
+void MD_SymCacheLookup_Test_SlotTaken(void)
+{
+    cpuaddr LookupAddr = 0x7000;
+    cpuaddr SymAddr    = 0;
+    uint32  Hash       = MD_SymCacheHash("symname");
+
+    UT_SetDataBuffer(UT_KEY(OS_SymbolLookup), &LookupAddr, sizeof(LookupAddr), false);
+    UT_SetHookFunction(UT_KEY(OS_SymbolLookup), MD_SYMCACHE_TEST_OS_SymbolLookupFillHook, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MD_SymCacheLookup("symname", &SymAddr));
+
+    /* Verify results, the symbol the other task cached is kept */
+    UtAssert_UINT32_EQ(SymAddr, 0x7000);
+    UtAssert_STRINGBUF_EQ(MD_AppData.SymCache.Entry[Hash & (MD_INTERNAL_SYM_CACHE_SIZE - 1)].SymName,
+                          CFE_MISSION_MAX_PATH_LEN, "other", -1);
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.Entry[Hash & (MD_INTERNAL_SYM_CACHE_SIZE - 1)].Address, 0x1000);
+}
+
+void MD_SymCacheLookup_Test_MutexError(void)
+{
+    cpuaddr LookupAddr = 0x5000;
+    cpuaddr SymAddr    = 0;
+    uint32  Hash       = MD_SymCacheHash("symname");
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_MutSemTake), OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(OS_SymbolLookup), &LookupAddr, sizeof(LookupAddr), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MD_SymCacheLookup("symname", &SymAddr));
+
+    /* Verify results, the symbol is resolved but not cached */
+    UtAssert_UINT32_EQ(SymAddr, 0x5000);
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.Entry[Hash & (MD_INTERNAL_SYM_CACHE_SIZE - 1)].SymName[0], '\0');
+    UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+}
+
+void MD_RefreshSymCache_Test_NoChange(void)
+{
+    MD_SYMCACHE_TEST_FillSlot(0, "symname", 0x1000);
+
+    /* Execute the function being tested */
+    MD_RefreshSymCache();
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(MD_AppData.SymCache.Entry[0].SymName, CFE_MISSION_MAX_PATH_LEN, "symname", -1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void MD_RefreshSymCache_Test_ModuleLoaded(void)
+{
+    MD_SYMCACHE_TEST_FillSlot(0, "symname", 0x1000);
+
+    UT_SetHookFunction(UT_KEY(OS_ForEachObjectOfType), MD_SYMCACHE_TEST_OS_ForEachObjectOfTypeHook, NULL);
+
+    /* Execute the function being tested */
+    MD_RefreshSymCache();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.Entry[0].SymName[0], '\0');
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.ModuleCount, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void MD_RefreshSymCache_Test_MutexError(void)
+{
+    MD_SYMCACHE_TEST_FillSlot(0, "symname", 0x1000);
+
+    UT_SetHookFunction(UT_KEY(OS_ForEachObjectOfType), MD_SYMCACHE_TEST_OS_ForEachObjectOfTypeHook, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(OS_MutSemTake), OS_ERROR);
+
+    /* Execute the function being tested */
+    MD_RefreshSymCache();
+
+    /* Verify results, the change is noticed on the next refresh */
+    UtAssert_STRINGBUF_EQ(MD_AppData.SymCache.Entry[0].SymName, CFE_MISSION_MAX_PATH_LEN, "symname", -1);
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.ModuleCount, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+}
+
+void MD_SymCacheModuleCallback_Test(void)
+{
+    MD_SymCacheModules_t Modules = {2, 5};
+
+    /* Execute the function being tested */
+    MD_SymCacheModuleCallback(OS_OBJECT_ID_UNDEFINED, &Modules);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Modules.Count, 3);
+    UtAssert_UINT32_EQ(Modules.IdSum, 5 + (uint32)OS_ObjectIdToInteger(OS_OBJECT_ID_UNDEFINED));
+}
+
+void MD_InvalidateSymCache_Test(void)
+{
+    MD_SYMCACHE_TEST_FillSlot(0, "first", 0x1000);
+    MD_SYMCACHE_TEST_FillSlot(MD_INTERNAL_SYM_CACHE_SIZE - 1, "last", 0x2000);
+    MD_AppData.SymCache.Generation = 5;
+
+    /* Execute the function being tested */
+    MD_InvalidateSymCache();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.Entry[0].SymName[0], '\0');
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.Entry[MD_INTERNAL_SYM_CACHE_SIZE - 1].SymName[0], '\0');
+    UtAssert_UINT32_EQ(MD_AppData.SymCache.Generation, 6);
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(MD_InitSymCache_Test_Nominal, MD_Test_Setup, MD_Test_TearDown, "MD_InitSymCache_Test_Nominal");
+    UtTest_Add(MD_InitSymCache_Test_MutexError, MD_Test_Setup, MD_Test_TearDown, "MD_InitSymCache_Test_MutexError");
+
+    UtTest_Add(MD_SymCacheHash_Test, MD_Test_Setup, MD_Test_TearDown, "MD_SymCacheHash_Test");
+
+    UtTest_Add(MD_SymCacheLookup_Test_MissThenHit, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SymCacheLookup_Test_MissThenHit");
+    UtTest_Add(MD_SymCacheLookup_Test_NotFound, MD_Test_Setup, MD_Test_TearDown, "MD_SymCacheLookup_Test_NotFound");
+    UtTest_Add(MD_SymCacheLookup_Test_ProbeHit, MD_Test_Setup, MD_Test_TearDown, "MD_SymCacheLookup_Test_ProbeHit");
+    UtTest_Add(MD_SymCacheLookup_Test_Evict, MD_Test_Setup, MD_Test_TearDown, "MD_SymCacheLookup_Test_Evict");
+    UtTest_Add(MD_SymCacheLookup_Test_Invalidated, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SymCacheLookup_Test_Invalidated");
+    UtTest_Add(MD_SymCacheLookup_Test_SlotTaken, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SymCacheLookup_Test_SlotTaken");
+    UtTest_Add(MD_SymCacheLookup_Test_MutexError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_SymCacheLookup_Test_MutexError");
+
+    UtTest_Add(MD_RefreshSymCache_Test_NoChange, MD_Test_Setup, MD_Test_TearDown, "MD_RefreshSymCache_Test_NoChange");
+    UtTest_Add(MD_RefreshSymCache_Test_ModuleLoaded, MD_Test_Setup, MD_Test_TearDown,
+               "MD_RefreshSymCache_Test_ModuleLoaded");
+    UtTest_Add(MD_RefreshSymCache_Test_MutexError, MD_Test_Setup, MD_Test_TearDown,
+               "MD_RefreshSymCache_Test_MutexError");
+
+    UtTest_Add(MD_SymCacheModuleCallback_Test, MD_Test_Setup, MD_Test_TearDown, "MD_SymCacheModuleCallback_Test");
+
+    UtTest_Add(MD_InvalidateSymCache_Test, MD_Test_Setup, MD_Test_TearDown, "MD_InvalidateSymCache_Test");
+}
@@ -21,6 +21,11 @@
  */
 
 #include "md_utils.h"
+#include "md_dwell_pkt.h"
+#include "md_capture.h"
+#include "md_dwell_err.h"
+#include "md_symcache.h"
+#include "md_snapshot.h"
 #include "md_msg.h"
 #include "md_msgdefs.h"
 #include "md_eventids.h"
@@ -99,8 +104,10 @@ void MD_UpdateDwellControlInfo_Test(void)
 {
     uint16 TableIndex = 1;
 
-    MD_AppData.MD_DwellTables[TableIndex].Entry[0].Length = 1;
-    MD_AppData.MD_DwellTables[TableIndex].Entry[0].Delay  = 2;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[0].Length    = 1;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[0].Delay     = 2;
+    MD_AppData.MD_DwellTables[TableIndex].HeartbeatCountdown = 4;
+    MD_AppData.MD_DwellTables[TableIndex].KeyframeCountdown  = 4;
 
     /* Execute the function being tested */
     MD_UpdateDwellControlInfo(TableIndex);
@@ -112,6 +119,13 @@ void MD_UpdateDwellControlInfo_Test(void)
                   "MD_AppData.MD_DwellTables[TableIndex].DataSize  == 1");
     UtAssert_True(MD_AppData.MD_DwellTables[TableIndex].Rate == 2,
                   "MD_AppData.MD_DwellTables[TableIndex].Rate      == 2");
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TableIndex].HeartbeatCountdown, 0);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TableIndex].KeyframeCountdown, 0);
+    UtAssert_STUB_COUNT(MD_SendDwellBatchPkt, 1);
+    UtAssert_STUB_COUNT(MD_SendDwellStatsPkt, 1);
+    UtAssert_STUB_COUNT(MD_UpdateDwellPktTemplate, 1);
+    UtAssert_STUB_COUNT(MD_CancelCapture, 1);
+    UtAssert_STUB_COUNT(MD_CompileDwellPlan, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -119,6 +133,36 @@ void MD_UpdateDwellControlInfo_Test(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_SetDwellControlInfo_Test(void)
+{
+    uint16 TableIndex = 1;
+
+    MD_AppData.MD_DwellTables[TableIndex].HeartbeatCountdown = 4;
+    MD_AppData.MD_DwellTables[TableIndex].KeyframeCountdown  = 4;
+
+    /* Execute the function being tested */
+    MD_SetDwellControlInfo(TableIndex, 3, 6, 9);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TableIndex].AddrCount, 3);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TableIndex].DataSize, 6);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TableIndex].Rate, 9);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TableIndex].HeartbeatCountdown, 0);
+    UtAssert_INT32_EQ(MD_AppData.MD_DwellTables[TableIndex].KeyframeCountdown, 0);
+    UtAssert_STUB_COUNT(MD_CancelCapture, 1);
+    UtAssert_STUB_COUNT(MD_SendDwellBatchPkt, 1);
+    UtAssert_STUB_COUNT(MD_SendDwellStatsPkt, 1);
+    UtAssert_STUB_COUNT(MD_UpdateDwellPktTemplate, 1);
+    UtAssert_STUB_COUNT(MD_RefreshDwellSchedule, 1);
+    UtAssert_STUB_COUNT(MD_BuildSnapshotGroups, 1);
+    UtAssert_STUB_COUNT(MD_ResetDwellReadErrors, 1);
+
+    /* The plan was compiled with the entries */
+    UtAssert_STUB_COUNT(MD_CompileDwellPlan, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void MD_UpdateDwellControlInfo_TestAllTableEntries(void)
 {
     uint16 TableIndex = 1;
@@ -153,7 +197,7 @@ void MD_ValidEntryId_Test_Valid(void)
     uint16 EntryId = 1;
 
     /* Execute the function being tested */
-    Result = MD_ValidEntryId(EntryId);
+    Result = MD_ValidEntryId(0, EntryId);
 
     /* Verify results */
     UtAssert_True(Result == true, "Result == true");
@@ -170,7 +214,7 @@ void MD_ValidEntryId_Test_Invalid(void)
     uint16 EntryId = 0;
 
     /* Execute the function being tested */
-    Result = MD_ValidEntryId(EntryId);
+    Result = MD_ValidEntryId(0, EntryId);
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
@@ -187,7 +231,26 @@ void MD_ValidEntryId_Test_RangeError(void)
     uint16 EntryId = MD_INTERFACE_DWELL_TABLE_SIZE + 1;
 
     /* Execute the function being tested */
-    Result = MD_ValidEntryId(EntryId);
+    Result = MD_ValidEntryId(0, EntryId);
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_ValidEntryId_Test_PastCapacity(void)
+{
+    bool   Result;
+    uint16 EntryId = 4;
+
+    MD_AppData.MD_DwellTables[0].Capacity = 3;
+
+    /* Execute the function being tested */
+    Result = MD_ValidEntryId(0, EntryId);
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
@@ -373,6 +436,95 @@ void MD_ValidFieldLength_Test_Invalid(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MD_ValidFieldLength_Test_Block(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MD_ValidFieldLength(MD_MIN_BLOCK_DWELL_LENGTH - 1));
+    UtAssert_BOOL_TRUE(MD_ValidFieldLength(MD_MIN_BLOCK_DWELL_LENGTH));
+    UtAssert_BOOL_TRUE(MD_ValidFieldLength(MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH));
+    UtAssert_BOOL_FALSE(MD_ValidFieldLength(MD_INTERFACE_MAX_BLOCK_DWELL_LENGTH + 1));
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MD_DwellDataSizeWithEntry_Test(void)
+{
+    uint16 TableIndex = 0;
+
+    MD_AppData.MD_DwellTables[TableIndex].Entry[0].Length = 4;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[1].Length = 2;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[2].Length = 0;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[3].Length = 1;
+
+    /* Replacing an active entry */
+    UtAssert_UINT32_EQ(MD_DwellDataSizeWithEntry(TableIndex, 1, MD_MIN_BLOCK_DWELL_LENGTH),
+                       4 + MD_MIN_BLOCK_DWELL_LENGTH);
+
+    /* Filling the null entry extends the active portion to the next null entry */
+    UtAssert_UINT32_EQ(MD_DwellDataSizeWithEntry(TableIndex, 2, MD_MIN_BLOCK_DWELL_LENGTH),
+                       4 + 2 + MD_MIN_BLOCK_DWELL_LENGTH + 1);
+
+    /* Entries after the first null entry don't count */
+    UtAssert_UINT32_EQ(MD_DwellDataSizeWithEntry(TableIndex, 4, MD_MIN_BLOCK_DWELL_LENGTH), 4 + 2);
+
+    /* Nulling an entry ends the active portion there */
+    UtAssert_UINT32_EQ(MD_DwellDataSizeWithEntry(TableIndex, 0, 0), 0);
+}
+
+void MD_DwellDataSizeWithJam_Test(void)
+{
+    uint16             TableIndex = 0;
+    MD_JamMultiEntry_t JamEntry[3];
+
+    memset(JamEntry, 0, sizeof(JamEntry));
+
+    MD_AppData.MD_DwellTables[TableIndex].Entry[0].Length = 4;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[1].Length = 2;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[2].Length = 0;
+    MD_AppData.MD_DwellTables[TableIndex].Entry[3].Length = 1;
+
+    /* Replacing an active entry and filling the null entry */
+    JamEntry[0].EntryId     = 2;
+    JamEntry[0].FieldLength = MD_MIN_BLOCK_DWELL_LENGTH;
+    JamEntry[1].EntryId     = 3;
+    JamEntry[1].FieldLength = 4;
+    UtAssert_UINT32_EQ(MD_DwellDataSizeWithJam(TableIndex, JamEntry, 2), 4 + MD_MIN_BLOCK_DWELL_LENGTH + 4 + 1);
+
+    /* The last entry for the same index applies */
+    JamEntry[2].EntryId     = 3;
+    JamEntry[2].FieldLength = 0;
+    UtAssert_UINT32_EQ(MD_DwellDataSizeWithJam(TableIndex, JamEntry, 3), 4 + MD_MIN_BLOCK_DWELL_LENGTH);
+
+    /* No entries leaves the table as it is */
+    UtAssert_UINT32_EQ(MD_DwellDataSizeWithJam(TableIndex, JamEntry, 0), 4 + 2);
+}
+
+void MD_ValidBatchFactor_Test(void)
+{
+    uint32 CycleSize = MD_INTERFACE_DWELL_PKT_DATA_SIZE + MD_BATCH_CYCLE_HDR_SIZE;
+
+    /* Factors of 0 and 1 don't batch and are always valid */
+    UtAssert_BOOL_TRUE(MD_ValidBatchFactor(0, MD_INTERFACE_DWELL_PKT_DATA_SIZE));
+    UtAssert_BOOL_TRUE(MD_ValidBatchFactor(1, MD_INTERFACE_DWELL_PKT_DATA_SIZE));
+
+    /* Exactly filling the batched dwell packet is valid, one more cycle is not */
+    UtAssert_BOOL_TRUE(MD_ValidBatchFactor(MD_INTERFACE_DWELL_BATCH_DATA_SIZE / CycleSize,
+                                           MD_INTERFACE_DWELL_PKT_DATA_SIZE));
+    UtAssert_BOOL_FALSE(MD_ValidBatchFactor(MD_INTERFACE_DWELL_BATCH_DATA_SIZE / CycleSize + 1,
+                                            MD_INTERFACE_DWELL_PKT_DATA_SIZE));
+
+    /* Smaller tables can batch more cycles */
+    UtAssert_BOOL_TRUE(MD_ValidBatchFactor(MD_INTERFACE_DWELL_BATCH_DATA_SIZE / (4 + MD_BATCH_CYCLE_HDR_SIZE), 4));
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void MD_Verify32Aligned_Test(void)
 {
     bool    Result;
@@ -461,8 +613,7 @@ void MD_ResolveSymAddr_Test(void)
     ResolvedAddr = 0;
     strncpy(SymAddr.SymName, "symname", sizeof(SymAddr.SymName));
 
-    UT_SetDataBuffer(UT_KEY(OS_SymbolLookup), &ResolvedAddr, sizeof(ResolvedAddr), false);
-    UT_SetDefaultReturnValue(UT_KEY(OS_SymbolLookup), OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(MD_SymCacheLookup), true);
 
     /* Execute the function being tested */
     Result = MD_ResolveSymAddr(&SymAddr, &ResolvedAddr);
@@ -471,7 +622,7 @@ void MD_ResolveSymAddr_Test(void)
     UtAssert_True(Result == true, "Result == true");
     UtAssert_True(ResolvedAddr == SymAddr.Offset, "ResolvedAddr == SymAddr.Offset");
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_SymbolLookup), -1);
+    UT_SetDefaultReturnValue(UT_KEY(MD_SymCacheLookup), false);
 
     /* Execute the function being tested */
     Result = MD_ResolveSymAddr(&SymAddr, &ResolvedAddr);
@@ -490,12 +641,15 @@ void UtTest_Setup(void)
                "MD_TableIsInMask_Test_TableNotInMask");
 
     UtTest_Add(MD_UpdateDwellControlInfo_Test, MD_Test_Setup, MD_Test_TearDown, "MD_UpdateDwellControlInfo_Test");
+    UtTest_Add(MD_SetDwellControlInfo_Test, MD_Test_Setup, MD_Test_TearDown, "MD_SetDwellControlInfo_Test");
     UtTest_Add(MD_UpdateDwellControlInfo_TestAllTableEntries, MD_Test_Setup, MD_Test_TearDown,
                "MD_UpdateDwellControlInfo_TestAllTableEntries");
 
     UtTest_Add(MD_ValidEntryId_Test_Valid, MD_Test_Setup, MD_Test_TearDown, "MD_ValidEntryId_Test_Valid");
     UtTest_Add(MD_ValidEntryId_Test_Invalid, MD_Test_Setup, MD_Test_TearDown, "MD_ValidEntryId_Test_Invalid");
     UtTest_Add(MD_ValidEntryId_Test_RangeError, MD_Test_Setup, MD_Test_TearDown, "MD_ValidEntryId_Test_RangeError");
+    UtTest_Add(MD_ValidEntryId_Test_PastCapacity, MD_Test_Setup, MD_Test_TearDown,
+               "MD_ValidEntryId_Test_PastCapacity");
 
     UtTest_Add(MD_ValidAddrRange_Test_Valid, MD_Test_Setup, MD_Test_TearDown, "MD_ValidAddrRange_Test_Valid");
     UtTest_Add(MD_ValidAddrRange_Test_Invalid, MD_Test_Setup, MD_Test_TearDown, "MD_ValidAddrRange_Test_Invalid");
@@ -513,6 +667,11 @@ void UtTest_Setup(void)
     UtTest_Add(MD_ValidFieldLength_Test_ValidFieldLength4, MD_Test_Setup, MD_Test_TearDown,
                "MD_ValidFieldLength_Test_ValidFieldLength4");
     UtTest_Add(MD_ValidFieldLength_Test_Invalid, MD_Test_Setup, MD_Test_TearDown, "MD_ValidFieldLength_Test_Invalid");
+    UtTest_Add(MD_ValidFieldLength_Test_Block, MD_Test_Setup, MD_Test_TearDown, "MD_ValidFieldLength_Test_Block");
+
+    UtTest_Add(MD_DwellDataSizeWithEntry_Test, MD_Test_Setup, MD_Test_TearDown, "MD_DwellDataSizeWithEntry_Test");
+    UtTest_Add(MD_DwellDataSizeWithJam_Test, MD_Test_Setup, MD_Test_TearDown, "MD_DwellDataSizeWithJam_Test");
+    UtTest_Add(MD_ValidBatchFactor_Test, MD_Test_Setup, MD_Test_TearDown, "MD_ValidBatchFactor_Test");
 
     UtTest_Add(MD_Verify32Aligned_Test, MD_Test_Setup, MD_Test_TearDown, "MD_Verify32Aligned_Test");
     UtTest_Add(MD_Verify16Aligned_Test, MD_Test_Setup, MD_Test_TearDown, "MD_Verify16Aligned_Test");
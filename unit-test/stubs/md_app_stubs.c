@@ -110,13 +110,40 @@ CFE_Status_t MD_InitTableServices(void)
  * Generated stub function for MD_ManageDwellTable()
  * ----------------------------------------------------
  */
-CFE_Status_t MD_ManageDwellTable(uint8 TblIndex)
+CFE_Status_t MD_ManageDwellTable(uint16 TblIndex)
 {
     UT_GenStub_SetupReturnBuffer(MD_ManageDwellTable, CFE_Status_t);
 
-    UT_GenStub_AddParam(MD_ManageDwellTable, uint8, TblIndex);
+    UT_GenStub_AddParam(MD_ManageDwellTable, uint16, TblIndex);
 
     UT_GenStub_Execute(MD_ManageDwellTable, Basic, NULL);
 
     return UT_GenStub_GetReturnValue(MD_ManageDwellTable, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_RetryTableUpdates()
+ * ----------------------------------------------------
+ */
+void MD_RetryTableUpdates(void)
+{
+
+    UT_GenStub_Execute(MD_RetryTableUpdates, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_UpdateDwellTable()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MD_UpdateDwellTable(uint16 TblIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_UpdateDwellTable, CFE_Status_t);
+
+    UT_GenStub_AddParam(MD_UpdateDwellTable, uint16, TblIndex);
+
+    UT_GenStub_Execute(MD_UpdateDwellTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_UpdateDwellTable, CFE_Status_t);
+}
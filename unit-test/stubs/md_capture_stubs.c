@@ -0,0 +1,136 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in md_capture header
+ */
+
+#include "md_capture.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ArmCapture()
+ * ----------------------------------------------------
+ */
+void MD_ArmCapture(const MD_CmdArmCapture_Payload_t *ArmPtr)
+{
+    UT_GenStub_AddParam(MD_ArmCapture, const MD_CmdArmCapture_Payload_t *, ArmPtr);
+
+    UT_GenStub_Execute(MD_ArmCapture, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_CancelCapture()
+ * ----------------------------------------------------
+ */
+void MD_CancelCapture(uint16 TableIndex)
+{
+    UT_GenStub_AddParam(MD_CancelCapture, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_CancelCapture, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_CaptureDwellCycle()
+ * ----------------------------------------------------
+ */
+void MD_CaptureDwellCycle(uint16 TableIndex, const uint8 *DataPtr)
+{
+    UT_GenStub_AddParam(MD_CaptureDwellCycle, uint16, TableIndex);
+    UT_GenStub_AddParam(MD_CaptureDwellCycle, const uint8 *, DataPtr);
+
+    UT_GenStub_Execute(MD_CaptureDwellCycle, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_CaptureTriggered()
+ * ----------------------------------------------------
+ */
+bool MD_CaptureTriggered(uint32 Value)
+{
+    UT_GenStub_SetupReturnBuffer(MD_CaptureTriggered, bool);
+
+    UT_GenStub_AddParam(MD_CaptureTriggered, uint32, Value);
+
+    UT_GenStub_Execute(MD_CaptureTriggered, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_CaptureTriggered, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ValidCaptureEntry()
+ * ----------------------------------------------------
+ */
+bool MD_ValidCaptureEntry(uint16 TableIndex, uint16 EntryId)
+{
+    UT_GenStub_SetupReturnBuffer(MD_ValidCaptureEntry, bool);
+
+    UT_GenStub_AddParam(MD_ValidCaptureEntry, uint16, TableIndex);
+    UT_GenStub_AddParam(MD_ValidCaptureEntry, uint16, EntryId);
+
+    UT_GenStub_Execute(MD_ValidCaptureEntry, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_ValidCaptureEntry, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ValidCaptureSize()
+ * ----------------------------------------------------
+ */
+bool MD_ValidCaptureSize(uint16 PreTrigger, uint16 PostTrigger, uint16 DataSize)
+{
+    UT_GenStub_SetupReturnBuffer(MD_ValidCaptureSize, bool);
+
+    UT_GenStub_AddParam(MD_ValidCaptureSize, uint16, PreTrigger);
+    UT_GenStub_AddParam(MD_ValidCaptureSize, uint16, PostTrigger);
+    UT_GenStub_AddParam(MD_ValidCaptureSize, uint16, DataSize);
+
+    UT_GenStub_Execute(MD_ValidCaptureSize, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_ValidCaptureSize, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_WriteCaptureFile()
+ * ----------------------------------------------------
+ */
+void MD_WriteCaptureFile(void)
+{
+
+    UT_GenStub_Execute(MD_WriteCaptureFile, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_WriteCompletedCapture()
+ * ----------------------------------------------------
+ */
+void MD_WriteCompletedCapture(void)
+{
+
+    UT_GenStub_Execute(MD_WriteCompletedCapture, Basic, NULL);
+}
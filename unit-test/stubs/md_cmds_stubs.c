@@ -25,6 +25,22 @@
 #include "md_cmds.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ArmCaptureCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MD_ArmCaptureCmd(const MD_ArmCaptureCmd_t *Msg)
+{
+    UT_GenStub_SetupReturnBuffer(MD_ArmCaptureCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(MD_ArmCaptureCmd, const MD_ArmCaptureCmd_t *, Msg);
+
+    UT_GenStub_Execute(MD_ArmCaptureCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_ArmCaptureCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MD_JamDwellCmd()
@@ -41,6 +57,22 @@ CFE_Status_t MD_JamDwellCmd(const MD_JamDwellCmd_t *Msg)
     return UT_GenStub_GetReturnValue(MD_JamDwellCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_JamMultiDwellCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MD_JamMultiDwellCmd(const MD_JamMultiDwellCmd_t *Msg)
+{
+    UT_GenStub_SetupReturnBuffer(MD_JamMultiDwellCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(MD_JamMultiDwellCmd, const MD_JamMultiDwellCmd_t *, Msg);
+
+    UT_GenStub_Execute(MD_JamMultiDwellCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_JamMultiDwellCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MD_NoopCmd()
@@ -73,6 +105,38 @@ CFE_Status_t MD_ResetCountersCmd(const MD_ResetCountersCmd_t *Msg)
     return UT_GenStub_GetReturnValue(MD_ResetCountersCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SendPerfHistCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MD_SendPerfHistCmd(const MD_SendPerfHistCmd_t *Msg)
+{
+    UT_GenStub_SetupReturnBuffer(MD_SendPerfHistCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(MD_SendPerfHistCmd, const MD_SendPerfHistCmd_t *, Msg);
+
+    UT_GenStub_Execute(MD_SendPerfHistCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_SendPerfHistCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SetBatchFactorCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MD_SetBatchFactorCmd(const MD_SetBatchFactorCmd_t *Msg)
+{
+    UT_GenStub_SetupReturnBuffer(MD_SetBatchFactorCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(MD_SetBatchFactorCmd, const MD_SetBatchFactorCmd_t *, Msg);
+
+    UT_GenStub_Execute(MD_SetBatchFactorCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_SetBatchFactorCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MD_SetSignatureCmd()
@@ -120,3 +184,37 @@ CFE_Status_t MD_StopDwellCmd(const MD_StopDwellCmd_t *Msg)
 
     return UT_GenStub_GetReturnValue(MD_StopDwellCmd, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_TblManageCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MD_TblManageCmd(const MD_TblManageCmd_t *Msg)
+{
+    UT_GenStub_SetupReturnBuffer(MD_TblManageCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(MD_TblManageCmd, const MD_TblManageCmd_t *, Msg);
+
+    UT_GenStub_Execute(MD_TblManageCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_TblManageCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ValidJamAddress()
+ * ----------------------------------------------------
+ */
+bool MD_ValidJamAddress(const MD_SymAddr_t *DwellAddress, uint16 FieldLength, cpuaddr *ResolvedAddrPtr)
+{
+    UT_GenStub_SetupReturnBuffer(MD_ValidJamAddress, bool);
+
+    UT_GenStub_AddParam(MD_ValidJamAddress, const MD_SymAddr_t *, DwellAddress);
+    UT_GenStub_AddParam(MD_ValidJamAddress, uint16, FieldLength);
+    UT_GenStub_AddParam(MD_ValidJamAddress, cpuaddr *, ResolvedAddrPtr);
+
+    UT_GenStub_Execute(MD_ValidJamAddress, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_ValidJamAddress, bool);
+}
@@ -37,6 +37,24 @@ void MD_ExecRequest(const CFE_SB_Buffer_t *BufPtr)
     UT_GenStub_Execute(MD_ExecRequest, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ExpectedCmdLength()
+ * ----------------------------------------------------
+ */
+size_t MD_ExpectedCmdLength(const CFE_SB_Buffer_t *BufPtr, size_t ActualLength, int16 CmdIndx)
+{
+    UT_GenStub_SetupReturnBuffer(MD_ExpectedCmdLength, size_t);
+
+    UT_GenStub_AddParam(MD_ExpectedCmdLength, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(MD_ExpectedCmdLength, size_t, ActualLength);
+    UT_GenStub_AddParam(MD_ExpectedCmdLength, int16, CmdIndx);
+
+    UT_GenStub_Execute(MD_ExpectedCmdLength, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_ExpectedCmdLength, size_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MD_ProcessCommandPacket()
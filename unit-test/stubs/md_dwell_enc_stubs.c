@@ -0,0 +1,85 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in md_dwell_enc header
+ */
+
+#include "md_dwell_enc.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DecodeDwellData()
+ * ----------------------------------------------------
+ */
+int32 MD_DecodeDwellData(uint8 *DataPtr, const uint8 *RefPtr, uint16 DataSize, const uint8 *EncPtr,
+                         uint16 EncodedSize)
+{
+    UT_GenStub_SetupReturnBuffer(MD_DecodeDwellData, int32);
+
+    UT_GenStub_AddParam(MD_DecodeDwellData, uint8 *, DataPtr);
+    UT_GenStub_AddParam(MD_DecodeDwellData, const uint8 *, RefPtr);
+    UT_GenStub_AddParam(MD_DecodeDwellData, uint16, DataSize);
+    UT_GenStub_AddParam(MD_DecodeDwellData, const uint8 *, EncPtr);
+    UT_GenStub_AddParam(MD_DecodeDwellData, uint16, EncodedSize);
+
+    UT_GenStub_Execute(MD_DecodeDwellData, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_DecodeDwellData, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_EncodeDwellData()
+ * ----------------------------------------------------
+ */
+uint16 MD_EncodeDwellData(uint8 *EncPtr, const uint8 *DataPtr, const uint8 *RefPtr, uint16 DataSize)
+{
+    UT_GenStub_SetupReturnBuffer(MD_EncodeDwellData, uint16);
+
+    UT_GenStub_AddParam(MD_EncodeDwellData, uint8 *, EncPtr);
+    UT_GenStub_AddParam(MD_EncodeDwellData, const uint8 *, DataPtr);
+    UT_GenStub_AddParam(MD_EncodeDwellData, const uint8 *, RefPtr);
+    UT_GenStub_AddParam(MD_EncodeDwellData, uint16, DataSize);
+
+    UT_GenStub_Execute(MD_EncodeDwellData, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_EncodeDwellData, uint16);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_EncodeDwellLiterals()
+ * ----------------------------------------------------
+ */
+uint16 MD_EncodeDwellLiterals(uint8 *EncPtr, const uint8 *DataPtr, const uint8 *RefPtr, uint16 Count)
+{
+    UT_GenStub_SetupReturnBuffer(MD_EncodeDwellLiterals, uint16);
+
+    UT_GenStub_AddParam(MD_EncodeDwellLiterals, uint8 *, EncPtr);
+    UT_GenStub_AddParam(MD_EncodeDwellLiterals, const uint8 *, DataPtr);
+    UT_GenStub_AddParam(MD_EncodeDwellLiterals, const uint8 *, RefPtr);
+    UT_GenStub_AddParam(MD_EncodeDwellLiterals, uint16, Count);
+
+    UT_GenStub_Execute(MD_EncodeDwellLiterals, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_EncodeDwellLiterals, uint16);
+}
@@ -0,0 +1,132 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in md_dwell_err header
+ */
+
+#include "md_dwell_err.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DwellReadFailed()
+ * ----------------------------------------------------
+ */
+void MD_DwellReadFailed(uint16 TblIndex, uint16 EntryIndex)
+{
+    UT_GenStub_AddParam(MD_DwellReadFailed, uint16, TblIndex);
+    UT_GenStub_AddParam(MD_DwellReadFailed, uint16, EntryIndex);
+
+    UT_GenStub_Execute(MD_DwellReadFailed, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DwellReadsSucceeded()
+ * ----------------------------------------------------
+ */
+void MD_DwellReadsSucceeded(uint16 TblIndex, uint16 FirstEntryIndex, uint16 LastEntryIndex)
+{
+    UT_GenStub_AddParam(MD_DwellReadsSucceeded, uint16, TblIndex);
+    UT_GenStub_AddParam(MD_DwellReadsSucceeded, uint16, FirstEntryIndex);
+    UT_GenStub_AddParam(MD_DwellReadsSucceeded, uint16, LastEntryIndex);
+
+    UT_GenStub_Execute(MD_DwellReadsSucceeded, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DwellEntryUnread()
+ * ----------------------------------------------------
+ */
+bool MD_DwellEntryUnread(uint16 TblIndex, uint16 EntryIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_DwellEntryUnread, bool);
+
+    UT_GenStub_AddParam(MD_DwellEntryUnread, uint16, TblIndex);
+    UT_GenStub_AddParam(MD_DwellEntryUnread, uint16, EntryIndex);
+
+    UT_GenStub_Execute(MD_DwellEntryUnread, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_DwellEntryUnread, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_QuarantineDwellEntry()
+ * ----------------------------------------------------
+ */
+void MD_QuarantineDwellEntry(uint16 TblIndex, uint16 EntryIndex)
+{
+    UT_GenStub_AddParam(MD_QuarantineDwellEntry, uint16, TblIndex);
+    UT_GenStub_AddParam(MD_QuarantineDwellEntry, uint16, EntryIndex);
+
+    UT_GenStub_Execute(MD_QuarantineDwellEntry, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SplitDwellPlan()
+ * ----------------------------------------------------
+ */
+void MD_SplitDwellPlan(uint16 TblIndex, uint16 EntryIndex)
+{
+    UT_GenStub_AddParam(MD_SplitDwellPlan, uint16, TblIndex);
+    UT_GenStub_AddParam(MD_SplitDwellPlan, uint16, EntryIndex);
+
+    UT_GenStub_Execute(MD_SplitDwellPlan, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_RejoinDwellPlan()
+ * ----------------------------------------------------
+ */
+void MD_RejoinDwellPlan(uint16 TblIndex)
+{
+    UT_GenStub_AddParam(MD_RejoinDwellPlan, uint16, TblIndex);
+
+    UT_GenStub_Execute(MD_RejoinDwellPlan, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ReportDwellReadErrors()
+ * ----------------------------------------------------
+ */
+void MD_ReportDwellReadErrors(uint32 Wakeups)
+{
+    UT_GenStub_AddParam(MD_ReportDwellReadErrors, uint32, Wakeups);
+
+    UT_GenStub_Execute(MD_ReportDwellReadErrors, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ResetDwellReadErrors()
+ * ----------------------------------------------------
+ */
+void MD_ResetDwellReadErrors(uint16 TblIndex)
+{
+    UT_GenStub_AddParam(MD_ResetDwellReadErrors, uint16, TblIndex);
+
+    UT_GenStub_Execute(MD_ResetDwellReadErrors, Basic, NULL);
+}
@@ -41,6 +41,35 @@ CFE_Status_t MD_DwellLoop(const MD_Wakeup_t *Msg)
     return UT_GenStub_GetReturnValue(MD_DwellLoop, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_CountWakeups()
+ * ----------------------------------------------------
+ */
+uint32 MD_CountWakeups(CFE_MSG_SequenceCount_t SeqCount)
+{
+    UT_GenStub_SetupReturnBuffer(MD_CountWakeups, uint32);
+
+    UT_GenStub_AddParam(MD_CountWakeups, CFE_MSG_SequenceCount_t, SeqCount);
+
+    UT_GenStub_Execute(MD_CountWakeups, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_CountWakeups, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_CountRephase()
+ * ----------------------------------------------------
+ */
+void MD_CountRephase(CFE_MSG_SequenceCount_t LastSeqCount, CFE_MSG_SequenceCount_t SeqCount)
+{
+    UT_GenStub_AddParam(MD_CountRephase, CFE_MSG_SequenceCount_t, LastSeqCount);
+    UT_GenStub_AddParam(MD_CountRephase, CFE_MSG_SequenceCount_t, SeqCount);
+
+    UT_GenStub_Execute(MD_CountRephase, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MD_GetDwellData()
@@ -81,3 +110,410 @@ void MD_StartDwellStream(uint16 TableIndex)
 
     UT_GenStub_Execute(MD_StartDwellStream, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ProcessDwellTable()
+ * ----------------------------------------------------
+ */
+int32 MD_ProcessDwellTable(uint16 TblIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_ProcessDwellTable, int32);
+
+    UT_GenStub_AddParam(MD_ProcessDwellTable, uint16, TblIndex);
+
+    UT_GenStub_Execute(MD_ProcessDwellTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_ProcessDwellTable, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ScheduleDwellTable()
+ * ----------------------------------------------------
+ */
+void MD_ScheduleDwellTable(uint16 TableIndex, uint32 Delay)
+{
+    UT_GenStub_AddParam(MD_ScheduleDwellTable, uint16, TableIndex);
+    UT_GenStub_AddParam(MD_ScheduleDwellTable, uint32, Delay);
+
+    UT_GenStub_Execute(MD_ScheduleDwellTable, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_UnscheduleDwellTable()
+ * ----------------------------------------------------
+ */
+void MD_UnscheduleDwellTable(uint16 TableIndex)
+{
+    UT_GenStub_AddParam(MD_UnscheduleDwellTable, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_UnscheduleDwellTable, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_RefreshDwellSchedule()
+ * ----------------------------------------------------
+ */
+void MD_RefreshDwellSchedule(uint16 TableIndex)
+{
+    UT_GenStub_AddParam(MD_RefreshDwellSchedule, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_RefreshDwellSchedule, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_PopDueDwellTable()
+ * ----------------------------------------------------
+ */
+bool MD_PopDueDwellTable(uint16 *TableIndexPtr)
+{
+    UT_GenStub_SetupReturnBuffer(MD_PopDueDwellTable, bool);
+
+    UT_GenStub_AddParam(MD_PopDueDwellTable, uint16 *, TableIndexPtr);
+
+    UT_GenStub_Execute(MD_PopDueDwellTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_PopDueDwellTable, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DwellDueBefore()
+ * ----------------------------------------------------
+ */
+bool MD_DwellDueBefore(uint16 TableIndexA, uint16 TableIndexB)
+{
+    UT_GenStub_SetupReturnBuffer(MD_DwellDueBefore, bool);
+
+    UT_GenStub_AddParam(MD_DwellDueBefore, uint16, TableIndexA);
+    UT_GenStub_AddParam(MD_DwellDueBefore, uint16, TableIndexB);
+
+    UT_GenStub_Execute(MD_DwellDueBefore, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_DwellDueBefore, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SiftDwellHeap()
+ * ----------------------------------------------------
+ */
+void MD_SiftDwellHeap(uint16 HeapPos)
+{
+    UT_GenStub_AddParam(MD_SiftDwellHeap, uint16, HeapPos);
+
+    UT_GenStub_Execute(MD_SiftDwellHeap, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_GetDwellBlockData()
+ * ----------------------------------------------------
+ */
+int32 MD_GetDwellBlockData(uint16 TblIndex, uint16 EntryIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_GetDwellBlockData, int32);
+
+    UT_GenStub_AddParam(MD_GetDwellBlockData, uint16, TblIndex);
+    UT_GenStub_AddParam(MD_GetDwellBlockData, uint16, EntryIndex);
+
+    UT_GenStub_Execute(MD_GetDwellBlockData, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_GetDwellBlockData, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SkipDwellData()
+ * ----------------------------------------------------
+ */
+void MD_SkipDwellData(uint16 TblIndex, uint16 EntryIndex)
+{
+    UT_GenStub_AddParam(MD_SkipDwellData, uint16, TblIndex);
+    UT_GenStub_AddParam(MD_SkipDwellData, uint16, EntryIndex);
+
+    UT_GenStub_Execute(MD_SkipDwellData, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_CompileDwellPlan()
+ * ----------------------------------------------------
+ */
+void MD_CompileDwellPlan(MD_DwellControlEntry_t *EntryPtr, const uint16 *GroupPtr, uint16 AddrCount)
+{
+    UT_GenStub_AddParam(MD_CompileDwellPlan, MD_DwellControlEntry_t *, EntryPtr);
+    UT_GenStub_AddParam(MD_CompileDwellPlan, const uint16 *, GroupPtr);
+    UT_GenStub_AddParam(MD_CompileDwellPlan, uint16, AddrCount);
+
+    UT_GenStub_Execute(MD_CompileDwellPlan, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_GetDwellPktBuf()
+ * ----------------------------------------------------
+ */
+MD_DwellPkt_t *MD_GetDwellPktBuf(uint16 TableIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_GetDwellPktBuf, MD_DwellPkt_t *);
+
+    UT_GenStub_AddParam(MD_GetDwellPktBuf, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_GetDwellPktBuf, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_GetDwellPktBuf, MD_DwellPkt_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ReleaseDwellPktBuf()
+ * ----------------------------------------------------
+ */
+void MD_ReleaseDwellPktBuf(uint16 TableIndex)
+{
+    UT_GenStub_AddParam(MD_ReleaseDwellPktBuf, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_ReleaseDwellPktBuf, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_UpdateDwellPktTemplate()
+ * ----------------------------------------------------
+ */
+void MD_UpdateDwellPktTemplate(uint16 TableIndex)
+{
+    UT_GenStub_AddParam(MD_UpdateDwellPktTemplate, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_UpdateDwellPktTemplate, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_BatchDwellPkt()
+ * ----------------------------------------------------
+ */
+void MD_BatchDwellPkt(uint16 TableIndex)
+{
+    UT_GenStub_AddParam(MD_BatchDwellPkt, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_BatchDwellPkt, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SendDwellBatchPkt()
+ * ----------------------------------------------------
+ */
+void MD_SendDwellBatchPkt(uint16 TableIndex)
+{
+    UT_GenStub_AddParam(MD_SendDwellBatchPkt, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_SendDwellBatchPkt, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DwellPktReportDue()
+ * ----------------------------------------------------
+ */
+bool MD_DwellPktReportDue(uint16 TableIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_DwellPktReportDue, bool);
+
+    UT_GenStub_AddParam(MD_DwellPktReportDue, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_DwellPktReportDue, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_DwellPktReportDue, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DwellDataChanged()
+ * ----------------------------------------------------
+ */
+bool MD_DwellDataChanged(uint16 TableIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_DwellDataChanged, bool);
+
+    UT_GenStub_AddParam(MD_DwellDataChanged, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_DwellDataChanged, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_DwellDataChanged, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SaveReportedDwellData()
+ * ----------------------------------------------------
+ */
+void MD_SaveReportedDwellData(uint16 TableIndex)
+{
+    UT_GenStub_AddParam(MD_SaveReportedDwellData, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_SaveReportedDwellData, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SendDwellEncPkt()
+ * ----------------------------------------------------
+ */
+void MD_SendDwellEncPkt(uint16 TableIndex)
+{
+    UT_GenStub_AddParam(MD_SendDwellEncPkt, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_SendDwellEncPkt, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DwellEntryValue()
+ * ----------------------------------------------------
+ */
+uint32 MD_DwellEntryValue(const uint8 *DataPtr, uint16 Length)
+{
+    UT_GenStub_SetupReturnBuffer(MD_DwellEntryValue, uint32);
+
+    UT_GenStub_AddParam(MD_DwellEntryValue, const uint8 *, DataPtr);
+    UT_GenStub_AddParam(MD_DwellEntryValue, uint16, Length);
+
+    UT_GenStub_Execute(MD_DwellEntryValue, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_DwellEntryValue, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DwellEntryStatsValue()
+ * ----------------------------------------------------
+ */
+int64 MD_DwellEntryStatsValue(const uint8 *DataPtr, uint16 Length, uint16 Signed)
+{
+    UT_GenStub_SetupReturnBuffer(MD_DwellEntryStatsValue, int64);
+
+    UT_GenStub_AddParam(MD_DwellEntryStatsValue, const uint8 *, DataPtr);
+    UT_GenStub_AddParam(MD_DwellEntryStatsValue, uint16, Length);
+    UT_GenStub_AddParam(MD_DwellEntryStatsValue, uint16, Signed);
+
+    UT_GenStub_Execute(MD_DwellEntryStatsValue, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_DwellEntryStatsValue, int64);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_AccumulateDwellStats()
+ * ----------------------------------------------------
+ */
+void MD_AccumulateDwellStats(uint16 TableIndex)
+{
+    UT_GenStub_AddParam(MD_AccumulateDwellStats, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_AccumulateDwellStats, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SendDwellStatsPkt()
+ * ----------------------------------------------------
+ */
+void MD_SendDwellStatsPkt(uint16 TableIndex)
+{
+    UT_GenStub_AddParam(MD_SendDwellStatsPkt, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_SendDwellStatsPkt, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SampleDwellTable()
+ * ----------------------------------------------------
+ */
+int32 MD_SampleDwellTable(uint16 TblIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_SampleDwellTable, int32);
+
+    UT_GenStub_AddParam(MD_SampleDwellTable, uint16, TblIndex);
+
+    UT_GenStub_Execute(MD_SampleDwellTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_SampleDwellTable, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ProcessDwellDeadlines()
+ * ----------------------------------------------------
+ */
+int32 MD_ProcessDwellDeadlines(void)
+{
+    UT_GenStub_SetupReturnBuffer(MD_ProcessDwellDeadlines, int32);
+
+    UT_GenStub_Execute(MD_ProcessDwellDeadlines, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_ProcessDwellDeadlines, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_TimeStampDwellPkt()
+ * ----------------------------------------------------
+ */
+void MD_TimeStampDwellPkt(uint16 TableIndex, CFE_MSG_Message_t *MsgPtr)
+{
+    UT_GenStub_AddParam(MD_TimeStampDwellPkt, uint16, TableIndex);
+    UT_GenStub_AddParam(MD_TimeStampDwellPkt, CFE_MSG_Message_t *, MsgPtr);
+
+    UT_GenStub_Execute(MD_TimeStampDwellPkt, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DwellTableIsTimed()
+ * ----------------------------------------------------
+ */
+bool MD_DwellTableIsTimed(uint16 TableIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_DwellTableIsTimed, bool);
+
+    UT_GenStub_AddParam(MD_DwellTableIsTimed, uint16, TableIndex);
+
+    UT_GenStub_Execute(MD_DwellTableIsTimed, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_DwellTableIsTimed, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_GetDeadlineTime()
+ * ----------------------------------------------------
+ */
+uint64 MD_GetDeadlineTime(void)
+{
+    UT_GenStub_SetupReturnBuffer(MD_GetDeadlineTime, uint64);
+
+    UT_GenStub_Execute(MD_GetDeadlineTime, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_GetDeadlineTime, uint64);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ScheduleDwellDeadline()
+ * ----------------------------------------------------
+ */
+void MD_ScheduleDwellDeadline(uint16 TableIndex, uint64 Now)
+{
+    UT_GenStub_AddParam(MD_ScheduleDwellDeadline, uint16, TableIndex);
+    UT_GenStub_AddParam(MD_ScheduleDwellDeadline, uint64, Now);
+
+    UT_GenStub_Execute(MD_ScheduleDwellDeadline, Basic, NULL);
+}
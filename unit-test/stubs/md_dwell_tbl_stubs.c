@@ -30,12 +30,13 @@
  * Generated stub function for MD_CheckTableEntries()
  * ----------------------------------------------------
  */
-int32 MD_CheckTableEntries(MD_DwellTableLoad_t *TblPtr, uint16 *ErrorEntryArg)
+int32 MD_CheckTableEntries(MD_DwellTableLoad_t *TblPtr, uint16 *ErrorEntryArg, MD_CompiledDwellTable_t *CompiledPtr)
 {
     UT_GenStub_SetupReturnBuffer(MD_CheckTableEntries, int32);
 
     UT_GenStub_AddParam(MD_CheckTableEntries, MD_DwellTableLoad_t *, TblPtr);
     UT_GenStub_AddParam(MD_CheckTableEntries, uint16 *, ErrorEntryArg);
+    UT_GenStub_AddParam(MD_CheckTableEntries, MD_CompiledDwellTable_t *, CompiledPtr);
 
     UT_GenStub_Execute(MD_CheckTableEntries, Basic, NULL);
 
@@ -47,48 +48,63 @@ int32 MD_CheckTableEntries(MD_DwellTableLoad_t *TblPtr, uint16 *ErrorEntryArg)
  * Generated stub function for MD_CopyUpdatedTbl()
  * ----------------------------------------------------
  */
-void MD_CopyUpdatedTbl(MD_DwellTableLoad_t *MD_LoadTablePtr, uint8 TblIndex)
+void MD_CopyUpdatedTbl(MD_DwellTableLoad_t *MD_LoadTablePtr, uint16 TblIndex)
 {
     UT_GenStub_AddParam(MD_CopyUpdatedTbl, MD_DwellTableLoad_t *, MD_LoadTablePtr);
-    UT_GenStub_AddParam(MD_CopyUpdatedTbl, uint8, TblIndex);
+    UT_GenStub_AddParam(MD_CopyUpdatedTbl, uint16, TblIndex);
 
     UT_GenStub_Execute(MD_CopyUpdatedTbl, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for MD_ReadDwellTable()
+ * Generated stub function for MD_TableValidationFunc()
  * ----------------------------------------------------
  */
-CFE_Status_t MD_ReadDwellTable(const MD_DwellTableLoad_t *TblPtr, uint16 *ActiveAddrCountPtr, uint16 *SizePtr,
-                               uint32 *RatePtr)
+int32 MD_TableValidationFunc(void *TblPtr)
 {
-    UT_GenStub_SetupReturnBuffer(MD_ReadDwellTable, CFE_Status_t);
+    UT_GenStub_SetupReturnBuffer(MD_TableValidationFunc, int32);
 
-    UT_GenStub_AddParam(MD_ReadDwellTable, const MD_DwellTableLoad_t *, TblPtr);
-    UT_GenStub_AddParam(MD_ReadDwellTable, uint16 *, ActiveAddrCountPtr);
-    UT_GenStub_AddParam(MD_ReadDwellTable, uint16 *, SizePtr);
-    UT_GenStub_AddParam(MD_ReadDwellTable, uint32 *, RatePtr);
+    UT_GenStub_AddParam(MD_TableValidationFunc, void *, TblPtr);
 
-    UT_GenStub_Execute(MD_ReadDwellTable, Basic, NULL);
+    UT_GenStub_Execute(MD_TableValidationFunc, Basic, NULL);
 
-    return UT_GenStub_GetReturnValue(MD_ReadDwellTable, CFE_Status_t);
+    return UT_GenStub_GetReturnValue(MD_TableValidationFunc, int32);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for MD_TableValidationFunc()
+ * Generated stub function for MD_UpdateTableBatchFactor()
  * ----------------------------------------------------
  */
-int32 MD_TableValidationFunc(void *TblPtr)
+CFE_Status_t MD_UpdateTableBatchFactor(uint16 TableIndex, uint16 NewBatchFactor)
 {
-    UT_GenStub_SetupReturnBuffer(MD_TableValidationFunc, int32);
+    UT_GenStub_SetupReturnBuffer(MD_UpdateTableBatchFactor, CFE_Status_t);
 
-    UT_GenStub_AddParam(MD_TableValidationFunc, void *, TblPtr);
+    UT_GenStub_AddParam(MD_UpdateTableBatchFactor, uint16, TableIndex);
+    UT_GenStub_AddParam(MD_UpdateTableBatchFactor, uint16, NewBatchFactor);
 
-    UT_GenStub_Execute(MD_TableValidationFunc, Basic, NULL);
+    UT_GenStub_Execute(MD_UpdateTableBatchFactor, Basic, NULL);
 
-    return UT_GenStub_GetReturnValue(MD_TableValidationFunc, int32);
+    return UT_GenStub_GetReturnValue(MD_UpdateTableBatchFactor, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_UpdateTableDwellEntries()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MD_UpdateTableDwellEntries(uint16 TableIndex, const MD_JamMultiEntry_t *JamEntry, uint16 NumEntries)
+{
+    UT_GenStub_SetupReturnBuffer(MD_UpdateTableDwellEntries, CFE_Status_t);
+
+    UT_GenStub_AddParam(MD_UpdateTableDwellEntries, uint16, TableIndex);
+    UT_GenStub_AddParam(MD_UpdateTableDwellEntries, const MD_JamMultiEntry_t *, JamEntry);
+    UT_GenStub_AddParam(MD_UpdateTableDwellEntries, uint16, NumEntries);
+
+    UT_GenStub_Execute(MD_UpdateTableDwellEntries, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_UpdateTableDwellEntries, CFE_Status_t);
 }
 
 /*
@@ -97,7 +113,7 @@ int32 MD_TableValidationFunc(void *TblPtr)
  * ----------------------------------------------------
  */
 CFE_Status_t MD_UpdateTableDwellEntry(uint16 TableIndex, uint16 EntryIndex, uint16 NewLength, uint16 NewDelay,
-                                      MD_SymAddr_t NewDwellAddress)
+                                      MD_SymAddr_t NewDwellAddress, uint32 NewDeadband)
 {
     UT_GenStub_SetupReturnBuffer(MD_UpdateTableDwellEntry, CFE_Status_t);
 
@@ -106,6 +122,7 @@ CFE_Status_t MD_UpdateTableDwellEntry(uint16 TableIndex, uint16 EntryIndex, uint
     UT_GenStub_AddParam(MD_UpdateTableDwellEntry, uint16, NewLength);
     UT_GenStub_AddParam(MD_UpdateTableDwellEntry, uint16, NewDelay);
     UT_GenStub_AddParam(MD_UpdateTableDwellEntry, MD_SymAddr_t, NewDwellAddress);
+    UT_GenStub_AddParam(MD_UpdateTableDwellEntry, uint32, NewDeadband);
 
     UT_GenStub_Execute(MD_UpdateTableDwellEntry, Basic, NULL);
 
@@ -150,11 +167,12 @@ CFE_Status_t MD_UpdateTableSignature(uint16 TableIndex, const char NewSignature[
  * Generated stub function for MD_ValidTableEntry()
  * ----------------------------------------------------
  */
-int32 MD_ValidTableEntry(MD_TableLoadEntry_t *TblEntryPtr)
+int32 MD_ValidTableEntry(MD_TableLoadEntry_t *TblEntryPtr, cpuaddr *ResolvedAddrPtr)
 {
     UT_GenStub_SetupReturnBuffer(MD_ValidTableEntry, int32);
 
     UT_GenStub_AddParam(MD_ValidTableEntry, MD_TableLoadEntry_t *, TblEntryPtr);
+    UT_GenStub_AddParam(MD_ValidTableEntry, cpuaddr *, ResolvedAddrPtr);
 
     UT_GenStub_Execute(MD_ValidTableEntry, Basic, NULL);
 
@@ -0,0 +1,83 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in md_perf header
+ */
+
+#include "md_perf.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_PerfBegin()
+ * ----------------------------------------------------
+ */
+void MD_PerfBegin(uint8 Phase, OS_time_t *StartTimePtr)
+{
+    UT_GenStub_AddParam(MD_PerfBegin, uint8, Phase);
+    UT_GenStub_AddParam(MD_PerfBegin, OS_time_t *, StartTimePtr);
+
+    UT_GenStub_Execute(MD_PerfBegin, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_PerfEnd()
+ * ----------------------------------------------------
+ */
+uint32 MD_PerfEnd(uint8 Phase, const OS_time_t *StartTimePtr)
+{
+    UT_GenStub_SetupReturnBuffer(MD_PerfEnd, uint32);
+
+    UT_GenStub_AddParam(MD_PerfEnd, uint8, Phase);
+    UT_GenStub_AddParam(MD_PerfEnd, const OS_time_t *, StartTimePtr);
+
+    UT_GenStub_Execute(MD_PerfEnd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_PerfEnd, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_PerfHistBin()
+ * ----------------------------------------------------
+ */
+uint16 MD_PerfHistBin(uint32 ElapsedTime)
+{
+    UT_GenStub_SetupReturnBuffer(MD_PerfHistBin, uint16);
+
+    UT_GenStub_AddParam(MD_PerfHistBin, uint32, ElapsedTime);
+
+    UT_GenStub_Execute(MD_PerfHistBin, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_PerfHistBin, uint16);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ResetPerfHist()
+ * ----------------------------------------------------
+ */
+void MD_ResetPerfHist(void)
+{
+
+    UT_GenStub_Execute(MD_ResetPerfHist, Basic, NULL);
+}
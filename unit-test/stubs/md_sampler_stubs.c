@@ -0,0 +1,120 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in md_sampler header
+ */
+
+#include "md_sampler.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_InitSampler()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MD_InitSampler(void)
+{
+    UT_GenStub_SetupReturnBuffer(MD_InitSampler, CFE_Status_t);
+
+    UT_GenStub_Execute(MD_InitSampler, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_InitSampler, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_IsMainTaskMsg()
+ * ----------------------------------------------------
+ */
+bool MD_IsMainTaskMsg(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(MD_IsMainTaskMsg, bool);
+
+    UT_GenStub_AddParam(MD_IsMainTaskMsg, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(MD_IsMainTaskMsg, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_IsMainTaskMsg, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ProcessSamplerQueue()
+ * ----------------------------------------------------
+ */
+void MD_ProcessSamplerQueue(void)
+{
+
+    UT_GenStub_Execute(MD_ProcessSamplerQueue, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_QueueSamplerMsg()
+ * ----------------------------------------------------
+ */
+void MD_QueueSamplerMsg(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_AddParam(MD_QueueSamplerMsg, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(MD_QueueSamplerMsg, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_QueueTableUpdate()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MD_QueueTableUpdate(uint16 TblIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_QueueTableUpdate, CFE_Status_t);
+
+    UT_GenStub_AddParam(MD_QueueTableUpdate, uint16, TblIndex);
+
+    UT_GenStub_Execute(MD_QueueTableUpdate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_QueueTableUpdate, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SamplerQueueFull()
+ * ----------------------------------------------------
+ */
+bool MD_SamplerQueueFull(void)
+{
+    UT_GenStub_SetupReturnBuffer(MD_SamplerQueueFull, bool);
+
+    UT_GenStub_Execute(MD_SamplerQueueFull, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_SamplerQueueFull, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SamplerTask()
+ * ----------------------------------------------------
+ */
+void MD_SamplerTask(void)
+{
+
+    UT_GenStub_Execute(MD_SamplerTask, Basic, NULL);
+}
@@ -0,0 +1,83 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in md_snapshot header
+ */
+
+#include "md_snapshot.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_BuildSnapshotGroups()
+ * ----------------------------------------------------
+ */
+void MD_BuildSnapshotGroups(void)
+{
+
+    UT_GenStub_Execute(MD_BuildSnapshotGroups, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_FindSnapshotMember()
+ * ----------------------------------------------------
+ */
+MD_SnapshotMember_t *MD_FindSnapshotMember(uint16 TblIndex, uint16 EntryIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_FindSnapshotMember, MD_SnapshotMember_t *);
+
+    UT_GenStub_AddParam(MD_FindSnapshotMember, uint16, TblIndex);
+    UT_GenStub_AddParam(MD_FindSnapshotMember, uint16, EntryIndex);
+
+    UT_GenStub_Execute(MD_FindSnapshotMember, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_FindSnapshotMember, MD_SnapshotMember_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_GetSnapshotData()
+ * ----------------------------------------------------
+ */
+int32 MD_GetSnapshotData(uint16 TblIndex, uint16 EntryIndex)
+{
+    UT_GenStub_SetupReturnBuffer(MD_GetSnapshotData, int32);
+
+    UT_GenStub_AddParam(MD_GetSnapshotData, uint16, TblIndex);
+    UT_GenStub_AddParam(MD_GetSnapshotData, uint16, EntryIndex);
+
+    UT_GenStub_Execute(MD_GetSnapshotData, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_GetSnapshotData, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_TakeSnapshot()
+ * ----------------------------------------------------
+ */
+void MD_TakeSnapshot(uint16 Group)
+{
+    UT_GenStub_AddParam(MD_TakeSnapshot, uint16, Group);
+
+    UT_GenStub_Execute(MD_TakeSnapshot, Basic, NULL);
+}
@@ -0,0 +1,108 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in md_symcache header
+ */
+
+#include "md_symcache.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_InitSymCache()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MD_InitSymCache(void)
+{
+    UT_GenStub_SetupReturnBuffer(MD_InitSymCache, CFE_Status_t);
+
+    UT_GenStub_Execute(MD_InitSymCache, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_InitSymCache, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_InvalidateSymCache()
+ * ----------------------------------------------------
+ */
+void MD_InvalidateSymCache(void)
+{
+
+    UT_GenStub_Execute(MD_InvalidateSymCache, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_RefreshSymCache()
+ * ----------------------------------------------------
+ */
+void MD_RefreshSymCache(void)
+{
+
+    UT_GenStub_Execute(MD_RefreshSymCache, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SymCacheHash()
+ * ----------------------------------------------------
+ */
+uint32 MD_SymCacheHash(const char *SymName)
+{
+    UT_GenStub_SetupReturnBuffer(MD_SymCacheHash, uint32);
+
+    UT_GenStub_AddParam(MD_SymCacheHash, const char *, SymName);
+
+    UT_GenStub_Execute(MD_SymCacheHash, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_SymCacheHash, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SymCacheLookup()
+ * ----------------------------------------------------
+ */
+bool MD_SymCacheLookup(const char *SymName, cpuaddr *SymAddr)
+{
+    UT_GenStub_SetupReturnBuffer(MD_SymCacheLookup, bool);
+
+    UT_GenStub_AddParam(MD_SymCacheLookup, const char *, SymName);
+    UT_GenStub_AddParam(MD_SymCacheLookup, cpuaddr *, SymAddr);
+
+    UT_GenStub_Execute(MD_SymCacheLookup, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_SymCacheLookup, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SymCacheModuleCallback()
+ * ----------------------------------------------------
+ */
+void MD_SymCacheModuleCallback(osal_id_t ModuleId, void *Arg)
+{
+    UT_GenStub_AddParam(MD_SymCacheModuleCallback, osal_id_t, ModuleId);
+    UT_GenStub_AddParam(MD_SymCacheModuleCallback, void *, Arg);
+
+    UT_GenStub_Execute(MD_SymCacheModuleCallback, Basic, NULL);
+}
@@ -25,6 +25,42 @@
 #include "md_utils.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DwellDataSizeWithEntry()
+ * ----------------------------------------------------
+ */
+uint32 MD_DwellDataSizeWithEntry(uint16 TableIndex, uint16 EntryIndex, uint16 NewLength)
+{
+    UT_GenStub_SetupReturnBuffer(MD_DwellDataSizeWithEntry, uint32);
+
+    UT_GenStub_AddParam(MD_DwellDataSizeWithEntry, uint16, TableIndex);
+    UT_GenStub_AddParam(MD_DwellDataSizeWithEntry, uint16, EntryIndex);
+    UT_GenStub_AddParam(MD_DwellDataSizeWithEntry, uint16, NewLength);
+
+    UT_GenStub_Execute(MD_DwellDataSizeWithEntry, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_DwellDataSizeWithEntry, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_DwellDataSizeWithJam()
+ * ----------------------------------------------------
+ */
+uint32 MD_DwellDataSizeWithJam(uint16 TableIndex, const MD_JamMultiEntry_t *JamEntry, uint16 NumEntries)
+{
+    UT_GenStub_SetupReturnBuffer(MD_DwellDataSizeWithJam, uint32);
+
+    UT_GenStub_AddParam(MD_DwellDataSizeWithJam, uint16, TableIndex);
+    UT_GenStub_AddParam(MD_DwellDataSizeWithJam, const MD_JamMultiEntry_t *, JamEntry);
+    UT_GenStub_AddParam(MD_DwellDataSizeWithJam, uint16, NumEntries);
+
+    UT_GenStub_Execute(MD_DwellDataSizeWithJam, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_DwellDataSizeWithJam, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MD_ResolveSymAddr()
@@ -42,6 +78,21 @@ bool MD_ResolveSymAddr(const MD_SymAddr_t *SymAddr, cpuaddr *ResolvedAddr)
     return UT_GenStub_GetReturnValue(MD_ResolveSymAddr, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_SetDwellControlInfo()
+ * ----------------------------------------------------
+ */
+void MD_SetDwellControlInfo(uint16 TableIndex, uint16 AddrCount, uint16 DataSize, uint32 Rate)
+{
+    UT_GenStub_AddParam(MD_SetDwellControlInfo, uint16, TableIndex);
+    UT_GenStub_AddParam(MD_SetDwellControlInfo, uint16, AddrCount);
+    UT_GenStub_AddParam(MD_SetDwellControlInfo, uint16, DataSize);
+    UT_GenStub_AddParam(MD_SetDwellControlInfo, uint32, Rate);
+
+    UT_GenStub_Execute(MD_SetDwellControlInfo, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MD_TableIsInMask()
@@ -88,15 +139,33 @@ bool MD_ValidAddrRange(cpuaddr Addr, uint32 Size)
     return UT_GenStub_GetReturnValue(MD_ValidAddrRange, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MD_ValidBatchFactor()
+ * ----------------------------------------------------
+ */
+bool MD_ValidBatchFactor(uint16 BatchFactor, uint32 DataSize)
+{
+    UT_GenStub_SetupReturnBuffer(MD_ValidBatchFactor, bool);
+
+    UT_GenStub_AddParam(MD_ValidBatchFactor, uint16, BatchFactor);
+    UT_GenStub_AddParam(MD_ValidBatchFactor, uint32, DataSize);
+
+    UT_GenStub_Execute(MD_ValidBatchFactor, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(MD_ValidBatchFactor, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MD_ValidEntryId()
  * ----------------------------------------------------
  */
-bool MD_ValidEntryId(uint16 EntryId)
+bool MD_ValidEntryId(uint16 TableIndex, uint16 EntryId)
 {
     UT_GenStub_SetupReturnBuffer(MD_ValidEntryId, bool);
 
+    UT_GenStub_AddParam(MD_ValidEntryId, uint16, TableIndex);
     UT_GenStub_AddParam(MD_ValidEntryId, uint16, EntryId);
 
     UT_GenStub_Execute(MD_ValidEntryId, Basic, NULL);
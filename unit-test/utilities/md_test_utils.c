@@ -78,10 +78,44 @@ void UT_Handler_CFE_ES_WriteToSysLog(void *UserObj, UT_EntryKey_t FuncKey, const
  */
 void MD_Test_Setup(void)
 {
+    uint16 TblIndex;
+
     /* initialize test environment to default state for every test */
     UT_ResetState(0);
 
     memset(&MD_AppData, 0, sizeof(MD_AppData));
+
+    /* Give every table a full size share of the entry pools, as MD_InitControlStructures does by default */
+    for (TblIndex = 0; TblIndex < MD_INTERFACE_NUM_DWELL_TABLES; TblIndex++)
+    {
+        MD_AppData.MD_DwellTables[TblIndex].Capacity = MD_INTERFACE_DWELL_TABLE_SIZE;
+        MD_AppData.MD_DwellTables[TblIndex].Entry =
+            &MD_AppData.DwellEntryPool[TblIndex * MD_INTERFACE_DWELL_TABLE_SIZE];
+
+        MD_AppData.DwellReportControl[TblIndex].Deadband =
+            &MD_AppData.DwellDeadbandPool[TblIndex * MD_INTERFACE_DWELL_TABLE_SIZE];
+        MD_AppData.DwellReportControl[TblIndex].Group =
+            &MD_AppData.DwellGroupPool[TblIndex * MD_INTERFACE_DWELL_TABLE_SIZE];
+        MD_AppData.DwellReportControl[TblIndex].Signed =
+            &MD_AppData.DwellSignedPool[TblIndex * MD_INTERFACE_DWELL_TABLE_SIZE];
+        MD_AppData.DwellReportControl[TblIndex].Stats =
+            &MD_AppData.DwellStatsPool[TblIndex * MD_INTERFACE_DWELL_TABLE_SIZE];
+        MD_AppData.DwellReportControl[TblIndex].ReadErr =
+            &MD_AppData.DwellReadErrPool[TblIndex * MD_INTERFACE_DWELL_TABLE_SIZE];
+
+        MD_AppData.CompiledTables[TblIndex].Capacity = MD_INTERFACE_DWELL_TABLE_SIZE;
+        MD_AppData.CompiledTables[TblIndex].Entry =
+            &MD_AppData.CompiledEntryPool[TblIndex * MD_INTERFACE_DWELL_TABLE_SIZE];
+        MD_AppData.CompiledTables[TblIndex].Deadband =
+            &MD_AppData.CompiledDeadbandPool[TblIndex * MD_INTERFACE_DWELL_TABLE_SIZE];
+        MD_AppData.CompiledTables[TblIndex].Group =
+            &MD_AppData.CompiledGroupPool[TblIndex * MD_INTERFACE_DWELL_TABLE_SIZE];
+        MD_AppData.CompiledTables[TblIndex].Signed =
+            &MD_AppData.CompiledSignedPool[TblIndex * MD_INTERFACE_DWELL_TABLE_SIZE];
+        MD_AppData.CompiledTables[TblIndex].Image =
+            &MD_AppData.CompiledImagePool[TblIndex * MD_INTERFACE_DWELL_TABLE_SIZE];
+    }
+
     memset(context_CFE_EVS_SendEvent, 0, sizeof(context_CFE_EVS_SendEvent));
     memset(&context_CFE_ES_WriteToSysLog, 0, sizeof(context_CFE_ES_WriteToSysLog));
     memset(&UT_CmdBuf, 0, sizeof(UT_CmdBuf));
@@ -60,6 +60,11 @@ typedef union
 #if MD_INTERFACE_SIGNATURE_OPTION == 1
     MD_SetSignatureCmd_t CmdSetSignature;
 #endif
+    MD_SetBatchFactorCmd_t CmdSetBatchFactor;
+    MD_ArmCaptureCmd_t     CmdArmCapture;
+    MD_TblManageCmd_t      CmdTblManage;
+    MD_JamMultiDwellCmd_t  CmdJamMulti;
+    MD_SendPerfHistCmd_t   CmdSendPerfHist;
 } UT_CmdBuf_t;
 
 extern UT_CmdBuf_t UT_CmdBuf;